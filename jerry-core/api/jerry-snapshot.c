@@ -22,6 +22,7 @@
 #include "jcontext.h"
 #include "jerryscript.h"
 #include "jerry-snapshot.h"
+#include "ecma-line-info.h"
 #include "js-parser.h"
 #include "lit-char-helpers.h"
 #include "re-compiler.h"
@@ -35,10 +36,12 @@
  */
 static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
 snapshot_get_global_flags (bool has_regex, /**< regex literal is present */
-                           bool has_class) /**< class literal is present */
+                           bool has_class, /**< class literal is present */
+                           bool has_line_info) /**< line info is present */
 {
   JERRY_UNUSED (has_regex);
   JERRY_UNUSED (has_class);
+  JERRY_UNUSED (has_line_info);
 
   uint32_t flags = 0;
 
@@ -48,6 +51,9 @@ snapshot_get_global_flags (bool has_regex, /**< regex literal is present */
 #if ENABLED (JERRY_ESNEXT)
   flags |= (has_class ? JERRY_SNAPSHOT_HAS_CLASS_LITERAL : 0);
 #endif /* ENABLED (JERRY_ESNEXT) */
+#if ENABLED (JERRY_LINE_INFO)
+  flags |= (has_line_info ? JERRY_SNAPSHOT_HAS_LINE_INFO : 0);
+#endif /* ENABLED (JERRY_LINE_INFO) */
 
   return flags;
 } /* snapshot_get_global_flags */
@@ -66,8 +72,11 @@ snapshot_check_global_flags (uint32_t global_flags) /**< global flags */
 #if ENABLED (JERRY_ESNEXT)
   global_flags &= (uint32_t) ~JERRY_SNAPSHOT_HAS_CLASS_LITERAL;
 #endif /* ENABLED (JERRY_ESNEXT) */
+#if ENABLED (JERRY_LINE_INFO)
+  global_flags &= (uint32_t) ~JERRY_SNAPSHOT_HAS_LINE_INFO;
+#endif /* ENABLED (JERRY_LINE_INFO) */
 
-  return global_flags == snapshot_get_global_flags (false, false);
+  return global_flags == snapshot_get_global_flags (false, false, false);
 } /* snapshot_check_global_flags */
 
 #endif /* ENABLED (JERRY_SNAPSHOT_SAVE) || ENABLED (JERRY_SNAPSHOT_EXEC) */
@@ -83,6 +92,7 @@ typedef struct
   ecma_value_t snapshot_error;
   bool regex_found;
   bool class_found;
+  bool line_info_found;
 } snapshot_globals_t;
 
 /** \addtogroup jerrysnapshot Jerry snapshot operations
@@ -240,6 +250,33 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< compiled
     return 0;
   }
 
+#if ENABLED (JERRY_LINE_INFO)
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_HAS_LINE_INFO)
+  {
+    /* The line info block is stored right after the byte code, and
+     * its aligned size is stored in place of the block pointer. */
+    uint8_t *line_info_p = ecma_compiled_code_get_line_info (compiled_code_p);
+    size_t line_info_size = ecma_line_info_get_size (line_info_p);
+
+    if (!snapshot_write_to_buffer_by_offset (snapshot_buffer_p,
+                                             snapshot_buffer_size,
+                                             &globals_p->snapshot_buffer_write_offset,
+                                             line_info_p,
+                                             line_info_size))
+    {
+      globals_p->snapshot_error = jerry_create_error (JERRY_ERROR_RANGE, error_buffer_too_small_p);
+      return 0;
+    }
+
+    globals_p->snapshot_buffer_write_offset = JERRY_ALIGNUP (globals_p->snapshot_buffer_write_offset,
+                                                             JMEM_ALIGNMENT);
+    globals_p->line_info_found = true;
+
+    *ecma_compiled_code_resolve_line_info (copied_code_p) = (ecma_value_t) JERRY_ALIGNUP (line_info_size,
+                                                                                         JMEM_ALIGNMENT);
+  }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
   /* Sub-functions and regular expressions are stored recursively. */
   uint8_t *buffer_p = (uint8_t *) copied_code_p;
   ecma_value_t *literal_start_p;
@@ -372,6 +409,11 @@ static_snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< c
 
   ((ecma_compiled_code_t *) copied_code_p)->status_flags |= CBC_CODE_FLAGS_STATIC_FUNCTION;
 
+#if ENABLED (JERRY_LINE_INFO)
+  /* Static snapshots are executed in place, so their line info cannot be referenced. */
+  copied_code_p->status_flags &= (uint16_t) ~CBC_CODE_FLAGS_HAS_LINE_INFO;
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
   if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
   {
     literal_start_p = (ecma_value_t *) (buffer_p + sizeof (cbc_uint16_arguments_t));
@@ -439,6 +481,27 @@ static_snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< c
   return start_offset;
 } /* static_snapshot_add_compiled_code */
 
+/**
+ * Get the size of a compiled code stored in a snapshot.
+ *
+ * @return size of the compiled code including its line info block
+ */
+static uint32_t
+snapshot_get_code_size (const ecma_compiled_code_t *bytecode_p) /**< compiled code */
+{
+  uint32_t code_size = ((uint32_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+
+#if ENABLED (JERRY_LINE_INFO)
+  if (CBC_IS_FUNCTION (bytecode_p->status_flags)
+      && (bytecode_p->status_flags & CBC_CODE_FLAGS_HAS_LINE_INFO))
+  {
+    code_size += (uint32_t) *ecma_compiled_code_resolve_line_info (bytecode_p);
+  }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
+  return code_size;
+} /* snapshot_get_code_size */
+
 /**
  * Set the uint16_t offsets in the code area.
  */
@@ -452,7 +515,7 @@ jerry_snapshot_set_offsets (uint32_t *buffer_p, /**< buffer */
   do
   {
     ecma_compiled_code_t *bytecode_p = (ecma_compiled_code_t *) buffer_p;
-    uint32_t code_size = ((uint32_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+    uint32_t code_size = snapshot_get_code_size (bytecode_p);
 
     if (CBC_IS_FUNCTION (bytecode_p->status_flags))
     {
@@ -627,6 +690,12 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
       extra_bytes += (uint32_t) sizeof (ecma_value_t);
     }
 
+    /* extended info */
+    if (bytecode_p->status_flags & CBC_CODE_FLAGS_HAS_EXTENDED_INFO)
+    {
+      extra_bytes += (uint32_t) sizeof (ecma_value_t);
+    }
+
     /* tagged template literals */
     if (bytecode_p->status_flags & CBC_CODE_FLAGS_HAS_TAGGED_LITERALS)
     {
@@ -634,6 +703,14 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
     }
 #endif /* ENABLED (JERRY_ESNEXT) */
 
+#if ENABLED (JERRY_LINE_INFO)
+    /* line info */
+    if (bytecode_p->status_flags & CBC_CODE_FLAGS_HAS_LINE_INFO)
+    {
+      extra_bytes += (uint32_t) sizeof (ecma_value_t);
+    }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
 #if ENABLED (JERRY_RESOURCE_NAME)
     /* resource name */
     extra_bytes += (uint32_t) sizeof (ecma_value_t);
@@ -669,6 +746,24 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
 
   JERRY_ASSERT (bytecode_p->refs == 1);
 
+#if ENABLED (JERRY_LINE_INFO)
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_HAS_LINE_INFO)
+  {
+    /* The line info block is stored right after the byte code. */
+    size_t snapshot_code_size = ((size_t) ((const ecma_compiled_code_t *) base_addr_p)->size) << JMEM_ALIGNMENT_LOG;
+    const uint8_t *snapshot_line_info_p = base_addr_p + snapshot_code_size;
+    size_t line_info_size = ecma_line_info_get_size (snapshot_line_info_p);
+    uint8_t *line_info_p = (uint8_t *) jmem_heap_alloc_block (line_info_size);
+
+#if ENABLED (JERRY_MEM_STATS)
+    jmem_stats_allocate_byte_code_bytes (line_info_size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+    memcpy (line_info_p, snapshot_line_info_p, line_info_size);
+    ECMA_SET_INTERNAL_VALUE_POINTER (*ecma_compiled_code_resolve_line_info (bytecode_p), line_info_p);
+  }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
 #if ENABLED (JERRY_DEBUGGER)
   bytecode_p->status_flags = (uint16_t) (bytecode_p->status_flags | CBC_CODE_FLAGS_DEBUGGER_IGNORE);
 #endif /* ENABLED (JERRY_DEBUGGER) */
@@ -765,6 +860,7 @@ jerry_generate_snapshot_with_args (const jerry_char_t *resource_name_p, /**< scr
   globals.snapshot_error = ECMA_VALUE_EMPTY;
   globals.regex_found = false;
   globals.class_found = false;
+  globals.line_info_found = false;
 
   uint32_t status_flags = ((generate_snapshot_opts & JERRY_SNAPSHOT_SAVE_STRICT) ? ECMA_PARSE_STRICT_MODE
                                                                                  : ECMA_PARSE_NO_OPTS);
@@ -799,7 +895,9 @@ jerry_generate_snapshot_with_args (const jerry_char_t *resource_name_p, /**< scr
   jerry_snapshot_header_t header;
   header.magic = JERRY_SNAPSHOT_MAGIC;
   header.version = JERRY_SNAPSHOT_VERSION;
-  header.global_flags = snapshot_get_global_flags (globals.regex_found, globals.class_found);
+  header.global_flags = snapshot_get_global_flags (globals.regex_found,
+                                                  globals.class_found,
+                                                  globals.line_info_found);
   header.lit_table_offset = (uint32_t) globals.snapshot_buffer_write_offset;
   header.number_of_funcs = 1;
   header.func_offsets[0] = aligned_header_size;
@@ -1076,7 +1174,7 @@ scan_snapshot_functions (const uint8_t *buffer_p, /**< snapshot buffer start */
   do
   {
     const ecma_compiled_code_t *bytecode_p = (ecma_compiled_code_t *) buffer_p;
-    uint32_t code_size = ((uint32_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+    uint32_t code_size = snapshot_get_code_size (bytecode_p);
 
     if (CBC_IS_FUNCTION (bytecode_p->status_flags)
         && !(bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION))
@@ -1142,7 +1240,7 @@ update_literal_offsets (uint8_t *buffer_p, /**< [in,out] snapshot buffer start *
   do
   {
     const ecma_compiled_code_t *bytecode_p = (ecma_compiled_code_t *) buffer_p;
-    uint32_t code_size = ((uint32_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+    uint32_t code_size = snapshot_get_code_size (bytecode_p);
 
     if (CBC_IS_FUNCTION (bytecode_p->status_flags)
         && !(bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION))
@@ -38,7 +38,9 @@
 #include "ecma-objects-general.h"
 #include "ecma-regexp-object.h"
 #include "ecma-promise-object.h"
+#include "ecma-property-hashmap.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 #include "ecma-symbol-object.h"
 #include "ecma-typedarray-object.h"
 #include "opcodes.h"
@@ -343,6 +345,25 @@ jerry_gc (jerry_gc_mode_t mode) /**< operational mode */
   ecma_free_unused_memory (JMEM_PRESSURE_HIGH);
 } /* jerry_gc */
 
+/**
+ * Perform a step of an incremental garbage collection cycle.
+ *
+ * Note:
+ *   - a new cycle is started when no cycle is in progress
+ *   - the unreachable objects are freed by the step which finishes the cycle
+ *   - any full garbage collection (e.g. jerry_gc) abandons the cycle in progress
+ *
+ * @return true - if the garbage collection cycle is finished by this step
+ *         false - otherwise
+ */
+bool
+jerry_gc_step (uint32_t budget_objects) /**< maximum number of objects marked in this step */
+{
+  jerry_assert_api_available ();
+
+  return ecma_gc_step (budget_objects > 0 ? budget_objects : 1);
+} /* jerry_gc_step */
+
 /**
  * Get heap memory stats.
  *
@@ -364,10 +385,14 @@ jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p) /**< [out] heap memory
 
   *out_stats_p = (jerry_heap_stats_t)
   {
-    .version = 1,
+    .version = 2,
     .size = jmem_heap_stats.size,
     .allocated_bytes = jmem_heap_stats.allocated_bytes,
-    .peak_allocated_bytes = jmem_heap_stats.peak_allocated_bytes
+    .peak_allocated_bytes = jmem_heap_stats.peak_allocated_bytes,
+    .gc_objects_scanned = JERRY_CONTEXT (ecma_gc_stats).objects_scanned,
+    .gc_mark_passes = JERRY_CONTEXT (ecma_gc_stats).mark_passes,
+    .gc_time_us = JERRY_CONTEXT (ecma_gc_stats).time_us,
+    .gc_max_time_us = JERRY_CONTEXT (ecma_gc_stats).max_time_us,
   };
 
   return true;
@@ -377,6 +402,153 @@ jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p) /**< [out] heap memory
 #endif /* ENABLED (JERRY_MEM_STATS) */
 } /* jerry_get_memory_stats */
 
+/**
+ * Get the property lookup cache stats.
+ *
+ * @return true - if the stats are available
+ *         false - otherwise. Either the MEM_STATS feature or the lookup cache is not enabled.
+ */
+bool
+jerry_get_lcache_stats (jerry_lcache_stats_t *out_stats_p) /**< [out] lookup cache stats */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_MEM_STATS) && ENABLED (JERRY_LCACHE)
+  if (out_stats_p == NULL)
+  {
+    return false;
+  }
+
+  out_stats_p->lookups = JERRY_CONTEXT (lcache_stats).lookups;
+  out_stats_p->hits = JERRY_CONTEXT (lcache_stats).hits;
+  out_stats_p->prototype_lookups = JERRY_CONTEXT (lcache_stats).proto_lookups;
+  out_stats_p->prototype_hits = JERRY_CONTEXT (lcache_stats).proto_hits;
+  return true;
+#else /* !ENABLED (JERRY_MEM_STATS) || !ENABLED (JERRY_LCACHE) */
+  JERRY_UNUSED (out_stats_p);
+  return false;
+#endif /* ENABLED (JERRY_MEM_STATS) && ENABLED (JERRY_LCACHE) */
+} /* jerry_get_lcache_stats */
+
+/**
+ * Set the maximum number of compiled regular expressions kept in the RegExp cache.
+ * The cache is emptied and its hit and miss counters are kept.
+ *
+ * Note:
+ *      size 0 disables the cache
+ *
+ * @return true - if the size is changed
+ *         false - otherwise. Either the RegExp feature is not enabled or the size is too large.
+ */
+bool
+jerry_set_regexp_cache_size (uint32_t size) /**< maximum number of cached regular expressions */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+  if (size > RE_CACHE_MAX_SIZE)
+  {
+    return false;
+  }
+
+  re_cache_set_size (size);
+  return true;
+#else /* !ENABLED (JERRY_BUILTIN_REGEXP) */
+  JERRY_UNUSED (size);
+  return false;
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+} /* jerry_set_regexp_cache_size */
+
+/**
+ * Get the RegExp cache stats.
+ *
+ * @return true - if the stats are available
+ *         false - otherwise. Usually it is because the RegExp feature is not enabled.
+ */
+bool
+jerry_get_regexp_cache_stats (jerry_regexp_cache_stats_t *out_stats_p) /**< [out] RegExp cache stats */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+  if (out_stats_p == NULL)
+  {
+    return false;
+  }
+
+  out_stats_p->size = JERRY_CONTEXT (re_cache_size);
+  out_stats_p->count = JERRY_CONTEXT (re_cache_count);
+  out_stats_p->hits = JERRY_CONTEXT (re_cache_hits);
+  out_stats_p->misses = JERRY_CONTEXT (re_cache_misses);
+  return true;
+#else /* !ENABLED (JERRY_BUILTIN_REGEXP) */
+  JERRY_UNUSED (out_stats_p);
+  return false;
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+} /* jerry_get_regexp_cache_stats */
+
+/**
+ * Set the thresholds of the automatic property hashmap creation.
+ *
+ * @return true - if the thresholds are changed
+ *         false - otherwise. Either the property hashmap is not enabled or a threshold is out of range.
+ */
+bool
+jerry_set_property_hashmap_thresholds (uint32_t lookup_length, /**< number of properties visited by
+                                                                *   a single lookup which creates a hashmap */
+                                       uint32_t miss_limit) /**< number of properties visited by repeated
+                                                             *   lookups which create a hashmap,
+                                                             *   0 disables the adaptive creation */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_PROPRETY_HASHMAP)
+  if (lookup_length < ECMA_PROPERTY_HASHMAP_MIN_PROPERTY_COUNT
+      || lookup_length > 2 * UINT16_MAX
+      || miss_limit > 2 * UINT16_MAX)
+  {
+    return false;
+  }
+
+  JERRY_CONTEXT (ecma_prop_hashmap_lookup_steps) = (uint16_t) (lookup_length / 2);
+  JERRY_CONTEXT (ecma_prop_hashmap_miss_limit) = (uint16_t) (miss_limit / 2);
+  JERRY_CONTEXT (ecma_prop_hashmap_misses) = 0;
+  return true;
+#else /* !ENABLED (JERRY_PROPRETY_HASHMAP) */
+  JERRY_UNUSED (lookup_length);
+  JERRY_UNUSED (miss_limit);
+  return false;
+#endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
+} /* jerry_set_property_hashmap_thresholds */
+
+/**
+ * Get the property hashmap stats.
+ *
+ * @return true - if the stats are available
+ *         false - otherwise. Either the MEM_STATS feature or the property hashmap is not enabled.
+ */
+bool
+jerry_get_property_hashmap_stats (jerry_property_hashmap_stats_t *out_stats_p) /**< [out] property hashmap
+                                                                                *   stats */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_MEM_STATS) && ENABLED (JERRY_PROPRETY_HASHMAP)
+  if (out_stats_p == NULL)
+  {
+    return false;
+  }
+
+  out_stats_p->lookups = JERRY_CONTEXT (ecma_prop_hashmap_stats).lookups;
+  out_stats_p->hits = JERRY_CONTEXT (ecma_prop_hashmap_stats).hits;
+  out_stats_p->probes = JERRY_CONTEXT (ecma_prop_hashmap_stats).probes;
+  return true;
+#else /* !ENABLED (JERRY_MEM_STATS) || !ENABLED (JERRY_PROPRETY_HASHMAP) */
+  JERRY_UNUSED (out_stats_p);
+  return false;
+#endif /* ENABLED (JERRY_MEM_STATS) && ENABLED (JERRY_PROPRETY_HASHMAP) */
+} /* jerry_get_property_hashmap_stats */
+
 /**
  * Simple Jerry runner
  *
@@ -412,6 +584,41 @@ jerry_run_simple (const jerry_char_t *script_source_p, /**< script source */
   return result;
 } /* jerry_run_simple */
 
+#if ENABLED (JERRY_PARSER)
+
+/**
+ * Convert jerry_parse_opts_t option bits to ecma_parse_opts_t option bits.
+ *
+ * @return ecma_parse_opts_t option bits
+ */
+static uint32_t
+jerry_get_ecma_parse_opts (uint32_t parse_opts) /**< jerry_parse_opts_t option bits */
+{
+  uint32_t ecma_parse_opts = ECMA_PARSE_NO_OPTS;
+
+  if (parse_opts & JERRY_PARSE_STRICT_MODE)
+  {
+    ecma_parse_opts |= ECMA_PARSE_STRICT_MODE;
+  }
+
+  if (parse_opts & JERRY_PARSE_LAZY_FUNCTIONS)
+  {
+    ecma_parse_opts |= ECMA_PARSE_LAZY_FUNCTIONS;
+  }
+
+#if ENABLED (JERRY_DEBUGGER)
+  if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
+  {
+    /* The debugger needs the breakpoints of all functions after parsing. */
+    ecma_parse_opts &= (uint32_t) ~ECMA_PARSE_LAZY_FUNCTIONS;
+  }
+#endif /* ENABLED (JERRY_DEBUGGER) */
+
+  return ecma_parse_opts;
+} /* jerry_get_ecma_parse_opts */
+
+#endif /* ENABLED (JERRY_PARSER) */
+
 /**
  * Parse script and construct an EcmaScript function. The lexical
  * environment is set to the global lexical environment.
@@ -457,7 +664,7 @@ jerry_parse (const jerry_char_t *resource_name_p, /**< resource name (usually a
                                                                source_p,
                                                                source_size,
                                                                resource_name,
-                                                               parse_opts);
+                                                               jerry_get_ecma_parse_opts (parse_opts));
 
   if (JERRY_UNLIKELY (bytecode_data_p == NULL))
   {
@@ -530,7 +737,7 @@ jerry_parse_function (const jerry_char_t *resource_name_p, /**< resource name (u
                                                           source_p,
                                                           source_size,
                                                           resource_name,
-                                                          parse_opts);
+                                                          jerry_get_ecma_parse_opts (parse_opts));
 
   if (JERRY_UNLIKELY (bytecode_p == NULL))
   {
@@ -3477,6 +3684,56 @@ jerry_set_prototype (const jerry_value_t obj_val, /**< object value */
   return ecma_op_ordinary_object_set_prototype_of (obj_p, proto_obj_val);
 } /* jerry_set_prototype */
 
+/**
+ * Hint that the object is used as a dictionary: a property hashmap is created
+ * for the object, so its properties are found without a linear search.
+ *
+ * Note:
+ *      the hashmap is maintained when properties are added, but it may be released
+ *      when most properties are deleted or the engine runs out of memory
+ *
+ * @return true - if the object has a property hashmap
+ *         false - otherwise
+ */
+bool
+jerry_object_optimize_for_lookup (const jerry_value_t obj_val) /**< object value */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_PROPRETY_HASHMAP)
+  if (!ecma_is_value_object (obj_val))
+  {
+    return false;
+  }
+
+  ecma_object_t *obj_p = ecma_get_object_from_value (obj_val);
+
+#if ENABLED (JERRY_BUILTIN_PROXY)
+  if (ECMA_OBJECT_IS_PROXY (obj_p))
+  {
+    return false;
+  }
+#endif /* ENABLED (JERRY_BUILTIN_PROXY) */
+
+  if (ecma_op_object_is_fast_array (obj_p))
+  {
+    return false;
+  }
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ECMA_OBJECT_HAS_SHAPE (obj_p))
+  {
+    ecma_shape_convert_to_property_list (obj_p, NULL);
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+  return ecma_property_hashmap_optimize (obj_p);
+#else /* !ENABLED (JERRY_PROPRETY_HASHMAP) */
+  JERRY_UNUSED (obj_val);
+  return false;
+#endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
+} /* jerry_object_optimize_for_lookup */
+
 /**
  * Utility to check if a given object can be used for the foreach api calls.
  *
@@ -3523,6 +3780,13 @@ jerry_objects_foreach (jerry_objects_foreach_t foreach_p, /**< function pointer
 
   JERRY_ASSERT (foreach_p != NULL);
 
+  /* The objects are split into several lists during an incremental GC cycle
+   * or when the generational garbage collector is enabled. */
+  ecma_gc_cancel_incremental ();
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  ecma_gc_merge_generations ();
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
   jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   while (iter_cp != JMEM_CP_NULL)
@@ -3561,6 +3825,13 @@ jerry_objects_foreach_by_native_info (const jerry_object_native_info_t *native_i
 
   ecma_native_pointer_t *native_pointer_p;
 
+  /* The objects are split into several lists during an incremental GC cycle
+   * or when the generational garbage collector is enabled. */
+  ecma_gc_cancel_incremental ();
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  ecma_gc_merge_generations ();
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
   jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   while (iter_cp != JMEM_CP_NULL)
@@ -5271,6 +5542,184 @@ jerry_json_stringify (const jerry_value_t input_value) /**< a value to stringify
 #endif /* ENABLED (JERRY_BUILTIN_JSON) */
 } /* jerry_json_stringify */
 
+#if ENABLED (JERRY_BUILTIN_JSON)
+
+/**
+ * Incremental JSON parser of the API
+ */
+struct jerry_json_parser_t
+{
+  ecma_json_parser_t *parser_p; /**< internal parser */
+  jerry_json_parser_callback_t callback; /**< callback of the application, can be NULL */
+  void *user_p; /**< user pointer passed to the callback */
+};
+
+/**
+ * Call the callback of the application with the API types of the event and the action.
+ *
+ * @return action returned by the callback
+ */
+static ecma_json_parser_action_t
+jerry_json_parser_callback (ecma_json_parser_event_t event, /**< event */
+                            ecma_value_t key, /**< key of the container */
+                            ecma_value_t value, /**< closed container or undefined */
+                            uint32_t depth, /**< depth of the container */
+                            void *user_p) /**< API parser */
+{
+  jerry_json_parser_t *api_parser_p = (jerry_json_parser_t *) user_p;
+  jerry_json_parser_event_t api_event;
+
+  switch (event)
+  {
+    case ECMA_JSON_PARSER_OBJECT_START:
+    {
+      api_event = JERRY_JSON_PARSER_OBJECT_START;
+      break;
+    }
+    case ECMA_JSON_PARSER_ARRAY_START:
+    {
+      api_event = JERRY_JSON_PARSER_ARRAY_START;
+      break;
+    }
+    case ECMA_JSON_PARSER_OBJECT_END:
+    {
+      api_event = JERRY_JSON_PARSER_OBJECT_END;
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (event == ECMA_JSON_PARSER_ARRAY_END);
+      api_event = JERRY_JSON_PARSER_ARRAY_END;
+      break;
+    }
+  }
+
+  jerry_json_parser_action_t action = api_parser_p->callback (api_event, key, value, depth, api_parser_p->user_p);
+
+  return (action == JERRY_JSON_PARSER_DISCARD) ? ECMA_JSON_PARSER_DISCARD : ECMA_JSON_PARSER_KEEP;
+} /* jerry_json_parser_callback */
+
+#endif /* ENABLED (JERRY_BUILTIN_JSON) */
+
+/**
+ * Create an incremental JSON parser, which receives its input in chunks.
+ *
+ * The callback (if not NULL) is called when an object or array is opened, and when
+ * a built object or array is closed. Returning JERRY_JSON_PARSER_DISCARD for a start
+ * event only validates the container, while returning it for an end event drops the
+ * container. Only the kept containers are stored in the memory.
+ *
+ * Note:
+ *      The returned parser must be freed with jerry_json_parser_free before jerry_cleanup.
+ *
+ * @return new parser - if the JSON support is enabled
+ *         NULL - otherwise
+ */
+jerry_json_parser_t *
+jerry_json_parser_create (jerry_json_parser_callback_t callback, /**< callback called at container boundaries,
+                                                                  *   can be NULL */
+                          void *user_p) /**< user pointer passed to the callback */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_BUILTIN_JSON)
+  jerry_json_parser_t *api_parser_p = (jerry_json_parser_t *) jmem_heap_alloc_block (sizeof (jerry_json_parser_t));
+
+  api_parser_p->callback = callback;
+  api_parser_p->user_p = user_p;
+  api_parser_p->parser_p = ecma_builtin_json_parser_create ((callback != NULL) ? jerry_json_parser_callback : NULL,
+                                                            api_parser_p);
+  return api_parser_p;
+#else /* !ENABLED (JERRY_BUILTIN_JSON) */
+  JERRY_UNUSED (callback);
+  JERRY_UNUSED (user_p);
+
+  return NULL;
+#endif /* ENABLED (JERRY_BUILTIN_JSON) */
+} /* jerry_json_parser_create */
+
+/**
+ * Pass the next chunk of the input to an incremental JSON parser.
+ *
+ * Tokens can be split between chunks. After an error is returned, the parser
+ * keeps returning errors.
+ *
+ * Note:
+ *      The returned value must be freed with jerry_release_value.
+ *
+ * @return true - if no syntax error is found so far
+ *         thrown SyntaxError - otherwise
+ */
+jerry_value_t
+jerry_json_parser_feed (jerry_json_parser_t *parser_p, /**< parser */
+                        const jerry_char_t *chunk_p, /**< chunk of the input */
+                        jerry_size_t chunk_size) /**< size of the chunk */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_BUILTIN_JSON)
+  if (!ecma_builtin_json_parser_feed (parser_p->parser_p, chunk_p, chunk_size))
+  {
+    return jerry_throw (ecma_raise_syntax_error (ECMA_ERR_MSG ("JSON string parse error.")));
+  }
+
+  return ECMA_VALUE_TRUE;
+#else /* !ENABLED (JERRY_BUILTIN_JSON) */
+  JERRY_UNUSED (parser_p);
+  JERRY_UNUSED (chunk_p);
+  JERRY_UNUSED (chunk_size);
+
+  return jerry_throw (ecma_raise_syntax_error (ECMA_ERR_MSG ("The JSON has been disabled.")));
+#endif /* ENABLED (JERRY_BUILTIN_JSON) */
+} /* jerry_json_parser_feed */
+
+/**
+ * Finish the parsing of the input passed to an incremental JSON parser.
+ *
+ * Note:
+ *      Only jerry_json_parser_free can be called after this function.
+ *      The returned value must be freed with jerry_release_value.
+ *
+ * @return parsed value (undefined if the top level container is discarded)
+ *         thrown SyntaxError - if the input is invalid or incomplete
+ */
+jerry_value_t
+jerry_json_parser_finish (jerry_json_parser_t *parser_p) /**< parser */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_BUILTIN_JSON)
+  ecma_value_t ret_value = ecma_builtin_json_parser_finish (parser_p->parser_p);
+
+  if (ecma_is_value_empty (ret_value))
+  {
+    return jerry_throw (ecma_raise_syntax_error (ECMA_ERR_MSG ("JSON string parse error.")));
+  }
+
+  return ret_value;
+#else /* !ENABLED (JERRY_BUILTIN_JSON) */
+  JERRY_UNUSED (parser_p);
+
+  return jerry_throw (ecma_raise_syntax_error (ECMA_ERR_MSG ("The JSON has been disabled.")));
+#endif /* ENABLED (JERRY_BUILTIN_JSON) */
+} /* jerry_json_parser_finish */
+
+/**
+ * Free an incremental JSON parser and the values held by it.
+ */
+void
+jerry_json_parser_free (jerry_json_parser_t *parser_p) /**< parser */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_BUILTIN_JSON)
+  ecma_builtin_json_parser_free (parser_p->parser_p);
+  jmem_heap_free_block (parser_p, sizeof (jerry_json_parser_t));
+#else /* !ENABLED (JERRY_BUILTIN_JSON) */
+  JERRY_UNUSED (parser_p);
+#endif /* ENABLED (JERRY_BUILTIN_JSON) */
+} /* jerry_json_parser_free */
+
 /**
  * Create a container type specified in jerry_container_type_t.
  * The container can be created with a list of arguments, which will be passed to the container constructor to be
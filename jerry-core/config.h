@@ -187,6 +187,23 @@
 # define JERRY_GLOBAL_HEAP_SIZE (512)
 #endif /* !defined (JERRY_GLOBAL_HEAP_SIZE) */
 
+/**
+ * Enable/Disable the segregated-fit mode of the heap allocator.
+ *
+ * When enabled, small freed regions are kept in per-size-class bins and
+ * larger free regions are stored in a size ordered, coalescing search tree
+ * instead of the single address ordered free list.
+ *
+ * Allowed values:
+ *  0: Use the address ordered first-fit free list.
+ *  1: Use size-class bins and a large block tree.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_MEM_SEGREGATED_FIT
+# define JERRY_MEM_SEGREGATED_FIT 0
+#endif /* !defined (JERRY_MEM_SEGREGATED_FIT) */
+
 /**
  * The allowed heap usage limit until next garbage collection, in bytes.
  *
@@ -210,13 +227,54 @@
 #endif /* !defined (JERRY_STACK_LIMIT) */
 
 /**
- * Maximum depth of recursion during GC mark phase
+ * Number of objects which can be stored on the GC mark stack.
  *
- * Default value: 8
+ * The mark stack is a fixed size buffer in the engine context. When it is full,
+ * the remaining objects are found by rescanning the list of objects.
+ *
+ * Default value: 64
  */
-#ifndef JERRY_GC_MARK_LIMIT
-# define JERRY_GC_MARK_LIMIT (8)
-#endif /* !defined (JERRY_GC_MARK_LIMIT) */
+#ifndef JERRY_GC_MARK_STACK_SIZE
+# ifdef JERRY_GC_MARK_LIMIT
+/* Deprecated: JERRY_GC_MARK_LIMIT was the maximum recursion depth of the GC mark phase,
+ * it is used as the size of the mark stack (at least one object). */
+#  if JERRY_GC_MARK_LIMIT > 0
+#   define JERRY_GC_MARK_STACK_SIZE JERRY_GC_MARK_LIMIT
+#  else /* JERRY_GC_MARK_LIMIT <= 0 */
+#   define JERRY_GC_MARK_STACK_SIZE (1)
+#  endif /* JERRY_GC_MARK_LIMIT > 0 */
+# else /* !defined (JERRY_GC_MARK_LIMIT) */
+#  define JERRY_GC_MARK_STACK_SIZE (64)
+# endif /* JERRY_GC_MARK_LIMIT */
+#endif /* !defined (JERRY_GC_MARK_STACK_SIZE) */
+
+/**
+ * Enable/Disable the generational garbage collector.
+ *
+ * Allowed values:
+ *  0: Disable generational garbage collection.
+ *  1: Enable generational garbage collection.
+ *
+ * When enabled, new objects are allocated in a young generation, which is collected by minor
+ * collections without marking the objects of the old generation. References from old objects
+ * to young objects are tracked by a remembered set. The old generation is collected when its
+ * size is doubled since the last full collection, or when the memory is low.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_GC_GENERATIONAL
+# define JERRY_GC_GENERATIONAL 0
+#endif /* !defined (JERRY_GC_GENERATIONAL) */
+
+/**
+ * Number of minor collections which must be survived by a young object before it
+ * is moved to the old generation. Only used when JERRY_GC_GENERATIONAL is enabled.
+ *
+ * Default value: 2
+ */
+#ifndef JERRY_GC_PROMOTION_AGE
+# define JERRY_GC_PROMOTION_AGE (2)
+#endif /* !defined (JERRY_GC_PROMOTION_AGE) */
 
 /**
  * Enable/Disable property lookup cache.
@@ -231,6 +289,142 @@
 # define JERRY_LCACHE 1
 #endif /* !defined (JERRY_LCACHE) */
 
+/**
+ * Number of rows in the property lookup cache (must be a power of 2).
+ * Each row contains two entries.
+ *
+ * Allowed values:
+ *  16-4096: Number of rows.
+ *
+ * Default value: 128
+ */
+#ifndef JERRY_LCACHE_ROWS
+# define JERRY_LCACHE_ROWS 128
+#endif /* !defined (JERRY_LCACHE_ROWS) */
+
+/**
+ * Number of rows in the second level of the property lookup cache (must be 0 or a power of 2),
+ * which stores the properties found on the prototype chain. Each row contains two entries.
+ *
+ * Allowed values:
+ *  0: Disable the prototype chain results.
+ *  1-1024: Number of rows.
+ *
+ * Default value: 32
+ */
+#ifndef JERRY_LCACHE_PROTOTYPE_ROWS
+# define JERRY_LCACHE_PROTOTYPE_ROWS 32
+#endif /* !defined (JERRY_LCACHE_PROTOTYPE_ROWS) */
+
+/**
+ * Enable/Disable inline caches for named property accesses in the VM.
+ *
+ * Allowed values:
+ *  0: Disable inline caches.
+ *  1: Enable inline caches.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_VM_INLINE_CACHE
+# define JERRY_VM_INLINE_CACHE 1
+#endif /* !defined (JERRY_VM_INLINE_CACHE) */
+
+/**
+ * Enable/Disable threaded dispatch of the byte code instructions in the VM.
+ *
+ * Threaded dispatch requires the labels as values extension of GCC and Clang.
+ *
+ * Allowed values:
+ *  0: Dispatch every instruction through a switch statement.
+ *  1: Dispatch the common instructions through a table of label addresses.
+ *
+ * Default value: 1 when compiled with GCC or Clang, 0 otherwise
+ */
+#ifndef JERRY_VM_COMPUTED_GOTO
+# if defined (__GNUC__) || defined (__clang__)
+#  define JERRY_VM_COMPUTED_GOTO 1
+# else /* !__GNUC__ && !__clang__ */
+#  define JERRY_VM_COMPUTED_GOTO 0
+# endif /* __GNUC__ || __clang__ */
+#endif /* !defined (JERRY_VM_COMPUTED_GOTO) */
+
+/**
+ * Enable/Disable the allocation of the VM frames on the engine heap.
+ *
+ * When enabled, the frame of each function call (the frame context, the
+ * registers and the value stack) is allocated from a segmented frame stack
+ * on the engine heap instead of the native stack. Calls of byte code functions
+ * by the byte code are executed by the vm_execute of the caller, so they do not
+ * consume native stack. Other calls, such as constructor calls and callbacks
+ * of built-in functions, still recurse on the native stack.
+ *
+ * Allowed values:
+ *  0: Allocate the frames on the native stack.
+ *  1: Allocate the frames on the engine heap.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_VM_HEAP_FRAMES
+# define JERRY_VM_HEAP_FRAMES 0
+#endif /* !defined (JERRY_VM_HEAP_FRAMES) */
+
+/**
+ * Enable/Disable hashmap for the literal storage.
+ *
+ * Allowed values:
+ *  0: Disable literal hashmap, literals are found by a linear search.
+ *  1: Enable literal hashmap.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_LITERAL_HASHMAP
+# define JERRY_LITERAL_HASHMAP 1
+#endif /* !defined (JERRY_LITERAL_HASHMAP) */
+
+/**
+ * Enable/Disable rope strings.
+ *
+ * Allowed values:
+ *  0: Disable rope strings, concatenation always copies both strings.
+ *  1: Enable rope strings.
+ *
+ * When enabled, long concatenated strings keep references to their parts, and the
+ * characters are copied into a single buffer when they are first accessed.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_ROPE_STRINGS
+# define JERRY_ROPE_STRINGS 1
+#endif /* !defined (JERRY_ROPE_STRINGS) */
+
+/**
+ * Enable/Disable SIMD instructions for scanning string buffers.
+ *
+ * Allowed values:
+ *  0: Scan with portable C code, which compares a machine word at a time.
+ *  1: Use SSE2 or NEON instructions when the compiler targets them.
+ *
+ * Used by the JSON parser and stringifier to find the next byte which needs processing.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_SIMD_SCAN
+# define JERRY_SIMD_SCAN 1
+#endif /* !defined (JERRY_SIMD_SCAN) */
+
+/**
+ * Minimum number of digits of both BigInt operands when multiplication uses the Karatsuba algorithm.
+ *
+ * Allowed values:
+ *  0: Disable Karatsuba multiplication, the schoolbook algorithm is always used.
+ *  4 - 1024: Operands with at least this number of 32 bit digits are multiplied by the Karatsuba algorithm.
+ *
+ * Default value: 32
+ */
+#ifndef JERRY_BIGINT_KARATSUBA_THRESHOLD
+# define JERRY_BIGINT_KARATSUBA_THRESHOLD 32
+#endif /* !defined (JERRY_BIGINT_KARATSUBA_THRESHOLD) */
+
 /**
  * Enable/Disable line-info management inside the engine.
  *
@@ -340,6 +534,19 @@
 # define JERRY_PROPRETY_HASHMAP 1
 #endif /* !defined (JERRY_PROPRETY_HASHMAP) */
 
+/**
+ * Enable/Disable shared shape descriptors for the properties of ordinary objects.
+ *
+ * Allowed values:
+ *  0: Disable object shapes, each object stores the names of its properties.
+ *  1: Enable object shapes.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_OBJECT_SHAPES
+# define JERRY_OBJECT_SHAPES 0
+#endif /* !defined (JERRY_OBJECT_SHAPES) */
+
 /**
  * Enable/Disable byte code dump functions for RegExp objects.
  * To dump the RegExp byte code the engine must be initialized with
@@ -356,6 +563,20 @@
 # define JERRY_REGEXP_DUMP_BYTE_CODE 0
 #endif /* !defined (JERRY_REGEXP_DUMP_BYTE_CODE) */
 
+/**
+ * Default number of compiled regular expressions kept in the RegExp cache.
+ * The size can be changed at runtime by jerry_set_regexp_cache_size.
+ *
+ * Allowed values:
+ *  0: Disable the RegExp cache.
+ *  1-1024: Maximum number of cached regular expressions.
+ *
+ * Default value: 8
+ */
+#ifndef JERRY_REGEXP_CACHE_SIZE
+# define JERRY_REGEXP_CACHE_SIZE 8
+#endif /* !defined (JERRY_REGEXP_CACHE_SIZE) */
+
 /**
  * Enables/disables the RegExp strict mode
  *
@@ -605,19 +826,67 @@
 #if !defined (JERRY_GLOBAL_HEAP_SIZE) || (JERRY_GLOBAL_HEAP_SIZE <= 0)
 # error "Invalid value for 'JERRY_GLOBAL_HEAP_SIZE' macro."
 #endif
+#if !defined (JERRY_MEM_SEGREGATED_FIT) \
+|| ((JERRY_MEM_SEGREGATED_FIT != 0) && (JERRY_MEM_SEGREGATED_FIT != 1))
+# error "Invalid value for 'JERRY_MEM_SEGREGATED_FIT' macro."
+#endif
 #if !defined (JERRY_GC_LIMIT) || (JERRY_GC_LIMIT < 0)
 # error "Invalid value for 'JERRY_GC_LIMIT' macro."
 #endif
 #if !defined (JERRY_STACK_LIMIT) || (JERRY_STACK_LIMIT < 0)
 # error "Invalid value for 'JERRY_STACK_LIMIT' macro."
 #endif
-#if !defined (JERRY_GC_MARK_LIMIT) || (JERRY_GC_MARK_LIMIT < 0)
-# error "Invalid value for 'JERRY_GC_MARK_LIMIT' macro."
+#if !defined (JERRY_GC_MARK_STACK_SIZE) || (JERRY_GC_MARK_STACK_SIZE <= 0)
+# error "Invalid value for 'JERRY_GC_MARK_STACK_SIZE' macro."
+#endif
+#if !defined (JERRY_GC_GENERATIONAL) \
+|| ((JERRY_GC_GENERATIONAL != 0) && (JERRY_GC_GENERATIONAL != 1))
+# error "Invalid value for 'JERRY_GC_GENERATIONAL' macro."
+#endif
+#if !defined (JERRY_GC_PROMOTION_AGE) || (JERRY_GC_PROMOTION_AGE <= 0) || (JERRY_GC_PROMOTION_AGE > 255)
+# error "Invalid value for 'JERRY_GC_PROMOTION_AGE' macro."
 #endif
 #if !defined (JERRY_LCACHE) \
 || ((JERRY_LCACHE != 0) && (JERRY_LCACHE != 1))
 # error "Invalid value for 'JERRY_LCACHE' macro."
 #endif
+#if !defined (JERRY_LCACHE_ROWS) || (JERRY_LCACHE_ROWS < 16) || (JERRY_LCACHE_ROWS > 4096) \
+|| ((JERRY_LCACHE_ROWS & (JERRY_LCACHE_ROWS - 1)) != 0)
+# error "Invalid value for 'JERRY_LCACHE_ROWS' macro."
+#endif
+#if !defined (JERRY_LCACHE_PROTOTYPE_ROWS) || (JERRY_LCACHE_PROTOTYPE_ROWS < 0) \
+|| (JERRY_LCACHE_PROTOTYPE_ROWS > 1024) || ((JERRY_LCACHE_PROTOTYPE_ROWS & (JERRY_LCACHE_PROTOTYPE_ROWS - 1)) != 0)
+# error "Invalid value for 'JERRY_LCACHE_PROTOTYPE_ROWS' macro."
+#endif
+#if !defined (JERRY_VM_INLINE_CACHE) \
+|| ((JERRY_VM_INLINE_CACHE != 0) && (JERRY_VM_INLINE_CACHE != 1))
+# error "Invalid value for 'JERRY_VM_INLINE_CACHE' macro."
+#endif
+#if !defined (JERRY_VM_COMPUTED_GOTO) \
+|| ((JERRY_VM_COMPUTED_GOTO != 0) && (JERRY_VM_COMPUTED_GOTO != 1))
+# error "Invalid value for 'JERRY_VM_COMPUTED_GOTO' macro."
+#endif
+#if !defined (JERRY_VM_HEAP_FRAMES) \
+|| ((JERRY_VM_HEAP_FRAMES != 0) && (JERRY_VM_HEAP_FRAMES != 1))
+# error "Invalid value for 'JERRY_VM_HEAP_FRAMES' macro."
+#endif
+#if !defined (JERRY_LITERAL_HASHMAP) \
+|| ((JERRY_LITERAL_HASHMAP != 0) && (JERRY_LITERAL_HASHMAP != 1))
+# error "Invalid value for 'JERRY_LITERAL_HASHMAP' macro."
+#endif
+#if !defined (JERRY_ROPE_STRINGS) \
+|| ((JERRY_ROPE_STRINGS != 0) && (JERRY_ROPE_STRINGS != 1))
+# error "Invalid value for 'JERRY_ROPE_STRINGS' macro."
+#endif
+#if !defined (JERRY_SIMD_SCAN) \
+|| ((JERRY_SIMD_SCAN != 0) && (JERRY_SIMD_SCAN != 1))
+# error "Invalid value for 'JERRY_SIMD_SCAN' macro."
+#endif
+#if !defined (JERRY_BIGINT_KARATSUBA_THRESHOLD) \
+|| ((JERRY_BIGINT_KARATSUBA_THRESHOLD != 0) \
+    && ((JERRY_BIGINT_KARATSUBA_THRESHOLD < 4) || (JERRY_BIGINT_KARATSUBA_THRESHOLD > 1024)))
+# error "Invalid value for 'JERRY_BIGINT_KARATSUBA_THRESHOLD' macro."
+#endif
 #if !defined (JERRY_LINE_INFO) \
 || ((JERRY_LINE_INFO != 0) && (JERRY_LINE_INFO != 1))
 # error "Invalid value for 'JERRY_LINE_INFO' macro."
@@ -650,10 +919,17 @@
 || ((JERRY_PROPRETY_HASHMAP != 0) && (JERRY_PROPRETY_HASHMAP != 1))
 # error "Invalid value for 'JERRY_PROPRETY_HASHMAP' macro."
 #endif
+#if !defined (JERRY_OBJECT_SHAPES) \
+|| ((JERRY_OBJECT_SHAPES != 0) && (JERRY_OBJECT_SHAPES != 1))
+# error "Invalid value for 'JERRY_OBJECT_SHAPES' macro."
+#endif
 #if !defined (JERRY_REGEXP_DUMP_BYTE_CODE) \
 || ((JERRY_REGEXP_DUMP_BYTE_CODE != 0) && (JERRY_REGEXP_DUMP_BYTE_CODE != 1))
 # error "Invalid value for 'JERRY_REGEXP_DUMP_BYTE_CODE' macro."
 #endif
+#if !defined (JERRY_REGEXP_CACHE_SIZE) || (JERRY_REGEXP_CACHE_SIZE < 0) || (JERRY_REGEXP_CACHE_SIZE > 1024)
+# error "Invalid value for 'JERRY_REGEXP_CACHE_SIZE' macro."
+#endif
 #if !defined (JERRY_REGEXP_STRICT_MODE) \
 || ((JERRY_REGEXP_STRICT_MODE != 0) && (JERRY_REGEXP_STRICT_MODE != 1))
 # error "Invalid value for 'JERRY_REGEXP_STRICT_MODE' macro."
@@ -697,6 +973,21 @@
 #  error "Date does not support float32"
 #endif
 
+/**
+ * The segregated-fit mode is a mode of the internal allocator,
+ * so it cannot be combined with the system allocator.
+ */
+#if ENABLED (JERRY_MEM_SEGREGATED_FIT) && ENABLED (JERRY_SYSTEM_ALLOCATOR)
+#  error "JERRY_MEM_SEGREGATED_FIT requires the internal allocator"
+#endif
+
+/**
+ * Threaded dispatch uses the labels as values extension.
+ */
+#if ENABLED (JERRY_VM_COMPUTED_GOTO) && !defined (__GNUC__) && !defined (__clang__)
+#  error "JERRY_VM_COMPUTED_GOTO requires GCC or Clang"
+#endif
+
 /**
  * Wrap container types into a single guard
  */
@@ -21,6 +21,7 @@
 #include "ecma-eval.h"
 #include "ecma-function-object.h"
 #include "ecma-objects.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 #include "jerryscript-port.h"
 #include "lit-char-helpers.h"
@@ -462,6 +463,12 @@ jerry_debugger_send_scope_variables (const uint8_t *recv_buffer_p) /**< pointer
     {
       ecma_fast_array_convert_to_normal (binding_obj_p);
     }
+#if ENABLED (JERRY_OBJECT_SHAPES)
+    else if (ECMA_OBJECT_HAS_SHAPE (binding_obj_p))
+    {
+      ecma_shape_convert_to_property_list (binding_obj_p, NULL);
+    }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
 
     prop_iter_cp = binding_obj_p->u1.property_list_cp;
   }
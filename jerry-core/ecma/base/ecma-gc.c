@@ -25,14 +25,17 @@
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
+#include "ecma-lcache.h"
 #include "ecma-objects.h"
 #include "ecma-property-hashmap.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "jrt-bit-fields.h"
 #include "re-compiler.h"
+#include "vm.h"
 #include "vm-defines.h"
 #include "vm-stack.h"
 
@@ -56,6 +59,28 @@
  * The garbage collector uses the reference counter
  * of object: it increases the counter by one when
  * the object is marked at the first time.
+ *
+ * A GC cycle can also be performed incrementally by ecma_gc_step. While the
+ * marking is in progress the following rules keep the unmarked (white) objects
+ * unreachable from the already marked (black) objects:
+ *  - objects created during the cycle are black
+ *  - objects whose reference counter is increased are marked gray, since they
+ *    have become roots (see ecma_ref_object)
+ *  - objects stored into properties, fast array items, arguments objects or
+ *    bindings of environment records are marked gray (see ecma_gc_write_barrier),
+ *    including the values copied directly from the value buffer of another
+ *    object, since these copies do not increase the reference counter
+ *
+ * When the generational mode is enabled, minor collections free the unreachable
+ * young objects without marking the old objects:
+ *  - objects are promoted to the old generation after they survive
+ *    JERRY_GC_PROMOTION_AGE minor collections or a major collection
+ *  - the roots of a minor collection are the young objects with references,
+ *    and the old objects of the remembered set
+ *  - an old object which is not in the remembered set has no references and no
+ *    young objects can be reached from it: its reference counter is set to
+ *    ECMA_OBJECT_UNREMEMBERED, and it is added to the remembered set before
+ *    it is modified (see ecma_ref_object and ecma_gc_remember_object)
  */
 
 /**
@@ -72,38 +97,47 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
   return (object_p->type_flags_refs < ECMA_OBJECT_NON_VISITED);
 } /* ecma_gc_is_object_visited */
 
-/**
- * Mark objects as visited starting from specified object as root
- */
-static void ecma_gc_mark (ecma_object_t *object_p);
-
 /**
  * Set visited flag of the object.
+ *
+ * Note:
+ *   the object is pushed onto the mark stack, so its references are marked later
+ *   by ecma_gc_mark_stacked_objects. If the stack is full, the object is left gray
+ *   and it is found later by rescanning the white-gray object list.
  */
 static void
 ecma_gc_set_object_visited (ecma_object_t *object_p) /**< object */
 {
   if (object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED)
   {
-#if (JERRY_GC_MARK_LIMIT != 0)
-    if (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) != 0)
+    if (JERRY_LIKELY (JERRY_CONTEXT (ecma_gc_mark_stack_top) < JERRY_GC_MARK_STACK_SIZE))
     {
-      JERRY_CONTEXT (ecma_gc_mark_recursion_limit)--;
       /* Set the reference count of gray object to 0 */
       object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
-      ecma_gc_mark (object_p);
-      JERRY_CONTEXT (ecma_gc_mark_recursion_limit)++;
+      ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_mark_stack)[JERRY_CONTEXT (ecma_gc_mark_stack_top)],
+                                 object_p);
+      JERRY_CONTEXT (ecma_gc_mark_stack_top)++;
+      return;
     }
-    else
+
+    JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = true;
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+    if (JERRY_CONTEXT (ecma_gc_incremental) || JERRY_CONTEXT (ecma_gc_minor))
+#else /* !ENABLED (JERRY_GC_GENERATIONAL) */
+    if (JERRY_CONTEXT (ecma_gc_incremental))
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
     {
-      /* Set the reference count of the non-marked gray object to 1 */
-      object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & ((ECMA_OBJECT_REF_ONE << 1) - 1));
-      JERRY_ASSERT (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE);
+      /* The reference counter can be changed by the application between the steps,
+       * and the young objects with references are not separated from the other
+       * young objects, so all gray objects are marked again during the rescan. */
+      object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
+      return;
     }
-#else /* (JERRY_GC_MARK_LIMIT == 0) */
-    /* Set the reference count of gray object to 0 */
-    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+
+    /* Set the reference count of the non-marked gray object to 1 */
+    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & ((ECMA_OBJECT_REF_ONE << 1) - 1));
+    JERRY_ASSERT (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE);
   }
 } /* ecma_gc_set_object_visited */
 
@@ -123,6 +157,47 @@ ecma_init_gc_info (ecma_object_t *object_p) /**< object */
   ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_objects_cp), object_p);
 } /* ecma_init_gc_info */
 
+#if ENABLED (JERRY_GC_GENERATIONAL)
+
+/**
+ * Add an object to the remembered set.
+ *
+ * Note:
+ *   when the remembered set is full, the next collection is a major collection
+ */
+static void
+ecma_gc_add_remembered_object (ecma_object_t *object_p) /**< old object */
+{
+  uint32_t count = JERRY_CONTEXT (ecma_gc_remembered_count);
+
+  if (JERRY_UNLIKELY (count >= CONFIG_ECMA_GC_REMEMBERED_SET_SIZE))
+  {
+    JERRY_CONTEXT (ecma_gc_major_pending) = true;
+    return;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_remembered_set)[count], object_p);
+  JERRY_CONTEXT (ecma_gc_remembered_count) = count + 1;
+} /* ecma_gc_add_remembered_object */
+
+/**
+ * Add an old object to the remembered set, if it is not in the set yet.
+ *
+ * Must be called before a reference is stored into an object without
+ * using ecma_gc_write_barrier (e.g. when a new property is created).
+ */
+inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_remember_object (ecma_object_t *object_p) /**< object */
+{
+  if (JERRY_UNLIKELY ((object_p->type_flags_refs & ECMA_OBJECT_REF_MASK) == ECMA_OBJECT_UNREMEMBERED))
+  {
+    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
+    ecma_gc_add_remembered_object (object_p);
+  }
+} /* ecma_gc_remember_object */
+
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
 /**
  * Increase reference counter of an object
  */
@@ -133,6 +208,22 @@ ecma_ref_object (ecma_object_t *object_p) /**< object */
   {
     object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs + ECMA_OBJECT_REF_ONE);
   }
+  else if (object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED)
+  {
+    /* White object during an incremental GC cycle: it becomes a root, so it must be marked. */
+    JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_incremental));
+
+    ecma_gc_set_object_visited (object_p);
+    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs + ECMA_OBJECT_REF_ONE);
+  }
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  else if (object_p->type_flags_refs >= ECMA_OBJECT_UNREMEMBERED)
+  {
+    /* Referenced objects can be modified without a write barrier. */
+    ecma_gc_remember_object (object_p);
+    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs + ECMA_OBJECT_REF_ONE);
+  }
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
   else
   {
     jerry_fatal (ERR_REF_COUNT_LIMIT);
@@ -149,6 +240,33 @@ ecma_deref_object (ecma_object_t *object_p) /**< object */
   object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs - ECMA_OBJECT_REF_ONE);
 } /* ecma_deref_object */
 
+/**
+ * Write barrier of the incremental and generational garbage collectors.
+ *
+ * Must be called when a value is stored into an object, so an object
+ * stored into an already marked object cannot remain unmarked, and
+ * the old objects which reference young objects are remembered.
+ */
+inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_write_barrier (ecma_object_t *object_p, /**< object */
+                       ecma_value_t value) /**< stored value */
+{
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  if (ecma_is_value_object (value))
+  {
+    ecma_gc_remember_object (object_p);
+  }
+#else /* !ENABLED (JERRY_GC_GENERATIONAL) */
+  JERRY_UNUSED (object_p);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (ecma_gc_incremental))
+      && ecma_is_value_object (value))
+  {
+    ecma_gc_set_object_visited (ecma_get_object_from_value (value));
+  }
+} /* ecma_gc_write_barrier */
+
 /**
  * Mark objects referenced by arguments object
  */
@@ -605,6 +723,10 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (ecma_gc_is_object_visited (object_p));
 
+#if ENABLED (JERRY_MEM_STATS)
+  JERRY_CONTEXT (ecma_gc_stats).objects_scanned++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
   if (ecma_is_lexical_environment (object_p))
   {
     jmem_cpointer_t outer_lex_env_cp = object_p->u2.outer_reference_cp;
@@ -904,6 +1026,24 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
 
   jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, prop_iter_cp);
+    ecma_property_value_t *property_values_p = ECMA_SHAPE_GET_VALUES (values_p);
+    uint32_t property_count = ECMA_SHAPE_GET_SHAPE (values_p)->property_count;
+
+    for (uint32_t i = 0; i < property_count; i++)
+    {
+      if (ecma_is_value_object (property_values_p[i].value))
+      {
+        ecma_gc_set_object_visited (ecma_get_object_from_value (property_values_p[i].value));
+      }
+    }
+    return;
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
   if (prop_iter_cp != JMEM_CP_NULL)
   {
@@ -926,6 +1066,27 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
   }
 } /* ecma_gc_mark */
 
+/**
+ * Mark the references of the objects on the mark stack until the stack is empty
+ * or the budget is exhausted.
+ *
+ * @return remaining budget
+ */
+static uint32_t
+ecma_gc_mark_stacked_objects (uint32_t budget) /**< maximum number of objects to mark */
+{
+  while (JERRY_CONTEXT (ecma_gc_mark_stack_top) > 0 && budget > 0)
+  {
+    JERRY_CONTEXT (ecma_gc_mark_stack_top)--;
+
+    jmem_cpointer_t object_cp = JERRY_CONTEXT (ecma_gc_mark_stack)[JERRY_CONTEXT (ecma_gc_mark_stack_top)];
+    ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, object_cp));
+    budget--;
+  }
+
+  return budget;
+} /* ecma_gc_mark_stacked_objects */
+
 /**
  * Free the native handle/pointer by calling its free callback.
  */
@@ -1146,6 +1307,14 @@ ecma_gc_free_executable_object (ecma_object_t *object_p) /**< object */
 void
 ecma_gc_free_properties (ecma_object_t *object_p) /**< object */
 {
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    ecma_shape_free_values (object_p);
+    return;
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
   jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
 
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
@@ -1257,6 +1426,14 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
   JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_objects_number) > 0);
   JERRY_CONTEXT (ecma_gc_objects_number)--;
 
+#if ENABLED (JERRY_LINE_INFO)
+  if (JERRY_UNLIKELY (object_p == JERRY_CONTEXT (vm_backtrace_error_p)))
+  {
+    /* The error is caught before it reaches an error completion. */
+    JERRY_CONTEXT (vm_backtrace_error_p) = NULL;
+  }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
   if (ecma_is_lexical_environment (object_p))
   {
     if (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
@@ -1617,44 +1794,165 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
 } /* ecma_gc_free_object */
 
 /**
- * Run garbage collection, freeing objects that are no longer referenced.
+ * Append an object to the end of the black object list.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_append_black_object (ecma_object_t *object_p, /**< object */
+                             jmem_cpointer_t object_cp) /**< compressed pointer of the object */
+{
+  object_p->gc_next_cp = JMEM_CP_NULL;
+
+  if (JERRY_CONTEXT (ecma_gc_black_end_cp) == JMEM_CP_NULL)
+  {
+    JERRY_CONTEXT (ecma_gc_black_cp) = object_cp;
+  }
+  else
+  {
+    ecma_object_t *black_end_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_black_end_cp));
+    black_end_p->gc_next_cp = object_cp;
+  }
+
+  JERRY_CONTEXT (ecma_gc_black_end_cp) = object_cp;
+} /* ecma_gc_append_black_object */
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+
+/**
+ * Concatenate two object lists.
+ *
+ * @return the concatenated list
+ */
+static jmem_cpointer_t
+ecma_gc_concat_object_lists (jmem_cpointer_t first_cp, /**< first list */
+                             jmem_cpointer_t second_cp) /**< second list */
+{
+  if (first_cp == JMEM_CP_NULL)
+  {
+    return second_cp;
+  }
+
+  ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, first_cp);
+
+  while (obj_iter_p->gc_next_cp != JMEM_CP_NULL)
+  {
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_p->gc_next_cp);
+  }
+
+  obj_iter_p->gc_next_cp = second_cp;
+  return first_cp;
+} /* ecma_gc_concat_object_lists */
+
+/**
+ * Move the objects of all generations to the list of alive objects.
+ *
+ * Note:
+ *   the next collection must be a major collection
  */
 void
-ecma_gc_run (void)
+ecma_gc_merge_generations (void)
 {
-#if (JERRY_GC_MARK_LIMIT != 0)
-  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) == JERRY_GC_MARK_LIMIT);
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+  /* The young lists are short, so they are moved in front of the old list. */
+  jmem_cpointer_t objects_cp = JERRY_CONTEXT (ecma_gc_old_cp);
 
-  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+  for (uint32_t age = JERRY_GC_PROMOTION_AGE; age > 0; age--)
+  {
+    objects_cp = ecma_gc_concat_object_lists (JERRY_CONTEXT (ecma_gc_young_cp)[age - 1], objects_cp);
+    JERRY_CONTEXT (ecma_gc_young_cp)[age - 1] = JMEM_CP_NULL;
+  }
+
+  JERRY_CONTEXT (ecma_gc_objects_cp) = ecma_gc_concat_object_lists (JERRY_CONTEXT (ecma_gc_objects_cp), objects_cp);
+  JERRY_CONTEXT (ecma_gc_old_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_old_objects) = 0;
+  JERRY_CONTEXT (ecma_gc_remembered_count) = 0;
+  JERRY_CONTEXT (ecma_gc_major_pending) = true;
+} /* ecma_gc_merge_generations */
+
+/**
+ * Promote the objects surviving a major collection to the old generation.
+ */
+static void
+ecma_gc_promote_all_objects (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_old_cp) == JMEM_CP_NULL);
+
+  JERRY_CONTEXT (ecma_gc_remembered_count) = 0;
+  JERRY_CONTEXT (ecma_gc_major_pending) = false;
+
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+  size_t old_objects = 0;
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+    if (obj_iter_p->type_flags_refs < ECMA_OBJECT_REF_ONE)
+    {
+      obj_iter_p->type_flags_refs |= ECMA_OBJECT_UNREMEMBERED;
+    }
+    else
+    {
+      /* Referenced objects can be modified without a write barrier. */
+      ecma_gc_add_remembered_object (obj_iter_p);
+    }
+
+    old_objects++;
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+  JERRY_CONTEXT (ecma_gc_old_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
+  JERRY_CONTEXT (ecma_gc_objects_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_old_objects) = old_objects;
+
+  /* The next major collection is performed when the old generation is doubled. */
+  JERRY_CONTEXT (ecma_gc_old_limit) = old_objects * 2;
+} /* ecma_gc_promote_all_objects */
 
-  ecma_object_t black_list_head;
-  black_list_head.gc_next_cp = JMEM_CP_NULL;
-  ecma_object_t *black_end_p = &black_list_head;
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+/**
+ * Start a new GC cycle: root objects (i.e. they have global or stack references) are moved
+ * to the black list, and all other objects are moved to the white-gray list.
+ */
+static void
+ecma_gc_start_cycle (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_stack_top) == 0);
+
+#if ENABLED (JERRY_MEM_STATS)
+  JERRY_CONTEXT (ecma_gc_stats).objects_scanned = 0;
+  JERRY_CONTEXT (ecma_gc_stats).mark_passes = 0;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = false;
+  JERRY_CONTEXT (ecma_gc_rescan_active) = false;
+  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+  JERRY_CONTEXT (ecma_gc_black_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_black_end_cp) = JMEM_CP_NULL;
 
   ecma_object_t white_gray_list_head;
   white_gray_list_head.gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   ecma_object_t *obj_prev_p = &white_gray_list_head;
   jmem_cpointer_t obj_iter_cp = obj_prev_p->gc_next_cp;
-  ecma_object_t *obj_iter_p;
 
-  /* Move root objects (i.e. they have global or stack references) to the black list. */
   while (obj_iter_cp != JMEM_CP_NULL)
   {
-    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
     const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
 
     JERRY_ASSERT (obj_prev_p == NULL
                   || ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_prev_p->gc_next_cp) == obj_iter_p);
 
+#if ENABLED (JERRY_GC_GENERATIONAL)
+    if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE
+        && obj_iter_p->type_flags_refs < ECMA_OBJECT_UNREMEMBERED)
+#else /* !ENABLED (JERRY_GC_GENERATIONAL) */
     if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
     {
       /* Moving the object to list of marked objects. */
       obj_prev_p->gc_next_cp = obj_next_cp;
-
-      black_end_p->gc_next_cp = obj_iter_cp;
-      black_end_p = obj_iter_p;
+      ecma_gc_append_black_object (obj_iter_p, obj_iter_cp);
     }
     else
     {
@@ -1665,92 +1963,573 @@ ecma_gc_run (void)
     obj_iter_cp = obj_next_cp;
   }
 
-  black_end_p->gc_next_cp = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_white_gray_cp) = white_gray_list_head.gc_next_cp;
+  JERRY_CONTEXT (ecma_gc_root_cursor_cp) = JERRY_CONTEXT (ecma_gc_black_cp);
+
+  /* Objects created during the cycle are collected in this list. */
+  JERRY_CONTEXT (ecma_gc_objects_cp) = JMEM_CP_NULL;
+} /* ecma_gc_start_cycle */
+
+/**
+ * Continue rescanning the white-gray list: the gray objects are moved to the black list
+ * and marked if they have not been marked yet.
+ *
+ * @return remaining budget
+ */
+static uint32_t
+ecma_gc_rescan_white_gray_list (uint32_t budget) /**< maximum number of objects to mark */
+{
+  jmem_cpointer_t obj_prev_cp = JERRY_CONTEXT (ecma_gc_rescan_prev_cp);
+
+  while (budget > 0)
+  {
+    ecma_object_t *obj_prev_p = NULL;
+    jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_white_gray_cp);
+
+    if (obj_prev_cp != JMEM_CP_NULL)
+    {
+      obj_prev_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_prev_cp);
+      obj_iter_cp = obj_prev_p->gc_next_cp;
+    }
+
+    if (obj_iter_cp == JMEM_CP_NULL)
+    {
+      JERRY_CONTEXT (ecma_gc_rescan_active) = false;
+      break;
+    }
+
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+    if (!ecma_gc_is_object_visited (obj_iter_p))
+    {
+      obj_prev_cp = obj_iter_cp;
+      continue;
+    }
+
+    if (obj_prev_p == NULL)
+    {
+      JERRY_CONTEXT (ecma_gc_white_gray_cp) = obj_iter_p->gc_next_cp;
+    }
+    else
+    {
+      obj_prev_p->gc_next_cp = obj_iter_p->gc_next_cp;
+    }
+
+    ecma_gc_append_black_object (obj_iter_p, obj_iter_cp);
+
+    if (JERRY_CONTEXT (ecma_gc_incremental) || obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+    {
+      /* Set the reference count of non-marked gray object to 0 */
+      if (!JERRY_CONTEXT (ecma_gc_incremental))
+      {
+        obj_iter_p->type_flags_refs = (uint16_t) (obj_iter_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
+      }
+
+      ecma_gc_mark (obj_iter_p);
+      budget = ecma_gc_mark_stacked_objects (budget - 1);
+    }
+  }
+
+  JERRY_CONTEXT (ecma_gc_rescan_prev_cp) = obj_prev_cp;
+  return budget;
+} /* ecma_gc_rescan_white_gray_list */
+
+/**
+ * Mark objects of the current GC cycle until all reachable objects are marked
+ * or the budget is exhausted.
+ *
+ * Note:
+ *   each object is marked once, except during incremental cycles where the gray objects
+ *   which did not fit onto the mark stack are found by marking all gray objects again.
+ *
+ * @return true - if the marking is finished
+ *         false - otherwise
+ */
+static bool
+ecma_gc_mark_objects (uint32_t budget) /**< maximum number of objects to mark */
+{
+  budget = ecma_gc_mark_stacked_objects (budget);
 
   /* Mark root objects. */
-  obj_iter_cp = black_list_head.gc_next_cp;
+  while (JERRY_CONTEXT (ecma_gc_root_cursor_cp) != JMEM_CP_NULL && budget > 0)
+  {
+    ecma_object_t *root_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_root_cursor_cp));
+    JERRY_CONTEXT (ecma_gc_root_cursor_cp) = root_p->gc_next_cp;
+
+    ecma_gc_mark (root_p);
+    budget = ecma_gc_mark_stacked_objects (budget - 1);
+  }
+
+  /* Mark the gray objects which did not fit onto the mark stack. */
+  while (budget > 0)
+  {
+    if (!JERRY_CONTEXT (ecma_gc_rescan_active))
+    {
+      if (!JERRY_CONTEXT (ecma_gc_mark_stack_overflow))
+      {
+        break;
+      }
+
+      JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = false;
+      JERRY_CONTEXT (ecma_gc_rescan_active) = true;
+      JERRY_CONTEXT (ecma_gc_rescan_prev_cp) = JMEM_CP_NULL;
+
+#if ENABLED (JERRY_MEM_STATS)
+      JERRY_CONTEXT (ecma_gc_stats).mark_passes++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+    }
+
+    budget = ecma_gc_rescan_white_gray_list (budget);
+  }
+
+  return (JERRY_CONTEXT (ecma_gc_mark_stack_top) == 0
+          && JERRY_CONTEXT (ecma_gc_root_cursor_cp) == JMEM_CP_NULL
+          && !JERRY_CONTEXT (ecma_gc_rescan_active)
+          && !JERRY_CONTEXT (ecma_gc_mark_stack_overflow));
+} /* ecma_gc_mark_objects */
+
+/**
+ * Finish the current GC cycle: free the unmarked objects.
+ */
+static void
+ecma_gc_finish_cycle (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_stack_top) == 0);
+
+  /* Objects created during an incremental cycle are kept. */
+  jmem_cpointer_t new_objects_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  ecma_object_t white_gray_list_head;
+  white_gray_list_head.gc_next_cp = JERRY_CONTEXT (ecma_gc_white_gray_cp);
+
+  ecma_object_t *obj_prev_p = &white_gray_list_head;
+  jmem_cpointer_t obj_iter_cp = obj_prev_p->gc_next_cp;
+  ecma_object_t *obj_iter_p;
+
+  /* Move the marked objects to the black list. */
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+
+    JERRY_ASSERT (obj_prev_p == NULL
+                  || ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_prev_p->gc_next_cp) == obj_iter_p);
+
+    if (ecma_gc_is_object_visited (obj_iter_p))
+    {
+      JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_incremental) || obj_iter_p->type_flags_refs < ECMA_OBJECT_REF_ONE);
+
+      obj_prev_p->gc_next_cp = obj_next_cp;
+      ecma_gc_append_black_object (obj_iter_p, obj_iter_cp);
+    }
+    else
+    {
+      obj_prev_p = obj_iter_p;
+    }
+
+    obj_iter_cp = obj_next_cp;
+  }
+
+  if (JERRY_CONTEXT (ecma_gc_black_end_cp) == JMEM_CP_NULL)
+  {
+    JERRY_CONTEXT (ecma_gc_objects_cp) = new_objects_cp;
+  }
+  else
+  {
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_black_end_cp));
+    obj_iter_p->gc_next_cp = new_objects_cp;
+    JERRY_CONTEXT (ecma_gc_objects_cp) = JERRY_CONTEXT (ecma_gc_black_cp);
+  }
+
+  JERRY_CONTEXT (ecma_gc_black_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_black_end_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_white_gray_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_incremental) = false;
+
+  /* Sweep objects that are currently unmarked. */
+  obj_iter_cp = white_gray_list_head.gc_next_cp;
+
   while (obj_iter_cp != JMEM_CP_NULL)
   {
     obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
-    ecma_gc_mark (obj_iter_p);
+    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+
+    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+
+    ecma_gc_free_object (obj_iter_p);
+    obj_iter_cp = obj_next_cp;
+  }
+
+#if ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0
+  ecma_lcache_proto_invalidate_all ();
+#endif /* ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
+
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+  vm_inline_cache_invalidate_all ();
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  ecma_gc_promote_all_objects ();
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+} /* ecma_gc_finish_cycle */
+
+/**
+ * Abandon the current incremental GC cycle (if any) without freeing any objects.
+ */
+void
+ecma_gc_cancel_incremental (void)
+{
+  if (!JERRY_CONTEXT (ecma_gc_incremental))
+  {
+    return;
+  }
+
+  JERRY_CONTEXT (ecma_gc_mark_stack_top) = 0;
+  JERRY_CONTEXT (ecma_gc_incremental) = false;
+
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_white_gray_cp);
+  ecma_object_t *obj_iter_p = NULL;
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+    if (!ecma_gc_is_object_visited (obj_iter_p))
+    {
+      /* Unmarked objects have no references. */
+      obj_iter_p->type_flags_refs = (uint16_t) (obj_iter_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
+    }
+
     obj_iter_cp = obj_iter_p->gc_next_cp;
   }
 
-  /* Mark non-root objects. */
-  bool marked_anything_during_current_iteration;
+  /* The list of all objects is restored from the new, the black and the white-gray lists. */
+  if (obj_iter_p != NULL)
+  {
+    obj_iter_p->gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+    JERRY_CONTEXT (ecma_gc_objects_cp) = JERRY_CONTEXT (ecma_gc_white_gray_cp);
+  }
 
-  do
+  if (JERRY_CONTEXT (ecma_gc_black_end_cp) != JMEM_CP_NULL)
   {
-#if (JERRY_GC_MARK_LIMIT != 0)
-    JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) == JERRY_GC_MARK_LIMIT);
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_black_end_cp));
+    obj_iter_p->gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+    JERRY_CONTEXT (ecma_gc_objects_cp) = JERRY_CONTEXT (ecma_gc_black_cp);
+  }
 
-    marked_anything_during_current_iteration = false;
+  JERRY_CONTEXT (ecma_gc_black_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_black_end_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_white_gray_cp) = JMEM_CP_NULL;
+} /* ecma_gc_cancel_incremental */
 
-    obj_prev_p = &white_gray_list_head;
-    obj_iter_cp = obj_prev_p->gc_next_cp;
+#if ENABLED (JERRY_MEM_STATS)
+
+/**
+ * Update the pause time statistics of the garbage collector.
+ */
+static void
+ecma_gc_update_time_stats (double start_time) /**< start time of the pause in milliseconds */
+{
+  double elapsed_us = (jerry_port_get_current_time () - start_time) * 1000.0;
+  size_t time_us = (elapsed_us > 0) ? (size_t) elapsed_us : 0;
+
+  JERRY_CONTEXT (ecma_gc_stats).time_us = time_us;
+
+  if (time_us > JERRY_CONTEXT (ecma_gc_stats).max_time_us)
+  {
+    JERRY_CONTEXT (ecma_gc_stats).max_time_us = time_us;
+  }
+} /* ecma_gc_update_time_stats */
+
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+
+/**
+ * Remove the objects without references from the remembered set.
+ *
+ * Note:
+ *   must be called when there are no young objects, since the removed
+ *   objects must not reference young objects
+ */
+static void
+ecma_gc_clear_remembered_set (void)
+{
+  jmem_cpointer_t *remembered_set_p = JERRY_CONTEXT (ecma_gc_remembered_set);
+  uint32_t count = JERRY_CONTEXT (ecma_gc_remembered_count);
+  uint32_t new_count = 0;
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    ecma_object_t *object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, remembered_set_p[i]);
+
+    if (object_p->type_flags_refs < ECMA_OBJECT_REF_ONE)
+    {
+      object_p->type_flags_refs |= ECMA_OBJECT_UNREMEMBERED;
+    }
+    else
+    {
+      /* Referenced objects can be modified without a write barrier. */
+      remembered_set_p[new_count++] = remembered_set_p[i];
+    }
+  }
+
+  JERRY_CONTEXT (ecma_gc_remembered_count) = new_count;
+} /* ecma_gc_clear_remembered_set */
+
+/**
+ * Mark the references of the young objects.
+ */
+static void
+ecma_gc_mark_young_objects (bool mark_all) /**< true - mark all visited young objects,
+                                            *   false - mark young objects with references */
+{
+  for (uint32_t age = 0; age < JERRY_GC_PROMOTION_AGE; age++)
+  {
+    jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_young_cp)[age];
 
     while (obj_iter_cp != JMEM_CP_NULL)
     {
-      obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
-      const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+      ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
 
-      JERRY_ASSERT (obj_prev_p == NULL
-                    || ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_prev_p->gc_next_cp) == obj_iter_p);
+      if (ecma_gc_is_object_visited (obj_iter_p)
+          && (mark_all || obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE))
+      {
+        ecma_gc_mark (obj_iter_p);
+        ecma_gc_mark_stacked_objects (UINT32_MAX);
+      }
 
-      if (ecma_gc_is_object_visited (obj_iter_p))
+      obj_iter_cp = obj_iter_p->gc_next_cp;
+    }
+  }
+} /* ecma_gc_mark_young_objects */
+
+/**
+ * Run a minor garbage collection, freeing the young objects that are no longer referenced.
+ */
+static void
+ecma_gc_run_minor (void)
+{
+  JERRY_ASSERT (!JERRY_CONTEXT (ecma_gc_incremental) && !JERRY_CONTEXT (ecma_gc_major_pending));
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_stack_top) == 0);
+
+#if ENABLED (JERRY_MEM_STATS)
+  double start_time = jerry_port_get_current_time ();
+  JERRY_CONTEXT (ecma_gc_stats).objects_scanned = 0;
+  JERRY_CONTEXT (ecma_gc_stats).mark_passes = 0;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  /* The newly allocated objects have not survived any minor collections. */
+  JERRY_CONTEXT (ecma_gc_young_cp)[0] = JERRY_CONTEXT (ecma_gc_objects_cp);
+  JERRY_CONTEXT (ecma_gc_objects_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+  JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = false;
+  JERRY_CONTEXT (ecma_gc_minor) = true;
+
+  for (uint32_t age = 0; age < JERRY_GC_PROMOTION_AGE; age++)
+  {
+    jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_young_cp)[age];
+
+    while (obj_iter_cp != JMEM_CP_NULL)
+    {
+      ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+      JERRY_ASSERT (obj_iter_p->type_flags_refs < ECMA_OBJECT_UNREMEMBERED);
+
+      if (obj_iter_p->type_flags_refs < ECMA_OBJECT_REF_ONE)
       {
-        /* Moving the object to list of marked objects */
-        obj_prev_p->gc_next_cp = obj_next_cp;
+        obj_iter_p->type_flags_refs |= ECMA_OBJECT_NON_VISITED;
+      }
 
-        black_end_p->gc_next_cp = obj_iter_cp;
-        black_end_p = obj_iter_p;
+      obj_iter_cp = obj_iter_p->gc_next_cp;
+    }
+  }
+
+  /* The old objects are not marked: their references to young objects
+   * are found by marking the objects of the remembered set. */
+  for (uint32_t i = 0; i < JERRY_CONTEXT (ecma_gc_remembered_count); i++)
+  {
+    ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_remembered_set)[i]));
+    ecma_gc_mark_stacked_objects (UINT32_MAX);
+  }
+
+  ecma_gc_mark_young_objects (false);
+
+  while (JERRY_CONTEXT (ecma_gc_mark_stack_overflow))
+  {
+    JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = false;
+
+#if ENABLED (JERRY_MEM_STATS)
+    JERRY_CONTEXT (ecma_gc_stats).mark_passes++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+    ecma_gc_mark_young_objects (true);
+  }
+
+  JERRY_CONTEXT (ecma_gc_minor) = false;
+
+  uint32_t promotion_age = JERRY_GC_PROMOTION_AGE;
+  uint32_t promoted_objects = 0;
+  jmem_cpointer_t promoted_cp = JMEM_CP_NULL;
+  ecma_object_t *promoted_last_p = NULL;
+  bool has_young_objects = false;
+
+  /* Sweep the young objects starting from the oldest ones, so the
+   * surviving objects can be moved to the next list immediately. */
+  for (uint32_t age = JERRY_GC_PROMOTION_AGE; age > 0; age--)
+  {
+    if (JERRY_CONTEXT (ecma_gc_remembered_count) + promoted_objects >= CONFIG_ECMA_GC_REMEMBERED_SET_SIZE / 2)
+    {
+      /* All young objects are promoted, so the remembered set can be cleared before it is full. */
+      promotion_age = 1;
+    }
 
-#if (JERRY_GC_MARK_LIMIT != 0)
-        if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+    jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_young_cp)[age - 1];
+    JERRY_CONTEXT (ecma_gc_young_cp)[age - 1] = JMEM_CP_NULL;
+
+    while (obj_iter_cp != JMEM_CP_NULL)
+    {
+      ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+      const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+
+      if (!ecma_gc_is_object_visited (obj_iter_p))
+      {
+        ecma_gc_free_object (obj_iter_p);
+      }
+      else if (age >= promotion_age)
+      {
+        if (promoted_last_p == NULL)
         {
-          /* Set the reference count of non-marked gray object to 0 */
-          obj_iter_p->type_flags_refs = (uint16_t) (obj_iter_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
-          ecma_gc_mark (obj_iter_p);
-          marked_anything_during_current_iteration = true;
+          promoted_last_p = obj_iter_p;
         }
-#else /* (JERRY_GC_MARK_LIMIT == 0) */
-        marked_anything_during_current_iteration = true;
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+
+        obj_iter_p->gc_next_cp = promoted_cp;
+        promoted_cp = obj_iter_cp;
+        promoted_objects++;
       }
       else
       {
-        obj_prev_p = obj_iter_p;
+        obj_iter_p->gc_next_cp = JERRY_CONTEXT (ecma_gc_young_cp)[age];
+        JERRY_CONTEXT (ecma_gc_young_cp)[age] = obj_iter_cp;
+        has_young_objects = true;
       }
 
       obj_iter_cp = obj_next_cp;
     }
   }
-  while (marked_anything_during_current_iteration);
 
-  black_end_p->gc_next_cp = JMEM_CP_NULL;
-  JERRY_CONTEXT (ecma_gc_objects_cp) = black_list_head.gc_next_cp;
+#if ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0
+  ecma_lcache_proto_invalidate_all ();
+#endif /* ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
 
-  /* Sweep objects that are currently unmarked. */
-  obj_iter_cp = white_gray_list_head.gc_next_cp;
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+  vm_inline_cache_invalidate_all ();
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
 
-  while (obj_iter_cp != JMEM_CP_NULL)
+  if (!has_young_objects)
   {
-    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
-    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+    ecma_gc_clear_remembered_set ();
+  }
 
-    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+  if (promoted_last_p != NULL)
+  {
+    jmem_cpointer_t obj_iter_cp = promoted_cp;
 
-    ecma_gc_free_object (obj_iter_p);
-    obj_iter_cp = obj_next_cp;
+    while (obj_iter_cp != JMEM_CP_NULL)
+    {
+      ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+      if (!has_young_objects && obj_iter_p->type_flags_refs < ECMA_OBJECT_REF_ONE)
+      {
+        obj_iter_p->type_flags_refs |= ECMA_OBJECT_UNREMEMBERED;
+      }
+      else
+      {
+        /* The promoted object may reference young objects. */
+        ecma_gc_add_remembered_object (obj_iter_p);
+      }
+
+      obj_iter_cp = obj_iter_p->gc_next_cp;
+    }
+
+    promoted_last_p->gc_next_cp = JERRY_CONTEXT (ecma_gc_old_cp);
+    JERRY_CONTEXT (ecma_gc_old_cp) = promoted_cp;
+    JERRY_CONTEXT (ecma_gc_old_objects) += promoted_objects;
   }
 
-#if ENABLED (JERRY_BUILTIN_REGEXP)
-  /* Free RegExp bytecodes stored in cache */
-  re_cache_gc ();
-#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+#if ENABLED (JERRY_MEM_STATS)
+  ecma_gc_update_time_stats (start_time);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+} /* ecma_gc_run_minor */
+
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+/**
+ * Run garbage collection, freeing objects that are no longer referenced.
+ *
+ * Note:
+ *   an incremental GC cycle in progress is abandoned, and a full cycle is performed instead
+ */
+void
+ecma_gc_run (void)
+{
+#if ENABLED (JERRY_MEM_STATS)
+  double start_time = jerry_port_get_current_time ();
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  ecma_gc_cancel_incremental ();
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  ecma_gc_merge_generations ();
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+  ecma_gc_start_cycle ();
+
+  bool is_finished = ecma_gc_mark_objects (UINT32_MAX);
+  JERRY_ASSERT (is_finished);
+  JERRY_UNUSED (is_finished);
+
+  ecma_gc_finish_cycle ();
+
+#if ENABLED (JERRY_MEM_STATS)
+  ecma_gc_update_time_stats (start_time);
+#endif /* ENABLED (JERRY_MEM_STATS) */
 } /* ecma_gc_run */
 
+/**
+ * Perform a step of an incremental GC cycle. A new cycle is started if no cycle is in progress.
+ *
+ * @return true - if the cycle is finished by this step
+ *         false - otherwise
+ */
+bool
+ecma_gc_step (uint32_t budget) /**< maximum number of objects to mark */
+{
+#if ENABLED (JERRY_MEM_STATS)
+  double start_time = jerry_port_get_current_time ();
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  if (!JERRY_CONTEXT (ecma_gc_incremental))
+  {
+#if ENABLED (JERRY_GC_GENERATIONAL)
+    ecma_gc_merge_generations ();
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+    ecma_gc_start_cycle ();
+    JERRY_CONTEXT (ecma_gc_incremental) = true;
+  }
+
+  bool is_finished = ecma_gc_mark_objects (budget);
+
+  if (is_finished)
+  {
+    ecma_gc_finish_cycle ();
+  }
+
+#if ENABLED (JERRY_MEM_STATS)
+  ecma_gc_update_time_stats (start_time);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  return is_finished;
+} /* ecma_gc_step */
+
 /**
  * Try to free some memory (depending on memory pressure).
  *
@@ -1782,10 +2561,38 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
      * Otherwise, probability to free sufficient space is considered to be low.
      */
     size_t new_objects_fraction = CONFIG_ECMA_GC_NEW_OBJECTS_FRACTION;
+    bool run_gc = (JERRY_CONTEXT (ecma_gc_new_objects) * new_objects_fraction
+                   > JERRY_CONTEXT (ecma_gc_objects_number));
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+    if (!JERRY_CONTEXT (ecma_gc_incremental))
+    {
+      if (!JERRY_CONTEXT (ecma_gc_major_pending)
+          && JERRY_CONTEXT (ecma_gc_old_objects) <= JERRY_CONTEXT (ecma_gc_old_limit))
+      {
+        /* Only the young objects are collected until the old generation grows too large. */
+        if (JERRY_CONTEXT (ecma_gc_new_objects) > 0)
+        {
+          ecma_gc_run_minor ();
+        }
+        return;
+      }
+
+      run_gc = true;
+    }
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
 
-    if (JERRY_CONTEXT (ecma_gc_new_objects) * new_objects_fraction > JERRY_CONTEXT (ecma_gc_objects_number))
+    if (run_gc)
     {
-      ecma_gc_run ();
+      if (JERRY_CONTEXT (ecma_gc_incremental))
+      {
+        /* Finish the incremental cycle instead of starting a new one. */
+        ecma_gc_step (UINT32_MAX);
+      }
+      else
+      {
+        ecma_gc_run ();
+      }
     }
 
     return;
@@ -1805,11 +2612,26 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
     }
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+    /* Free RegExp bytecodes stored in cache */
+    re_cache_gc ();
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+    /* Free the cached frame stack segment */
+    vm_free_unused_frame_segments ();
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
+
     ecma_gc_run ();
 
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
     /* Free hashmaps of remaining objects. */
+#if ENABLED (JERRY_GC_GENERATIONAL)
+    /* The remaining objects are promoted to the old generation. */
+    jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_old_cp);
+#else /* !ENABLED (JERRY_GC_GENERATIONAL) */
     jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
 
     while (obj_iter_cp != JMEM_CP_NULL)
     {
@@ -29,8 +29,15 @@
 void ecma_init_gc_info (ecma_object_t *object_p);
 void ecma_ref_object (ecma_object_t *object_p);
 void ecma_deref_object (ecma_object_t *object_p);
+void ecma_gc_write_barrier (ecma_object_t *object_p, ecma_value_t value);
 void ecma_gc_free_properties (ecma_object_t *object_p);
 void ecma_gc_run (void);
+bool ecma_gc_step (uint32_t budget);
+void ecma_gc_cancel_incremental (void);
+#if ENABLED (JERRY_GC_GENERATIONAL)
+void ecma_gc_remember_object (ecma_object_t *object_p);
+void ecma_gc_merge_generations (void);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
 void ecma_free_unused_memory (jmem_pressure_t pressure);
 
 /**
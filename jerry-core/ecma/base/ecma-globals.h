@@ -123,6 +123,7 @@ typedef enum
 
   ECMA_PARSE_GENERATOR_FUNCTION = (1u << 10), /**< generator function is parsed */
   ECMA_PARSE_ASYNC_FUNCTION = (1u << 11), /**< async function is parsed */
+  ECMA_PARSE_LAZY_FUNCTIONS = (1u << 13), /**< the byte code of simple functions is generated on their first call */
 
   /* These flags are internally used by the parser. */
 #if ENABLED (JERRY_ESNEXT)
@@ -490,6 +491,10 @@ typedef enum
    * ECMA_PROPERTY_IS_PROPERTY_PAIR must be updated as well. */
   ECMA_SPECIAL_PROPERTY_HASHMAP, /**< hashmap property */
   ECMA_SPECIAL_PROPERTY_DELETED, /**< deleted property */
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  ECMA_SPECIAL_PROPERTY_SHAPE, /**< property values of an object with a shape,
+                                *   never part of a property pair list */
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
 
   ECMA_SPECIAL_PROPERTY__COUNT /**< Number of special property types */
 } ecma_special_property_id_t;
@@ -510,6 +515,15 @@ typedef enum
  */
 #define ECMA_PROPERTY_TYPE_HASHMAP ECMA_SPECIAL_PROPERTY_VALUE (ECMA_SPECIAL_PROPERTY_HASHMAP)
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+
+/**
+ * Type of the property values of an object with a shape.
+ */
+#define ECMA_PROPERTY_TYPE_SHAPE ECMA_SPECIAL_PROPERTY_VALUE (ECMA_SPECIAL_PROPERTY_SHAPE)
+
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
 /**
  * Type of property not found.
  */
@@ -807,11 +821,27 @@ typedef enum
  */
 #define ECMA_OBJECT_NON_VISITED (0x3ffu << ECMA_OBJECT_REF_SHIFT)
 
+#if ENABLED (JERRY_GC_GENERATIONAL)
+
+/**
+ * Represents an old object without references, which is not in the remembered set
+ */
+#define ECMA_OBJECT_UNREMEMBERED (ECMA_OBJECT_NON_VISITED - ECMA_OBJECT_REF_ONE)
+
+/**
+ * Maximum value of the object reference counter (1021).
+ */
+#define ECMA_OBJECT_MAX_REF (ECMA_OBJECT_UNREMEMBERED - ECMA_OBJECT_REF_ONE)
+
+#else /* !ENABLED (JERRY_GC_GENERATIONAL) */
+
 /**
  * Maximum value of the object reference counter (1022).
  */
 #define ECMA_OBJECT_MAX_REF (ECMA_OBJECT_NON_VISITED - ECMA_OBJECT_REF_ONE)
 
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
 /**
  * Description of ECMA-object or lexical environment
  * (depending on is_lexical_environment).
@@ -1117,17 +1147,80 @@ typedef struct
 #define ECMA_CONTAINER_SET_SIZE(container_p, size) \
   (container_p->buffer_p[0] = (ecma_value_t) (size))
 
+/**
+ * Get the hash index of the internal buffer (can be NULL).
+ */
+#define ECMA_CONTAINER_GET_INDEX(container_p) \
+  ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_container_index_t, container_p->buffer_p[1])
+
+/**
+ * Set the hash index of the internal buffer (can be NULL).
+ */
+#define ECMA_CONTAINER_SET_INDEX(container_p, index_p) \
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (container_p->buffer_p[1], index_p)
+
+/**
+ * Number of header values (size and hash index) of the internal buffer.
+ */
+#define ECMA_CONTAINER_HEADER_SIZE 2
+
 /**
  * Number of entries of the internal buffer.
  */
 #define ECMA_CONTAINER_ENTRY_COUNT(collection_p) \
-  (collection_p->item_count - 1)
+  (collection_p->item_count - ECMA_CONTAINER_HEADER_SIZE)
 
 /**
  * Pointer to the first entry of the internal buffer.
  */
 #define ECMA_CONTAINER_START(collection_p) \
-  (collection_p->buffer_p + 1)
+  (collection_p->buffer_p + ECMA_CONTAINER_HEADER_SIZE)
+
+/**
+ * Hash index of a container object.
+ *
+ * The index is an open addressing hash table with linear probing which is
+ * built when the container grows beyond ECMA_CONTAINER_INDEX_MIN_SIZE entries.
+ * Each slot holds the offset of an entry in the internal buffer, so the
+ * entries keep their insertion order. The slots follow this header.
+ */
+typedef struct
+{
+  uint32_t mask; /**< number of slots minus one (number of slots is a power of 2) */
+  uint32_t used_count; /**< number of non-empty slots (live and deleted) */
+} ecma_container_index_t;
+
+/**
+ * Minimum number of live entries for building a hash index.
+ */
+#define ECMA_CONTAINER_INDEX_MIN_SIZE 16
+
+/**
+ * Index slot which has never been used.
+ */
+#define ECMA_CONTAINER_INDEX_EMPTY 0
+
+/**
+ * Index slot whose entry has been deleted.
+ */
+#define ECMA_CONTAINER_INDEX_DELETED 1
+
+/**
+ * Difference between the value stored in an index slot and the entry offset.
+ */
+#define ECMA_CONTAINER_INDEX_OFFSET_SHIFT 2
+
+/**
+ * Get the slots of a hash index.
+ */
+#define ECMA_CONTAINER_INDEX_SLOTS(index_p) \
+  ((uint32_t *) ((index_p) + 1))
+
+/**
+ * Size of a hash index in bytes.
+ */
+#define ECMA_CONTAINER_INDEX_BYTE_SIZE(mask) \
+  (sizeof (ecma_container_index_t) + ((size_t) (mask) + 1) * sizeof (uint32_t))
 
 #endif /* ENABLED (JERRY_BUILTIN_CONTAINER) */
 
@@ -1577,8 +1670,10 @@ typedef enum
                                             *   maximum size is 2^16. */
   ECMA_STRING_CONTAINER_MAGIC_STRING_EX, /**< the ecma-string is equal to one of external magic strings */
   ECMA_STRING_CONTAINER_SYMBOL, /**< the ecma-string is a symbol */
+  ECMA_STRING_CONTAINER_ROPE_STRING, /**< concatenation of two strings, its characters are copied
+                                      *   into a single buffer when they are first accessed */
 
-  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_SYMBOL /**< maximum value */
+  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_ROPE_STRING /**< maximum value */
 } ecma_string_container_t;
 
 /**
@@ -1680,6 +1775,50 @@ typedef struct
   ecma_object_native_free_callback_t free_cb; /**< free callback */
 } ecma_external_string_t;
 
+/**
+ * Last code unit position converted to a byte offset in a non-ASCII string
+ */
+typedef struct
+{
+  const ecma_string_t *string_p; /**< string of the position (NULL, if the cache is empty) */
+  lit_utf8_size_t index; /**< code unit index */
+  lit_utf8_size_t offset; /**< byte offset of the code unit */
+} ecma_string_position_cache_t;
+
+/**
+ * Minimum size of non-ASCII strings whose positions are cached.
+ */
+#define ECMA_STRING_POSITION_CACHE_MIN_SIZE 128
+
+#if ENABLED (JERRY_ROPE_STRINGS)
+
+/**
+ * Rope string-value descriptor
+ *
+ * Note:
+ *   The string_p field of the header is NULL until the rope is flattened. The right part of
+ *   a rope is always a flat string, so ropes only grow along their left parts.
+ */
+typedef struct
+{
+  ecma_long_string_t header; /**< long string header */
+  ecma_value_t left; /**< left part of the rope (string value) */
+  ecma_value_t right; /**< right part of the rope (string value) */
+} ecma_rope_string_t;
+
+/**
+ * Minimum size of concatenated strings which are represented by ropes.
+ */
+#define ECMA_ROPE_STRING_MIN_SIZE 256
+
+/**
+ * Maximum size of the right part of a rope which is extended by copying
+ * instead of creating a new rope for the concatenation.
+ */
+#define ECMA_ROPE_STRING_LEAF_SIZE 512
+
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
 /**
  * Header size of an ecma ASCII string
  */
@@ -1828,6 +1967,31 @@ typedef struct
   jmem_cpointer_t values[ECMA_LIT_STORAGE_VALUE_COUNT]; /**< list of values */
 } ecma_lit_storage_item_t;
 
+#if ENABLED (JERRY_MEM_STATS)
+/**
+ * Garbage collector statistics
+ */
+typedef struct
+{
+  size_t objects_scanned; /**< number of objects scanned by the last garbage collection */
+  size_t mark_passes; /**< number of object list rescans by the last garbage collection */
+  size_t time_us; /**< duration of the last garbage collection in microseconds */
+  size_t max_time_us; /**< longest garbage collection in microseconds */
+} ecma_gc_stats_t;
+
+#if ENABLED (JERRY_PROPRETY_HASHMAP)
+/**
+ * Property hashmap statistics
+ */
+typedef struct
+{
+  size_t lookups; /**< number of property lookups in hashmaps */
+  size_t hits; /**< number of lookups which found the property */
+  size_t probes; /**< number of hashmap entries checked by the lookups */
+} ecma_prop_hashmap_stats_t;
+#endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
 #if ENABLED (JERRY_LCACHE)
 /**
  * Container of an LCache entry identifier
@@ -1853,13 +2017,77 @@ typedef struct
 /**
  * Number of rows in LCache's hash table
  */
-#define ECMA_LCACHE_HASH_ROWS_COUNT 128
+#define ECMA_LCACHE_HASH_ROWS_COUNT JERRY_LCACHE_ROWS
 
 /**
  * Number of entries in a row of LCache's hash table
  */
 #define ECMA_LCACHE_HASH_ROW_LENGTH 2
 
+#if JERRY_LCACHE_PROTOTYPE_ROWS > 0
+
+/**
+ * Entry of the LCache table which stores the properties found on the prototype chain
+ */
+typedef struct
+{
+  /** Pointer to the property found on the prototype chain (NULL for properties described by shapes) */
+  ecma_property_t *prop_p;
+
+  /** Value of the prototype epoch when the entry is created */
+  uint32_t epoch;
+
+  /** Object where the search is started */
+  jmem_cpointer_t object_cp;
+
+  /** Name of the property */
+  jmem_cpointer_t name_cp;
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  /** Object which has the property described by its shape */
+  jmem_cpointer_t holder_cp;
+
+  /** Shape of the holder object when the entry is created */
+  jmem_cpointer_t shape_cp;
+
+  /** Type and flags of the property described by the shape */
+  ecma_property_t property;
+
+  /** Index of the property value in the values of the holder object */
+  uint8_t index;
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+} ecma_lcache_proto_entry_t;
+
+/**
+ * Number of rows in the prototype table of LCache
+ */
+#define ECMA_LCACHE_PROTO_ROWS_COUNT JERRY_LCACHE_PROTOTYPE_ROWS
+
+/**
+ * Number of entries in a row of the prototype table of LCache
+ */
+#define ECMA_LCACHE_PROTO_ROW_LENGTH 2
+
+/**
+ * Number of bits in the filter of the objects on the prototype chains searched by LCache
+ */
+#define ECMA_LCACHE_PROTO_FILTER_BITS 256
+
+#endif /* JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
+
+#if ENABLED (JERRY_MEM_STATS)
+/**
+ * LCache statistics
+ */
+typedef struct
+{
+  size_t lookups; /**< number of own property lookups */
+  size_t hits; /**< number of own property lookups which found the property */
+  size_t proto_lookups; /**< number of prototype chain lookups */
+  size_t proto_hits; /**< number of prototype chain lookups which found the property */
+} ecma_lcache_stats_t;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
 #endif /* ENABLED (JERRY_LCACHE) */
 
 #if ENABLED (JERRY_BUILTIN_TYPEDARRAY)
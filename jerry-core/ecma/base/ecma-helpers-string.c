@@ -19,6 +19,7 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "lit-char-helpers.h"
@@ -118,6 +119,145 @@ ecma_string_to_array_index (const lit_utf8_byte_t *string_p, /**< utf-8 string *
   return true;
 } /* ecma_string_to_array_index */
 
+/**
+ * Forget the cached position of a string which is freed
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_string_position_cache_remove (const ecma_string_t *string_p) /**< freed string */
+{
+  if (JERRY_CONTEXT (string_position_cache).string_p == string_p)
+  {
+    JERRY_CONTEXT (string_position_cache).string_p = NULL;
+  }
+} /* ecma_string_position_cache_remove */
+
+#if ENABLED (JERRY_ROPE_STRINGS)
+
+/**
+ * Checks whether a non-direct string is described by an ecma_long_string_t header.
+ */
+#define ECMA_STRING_HAS_LONG_HEADER(string_p) \
+  (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING \
+   || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING)
+
+/**
+ * Copy the characters of a rope into a single buffer, and release the parts of the rope.
+ * Afterwards the rope can be accessed as a long string.
+ *
+ * Note:
+ *   flattening does not change the value of the string, so constant strings can be flattened as well
+ */
+static void JERRY_ATTR_NOINLINE
+ecma_rope_string_flatten (const ecma_string_t *string_p) /**< rope string */
+{
+  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE_STRING);
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+
+  if (rope_p->header.string_p != NULL)
+  {
+    return;
+  }
+
+  lit_utf8_byte_t *buffer_p = (lit_utf8_byte_t *) ecma_alloc_string_buffer (rope_p->header.size);
+  lit_utf8_size_t position = rope_p->header.size;
+  ecma_rope_string_t *current_p = rope_p;
+
+  /* The right parts are flat strings, so the characters are copied backwards
+   * while the left parts are traversed. */
+  while (true)
+  {
+    ecma_string_t *part_p = ecma_get_string_from_value (current_p->right);
+    lit_utf8_size_t part_size = ecma_string_get_size (part_p);
+
+    JERRY_ASSERT (part_size <= position);
+    position -= part_size;
+
+    lit_utf8_size_t copied_size = ecma_string_copy_to_cesu8_buffer (part_p, buffer_p + position, part_size);
+    JERRY_ASSERT (copied_size == part_size);
+
+    part_p = ecma_get_string_from_value (current_p->left);
+
+    if (ECMA_IS_DIRECT_STRING (part_p)
+        || ECMA_STRING_GET_CONTAINER (part_p) != ECMA_STRING_CONTAINER_ROPE_STRING
+        || ((ecma_rope_string_t *) part_p)->header.string_p != NULL)
+    {
+      copied_size = ecma_string_copy_to_cesu8_buffer (part_p, buffer_p, position);
+      JERRY_ASSERT (copied_size == position);
+      break;
+    }
+
+    current_p = (ecma_rope_string_t *) part_p;
+  }
+
+  rope_p->header.string_p = buffer_p;
+
+  ecma_deref_ecma_string (ecma_get_string_from_value (rope_p->right));
+  ecma_deref_ecma_string (ecma_get_string_from_value (rope_p->left));
+} /* ecma_rope_string_flatten */
+
+/**
+ * Deallocate a rope string
+ *
+ * Note:
+ *   the left parts are released by a loop, so long chains of ropes do not exhaust the stack
+ */
+static void
+ecma_destroy_rope_string (ecma_rope_string_t *rope_p) /**< rope string */
+{
+  while (true)
+  {
+    ecma_string_t *left_p = NULL;
+
+    ecma_string_position_cache_remove ((ecma_string_t *) rope_p);
+
+    if (rope_p->header.string_p != NULL)
+    {
+      ecma_dealloc_string_buffer ((ecma_string_t *) rope_p->header.string_p, rope_p->header.size);
+    }
+    else
+    {
+      ecma_deref_ecma_string (ecma_get_string_from_value (rope_p->right));
+      left_p = ecma_get_string_from_value (rope_p->left);
+    }
+
+    ecma_dealloc_string_buffer ((ecma_string_t *) rope_p, sizeof (ecma_rope_string_t));
+
+    if (left_p == NULL)
+    {
+      return;
+    }
+
+    if (ECMA_IS_DIRECT_STRING (left_p)
+        || ECMA_STRING_GET_CONTAINER (left_p) != ECMA_STRING_CONTAINER_ROPE_STRING)
+    {
+      ecma_deref_ecma_string (left_p);
+      return;
+    }
+
+    JERRY_ASSERT (left_p->refs_and_container >= ECMA_STRING_REF_ONE);
+
+    left_p->refs_and_container -= ECMA_STRING_REF_ONE;
+
+    if (left_p->refs_and_container >= ECMA_STRING_REF_ONE)
+    {
+      return;
+    }
+
+    rope_p = (ecma_rope_string_t *) left_p;
+  }
+} /* ecma_destroy_rope_string */
+
+#else /* !ENABLED (JERRY_ROPE_STRINGS) */
+
+/**
+ * Checks whether a non-direct string is described by an ecma_long_string_t header.
+ */
+#define ECMA_STRING_HAS_LONG_HEADER(string_p) \
+  (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
 /**
  * Returns the characters and size of a string.
  *
@@ -159,6 +299,13 @@ ecma_string_get_chars_fast (const ecma_string_t *string_p, /**< ecma-string */
       *size_p = ((ecma_short_string_t *) string_p)->size;
       return ECMA_SHORT_STRING_GET_BUFFER (string_p);
     }
+#if ENABLED (JERRY_ROPE_STRINGS)
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      ecma_rope_string_flatten (string_p);
+      /* FALLTHRU */
+    }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
@@ -779,6 +926,79 @@ ecma_append_chars_to_string (ecma_string_t *string1_p, /**< base ecma-string */
   return (ecma_string_t *) string_desc_p;
 } /* ecma_append_chars_to_string */
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+
+/**
+ * Create a rope from an ecma-string and the characters of another ecma-string
+ *
+ * Note:
+ *   The string1_p argument is freed. If it needs to be preserved,
+ *   call ecma_ref_ecma_string with string1_p before the call.
+ *
+ * @return concatenation of the two ecma-strings
+ */
+static ecma_string_t *
+ecma_concat_ecma_strings_to_rope (ecma_string_t *string1_p, /**< first ecma-string */
+                                  ecma_string_t *string2_p, /**< second ecma-string */
+                                  const lit_utf8_byte_t *cesu8_string2_p, /**< characters of string2_p */
+                                  lit_utf8_size_t cesu8_string2_size, /**< byte size of cesu8_string2_p */
+                                  lit_utf8_size_t cesu8_string2_length) /**< character length of cesu8_string2_p */
+{
+  JERRY_ASSERT (!ECMA_IS_DIRECT_STRING (string1_p));
+  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string1_p) != ECMA_STRING_CONTAINER_UINT32_IN_DESC
+                && ECMA_STRING_GET_CONTAINER (string1_p) != ECMA_STRING_CONTAINER_MAGIC_STRING_EX
+                && ECMA_STRING_GET_CONTAINER (string1_p) != ECMA_STRING_CONTAINER_SYMBOL);
+
+  lit_utf8_size_t new_size = ecma_string_get_size (string1_p) + cesu8_string2_size;
+
+  /* Poor man's carry flag check: it is impossible to allocate this large string. */
+  if (new_size < cesu8_string2_size)
+  {
+    jerry_fatal (ERR_OUT_OF_MEMORY);
+  }
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) ecma_alloc_string_buffer (sizeof (ecma_rope_string_t));
+  rope_p->header.header.refs_and_container = ECMA_STRING_CONTAINER_ROPE_STRING | ECMA_STRING_REF_ONE;
+  rope_p->header.header.u.hash = lit_utf8_string_hash_combine (string1_p->u.hash,
+                                                               cesu8_string2_p,
+                                                               cesu8_string2_size);
+  rope_p->header.string_p = NULL;
+  rope_p->header.size = new_size;
+  rope_p->header.length = ecma_string_get_length (string1_p) + cesu8_string2_length;
+
+  if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_ROPE_STRING
+      && ((ecma_rope_string_t *) string1_p)->header.string_p == NULL)
+  {
+    /* Short strings appended to a rope are merged with the right part of the
+     * rope to avoid creating a long chain of ropes with tiny parts. */
+    ecma_rope_string_t *rope1_p = (ecma_rope_string_t *) string1_p;
+    ecma_string_t *right1_p = ecma_get_string_from_value (rope1_p->right);
+
+    if (ecma_string_get_size (right1_p) + cesu8_string2_size <= ECMA_ROPE_STRING_LEAF_SIZE)
+    {
+      ecma_ref_ecma_string (right1_p);
+      right1_p = ecma_append_chars_to_string (right1_p,
+                                              cesu8_string2_p,
+                                              cesu8_string2_size,
+                                              cesu8_string2_length);
+
+      ecma_ref_ecma_string (ecma_get_string_from_value (rope1_p->left));
+      rope_p->left = rope1_p->left;
+      rope_p->right = ecma_make_string_value (right1_p);
+
+      ecma_deref_ecma_string (string1_p);
+      return (ecma_string_t *) rope_p;
+    }
+  }
+
+  ecma_ref_ecma_string (string2_p);
+  rope_p->left = ecma_make_string_value (string1_p);
+  rope_p->right = ecma_make_string_value (string2_p);
+  return (ecma_string_t *) rope_p;
+} /* ecma_concat_ecma_strings_to_rope */
+
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
 /**
  * Concatenate ecma-strings
  *
@@ -817,10 +1037,33 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
 
   JERRY_ASSERT (cesu8_string2_p != NULL);
 
-  ecma_string_t *result_p = ecma_append_chars_to_string (string1_p,
-                                                         cesu8_string2_p,
-                                                         cesu8_string2_size,
-                                                         cesu8_string2_length);
+  ecma_string_t *result_p;
+
+#if ENABLED (JERRY_ROPE_STRINGS)
+  /* Ropes are not created when external magic strings are registered, since any
+   * concatenation could produce an external magic string. Other special strings
+   * are shorter than the minimum size of ropes. */
+  if (!ECMA_IS_DIRECT_STRING (string1_p)
+      && ECMA_STRING_GET_CONTAINER (string1_p) != ECMA_STRING_CONTAINER_UINT32_IN_DESC
+      && ecma_string_get_size (string1_p) + cesu8_string2_size >= ECMA_ROPE_STRING_MIN_SIZE
+      && lit_get_magic_string_ex_count () == 0)
+  {
+    result_p = ecma_concat_ecma_strings_to_rope (string1_p,
+                                                 string2_p,
+                                                 cesu8_string2_p,
+                                                 cesu8_string2_size,
+                                                 cesu8_string2_length);
+  }
+  else
+  {
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+    result_p = ecma_append_chars_to_string (string1_p,
+                                            cesu8_string2_p,
+                                            cesu8_string2_size,
+                                            cesu8_string2_length);
+#if ENABLED (JERRY_ROPE_STRINGS)
+  }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
 
   JERRY_ASSERT (!(flags & ECMA_STRING_FLAG_MUST_BE_FREED));
 
@@ -904,6 +1147,8 @@ ecma_destroy_ecma_string (ecma_string_t *string_p) /**< ecma-string */
   JERRY_ASSERT (!ECMA_IS_DIRECT_STRING (string_p));
   JERRY_ASSERT ((string_p->refs_and_container < ECMA_STRING_REF_ONE) || ECMA_STRING_IS_STATIC (string_p));
 
+  ecma_string_position_cache_remove (string_p);
+
   switch (ECMA_STRING_GET_CONTAINER (string_p))
   {
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
@@ -931,6 +1176,13 @@ ecma_destroy_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       ecma_dealloc_external_string (external_string_p);
       return;
     }
+#if ENABLED (JERRY_ROPE_STRINGS)
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      ecma_destroy_rope_string ((ecma_rope_string_t *) string_p);
+      return;
+    }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
     case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
     {
       ecma_dealloc_string_buffer (string_p, ECMA_ASCII_STRING_GET_SIZE (string_p) + ECMA_ASCII_STRING_HEADER_SIZE);
@@ -1497,6 +1749,13 @@ ecma_string_get_chars (const ecma_string_t *string_p, /**< ecma-string */
         result_p = ECMA_SHORT_STRING_GET_BUFFER (short_string_p);
         break;
       }
+#if ENABLED (JERRY_ROPE_STRINGS)
+      case ECMA_STRING_CONTAINER_ROPE_STRING:
+      {
+        ecma_rope_string_flatten (string_p);
+        /* FALLTHRU */
+      }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
       case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
       {
         ecma_long_string_t *long_string_desc_p = (ecma_long_string_t *) string_p;
@@ -1752,6 +2011,13 @@ ecma_compare_get_string_chars (const ecma_string_t *string_p, /**< ecma-string *
       size_and_length_p[1] = short_string_p->length;
       return ECMA_SHORT_STRING_GET_BUFFER (string_p);
     }
+#if ENABLED (JERRY_ROPE_STRINGS)
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      ecma_rope_string_flatten (string_p);
+      /* FALLTHRU */
+    }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
@@ -2054,7 +2320,7 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
     return ((ecma_short_string_t *) string_p)->length;
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_HAS_LONG_HEADER (string_p))
   {
     return ((ecma_long_string_t *) string_p)->length;
   }
@@ -2104,7 +2370,7 @@ ecma_string_get_utf8_length (const ecma_string_t *string_p) /**< ecma-string */
     return lit_get_utf8_length_of_cesu8_string (ECMA_SHORT_STRING_GET_BUFFER (string_p), size);
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_HAS_LONG_HEADER (string_p))
   {
     ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
     lit_utf8_size_t size = long_string_p->size;
@@ -2114,6 +2380,13 @@ ecma_string_get_utf8_length (const ecma_string_t *string_p) /**< ecma-string */
       return size;
     }
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+    if (long_string_p->string_p == NULL)
+    {
+      ecma_rope_string_flatten (string_p);
+    }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
     return lit_get_utf8_length_of_cesu8_string (long_string_p->string_p, size);
   }
 
@@ -2153,7 +2426,7 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
     return ((ecma_short_string_t *) string_p)->size;
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_HAS_LONG_HEADER (string_p))
   {
     return ((ecma_long_string_t *) string_p)->size;
   }
@@ -2201,7 +2474,7 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
     return lit_get_utf8_size_of_cesu8_string (ECMA_SHORT_STRING_GET_BUFFER (string_p), size);
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_HAS_LONG_HEADER (string_p))
   {
     ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
 
@@ -2210,6 +2483,13 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
       return long_string_p->size;
     }
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+    if (long_string_p->string_p == NULL)
+    {
+      ecma_rope_string_flatten (string_p);
+    }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
     return lit_get_utf8_size_of_cesu8_string (long_string_p->string_p, long_string_p->size);
   }
 
@@ -2220,6 +2500,125 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
                                             lit_get_magic_string_ex_size (id));
 } /* ecma_string_get_utf8_size */
 
+/**
+ * Get the byte offset of a code unit in the characters of a string
+ *
+ * Note:
+ *   the last position converted in a long non-ASCII string is remembered, and the next
+ *   conversion only scans the characters between the remembered and the requested position
+ *
+ * @return byte offset of the code unit
+ */
+lit_utf8_size_t
+ecma_string_index_to_offset (const ecma_string_t *string_p, /**< ecma-string */
+                             const lit_utf8_byte_t *chars_p, /**< characters of the string */
+                             lit_utf8_size_t size, /**< size of the characters */
+                             lit_utf8_size_t index) /**< code unit index (can be equal to the length) */
+{
+  const lit_utf8_byte_t *current_p = chars_p;
+  lit_utf8_size_t current_index = 0;
+
+  if (size < ECMA_STRING_POSITION_CACHE_MIN_SIZE)
+  {
+    while (current_index++ < index)
+    {
+      lit_utf8_incr (&current_p);
+    }
+
+    return (lit_utf8_size_t) (current_p - chars_p);
+  }
+
+  ecma_string_position_cache_t *cache_p = &JERRY_CONTEXT (string_position_cache);
+
+  if (cache_p->string_p == string_p)
+  {
+    if (cache_p->index <= index)
+    {
+      current_p += cache_p->offset;
+      current_index = cache_p->index;
+    }
+    else if (cache_p->index - index < index)
+    {
+      current_p += cache_p->offset;
+      current_index = cache_p->index;
+
+      while (current_index > index)
+      {
+        lit_utf8_decr (&current_p);
+        current_index--;
+      }
+    }
+  }
+
+  while (current_index < index)
+  {
+    lit_utf8_incr (&current_p);
+    current_index++;
+  }
+
+  JERRY_ASSERT (current_p <= chars_p + size);
+
+  cache_p->string_p = string_p;
+  cache_p->index = index;
+  cache_p->offset = (lit_utf8_size_t) (current_p - chars_p);
+  return cache_p->offset;
+} /* ecma_string_index_to_offset */
+
+/**
+ * Get the code unit index of a byte offset in the characters of a string
+ *
+ * Note:
+ *   uses the same cache as ecma_string_index_to_offset
+ *
+ * @return code unit index
+ */
+lit_utf8_size_t
+ecma_string_offset_to_index (const ecma_string_t *string_p, /**< ecma-string */
+                             const lit_utf8_byte_t *chars_p, /**< characters of the string */
+                             lit_utf8_size_t size, /**< size of the characters */
+                             lit_utf8_size_t offset) /**< byte offset of a code unit (can be equal to the size) */
+{
+  JERRY_ASSERT (offset <= size);
+
+  if (size < ECMA_STRING_POSITION_CACHE_MIN_SIZE)
+  {
+    return lit_utf8_string_length (chars_p, offset);
+  }
+
+  ecma_string_position_cache_t *cache_p = &JERRY_CONTEXT (string_position_cache);
+  lit_utf8_size_t index;
+
+  if (cache_p->string_p == string_p && cache_p->offset <= offset)
+  {
+    index = cache_p->index + lit_utf8_string_length (chars_p + cache_p->offset, offset - cache_p->offset);
+  }
+  else
+  {
+    index = lit_utf8_string_length (chars_p, offset);
+  }
+
+  cache_p->string_p = string_p;
+  cache_p->index = index;
+  cache_p->offset = offset;
+  return index;
+} /* ecma_string_offset_to_index */
+
+/**
+ * Get a code unit of a non-ASCII string
+ *
+ * @return code unit value
+ */
+static ecma_char_t
+ecma_string_get_code_unit_at (const ecma_string_t *string_p, /**< ecma-string */
+                              const lit_utf8_byte_t *chars_p, /**< characters of the string */
+                              lit_utf8_size_t size, /**< size of the characters */
+                              lit_utf8_size_t index) /**< code unit index */
+{
+  ecma_char_t code_unit;
+  lit_read_code_unit_from_utf8 (chars_p + ecma_string_index_to_offset (string_p, chars_p, size, index), &code_unit);
+  return code_unit;
+} /* ecma_string_get_code_unit_at */
+
 /**
  * Get character from specified position in an external ecma-string.
  *
@@ -2300,8 +2699,15 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
         return (ecma_char_t) data_p[index];
       }
 
-      return lit_utf8_string_code_unit_at (data_p, size, index);
+      return ecma_string_get_code_unit_at (string_p, data_p, size, index);
     }
+#if ENABLED (JERRY_ROPE_STRINGS)
+    case ECMA_STRING_CONTAINER_ROPE_STRING:
+    {
+      ecma_rope_string_flatten (string_p);
+      /* FALLTHRU */
+    }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
@@ -2313,7 +2719,7 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
         return (ecma_char_t) data_p[index];
       }
 
-      return lit_utf8_string_code_unit_at (data_p, size, index);
+      return ecma_string_get_code_unit_at (string_p, data_p, size, index);
     }
     case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
     {
@@ -2406,18 +2812,10 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
   }
   else
   {
-    while (start_pos--)
-    {
-      start_p += lit_get_unicode_char_size_by_utf8_first_byte (*start_p);
-    }
-
-    const lit_utf8_byte_t *end_p = start_p;
-    while (end_pos--)
-    {
-      end_p += lit_get_unicode_char_size_by_utf8_first_byte (*end_p);
-    }
+    lit_utf8_size_t start_offset = ecma_string_index_to_offset (string_p, start_p, buffer_size, start_pos);
+    lit_utf8_size_t end_offset = ecma_string_index_to_offset (string_p, start_p, buffer_size, start_pos + end_pos);
 
-    ecma_string_p = ecma_new_ecma_string_from_utf8 (start_p, (lit_utf8_size_t) (end_p - start_p));
+    ecma_string_p = ecma_new_ecma_string_from_utf8 (start_p + start_offset, end_offset - start_offset);
   }
 
   ECMA_FINALIZE_UTF8_STRING (start_p, buffer_size);
@@ -19,11 +19,14 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
+#include "ecma-line-info.h"
 #include "ecma-property-hashmap.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 #include "jrt-bit-fields.h"
 #include "byte-code.h"
 #include "re-compiler.h"
+#include "vm.h"
 #include "ecma-builtins.h"
 
 #if ENABLED (JERRY_DEBUGGER)
@@ -55,8 +58,8 @@ JERRY_STATIC_ASSERT (ECMA_OBJECT_FLAG_EXTENSIBLE == (ECMA_OBJECT_FLAG_BUILT_IN_O
 JERRY_STATIC_ASSERT (ECMA_OBJECT_REF_ONE == (ECMA_OBJECT_FLAG_EXTENSIBLE << 1),
                      ecma_object_ref_one_must_follow_the_extensible_flag);
 
-JERRY_STATIC_ASSERT (((ECMA_OBJECT_MAX_REF + ECMA_OBJECT_REF_ONE) | (ECMA_OBJECT_REF_ONE - 1)) == UINT16_MAX,
-                      ecma_object_max_ref_does_not_fill_the_remaining_bits);
+JERRY_STATIC_ASSERT ((ECMA_OBJECT_NON_VISITED | (ECMA_OBJECT_REF_ONE - 1)) == UINT16_MAX,
+                      ecma_object_non_visited_does_not_fill_the_remaining_bits);
 
 JERRY_STATIC_ASSERT (ECMA_PROPERTY_TYPE_DELETED == (ECMA_DIRECT_STRING_MAGIC << ECMA_PROPERTY_NAME_TYPE_SHIFT),
                      ecma_property_type_deleted_must_have_magic_string_name_type);
@@ -384,6 +387,19 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
   JERRY_ASSERT (name_p != NULL);
   JERRY_ASSERT (object_p != NULL);
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  /* Accessors, internal properties and properties whose pointer is returned are not described by shapes. */
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    ecma_shape_convert_to_property_list (object_p, NULL);
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  /* The value of the new property is often initialized without a write barrier. */
+  ecma_gc_remember_object (object_p);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
   jmem_cpointer_t *property_list_head_p = &object_p->u1.property_list_cp;
 
   if (*property_list_head_p != ECMA_NULL_POINTER)
@@ -522,11 +538,36 @@ ecma_create_named_data_property (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (object_p != NULL && name_p != NULL);
   JERRY_ASSERT (ecma_is_lexical_environment (object_p)
                 || !ecma_op_object_is_fast_array (object_p));
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  JERRY_ASSERT (ECMA_OBJECT_HAS_SHAPE (object_p) ? !ecma_shape_has_property (object_p, name_p)
+                                                 : ecma_find_named_property (object_p, name_p) == NULL);
+#else /* !ENABLED (JERRY_OBJECT_SHAPES) */
   JERRY_ASSERT (ecma_find_named_property (object_p, name_p) == NULL);
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
   JERRY_ASSERT ((prop_attributes & ~ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE) == 0);
 
+#if ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0
+  if (JERRY_UNLIKELY (ecma_lcache_proto_is_marked (object_p)))
+  {
+    ecma_lcache_proto_invalidate (ecma_string_hash (name_p));
+  }
+#endif /* ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
+
   uint8_t type_and_flags = ECMA_PROPERTY_TYPE_NAMEDDATA | prop_attributes;
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  /* The property must be stored in a property pair when it is also returned. */
+  if (out_prop_p == NULL)
+  {
+    ecma_property_value_t *value_p = ecma_shape_create_property (object_p, name_p, type_and_flags);
+
+    if (value_p != NULL)
+    {
+      return value_p;
+    }
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
   ecma_property_value_t value;
   value.value = ECMA_VALUE_UNDEFINED;
 
@@ -553,6 +594,13 @@ ecma_create_named_accessor_property (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (ecma_find_named_property (object_p, name_p) == NULL);
   JERRY_ASSERT ((prop_attributes & ~ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE) == 0);
 
+#if ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0
+  if (JERRY_UNLIKELY (ecma_lcache_proto_is_marked (object_p)))
+  {
+    ecma_lcache_proto_invalidate (ecma_string_hash (name_p));
+  }
+#endif /* ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
+
   uint8_t type_and_flags = ECMA_PROPERTY_TYPE_NAMEDACCESSOR | prop_attributes;
 
   ecma_property_value_t value;
@@ -573,6 +621,10 @@ ecma_create_named_accessor_property (ecma_object_t *object_p, /**< object */
 /**
  * Find named data property or named access property in specified object.
  *
+ * Note:
+ *      an object with a shape is converted to a property pair list when the property is found,
+ *      so operations which only read or write the value use ecma_shape_find_property instead
+ *
  * @return pointer to the property, if it is found,
  *         NULL - otherwise.
  */
@@ -587,6 +639,19 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
 
   ecma_property_t *property_p = NULL;
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ECMA_OBJECT_HAS_SHAPE (obj_p))
+  {
+    if (!ecma_shape_has_property (obj_p, name_p))
+    {
+      return NULL;
+    }
+
+    /* The caller may change the attributes through the returned property pointer. */
+    ecma_shape_convert_to_property_list (obj_p, NULL);
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
 #if ENABLED (JERRY_LCACHE)
   property_p = ecma_lcache_lookup (obj_p, name_p);
   if (property_p != NULL)
@@ -708,9 +773,9 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
   }
 
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
-  if (steps >= (ECMA_PROPERTY_HASMAP_MINIMUM_SIZE / 2))
+  if (steps >= ECMA_PROPERTY_HASHMAP_ADAPTIVE_MIN_STEPS)
   {
-    ecma_property_hashmap_create (obj_p);
+    ecma_property_hashmap_lookup_missed (obj_p, steps);
   }
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
@@ -813,6 +878,13 @@ void
 ecma_delete_property (ecma_object_t *object_p, /**< object */
                       ecma_property_value_t *prop_value_p) /**< property value reference */
 {
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    prop_value_p = ecma_shape_convert_to_property_list (object_p, prop_value_p);
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
   jmem_cpointer_t cur_prop_cp = object_p->u1.property_list_cp;
 
   ecma_property_header_t *prev_prop_p = NULL;
@@ -858,6 +930,14 @@ ecma_delete_property (ecma_object_t *object_p, /**< object */
         }
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
+#if ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0
+        if (ecma_lcache_proto_is_marked (object_p))
+        {
+          ecma_lcache_proto_invalidate (ecma_string_get_property_name_hash (cur_prop_p->types[i],
+                                                                            prop_pair_p->names_cp[i]));
+        }
+#endif /* ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
+
         ecma_free_property (object_p, prop_pair_p->names_cp[i], cur_prop_p->types + i);
         cur_prop_p->types[i] = ECMA_PROPERTY_TYPE_DELETED;
         prop_pair_p->names_cp[i] = LIT_INTERNAL_MAGIC_STRING_DELETED;
@@ -890,6 +970,10 @@ ecma_delete_property (ecma_object_t *object_p, /**< object */
 
         ecma_dealloc_property_pair ((ecma_property_pair_t *) cur_prop_p);
 
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+        vm_inline_cache_invalidate_all ();
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
+
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
         if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP)
         {
@@ -920,6 +1004,18 @@ ecma_assert_object_contains_the_property (const ecma_object_t *object_p, /**< ec
 
   ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+  {
+    const ecma_property_value_t *values_p = ECMA_SHAPE_GET_VALUES (prop_iter_p);
+
+    JERRY_ASSERT (type == ECMA_PROPERTY_TYPE_NAMEDDATA);
+    JERRY_ASSERT (prop_value_p >= values_p
+                  && prop_value_p < values_p + ECMA_SHAPE_GET_SHAPE (prop_iter_p)->property_count);
+    return;
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
   if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
   {
     prop_iter_cp = prop_iter_p->next_property_cp;
@@ -964,6 +1060,7 @@ ecma_named_data_property_assign_value (ecma_object_t *obj_p, /**< object */
 {
   ecma_assert_object_contains_the_property (obj_p, prop_value_p, ECMA_PROPERTY_TYPE_NAMEDDATA);
 
+  ecma_gc_write_barrier (obj_p, value);
   ecma_value_assign_value (&prop_value_p->value, value);
 } /* ecma_named_data_property_assign_value */
 
@@ -992,6 +1089,10 @@ ecma_set_named_accessor_property_getter (ecma_object_t *object_p, /**< the prope
 {
   ecma_assert_object_contains_the_property (object_p, prop_value_p, ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
 
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  ecma_gc_remember_object (object_p);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
 #if ENABLED (JERRY_CPOINTER_32_BIT)
   ecma_getter_setter_pointers_t *getter_setter_pair_p;
   getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t,
@@ -1012,6 +1113,10 @@ ecma_set_named_accessor_property_setter (ecma_object_t *object_p, /**< the prope
 {
   ecma_assert_object_contains_the_property (object_p, prop_value_p, ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
 
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  ecma_gc_remember_object (object_p);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
 #if ENABLED (JERRY_CPOINTER_32_BIT)
   ecma_getter_setter_pointers_t *getter_setter_pair_p;
   getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t,
@@ -1423,6 +1528,31 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
       literal_start_p -= args_p->register_end;
     }
 
+#if ENABLED (JERRY_PARSER)
+    if (JERRY_UNLIKELY (bytecode_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION))
+    {
+      cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) bytecode_p;
+      ecma_compiled_code_t *compiled_code_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_compiled_code_t,
+                                                                                   lazy_function_p->compiled_code);
+
+      if (compiled_code_p != NULL)
+      {
+        ecma_bytecode_deref (compiled_code_p);
+      }
+    }
+#endif /* ENABLED (JERRY_PARSER) */
+
+#if ENABLED (JERRY_LINE_INFO)
+    if (bytecode_p->status_flags & CBC_CODE_FLAGS_HAS_LINE_INFO)
+    {
+      ecma_line_info_free (ecma_compiled_code_get_line_info (bytecode_p));
+    }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+    vm_inline_cache_free_table (bytecode_p);
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
+
     for (uint32_t i = const_literal_end; i < literal_end; i++)
     {
       ecma_compiled_code_t *bytecode_literal_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t,
@@ -1579,6 +1709,51 @@ ecma_compiled_code_get_tagged_template_collection (const ecma_compiled_code_t *b
 
 #endif /* ENABLED (JERRY_ESNEXT) */
 
+#if ENABLED (JERRY_LINE_INFO)
+
+/**
+ * Resolve the position of the line info block pointer of the compiled code
+ *
+ * @return position of the line info block pointer
+ */
+ecma_value_t *
+ecma_compiled_code_resolve_line_info (const ecma_compiled_code_t *bytecode_header_p) /**< compiled code */
+{
+  JERRY_ASSERT (bytecode_header_p != NULL);
+  JERRY_ASSERT (bytecode_header_p->status_flags & CBC_CODE_FLAGS_HAS_LINE_INFO);
+
+#if ENABLED (JERRY_ESNEXT)
+  ecma_value_t *base_p = ecma_compiled_code_resolve_function_name (bytecode_header_p);
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_HAS_EXTENDED_INFO)
+  {
+    base_p--;
+  }
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_HAS_TAGGED_LITERALS)
+  {
+    base_p--;
+  }
+#else /* !ENABLED (JERRY_ESNEXT) */
+  ecma_value_t *base_p = ecma_compiled_code_resolve_arguments_start (bytecode_header_p);
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+  return base_p - 1;
+} /* ecma_compiled_code_resolve_line_info */
+
+/**
+ * Get the line info block of the compiled code
+ *
+ * @return pointer to the line info block
+ */
+uint8_t *
+ecma_compiled_code_get_line_info (const ecma_compiled_code_t *bytecode_header_p) /**< compiled code */
+{
+  return ECMA_GET_INTERNAL_VALUE_POINTER (uint8_t, *ecma_compiled_code_resolve_line_info (bytecode_header_p));
+} /* ecma_compiled_code_get_line_info */
+
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
 /**
  * Get the resource name of a compiled code.
  *
@@ -369,6 +369,10 @@ lit_utf8_size_t ecma_string_get_length (const ecma_string_t *string_p);
 lit_utf8_size_t ecma_string_get_utf8_length (const ecma_string_t *string_p);
 lit_utf8_size_t ecma_string_get_size (const ecma_string_t *string_p);
 lit_utf8_size_t ecma_string_get_utf8_size (const ecma_string_t *string_p);
+lit_utf8_size_t ecma_string_index_to_offset (const ecma_string_t *string_p, const lit_utf8_byte_t *chars_p,
+                                             lit_utf8_size_t size, lit_utf8_size_t index);
+lit_utf8_size_t ecma_string_offset_to_index (const ecma_string_t *string_p, const lit_utf8_byte_t *chars_p,
+                                             lit_utf8_size_t size, lit_utf8_size_t offset);
 ecma_char_t ecma_string_get_char_at_pos (const ecma_string_t *string_p, lit_utf8_size_t index);
 
 lit_magic_string_id_t ecma_get_string_magic (const ecma_string_t *string_p);
@@ -520,6 +524,10 @@ ecma_value_t *ecma_compiled_code_resolve_function_name (const ecma_compiled_code
 uint32_t ecma_compiled_code_resolve_extended_info (const ecma_compiled_code_t *bytecode_header_p);
 ecma_collection_t *ecma_compiled_code_get_tagged_template_collection (const ecma_compiled_code_t *bytecode_header_p);
 #endif /* ENABLED (JERRY_ESNEXT) */
+#if ENABLED (JERRY_LINE_INFO)
+ecma_value_t *ecma_compiled_code_resolve_line_info (const ecma_compiled_code_t *bytecode_header_p);
+uint8_t *ecma_compiled_code_get_line_info (const ecma_compiled_code_t *bytecode_header_p);
+#endif /* ENABLED (JERRY_LINE_INFO) */
 ecma_value_t ecma_get_resource_name (const ecma_compiled_code_t *bytecode_p);
 #if (JERRY_STACK_LIMIT != 0)
 uintptr_t ecma_get_current_stack_usage (void);
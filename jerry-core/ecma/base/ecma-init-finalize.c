@@ -19,8 +19,11 @@
 #include "ecma-init-finalize.h"
 #include "ecma-lex-env.h"
 #include "ecma-literal-storage.h"
+#include "ecma-property-hashmap.h"
 #include "jmem.h"
 #include "jcontext.h"
+#include "re-compiler.h"
+#include "vm.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -40,17 +43,19 @@
 void
 ecma_init (void)
 {
-#if (JERRY_GC_MARK_LIMIT != 0)
-  JERRY_CONTEXT (ecma_gc_mark_recursion_limit) = JERRY_GC_MARK_LIMIT;
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
-
   ecma_init_global_environment ();
 
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
   JERRY_CONTEXT (ecma_prop_hashmap_alloc_state) = ECMA_PROP_HASHMAP_ALLOC_ON;
+  JERRY_CONTEXT (ecma_prop_hashmap_lookup_steps) = ECMA_PROPERTY_HASHMAP_LOOKUP_STEPS;
+  JERRY_CONTEXT (ecma_prop_hashmap_miss_limit) = ECMA_PROPERTY_HASHMAP_MISS_LIMIT;
   JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_HIGH_PRESSURE_GC;
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+  JERRY_CONTEXT (re_cache_size) = JERRY_REGEXP_CACHE_SIZE;
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+
 #if (JERRY_STACK_LIMIT != 0)
   volatile int sp;
   JERRY_CONTEXT (stack_base) = (uintptr_t) &sp;
@@ -76,6 +81,11 @@ ecma_finalize (void)
 #endif /* ENABLED (JERRY_ESNEXT) */
 
   ecma_finalize_global_environment ();
+
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+  re_cache_gc ();
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+
   uint8_t runs = 0;
   do
   {
@@ -87,7 +97,15 @@ ecma_finalize (void)
     }
   }
   while (JERRY_CONTEXT (ecma_gc_new_objects) != 0);
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_shape_roots_cp) == JMEM_CP_NULL);
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
   ecma_finalize_lit_storage ();
+
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+  JERRY_ASSERT (JERRY_CONTEXT (vm_frame_segment_p) == NULL);
+  vm_free_unused_frame_segments ();
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
 } /* ecma_finalize */
 
 /**
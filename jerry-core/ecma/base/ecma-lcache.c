@@ -167,11 +167,18 @@ ecma_lcache_lookup (const ecma_object_t *object_p, /**< object */
   ecma_lcache_hash_entry_t *entry_end_p = entry_p + ECMA_LCACHE_HASH_ROW_LENGTH;
   ecma_lcache_hash_entry_id_t id = ECMA_LCACHE_CREATE_ID (object_cp, prop_name_cp);
 
+#if ENABLED (JERRY_MEM_STATS)
+  JERRY_CONTEXT (lcache_stats).lookups++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
   do
   {
     if (entry_p->id == id && JERRY_LIKELY (ECMA_PROPERTY_GET_NAME_TYPE (*entry_p->prop_p) == prop_name_type))
     {
       JERRY_ASSERT (entry_p->prop_p != NULL && ecma_is_property_lcached (entry_p->prop_p));
+#if ENABLED (JERRY_MEM_STATS)
+      JERRY_CONTEXT (lcache_stats).hits++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
       return entry_p->prop_p;
     }
     entry_p++;
@@ -217,6 +224,266 @@ ecma_lcache_invalidate (const ecma_object_t *object_p, /**< object */
   }
 } /* ecma_lcache_invalidate */
 
+#if JERRY_LCACHE_PROTOTYPE_ROWS > 0
+
+/**
+ * Compute the row index of a property name in the prototype table
+ *
+ * Note: the row only depends on the characters of the name, so the entries
+ *       of a name can be found from any string which has the same characters.
+ *
+ * @return row index
+ */
+static inline size_t JERRY_ATTR_ALWAYS_INLINE
+ecma_lcache_proto_row_index (lit_string_hash_t name_hash) /**< hash of the property name */
+{
+  return (size_t) (name_hash & (ECMA_LCACHE_PROTO_ROWS_COUNT - 1));
+} /* ecma_lcache_proto_row_index */
+
+/**
+ * Insert a property found on the prototype chain into LCache
+ *
+ * Note: the property must be a named property of the holder object, which is found by
+ *       searching the property name from the start object along the prototype chain
+ */
+void
+ecma_lcache_proto_insert (const ecma_object_t *object_p, /**< object where the search is started */
+                          const ecma_object_t *holder_p, /**< object which has the property */
+                          const ecma_string_t *name_p, /**< property name */
+                          ecma_property_t *prop_p) /**< property */
+{
+  JERRY_ASSERT (object_p != NULL && holder_p != NULL);
+  JERRY_ASSERT (prop_p != NULL);
+  JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (*prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+                || ECMA_PROPERTY_GET_TYPE (*prop_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
+
+  /* The name of the entry must be kept alive by the property,
+   * so it is taken from the property pair of the holder. */
+  jmem_cpointer_t prop_iter_cp = holder_p->u1.property_list_cp;
+  jmem_cpointer_t name_cp = JMEM_CP_NULL;
+
+  while (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+    if (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p))
+    {
+      if (prop_p == prop_iter_p->types + 0 || prop_p == prop_iter_p->types + 1)
+      {
+        name_cp = ((ecma_property_pair_t *) prop_iter_p)->names_cp[prop_p - prop_iter_p->types];
+        break;
+      }
+    }
+
+    prop_iter_cp = prop_iter_p->next_property_cp;
+  }
+
+  JERRY_ASSERT (prop_iter_cp != JMEM_CP_NULL);
+
+  ecma_lcache_proto_entry_t *entry_p;
+  entry_p = JERRY_CONTEXT (lcache_proto)[ecma_lcache_proto_row_index (ecma_string_hash (name_p))];
+
+  /* The new entry is stored at the start of the row. */
+  entry_p[1] = entry_p[0];
+
+  entry_p->prop_p = prop_p;
+  entry_p->epoch = JERRY_CONTEXT (lcache_proto_epoch);
+  ECMA_SET_NON_NULL_POINTER (entry_p->object_cp, object_p);
+  entry_p->name_cp = name_cp;
+} /* ecma_lcache_proto_insert */
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+
+/**
+ * Insert a property described by the shape of its holder object into LCache
+ *
+ * Note: the property is found by searching its name from the start object along the prototype chain,
+ *       and the entry is only valid until the holder object has the same shape
+ */
+void
+ecma_lcache_proto_insert_shape (const ecma_object_t *object_p, /**< object where the search is started */
+                                const ecma_object_t *holder_p, /**< object which has the property */
+                                const ecma_string_t *name_p, /**< property name */
+                                const ecma_shape_t *shape_p) /**< shape which describes the property */
+{
+  JERRY_ASSERT (object_p != NULL && holder_p != NULL);
+  JERRY_ASSERT (ECMA_OBJECT_HAS_SHAPE (holder_p));
+
+  ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, holder_p->u1.property_list_cp);
+
+  ecma_lcache_proto_entry_t *entry_p;
+  entry_p = JERRY_CONTEXT (lcache_proto)[ecma_lcache_proto_row_index (ecma_string_hash (name_p))];
+
+  /* The new entry is stored at the start of the row. */
+  entry_p[1] = entry_p[0];
+
+  /* The name of the entry is kept alive by the shape. */
+  entry_p->prop_p = NULL;
+  entry_p->epoch = JERRY_CONTEXT (lcache_proto_epoch);
+  ECMA_SET_NON_NULL_POINTER (entry_p->object_cp, object_p);
+  entry_p->name_cp = shape_p->name_cp;
+  ECMA_SET_NON_NULL_POINTER (entry_p->holder_cp, holder_p);
+  entry_p->shape_cp = values_p->header.next_property_cp;
+  entry_p->property = shape_p->property;
+  entry_p->index = (uint8_t) (shape_p->property_count - 1);
+} /* ecma_lcache_proto_insert_shape */
+
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+/**
+ * Lookup a property found on the prototype chain in LCache
+ *
+ * @return pointer to the value of the property if the lookup is successful
+ *         NULL otherwise
+ */
+ecma_property_value_t *
+ecma_lcache_proto_lookup (const ecma_object_t *object_p, /**< object where the search is started */
+                          const ecma_string_t *name_p, /**< property name */
+                          ecma_property_t *property_p) /**< [out] type and flags of the property */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (name_p != NULL);
+
+  jmem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  ecma_property_t name_type = ECMA_DIRECT_STRING_PTR;
+  jmem_cpointer_t name_cp;
+
+  if (JERRY_UNLIKELY (ECMA_IS_DIRECT_STRING (name_p)))
+  {
+    name_type = (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (name_p);
+    name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p);
+  }
+  else
+  {
+    ECMA_SET_NON_NULL_POINTER (name_cp, name_p);
+  }
+
+  ecma_lcache_proto_entry_t *entry_p;
+  entry_p = JERRY_CONTEXT (lcache_proto)[ecma_lcache_proto_row_index (ecma_string_hash (name_p))];
+  ecma_lcache_proto_entry_t *entry_end_p = entry_p + ECMA_LCACHE_PROTO_ROW_LENGTH;
+  uint32_t epoch = JERRY_CONTEXT (lcache_proto_epoch);
+
+#if ENABLED (JERRY_MEM_STATS)
+  JERRY_CONTEXT (lcache_stats).proto_lookups++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  do
+  {
+    if (entry_p->object_cp == object_cp
+        && entry_p->name_cp == name_cp
+        && entry_p->epoch == epoch)
+    {
+#if ENABLED (JERRY_OBJECT_SHAPES)
+      if (entry_p->prop_p == NULL)
+      {
+        /* The values of the holder are only accessed when it still has the same shape. */
+        ecma_object_t *holder_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, entry_p->holder_cp);
+
+        if (ECMA_OBJECT_HAS_SHAPE (holder_p)
+            && ECMA_PROPERTY_GET_NAME_TYPE (entry_p->property) == name_type)
+        {
+          ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t,
+                                                                     holder_p->u1.property_list_cp);
+
+          if (values_p->header.next_property_cp == entry_p->shape_cp)
+          {
+#if ENABLED (JERRY_MEM_STATS)
+            JERRY_CONTEXT (lcache_stats).proto_hits++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+            *property_p = entry_p->property;
+            return ECMA_SHAPE_GET_VALUES (values_p) + entry_p->index;
+          }
+        }
+      }
+      else
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+      /* The property is only accessed when the entry is valid. */
+      if (JERRY_LIKELY (ECMA_PROPERTY_GET_NAME_TYPE (*entry_p->prop_p) == name_type))
+      {
+#if ENABLED (JERRY_MEM_STATS)
+        JERRY_CONTEXT (lcache_stats).proto_hits++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+        *property_p = *entry_p->prop_p;
+        return ECMA_PROPERTY_VALUE_PTR (entry_p->prop_p);
+      }
+    }
+    entry_p++;
+  }
+  while (entry_p < entry_end_p);
+
+  return NULL;
+} /* ecma_lcache_proto_lookup */
+
+/**
+ * Get the index of an object in the filter of the objects on the searched prototype chains
+ */
+#define ECMA_LCACHE_PROTO_FILTER_INDEX(object_p) \
+  ((uint32_t) (((uintptr_t) (object_p) >> JMEM_ALIGNMENT_LOG) % ECMA_LCACHE_PROTO_FILTER_BITS))
+
+/**
+ * Mark an object of a prototype chain searched by LCache
+ *
+ * Note: the results of the chain may change when a property of the object is created or deleted
+ */
+void
+ecma_lcache_proto_mark (const ecma_object_t *object_p) /**< object */
+{
+  uint32_t index = ECMA_LCACHE_PROTO_FILTER_INDEX (object_p);
+
+  JERRY_CONTEXT (lcache_proto_filter)[index >> 5] |= (uint32_t) 1 << (index & 0x1f);
+} /* ecma_lcache_proto_mark */
+
+/**
+ * Check whether an object may be on a prototype chain searched by LCache since the last epoch
+ *
+ * @return true - if the object may be on a searched prototype chain
+ *         false - otherwise
+ */
+inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_lcache_proto_is_marked (const ecma_object_t *object_p) /**< object */
+{
+  uint32_t index = ECMA_LCACHE_PROTO_FILTER_INDEX (object_p);
+
+  return (JERRY_CONTEXT (lcache_proto_filter)[index >> 5] & ((uint32_t) 1 << (index & 0x1f))) != 0;
+} /* ecma_lcache_proto_is_marked */
+
+/**
+ * Invalidate the prototype chain results of a property name
+ *
+ * Note: this function must be called when a property of a marked object is created
+ *       or deleted, since the property may hide or remove a cached property
+ */
+void
+ecma_lcache_proto_invalidate (lit_string_hash_t name_hash) /**< hash of the property name */
+{
+  ecma_lcache_proto_entry_t *entry_p = JERRY_CONTEXT (lcache_proto)[ecma_lcache_proto_row_index (name_hash)];
+
+  entry_p[0].object_cp = JMEM_CP_NULL;
+  entry_p[1].object_cp = JMEM_CP_NULL;
+} /* ecma_lcache_proto_invalidate */
+
+/**
+ * Invalidate all prototype chain results
+ *
+ * Note: this function must be called when a prototype is changed or objects are freed
+ */
+void
+ecma_lcache_proto_invalidate_all (void)
+{
+  /* No object is on the prototype chain of a valid result. */
+  memset (JERRY_CONTEXT (lcache_proto_filter), 0, sizeof (JERRY_CONTEXT (lcache_proto_filter)));
+
+  if (JERRY_UNLIKELY (++JERRY_CONTEXT (lcache_proto_epoch) == 0))
+  {
+    /* The old entries must not match after the epoch is wrapped around. */
+    memset (JERRY_CONTEXT (lcache_proto), 0, sizeof (JERRY_CONTEXT (lcache_proto)));
+  }
+} /* ecma_lcache_proto_invalidate_all */
+
+#endif /* JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
+
 #endif /* ENABLED (JERRY_LCACHE) */
 
 /**
@@ -16,6 +16,8 @@
 #ifndef ECMA_LCACHE_H
 #define ECMA_LCACHE_H
 
+#include "ecma-shape.h"
+
 /** \addtogroup ecma ECMA
  * @{
  *
@@ -28,6 +30,21 @@ void ecma_lcache_insert (const ecma_object_t *object_p, const jmem_cpointer_t na
 ecma_property_t *ecma_lcache_lookup (const ecma_object_t *object_p, const ecma_string_t *prop_name_p);
 void ecma_lcache_invalidate (const ecma_object_t *object_p, const jmem_cpointer_t name_cp, ecma_property_t *prop_p);
 
+#if JERRY_LCACHE_PROTOTYPE_ROWS > 0
+void ecma_lcache_proto_insert (const ecma_object_t *object_p, const ecma_object_t *holder_p,
+                               const ecma_string_t *name_p, ecma_property_t *prop_p);
+#if ENABLED (JERRY_OBJECT_SHAPES)
+void ecma_lcache_proto_insert_shape (const ecma_object_t *object_p, const ecma_object_t *holder_p,
+                                     const ecma_string_t *name_p, const ecma_shape_t *shape_p);
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+ecma_property_value_t *ecma_lcache_proto_lookup (const ecma_object_t *object_p, const ecma_string_t *name_p,
+                                                 ecma_property_t *property_p);
+void ecma_lcache_proto_mark (const ecma_object_t *object_p);
+bool ecma_lcache_proto_is_marked (const ecma_object_t *object_p);
+void ecma_lcache_proto_invalidate (lit_string_hash_t name_hash);
+void ecma_lcache_proto_invalidate_all (void);
+#endif /* JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
+
 #endif /* ENABLED (JERRY_LCACHE) */
 
 /**
@@ -0,0 +1,228 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-line-info.h"
+#include "jmem.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmalineinfo Line info
+ * @{
+ */
+
+#if ENABLED (JERRY_LINE_INFO)
+
+/*
+ * The line info of a compiled code is stored in a separate block. The
+ * block starts with the size of the entries, which is followed by the
+ * entries. Each entry is a byte code offset and line pair: the offset is
+ * encoded as the difference from the offset of the previous entry, and the
+ * line is encoded as the zigzag encoded difference from the line of the
+ * previous entry. The byte code between the offsets of two entries belongs
+ * to the line of the first entry.
+ *
+ * All values are encoded in the same variable length format as the line
+ * numbers of the parser: seven bits are stored in each byte starting from
+ * the most significant bits, and the highest bit is set for all bytes
+ * except the last one.
+ */
+
+/**
+ * Mask of the bits stored in a byte of an encoded value.
+ */
+#define ECMA_LINE_INFO_VALUE_MASK 0x7f
+
+/**
+ * Flag of the bytes which are followed by further bytes of an encoded value.
+ */
+#define ECMA_LINE_INFO_HAS_NEXT_BYTE 0x80
+
+/**
+ * Encode an unsigned value.
+ *
+ * @return position after the encoded value
+ */
+uint8_t *
+ecma_line_info_encode_value (uint8_t *buffer_p, /**< target buffer */
+                             uint32_t value) /**< encoded value */
+{
+  uint32_t shift = 7;
+
+  while (shift < 7 * ECMA_LINE_INFO_ENCODED_VALUE_MAX_SIZE && (value >> shift) > 0)
+  {
+    shift += 7;
+  }
+
+  do
+  {
+    shift -= 7;
+
+    uint8_t byte = (uint8_t) ((value >> shift) & ECMA_LINE_INFO_VALUE_MASK);
+
+    if (shift > 0)
+    {
+      byte |= ECMA_LINE_INFO_HAS_NEXT_BYTE;
+    }
+
+    *buffer_p++ = byte;
+  }
+  while (shift > 0);
+
+  return buffer_p;
+} /* ecma_line_info_encode_value */
+
+/**
+ * Decode an unsigned value.
+ *
+ * @return position after the encoded value
+ */
+static const uint8_t *
+ecma_line_info_decode_value (const uint8_t *buffer_p, /**< encoded value */
+                             uint32_t *value_p) /**< [out] decoded value */
+{
+  uint32_t value = 0;
+  uint8_t byte;
+
+  do
+  {
+    byte = *buffer_p++;
+    value = (value << 7) | (byte & ECMA_LINE_INFO_VALUE_MASK);
+  }
+  while (byte & ECMA_LINE_INFO_HAS_NEXT_BYTE);
+
+  *value_p = value;
+  return buffer_p;
+} /* ecma_line_info_decode_value */
+
+/**
+ * Encode a line info entry.
+ *
+ * @return position after the encoded entry
+ */
+uint8_t *
+ecma_line_info_encode_entry (uint8_t *buffer_p, /**< target buffer */
+                             uint32_t offset_delta, /**< difference from the byte code offset of the previous entry */
+                             uint32_t line, /**< line of the entry */
+                             uint32_t last_line) /**< line of the previous entry */
+{
+  uint32_t line_delta;
+
+  if (line >= last_line)
+  {
+    line_delta = (line - last_line) << 1;
+  }
+  else
+  {
+    line_delta = ((last_line - line) << 1) - 1;
+  }
+
+  buffer_p = ecma_line_info_encode_value (buffer_p, offset_delta);
+  return ecma_line_info_encode_value (buffer_p, line_delta);
+} /* ecma_line_info_encode_entry */
+
+/**
+ * Get the size of a line info block whose entries use the given number of bytes.
+ *
+ * @return size of the line info block
+ */
+size_t
+ecma_line_info_get_block_size (uint32_t entries_size) /**< size of the entries */
+{
+  uint8_t buffer[ECMA_LINE_INFO_ENCODED_VALUE_MAX_SIZE];
+  uint8_t *buffer_end_p = ecma_line_info_encode_value (buffer, entries_size);
+
+  return (size_t) (buffer_end_p - buffer) + entries_size;
+} /* ecma_line_info_get_block_size */
+
+/**
+ * Get the line which belongs to a byte code offset.
+ *
+ * @return line number - if the offset is covered by the line info
+ *         0 - otherwise
+ */
+uint32_t
+ecma_line_info_get_line (const uint8_t *line_info_p, /**< line info block */
+                         uint32_t offset) /**< byte code offset */
+{
+  uint32_t entries_size;
+  line_info_p = ecma_line_info_decode_value (line_info_p, &entries_size);
+
+  const uint8_t *line_info_end_p = line_info_p + entries_size;
+  uint32_t entry_offset = 0;
+  uint32_t line = 0;
+
+  while (line_info_p < line_info_end_p)
+  {
+    uint32_t value;
+    line_info_p = ecma_line_info_decode_value (line_info_p, &value);
+
+    entry_offset += value;
+
+    if (entry_offset > offset)
+    {
+      break;
+    }
+
+    line_info_p = ecma_line_info_decode_value (line_info_p, &value);
+
+    if (value & 0x1)
+    {
+      line -= (value + 1) >> 1;
+    }
+    else
+    {
+      line += value >> 1;
+    }
+  }
+
+  return line;
+} /* ecma_line_info_get_line */
+
+/**
+ * Get the size of a line info block.
+ *
+ * @return size of the line info block
+ */
+size_t
+ecma_line_info_get_size (const uint8_t *line_info_p) /**< line info block */
+{
+  uint32_t entries_size;
+  ecma_line_info_decode_value (line_info_p, &entries_size);
+
+  return ecma_line_info_get_block_size (entries_size);
+} /* ecma_line_info_get_size */
+
+/**
+ * Free a line info block.
+ */
+void
+ecma_line_info_free (uint8_t *line_info_p) /**< line info block */
+{
+  size_t size = ecma_line_info_get_size (line_info_p);
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_free_byte_code_bytes (size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  jmem_heap_free_block (line_info_p, size);
+} /* ecma_line_info_free */
+
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
+/**
+ * @}
+ * @}
+ */
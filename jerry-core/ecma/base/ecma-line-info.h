@@ -0,0 +1,54 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_LINE_INFO_H
+#define ECMA_LINE_INFO_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmalineinfo Line info
+ * @{
+ */
+
+#if ENABLED (JERRY_LINE_INFO)
+
+/**
+ * Maximum number of bytes used by an encoded 32 bit value.
+ */
+#define ECMA_LINE_INFO_ENCODED_VALUE_MAX_SIZE 5
+
+/**
+ * Maximum number of bytes used by an entry of the line info.
+ */
+#define ECMA_LINE_INFO_ENTRY_MAX_SIZE (2 * ECMA_LINE_INFO_ENCODED_VALUE_MAX_SIZE)
+
+uint8_t *ecma_line_info_encode_value (uint8_t *buffer_p, uint32_t value);
+uint8_t *ecma_line_info_encode_entry (uint8_t *buffer_p, uint32_t offset_delta, uint32_t line, uint32_t last_line);
+size_t ecma_line_info_get_block_size (uint32_t entries_size);
+size_t ecma_line_info_get_size (const uint8_t *line_info_p);
+uint32_t ecma_line_info_get_line (const uint8_t *line_info_p, uint32_t offset);
+void ecma_line_info_free (uint8_t *line_info_p);
+
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_LINE_INFO_H */
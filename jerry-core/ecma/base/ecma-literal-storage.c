@@ -142,12 +142,292 @@ ecma_free_bigint_list (jmem_cpointer_t bigint_list_cp) /**< bigint list */
 
 #endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
 
+/**
+ * Append a value to a literal storage list.
+ *
+ * Note:
+ *   values are never removed from the literal storage lists, so only
+ *   the first item of a list can have free slots
+ */
+static void
+ecma_lit_storage_list_append (jmem_cpointer_t *list_first_cp_p, /**< [in,out] first item of the list */
+                              jmem_cpointer_t value_cp) /**< compressed pointer of the value */
+{
+  if (*list_first_cp_p != JMEM_CP_NULL)
+  {
+    ecma_lit_storage_item_t *first_item_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t,
+                                                                          *list_first_cp_p);
+
+    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      if (first_item_p->values[i] == JMEM_CP_NULL)
+      {
+        first_item_p->values[i] = value_cp;
+        return;
+      }
+    }
+  }
+
+  ecma_lit_storage_item_t *new_item_p;
+  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
+
+  new_item_p->values[0] = value_cp;
+  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+  {
+    new_item_p->values[i] = JMEM_CP_NULL;
+  }
+
+  new_item_p->next_cp = *list_first_cp_p;
+  JMEM_CP_SET_NON_NULL_POINTER (*list_first_cp_p, new_item_p);
+} /* ecma_lit_storage_list_append */
+
+#if ENABLED (JERRY_LITERAL_HASHMAP)
+
+/**
+ * Minimum number of literals in the literal storage for allocating the hashmap.
+ */
+#define ECMA_LIT_HASHMAP_MIN_COUNT 32
+
+/**
+ * Compute the first hashmap slot of a hash value.
+ *
+ * @return slot index
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_lit_hashmap_get_slot (uint32_t hash, /**< hash value */
+                           uint32_t mask) /**< hashmap mask */
+{
+  hash *= 0x9e3779b1u;
+  return (hash ^ (hash >> 16)) & mask;
+} /* ecma_lit_hashmap_get_slot */
+
+/**
+ * Compute the hash of a literal number.
+ *
+ * @return hash value
+ */
+static uint32_t
+ecma_lit_hashmap_number_hash (ecma_number_t number) /**< number */
+{
+  uint32_t words[(sizeof (ecma_number_t) + sizeof (uint32_t) - 1) / sizeof (uint32_t)] = { 0 };
+  memcpy (words, &number, sizeof (ecma_number_t));
+
+  uint32_t hash = 0;
+
+  for (uint32_t i = 0; i < sizeof (words) / sizeof (uint32_t); i++)
+  {
+    hash = (hash * 31) ^ words[i];
+  }
+
+  return hash;
+} /* ecma_lit_hashmap_number_hash */
+
+#if ENABLED (JERRY_BUILTIN_BIGINT)
+
+/**
+ * Compute the hash of a literal BigInt.
+ *
+ * @return hash value
+ */
+static uint32_t
+ecma_lit_hashmap_bigint_hash (ecma_value_t bigint) /**< non-zero BigInt value */
+{
+  ecma_extended_primitive_t *bigint_p = ecma_get_extended_primitive_from_value (bigint);
+  uint32_t size = ECMA_BIGINT_GET_SIZE (bigint_p);
+  uint32_t hash = bigint_p->u.bigint_sign_and_size;
+
+  for (uint32_t i = 0; i < size; i += (uint32_t) sizeof (ecma_bigint_digit_t))
+  {
+    hash = (hash * 31) ^ *ECMA_BIGINT_GET_DIGITS (bigint_p, i);
+  }
+
+  return hash;
+} /* ecma_lit_hashmap_bigint_hash */
+
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+
+/**
+ * Compute the hash of a value stored in the literal storage.
+ *
+ * @return hash value
+ */
+static uint32_t
+ecma_lit_hashmap_value_hash (ecma_value_t value) /**< literal value */
+{
+  if (ecma_is_value_string (value))
+  {
+    return ecma_string_hash (ecma_get_string_from_value (value));
+  }
+
+#if ENABLED (JERRY_BUILTIN_BIGINT)
+  if (ecma_is_value_bigint (value))
+  {
+    return ecma_lit_hashmap_bigint_hash (value);
+  }
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+
+  return ecma_lit_hashmap_number_hash (ecma_get_float_from_value (value));
+} /* ecma_lit_hashmap_value_hash */
+
+/**
+ * Insert a value into a literal hashmap which has free slots.
+ */
+static void
+ecma_lit_hashmap_insert (ecma_value_t *hashmap_p, /**< hashmap */
+                         uint32_t mask, /**< hashmap mask */
+                         ecma_value_t value) /**< literal value */
+{
+  uint32_t slot = ecma_lit_hashmap_get_slot (ecma_lit_hashmap_value_hash (value), mask);
+
+  while (hashmap_p[slot] != ECMA_VALUE_EMPTY)
+  {
+    slot = (slot + 1) & mask;
+  }
+
+  hashmap_p[slot] = value;
+} /* ecma_lit_hashmap_insert */
+
+/**
+ * Free the literal hashmap.
+ */
+static void
+ecma_lit_hashmap_free (void)
+{
+  ecma_value_t *hashmap_p = JERRY_CONTEXT (lit_hashmap_p);
+
+  if (hashmap_p != NULL)
+  {
+    jmem_heap_free_block (hashmap_p, ((size_t) JERRY_CONTEXT (lit_hashmap_mask) + 1) * sizeof (ecma_value_t));
+    JERRY_CONTEXT (lit_hashmap_p) = NULL;
+  }
+} /* ecma_lit_hashmap_free */
+
+/**
+ * Insert all values of a literal storage list into the hashmap.
+ */
+static void
+ecma_lit_hashmap_insert_list (ecma_value_t *hashmap_p, /**< hashmap */
+                              uint32_t mask, /**< hashmap mask */
+                              jmem_cpointer_t list_cp, /**< first item of the list */
+                              ecma_type_t type) /**< type of the values */
+{
+  while (list_cp != JMEM_CP_NULL)
+  {
+    ecma_lit_storage_item_t *list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, list_cp);
+
+    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      if (list_p->values[i] != JMEM_CP_NULL)
+      {
+        void *value_p = JMEM_CP_GET_NON_NULL_POINTER (void, list_p->values[i]);
+        ecma_value_t value;
+
+        if (type == ECMA_TYPE_STRING)
+        {
+          value = ecma_make_string_value ((ecma_string_t *) value_p);
+        }
+        else if (type == ECMA_TYPE_FLOAT)
+        {
+          value = ecma_make_float_value ((ecma_number_t *) value_p);
+        }
+        else
+        {
+          value = ecma_make_extended_primitive_value ((ecma_extended_primitive_t *) value_p, type);
+        }
+
+        ecma_lit_hashmap_insert (hashmap_p, mask, value);
+      }
+    }
+
+    list_cp = list_p->next_cp;
+  }
+} /* ecma_lit_hashmap_insert_list */
+
+/**
+ * Rebuild the literal hashmap from the literal storage lists.
+ *
+ * Note:
+ *   if the allocation fails, the hashmap is not used until the next rebuild
+ */
+static void
+ecma_lit_hashmap_rebuild (void)
+{
+  ecma_lit_hashmap_free ();
+
+  uint32_t slot_count = 2 * ECMA_LIT_HASHMAP_MIN_COUNT;
+
+  while (slot_count < 2 * JERRY_CONTEXT (lit_storage_count))
+  {
+    slot_count <<= 1;
+  }
+
+  ecma_value_t *hashmap_p = jmem_heap_alloc_block_null_on_error (slot_count * sizeof (ecma_value_t));
+
+  if (hashmap_p == NULL)
+  {
+    return;
+  }
+
+  for (uint32_t i = 0; i < slot_count; i++)
+  {
+    hashmap_p[i] = ECMA_VALUE_EMPTY;
+  }
+
+  uint32_t mask = slot_count - 1;
+
+  ecma_lit_hashmap_insert_list (hashmap_p, mask, JERRY_CONTEXT (string_list_first_cp), ECMA_TYPE_STRING);
+  ecma_lit_hashmap_insert_list (hashmap_p, mask, JERRY_CONTEXT (number_list_first_cp), ECMA_TYPE_FLOAT);
+#if ENABLED (JERRY_BUILTIN_BIGINT)
+  ecma_lit_hashmap_insert_list (hashmap_p, mask, JERRY_CONTEXT (bigint_list_first_cp), ECMA_TYPE_BIGINT);
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+
+  JERRY_CONTEXT (lit_hashmap_p) = hashmap_p;
+  JERRY_CONTEXT (lit_hashmap_mask) = mask;
+} /* ecma_lit_hashmap_rebuild */
+
+/**
+ * Register a value which has been appended to the literal storage.
+ */
+static void
+ecma_lit_hashmap_add (ecma_value_t value) /**< literal value */
+{
+  uint32_t count = ++JERRY_CONTEXT (lit_storage_count);
+  ecma_value_t *hashmap_p = JERRY_CONTEXT (lit_hashmap_p);
+
+  if (hashmap_p == NULL)
+  {
+    /* A failed allocation is retried when the count reaches the next power of 2. */
+    if (count >= ECMA_LIT_HASHMAP_MIN_COUNT && (count & (count - 1)) == 0)
+    {
+      ecma_lit_hashmap_rebuild ();
+    }
+    return;
+  }
+
+  uint32_t mask = JERRY_CONTEXT (lit_hashmap_mask);
+
+  /* Keep the load factor below 3/4. */
+  if (count * 4 > (mask + 1) * 3)
+  {
+    ecma_lit_hashmap_rebuild ();
+    return;
+  }
+
+  ecma_lit_hashmap_insert (hashmap_p, mask, value);
+} /* ecma_lit_hashmap_add */
+
+#endif /* ENABLED (JERRY_LITERAL_HASHMAP) */
+
 /**
  * Finalize literal storage
  */
 void
 ecma_finalize_lit_storage (void)
 {
+#if ENABLED (JERRY_LITERAL_HASHMAP)
+  ecma_lit_hashmap_free ();
+  JERRY_CONTEXT (lit_storage_count) = 0;
+#endif /* ENABLED (JERRY_LITERAL_HASHMAP) */
 #if ENABLED (JERRY_ESNEXT)
   ecma_free_symbol_list (JERRY_CONTEXT (symbol_list_first_cp));
 #endif /* ENABLED (JERRY_ESNEXT) */
@@ -175,7 +455,32 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
   }
 
   jmem_cpointer_t string_list_cp = JERRY_CONTEXT (string_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+
+#if ENABLED (JERRY_LITERAL_HASHMAP)
+  ecma_value_t *hashmap_p = JERRY_CONTEXT (lit_hashmap_p);
+
+  if (hashmap_p != NULL)
+  {
+    uint32_t mask = JERRY_CONTEXT (lit_hashmap_mask);
+    uint32_t slot = ecma_lit_hashmap_get_slot (ecma_string_hash (string_p), mask);
+
+    while (hashmap_p[slot] != ECMA_VALUE_EMPTY)
+    {
+      if (ecma_is_value_string (hashmap_p[slot])
+          && ecma_compare_ecma_strings (string_p, ecma_get_string_from_value (hashmap_p[slot])))
+      {
+        /* Return with string if found in the hashmap. */
+        ecma_deref_ecma_string (string_p);
+        return hashmap_p[slot];
+      }
+
+      slot = (slot + 1) & mask;
+    }
+
+    /* The hashmap contains all literals. */
+    string_list_cp = JMEM_CP_NULL;
+  }
+#endif /* ENABLED (JERRY_LITERAL_HASHMAP) */
 
   while (string_list_cp != JMEM_CP_NULL)
   {
@@ -183,14 +488,7 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
 
     for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
     {
-      if (string_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = string_list_p->values + i;
-        }
-      }
-      else
+      if (string_list_p->values[i] != JMEM_CP_NULL)
       {
         ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t,
                                                                string_list_p->values[i]);
@@ -210,28 +508,30 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
   ECMA_SET_STRING_AS_STATIC (string_p);
   jmem_cpointer_t result;
   JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
+  ecma_lit_storage_list_append (&JERRY_CONTEXT (string_list_first_cp), result);
 
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return ecma_make_string_value (string_p);
-  }
-
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
-
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
-
-  new_item_p->next_cp = JERRY_CONTEXT (string_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (string_list_first_cp), new_item_p);
+#if ENABLED (JERRY_LITERAL_HASHMAP)
+  ecma_lit_hashmap_add (ecma_make_string_value (string_p));
+#endif /* ENABLED (JERRY_LITERAL_HASHMAP) */
 
   return ecma_make_string_value (string_p);
 } /* ecma_find_or_create_literal_string */
 
+/**
+ * Checks whether two numbers are the same literal. The bit patterns are compared,
+ * so negative and positive zeros are different literals, and equal NaN values are
+ * the same literal.
+ *
+ * @return true - if the numbers are the same literal
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_lit_storage_number_equals (ecma_number_t left_num, /**< left number */
+                                ecma_number_t right_num) /**< right number */
+{
+  return memcmp (&left_num, &right_num, sizeof (ecma_number_t)) == 0;
+} /* ecma_lit_storage_number_equals */
+
 /**
  * Find or create a literal number.
  *
@@ -250,7 +550,31 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
   JERRY_ASSERT (ecma_is_value_float_number (num));
 
   jmem_cpointer_t number_list_cp = JERRY_CONTEXT (number_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+
+#if ENABLED (JERRY_LITERAL_HASHMAP)
+  ecma_value_t *hashmap_p = JERRY_CONTEXT (lit_hashmap_p);
+
+  if (hashmap_p != NULL)
+  {
+    uint32_t mask = JERRY_CONTEXT (lit_hashmap_mask);
+    uint32_t slot = ecma_lit_hashmap_get_slot (ecma_lit_hashmap_number_hash (number_arg), mask);
+
+    while (hashmap_p[slot] != ECMA_VALUE_EMPTY)
+    {
+      if (ecma_is_value_float_number (hashmap_p[slot])
+          && ecma_lit_storage_number_equals (ecma_get_float_from_value (hashmap_p[slot]), number_arg))
+      {
+        ecma_free_value (num);
+        return hashmap_p[slot];
+      }
+
+      slot = (slot + 1) & mask;
+    }
+
+    /* The hashmap contains all literals. */
+    number_list_cp = JMEM_CP_NULL;
+  }
+#endif /* ENABLED (JERRY_LITERAL_HASHMAP) */
 
   while (number_list_cp != JMEM_CP_NULL)
   {
@@ -259,19 +583,12 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
 
     for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
     {
-      if (number_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = number_list_p->values + i;
-        }
-      }
-      else
+      if (number_list_p->values[i] != JMEM_CP_NULL)
       {
         ecma_number_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t,
                                                                 number_list_p->values[i]);
 
-        if (*number_p == number_arg)
+        if (ecma_lit_storage_number_equals (*number_p, number_arg))
         {
           ecma_free_value (num);
           return ecma_make_float_value (number_p);
@@ -284,24 +601,11 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
 
   jmem_cpointer_t result;
   JMEM_CP_SET_NON_NULL_POINTER (result, ecma_get_pointer_from_float_value (num));
+  ecma_lit_storage_list_append (&JERRY_CONTEXT (number_list_first_cp), result);
 
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return num;
-  }
-
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
-
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
-
-  new_item_p->next_cp = JERRY_CONTEXT (number_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (number_list_first_cp), new_item_p);
+#if ENABLED (JERRY_LITERAL_HASHMAP)
+  ecma_lit_hashmap_add (num);
+#endif /* ENABLED (JERRY_LITERAL_HASHMAP) */
 
   return num;
 } /* ecma_find_or_create_literal_number */
@@ -324,7 +628,31 @@ ecma_find_or_create_literal_bigint (ecma_value_t bigint) /**< bigint to be searc
   }
 
   jmem_cpointer_t bigint_list_cp = JERRY_CONTEXT (bigint_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+
+#if ENABLED (JERRY_LITERAL_HASHMAP)
+  ecma_value_t *hashmap_p = JERRY_CONTEXT (lit_hashmap_p);
+
+  if (hashmap_p != NULL)
+  {
+    uint32_t mask = JERRY_CONTEXT (lit_hashmap_mask);
+    uint32_t slot = ecma_lit_hashmap_get_slot (ecma_lit_hashmap_bigint_hash (bigint), mask);
+
+    while (hashmap_p[slot] != ECMA_VALUE_EMPTY)
+    {
+      if (ecma_is_value_bigint (hashmap_p[slot])
+          && ecma_bigint_is_equal_to_bigint (bigint, hashmap_p[slot]))
+      {
+        ecma_free_value (bigint);
+        return hashmap_p[slot];
+      }
+
+      slot = (slot + 1) & mask;
+    }
+
+    /* The hashmap contains all literals. */
+    bigint_list_cp = JMEM_CP_NULL;
+  }
+#endif /* ENABLED (JERRY_LITERAL_HASHMAP) */
 
   while (bigint_list_cp != JMEM_CP_NULL)
   {
@@ -333,14 +661,7 @@ ecma_find_or_create_literal_bigint (ecma_value_t bigint) /**< bigint to be searc
 
     for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
     {
-      if (bigint_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = bigint_list_p->values + i;
-        }
-      }
-      else
+      if (bigint_list_p->values[i] != JMEM_CP_NULL)
       {
         ecma_extended_primitive_t *other_bigint_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_extended_primitive_t,
                                                                                   bigint_list_p->values[i]);
@@ -359,24 +680,11 @@ ecma_find_or_create_literal_bigint (ecma_value_t bigint) /**< bigint to be searc
 
   jmem_cpointer_t result;
   JMEM_CP_SET_NON_NULL_POINTER (result, ecma_get_extended_primitive_from_value (bigint));
+  ecma_lit_storage_list_append (&JERRY_CONTEXT (bigint_list_first_cp), result);
 
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return bigint;
-  }
-
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
-
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
-
-  new_item_p->next_cp = JERRY_CONTEXT (bigint_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (bigint_list_first_cp), new_item_p);
+#if ENABLED (JERRY_LITERAL_HASHMAP)
+  ecma_lit_hashmap_add (bigint);
+#endif /* ENABLED (JERRY_LITERAL_HASHMAP) */
 
   return bigint;
 } /* ecma_find_or_create_literal_bigint */
@@ -66,11 +66,13 @@ static const uint8_t ecma_property_hashmap_steps[ECMA_PROPERTY_HASHMAP_NUMBER_OF
   ((byte_p)[(index) >> 3] = (uint8_t) ((byte_p)[(index) >> 3] | (1 << ((index) & 0x7))))
 
 /**
- * Create a new property hashmap for the object.
+ * Create a new property hashmap for the object if it has enough named properties.
  * The object must not have a property hashmap.
  */
-void
-ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
+static void
+ecma_property_hashmap_create_with_minimum (ecma_object_t *object_p, /**< object */
+                                           uint32_t min_property_count) /**< minimum number of
+                                                                         *   named properties */
 {
   if (JERRY_CONTEXT (ecma_prop_hashmap_alloc_state) != ECMA_PROP_HASHMAP_ALLOC_ON)
   {
@@ -103,7 +105,7 @@ ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
     prop_iter_cp = prop_iter_p->next_property_cp;
   }
 
-  if (named_property_count < (ECMA_PROPERTY_HASMAP_MINIMUM_SIZE / 2))
+  if (named_property_count == 0 || named_property_count < min_property_count)
   {
     return;
   }
@@ -189,8 +191,88 @@ ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
 
     prop_iter_cp = prop_iter_p->next_property_cp;
   }
+} /* ecma_property_hashmap_create_with_minimum */
+
+/**
+ * Create a new property hashmap for the object.
+ * The object must not have a property hashmap.
+ */
+void
+ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
+{
+  ecma_property_hashmap_create_with_minimum (object_p, ECMA_PROPERTY_HASHMAP_MIN_PROPERTY_COUNT);
 } /* ecma_property_hashmap_create */
 
+/**
+ * Create a property hashmap for the object regardless of its number of properties,
+ * since the object is expected to be used as a dictionary.
+ *
+ * @return true - if the object has a property hashmap
+ *         false - otherwise
+ */
+bool
+ecma_property_hashmap_optimize (ecma_object_t *object_p) /**< object */
+{
+  jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
+
+  if (prop_iter_cp == JMEM_CP_NULL)
+  {
+    return false;
+  }
+
+  ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+  if (prop_iter_p->types[0] != ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    ecma_property_hashmap_create_with_minimum (object_p, 1);
+    prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, object_p->u1.property_list_cp);
+  }
+
+  return prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP;
+} /* ecma_property_hashmap_optimize */
+
+/**
+ * Count the property pairs visited by a lookup which did not use a hashmap,
+ * and create a hashmap when the lookups of the object became too slow.
+ *
+ * A single lookup which visits many property pairs creates the hashmap
+ * immediately. Otherwise the visited pairs of all slow lookups are summed,
+ * and the object whose lookup reaches the limit gets a hashmap. Objects are
+ * selected in proportion to their share of the visited pairs, so frequently
+ * searched objects get a hashmap soon, while the number of created hashmaps
+ * is bounded by the amount of linear search.
+ */
+void
+ecma_property_hashmap_lookup_missed (ecma_object_t *object_p, /**< object */
+                                     uint32_t steps) /**< number of visited property pairs */
+{
+  JERRY_ASSERT (steps >= ECMA_PROPERTY_HASHMAP_ADAPTIVE_MIN_STEPS);
+
+  if (steps >= JERRY_CONTEXT (ecma_prop_hashmap_lookup_steps))
+  {
+    ecma_property_hashmap_create (object_p);
+    return;
+  }
+
+  uint32_t miss_limit = JERRY_CONTEXT (ecma_prop_hashmap_miss_limit);
+
+  if (miss_limit == 0)
+  {
+    return;
+  }
+
+  uint32_t misses = JERRY_CONTEXT (ecma_prop_hashmap_misses) + steps;
+
+  if (misses < miss_limit)
+  {
+    JERRY_CONTEXT (ecma_prop_hashmap_misses) = (uint16_t) misses;
+    return;
+  }
+
+  JERRY_CONTEXT (ecma_prop_hashmap_misses) = 0;
+  ecma_property_hashmap_create (object_p);
+} /* ecma_property_hashmap_lookup_missed */
+
 /**
  * Free the hashmap of the object.
  * The object must have a property hashmap.
@@ -246,7 +328,7 @@ ecma_property_hashmap_insert (ecma_object_t *object_p, /**< object */
   entry_index &= mask;
 
 #ifndef JERRY_NDEBUG
-  /* See the comment for this variable in ecma_property_hashmap_create. */
+  /* See the comment for this variable in ecma_property_hashmap_create_with_minimum. */
   uint32_t start_entry_index = entry_index;
 #endif /* !JERRY_NDEBUG */
 
@@ -321,7 +403,7 @@ ecma_property_hashmap_delete (ecma_object_t *object_p, /**< object */
   entry_index &= mask;
 
 #ifndef JERRY_NDEBUG
-  /* See the comment for this variable in ecma_property_hashmap_create. */
+  /* See the comment for this variable in ecma_property_hashmap_create_with_minimum. */
   uint32_t start_entry_index = entry_index;
 #endif /* !JERRY_NDEBUG */
 
@@ -415,10 +497,14 @@ ecma_property_hashmap_find (ecma_property_hashmap_t *hashmap_p, /**< hashmap */
   entry_index &= mask;
 
 #ifndef JERRY_NDEBUG
-  /* See the comment for this variable in ecma_property_hashmap_create. */
+  /* See the comment for this variable in ecma_property_hashmap_create_with_minimum. */
   uint32_t start_entry_index = entry_index;
 #endif /* !JERRY_NDEBUG */
 
+#if ENABLED (JERRY_MEM_STATS)
+  JERRY_CONTEXT (ecma_prop_hashmap_stats).lookups++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
   if (ECMA_IS_DIRECT_STRING (name_p))
   {
     ecma_property_t prop_name_type = (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (name_p);
@@ -428,6 +514,10 @@ ecma_property_hashmap_find (ecma_property_hashmap_t *hashmap_p, /**< hashmap */
 
     while (true)
     {
+#if ENABLED (JERRY_MEM_STATS)
+      JERRY_CONTEXT (ecma_prop_hashmap_stats).probes++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
       if (pair_list_p[entry_index] != ECMA_NULL_POINTER)
       {
         size_t offset = 0;
@@ -450,6 +540,10 @@ ecma_property_hashmap_find (ecma_property_hashmap_t *hashmap_p, /**< hashmap */
           JERRY_ASSERT (property_found);
 #endif /* !JERRY_NDEBUG */
 
+#if ENABLED (JERRY_MEM_STATS)
+          JERRY_CONTEXT (ecma_prop_hashmap_stats).hits++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
           *property_real_name_cp = property_name_cp;
           return property_p;
         }
@@ -477,6 +571,10 @@ ecma_property_hashmap_find (ecma_property_hashmap_t *hashmap_p, /**< hashmap */
 
   while (true)
   {
+#if ENABLED (JERRY_MEM_STATS)
+    JERRY_CONTEXT (ecma_prop_hashmap_stats).probes++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
     if (pair_list_p[entry_index] != ECMA_NULL_POINTER)
     {
       size_t offset = 0;
@@ -502,6 +600,10 @@ ecma_property_hashmap_find (ecma_property_hashmap_t *hashmap_p, /**< hashmap */
           JERRY_ASSERT (property_found);
 #endif /* !JERRY_NDEBUG */
 
+#if ENABLED (JERRY_MEM_STATS)
+          JERRY_CONTEXT (ecma_prop_hashmap_stats).hits++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
           *property_real_name_cp = property_pair_p->names_cp[offset];
           return property_p;
         }
@@ -28,6 +28,28 @@
  */
 #define ECMA_PROPERTY_HASMAP_MINIMUM_SIZE 32
 
+/**
+ * Minimum number of named properties of an object which has a property hashmap.
+ */
+#define ECMA_PROPERTY_HASHMAP_MIN_PROPERTY_COUNT 8
+
+/**
+ * Default number of property pairs which must be visited by a single lookup
+ * to create a property hashmap for the object.
+ */
+#define ECMA_PROPERTY_HASHMAP_LOOKUP_STEPS (ECMA_PROPERTY_HASMAP_MINIMUM_SIZE / 2)
+
+/**
+ * Default number of property pairs visited by slow lookups after which
+ * a property hashmap is created for the object searched by the last lookup.
+ */
+#define ECMA_PROPERTY_HASHMAP_MISS_LIMIT 128
+
+/**
+ * Lookups which visit fewer property pairs are not counted by the adaptive hashmap creation.
+ */
+#define ECMA_PROPERTY_HASHMAP_ADAPTIVE_MIN_STEPS (ECMA_PROPERTY_HASHMAP_MIN_PROPERTY_COUNT / 2)
+
 /**
  * Property hash.
  */
@@ -66,6 +88,8 @@ typedef enum
 } ecma_property_hashmap_delete_status;
 
 void ecma_property_hashmap_create (ecma_object_t *object_p);
+bool ecma_property_hashmap_optimize (ecma_object_t *object_p);
+void ecma_property_hashmap_lookup_missed (ecma_object_t *object_p, uint32_t steps);
 void ecma_property_hashmap_free (ecma_object_t *object_p);
 void ecma_property_hashmap_insert (ecma_object_t *object_p, ecma_string_t *name_p,
                                    ecma_property_pair_t *property_pair_p, int property_index);
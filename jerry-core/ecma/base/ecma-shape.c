@@ -0,0 +1,486 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-shape.h"
+#include "jcontext.h"
+#include "vm.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Object shapes
+ * @{
+ */
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+
+JERRY_STATIC_ASSERT (ECMA_SHAPE_MAX_PROPERTIES <= UINT8_MAX,
+                     ecma_shape_max_properties_must_fit_into_the_capacity_of_the_values);
+
+/**
+ * Mask of the type and flags of a property without its name type.
+ */
+#define ECMA_SHAPE_TYPE_AND_FLAGS_MASK ((1 << ECMA_PROPERTY_NAME_TYPE_SHIFT) - 1)
+
+/**
+ * Compute the size of a property value block.
+ *
+ * @return size in bytes
+ */
+#define ECMA_SHAPE_VALUES_SIZE(capacity) \
+  (sizeof (ecma_shape_values_t) + (capacity) * sizeof (ecma_property_value_t))
+
+/**
+ * Allocate a memory block for a shape or for property values.
+ *
+ * @return pointer to the allocated block
+ */
+static void *
+ecma_shape_alloc (size_t size) /**< size of the block */
+{
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_allocate_property_bytes (size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  return jmem_heap_alloc_block (size);
+} /* ecma_shape_alloc */
+
+/**
+ * Free a memory block of a shape or property values.
+ */
+static void
+ecma_shape_free (void *block_p, /**< block */
+                 size_t size) /**< size of the block */
+{
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_free_property_bytes (size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  jmem_heap_free_block (block_p, size);
+} /* ecma_shape_free */
+
+/**
+ * Decrease the reference counter of a shape, and free the
+ * shape (and its unreferenced parents) when it reaches zero.
+ */
+static void
+ecma_shape_deref (ecma_shape_t *shape_p) /**< shape */
+{
+  while (true)
+  {
+    JERRY_ASSERT (shape_p->refs > 0);
+
+    if (--shape_p->refs > 0)
+    {
+      return;
+    }
+
+    JERRY_ASSERT (shape_p->children_cp == JMEM_CP_NULL);
+
+    jmem_cpointer_t shape_cp;
+    ECMA_SET_NON_NULL_POINTER (shape_cp, shape_p);
+
+    ecma_shape_t *parent_p = NULL;
+    jmem_cpointer_t *list_p = &JERRY_CONTEXT (ecma_shape_roots_cp);
+
+    if (shape_p->parent_cp != JMEM_CP_NULL)
+    {
+      parent_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+      list_p = &parent_p->children_cp;
+    }
+
+    while (*list_p != shape_cp)
+    {
+      JERRY_ASSERT (*list_p != JMEM_CP_NULL);
+      list_p = &ECMA_GET_NON_NULL_POINTER (ecma_shape_t, *list_p)->next_sibling_cp;
+    }
+
+    *list_p = shape_p->next_sibling_cp;
+
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+    /* The compressed pointer of the shape can be reused by another shape. */
+    vm_inline_cache_invalidate_all ();
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
+
+    if (ECMA_PROPERTY_GET_NAME_TYPE (shape_p->property) == ECMA_DIRECT_STRING_PTR)
+    {
+      ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp));
+    }
+
+    ecma_shape_free (shape_p, sizeof (ecma_shape_t));
+
+    if (parent_p == NULL)
+    {
+      return;
+    }
+
+    shape_p = parent_p;
+  }
+} /* ecma_shape_deref */
+
+/**
+ * Find or create the shape which extends a shape with a new property.
+ *
+ * @return shape with an increased reference counter
+ */
+static ecma_shape_t *
+ecma_shape_get_child (ecma_shape_t *parent_p, /**< parent shape or NULL */
+                      ecma_string_t *name_p, /**< property name */
+                      uint8_t type_and_flags) /**< type and flags, see ecma_property_info_t */
+{
+  jmem_cpointer_t child_cp = JERRY_CONTEXT (ecma_shape_roots_cp);
+
+  if (parent_p != NULL)
+  {
+    child_cp = parent_p->children_cp;
+  }
+
+  while (child_cp != JMEM_CP_NULL)
+  {
+    ecma_shape_t *child_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, child_cp);
+
+    if ((child_p->property & ECMA_SHAPE_TYPE_AND_FLAGS_MASK) == type_and_flags
+        && ecma_string_compare_to_property_name (child_p->property, child_p->name_cp, name_p))
+    {
+      child_p->refs++;
+      return child_p;
+    }
+
+    child_cp = child_p->next_sibling_cp;
+  }
+
+  /* The allocation may trigger a garbage collection, which may free other children. */
+  ecma_shape_t *child_p = (ecma_shape_t *) ecma_shape_alloc (sizeof (ecma_shape_t));
+  jmem_cpointer_t *list_p = &JERRY_CONTEXT (ecma_shape_roots_cp);
+
+  child_p->parent_cp = JMEM_CP_NULL;
+  child_p->property_count = 1;
+
+  if (parent_p != NULL)
+  {
+    JERRY_ASSERT (parent_p->property_count < ECMA_SHAPE_MAX_PROPERTIES);
+
+    parent_p->refs++;
+    ECMA_SET_NON_NULL_POINTER (child_p->parent_cp, parent_p);
+    child_p->property_count = (uint8_t) (parent_p->property_count + 1);
+    list_p = &parent_p->children_cp;
+  }
+
+  ecma_property_t name_type;
+  child_p->name_cp = ecma_string_to_property_name (name_p, &name_type);
+  child_p->property = (ecma_property_t) (type_and_flags | name_type);
+  child_p->refs = 1;
+  child_p->children_cp = JMEM_CP_NULL;
+  child_p->next_sibling_cp = *list_p;
+  ECMA_SET_NON_NULL_POINTER (*list_p, child_p);
+
+  return child_p;
+} /* ecma_shape_get_child */
+
+/**
+ * Find the shape which describes a property in the shape chain of a shape.
+ *
+ * @return the shape whose last property has the given name, if the property is found
+ *         NULL - otherwise
+ */
+ecma_shape_t *
+ecma_shape_find (ecma_shape_t *shape_p, /**< shape */
+                 ecma_string_t *name_p) /**< property name */
+{
+  if (ECMA_IS_DIRECT_STRING (name_p))
+  {
+    ecma_property_t name_type = (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (name_p);
+    jmem_cpointer_t name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p);
+
+    while (shape_p->name_cp != name_cp
+           || ECMA_PROPERTY_GET_NAME_TYPE (shape_p->property) != name_type)
+    {
+      if (shape_p->parent_cp == JMEM_CP_NULL)
+      {
+        return NULL;
+      }
+
+      shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+    }
+
+    return shape_p;
+  }
+
+  while (ECMA_PROPERTY_GET_NAME_TYPE (shape_p->property) != ECMA_DIRECT_STRING_PTR
+         || !ecma_compare_ecma_non_direct_strings (name_p,
+                                                   ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp)))
+  {
+    if (shape_p->parent_cp == JMEM_CP_NULL)
+    {
+      return NULL;
+    }
+
+    shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+  }
+
+  return shape_p;
+} /* ecma_shape_find */
+
+/**
+ * Find a named data property of an object with a shape.
+ *
+ * @return pointer to the property value, if the property is found
+ *         NULL - otherwise
+ */
+ecma_property_value_t *
+ecma_shape_find_property (ecma_object_t *object_p, /**< object with a shape */
+                          ecma_string_t *name_p, /**< property name */
+                          ecma_property_t *property_p) /**< [out] type and flags of the property */
+{
+  JERRY_ASSERT (ECMA_OBJECT_HAS_SHAPE (object_p));
+
+  ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, object_p->u1.property_list_cp);
+  ecma_shape_t *shape_p = ecma_shape_find (ECMA_SHAPE_GET_SHAPE (values_p), name_p);
+
+  if (shape_p == NULL)
+  {
+    return NULL;
+  }
+
+  *property_p = shape_p->property;
+  return ECMA_SHAPE_GET_VALUES (values_p) + (shape_p->property_count - 1);
+} /* ecma_shape_find_property */
+
+/**
+ * Checks whether an object with a shape has a named data property.
+ *
+ * @return true - if the property is found
+ *         false - otherwise
+ */
+bool
+ecma_shape_has_property (ecma_object_t *object_p, /**< object with a shape */
+                         ecma_string_t *name_p) /**< property name */
+{
+  ecma_property_t property;
+  return ecma_shape_find_property (object_p, name_p, &property) != NULL;
+} /* ecma_shape_has_property */
+
+/**
+ * Create a named data property in an object without properties or in an object with a shape.
+ *
+ * Note:
+ *   the object receives a new shape, which extends its current shape with the new property
+ *
+ * @return pointer to the value of the new property (its value is undefined), if the
+ *         property is created, NULL - if the object cannot have a shape (in this case
+ *         the property must be created in the property pair list of the object)
+ */
+ecma_property_value_t *
+ecma_shape_create_property (ecma_object_t *object_p, /**< object */
+                            ecma_string_t *name_p, /**< property name */
+                            uint8_t type_and_flags) /**< type and flags, see ecma_property_info_t */
+{
+  JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (type_and_flags) == ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+  ecma_shape_values_t *values_p = NULL;
+  ecma_shape_t *shape_p = NULL;
+  uint32_t property_count = 0;
+  uint32_t capacity = 0;
+
+  if (object_p->u1.property_list_cp != JMEM_CP_NULL)
+  {
+    values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, object_p->u1.property_list_cp);
+
+    if (values_p->header.types[0] != ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      return NULL;
+    }
+
+    shape_p = ECMA_SHAPE_GET_SHAPE (values_p);
+    property_count = shape_p->property_count;
+    capacity = values_p->header.types[1];
+
+    if (property_count >= ECMA_SHAPE_MAX_PROPERTIES)
+    {
+      ecma_shape_convert_to_property_list (object_p, NULL);
+      return NULL;
+    }
+  }
+  else if (ecma_is_lexical_environment (object_p)
+           || ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_GENERAL
+           || ecma_get_object_is_builtin (object_p))
+  {
+    return NULL;
+  }
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  /* The value of the new property is often initialized without a write barrier. */
+  ecma_gc_remember_object (object_p);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+  ecma_shape_t *new_shape_p = ecma_shape_get_child (shape_p, name_p, type_and_flags);
+
+  if (property_count >= capacity)
+  {
+    uint32_t new_capacity = capacity + ECMA_SHAPE_VALUES_INCREASE;
+    ecma_shape_values_t *new_values_p;
+    new_values_p = (ecma_shape_values_t *) ecma_shape_alloc (ECMA_SHAPE_VALUES_SIZE (new_capacity));
+
+    new_values_p->header.types[0] = ECMA_PROPERTY_TYPE_SHAPE;
+    new_values_p->header.types[1] = (ecma_property_t) new_capacity;
+
+    if (values_p != NULL)
+    {
+      memcpy (ECMA_SHAPE_GET_VALUES (new_values_p),
+              ECMA_SHAPE_GET_VALUES (values_p),
+              property_count * sizeof (ecma_property_value_t));
+      ecma_shape_free (values_p, ECMA_SHAPE_VALUES_SIZE (capacity));
+    }
+
+    values_p = new_values_p;
+    ECMA_SET_NON_NULL_POINTER (object_p->u1.property_list_cp, values_p);
+  }
+
+  ECMA_SET_NON_NULL_POINTER (values_p->header.next_property_cp, new_shape_p);
+
+  if (shape_p != NULL)
+  {
+    ecma_shape_deref (shape_p);
+  }
+
+  ecma_property_value_t *value_p = ECMA_SHAPE_GET_VALUES (values_p) + property_count;
+  value_p->value = ECMA_VALUE_UNDEFINED;
+  return value_p;
+} /* ecma_shape_create_property */
+
+/**
+ * Convert the properties of an object with a shape to a property pair list.
+ *
+ * Note:
+ *   the property pairs have the same layout as if the properties
+ *   were created by ecma_create_property in their creation order
+ *
+ * @return the new location of the property value referenced by value_p
+ */
+ecma_property_value_t *
+ecma_shape_convert_to_property_list (ecma_object_t *object_p, /**< object with a shape */
+                                     ecma_property_value_t *value_p) /**< value of a property of the
+                                                                      *   object or NULL */
+{
+  JERRY_ASSERT (ECMA_OBJECT_HAS_SHAPE (object_p));
+
+  ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, object_p->u1.property_list_cp);
+  uint32_t property_count = ECMA_SHAPE_GET_SHAPE (values_p)->property_count;
+  uint32_t pair_count = (property_count + 1) / 2;
+  ecma_property_pair_t *pairs_p[(ECMA_SHAPE_MAX_PROPERTIES + 1) / 2];
+
+  /* The allocations may trigger a garbage collection, so the pairs are
+   * filled after all of them are allocated and the object is unchanged. */
+  for (uint32_t i = 0; i < pair_count; i++)
+  {
+    pairs_p[i] = ecma_alloc_property_pair ();
+  }
+
+  ecma_shape_t *shape_p = ECMA_SHAPE_GET_SHAPE (values_p);
+  ecma_property_value_t *property_values_p = ECMA_SHAPE_GET_VALUES (values_p);
+  ecma_property_value_t *result_p = NULL;
+
+  /* Odd properties are stored in the first, even properties are stored in the second
+   * slot of the pairs, and the first slot of the newest pair is deleted when the
+   * number of properties is odd. The newest pair is the head of the list. */
+  if (property_count & 0x1)
+  {
+    ecma_property_pair_t *last_pair_p = pairs_p[pair_count - 1];
+    last_pair_p->header.types[0] = ECMA_PROPERTY_TYPE_DELETED;
+    last_pair_p->names_cp[0] = LIT_INTERNAL_MAGIC_STRING_DELETED;
+  }
+
+  for (uint32_t i = 0; i < pair_count; i++)
+  {
+    pairs_p[i]->header.next_property_cp = JMEM_CP_NULL;
+
+    if (i > 0)
+    {
+      ECMA_SET_NON_NULL_POINTER (pairs_p[i]->header.next_property_cp, pairs_p[i - 1]);
+    }
+  }
+
+  ecma_shape_t *iter_p = shape_p;
+
+  while (true)
+  {
+    uint32_t index = (uint32_t) iter_p->property_count - 1;
+    ecma_property_pair_t *pair_p = pairs_p[index / 2];
+    uint32_t slot = (index & 0x1) ? 0 : 1;
+
+    if (ECMA_PROPERTY_GET_NAME_TYPE (iter_p->property) == ECMA_DIRECT_STRING_PTR)
+    {
+      ecma_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, iter_p->name_cp));
+    }
+
+    pair_p->header.types[slot] = iter_p->property;
+    pair_p->names_cp[slot] = iter_p->name_cp;
+    pair_p->values[slot] = property_values_p[index];
+
+    if (property_values_p + index == value_p)
+    {
+      result_p = pair_p->values + slot;
+    }
+
+    if (iter_p->parent_cp == JMEM_CP_NULL)
+    {
+      break;
+    }
+
+    iter_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, iter_p->parent_cp);
+  }
+
+  ECMA_SET_NON_NULL_POINTER (object_p->u1.property_list_cp, pairs_p[pair_count - 1]);
+
+  ecma_shape_free (values_p, ECMA_SHAPE_VALUES_SIZE (values_p->header.types[1]));
+  ecma_shape_deref (shape_p);
+
+  JERRY_ASSERT (value_p == NULL || result_p != NULL);
+  return result_p;
+} /* ecma_shape_convert_to_property_list */
+
+/**
+ * Free the property values and release the shape of an object.
+ */
+void
+ecma_shape_free_values (ecma_object_t *object_p) /**< object with a shape */
+{
+  JERRY_ASSERT (ECMA_OBJECT_HAS_SHAPE (object_p));
+
+  ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, object_p->u1.property_list_cp);
+  ecma_shape_t *shape_p = ECMA_SHAPE_GET_SHAPE (values_p);
+  ecma_property_value_t *property_values_p = ECMA_SHAPE_GET_VALUES (values_p);
+
+  for (uint32_t i = 0; i < shape_p->property_count; i++)
+  {
+    ecma_free_value_if_not_object (property_values_p[i].value);
+  }
+
+  object_p->u1.property_list_cp = JMEM_CP_NULL;
+
+  ecma_shape_free (values_p, ECMA_SHAPE_VALUES_SIZE (values_p->header.types[1]));
+  ecma_shape_deref (shape_p);
+} /* ecma_shape_free_values */
+
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+/**
+ * @}
+ * @}
+ */
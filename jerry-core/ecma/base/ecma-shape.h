@@ -0,0 +1,108 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_SHAPE_H
+#define ECMA_SHAPE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Object shapes
+ * @{
+ */
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+
+/**
+ * Maximum number of properties described by a shape. Objects
+ * with more properties are converted to property pair lists.
+ */
+#define ECMA_SHAPE_MAX_PROPERTIES 16
+
+/**
+ * Number of property values allocated at once for objects with a shape.
+ */
+#define ECMA_SHAPE_VALUES_INCREASE 2
+
+/**
+ * Shape descriptor.
+ *
+ * A shape describes the names and attributes of the named data properties
+ * of an object in their creation order. Objects which receive the same
+ * properties in the same order share the same shape, and store only the
+ * values of their properties. The shapes form a transition tree: each
+ * shape extends its parent with one property.
+ */
+typedef struct
+{
+  jmem_cpointer_t parent_cp; /**< shape without the last property (JMEM_CP_NULL for root shapes) */
+  jmem_cpointer_t children_cp; /**< first shape which extends this shape */
+  jmem_cpointer_t next_sibling_cp; /**< next shape with the same parent */
+  jmem_cpointer_t name_cp; /**< name of the last property */
+  uint32_t refs; /**< number of objects and child shapes which reference this shape */
+  ecma_property_t property; /**< type, flags and name type of the last property */
+  uint8_t property_count; /**< number of properties described by this shape */
+} ecma_shape_t;
+
+/**
+ * Property values of an object with a shape.
+ */
+typedef struct
+{
+  ecma_property_header_t header; /**< header: types[0] is ECMA_PROPERTY_TYPE_SHAPE, types[1] is the
+                                  *   number of allocated values, and next_property_cp is the shape */
+
+  /* The header is followed by the ecma_property_value_t values of the properties. */
+} ecma_shape_values_t;
+
+/**
+ * Get the property values of an object with a shape.
+ */
+#define ECMA_SHAPE_GET_VALUES(values_p) ((ecma_property_value_t *) (((ecma_shape_values_t *) (values_p)) + 1))
+
+/**
+ * Get the shape of an object with a shape.
+ */
+#define ECMA_SHAPE_GET_SHAPE(values_p) \
+  ECMA_GET_NON_NULL_POINTER (ecma_shape_t, ((ecma_shape_values_t *) (values_p))->header.next_property_cp)
+
+/**
+ * Checks whether the property list of an object (which is not a fast access mode array) is a shape.
+ */
+#define ECMA_OBJECT_HAS_SHAPE(object_p) \
+  ((object_p)->u1.property_list_cp != JMEM_CP_NULL \
+   && ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, \
+                                 (object_p)->u1.property_list_cp)->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+
+ecma_shape_t *ecma_shape_find (ecma_shape_t *shape_p, ecma_string_t *name_p);
+ecma_property_value_t *ecma_shape_find_property (ecma_object_t *object_p, ecma_string_t *name_p,
+                                                 ecma_property_t *property_p);
+ecma_property_value_t *ecma_shape_create_property (ecma_object_t *object_p, ecma_string_t *name_p,
+                                                   uint8_t type_and_flags);
+bool ecma_shape_has_property (ecma_object_t *object_p, ecma_string_t *name_p);
+ecma_property_value_t *ecma_shape_convert_to_property_list (ecma_object_t *object_p,
+                                                            ecma_property_value_t *value_p);
+void ecma_shape_free_values (ecma_object_t *object_p);
+
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_SHAPE_H */
@@ -462,6 +462,7 @@ ecma_builtin_array_prototype_object_push (const ecma_value_t *argument_list_p, /
 
     for (uint32_t index = 0; index < arguments_number; index++)
     {
+      ecma_gc_write_barrier (obj_p, argument_list_p[index]);
       buffer_p[index] = ecma_copy_value_if_not_object (argument_list_p[index]);
     }
 
@@ -918,6 +919,7 @@ ecma_builtin_array_prototype_object_slice (ecma_value_t arg1, /**< start */
 #if ENABLED (JERRY_ESNEXT)
         ecma_free_value_if_not_object (to_buffer_p[n]);
 #endif /* ENABLED (JERRY_ESNEXT) */
+        ecma_gc_write_barrier (new_array_p, from_buffer_p[k]);
         to_buffer_p[n] = ecma_copy_value_if_not_object (from_buffer_p[k]);
       }
 
@@ -1535,6 +1537,7 @@ ecma_builtin_array_prototype_object_unshift (const ecma_value_t args[], /**< arg
 
       while (index < args_number)
       {
+        ecma_gc_write_barrier (obj_p, args[index]);
         buffer_p[index] = ecma_copy_value_if_not_object (args[index]);
         index++;
       }
@@ -2312,6 +2315,7 @@ ecma_builtin_array_prototype_fill (ecma_value_t value, /**< value */
       }
 
       ecma_value_t *buffer_p = ECMA_GET_NON_NULL_POINTER (ecma_value_t, obj_p->u1.property_list_cp);
+      ecma_gc_write_barrier (obj_p, value);
 
       while (k < final)
       {
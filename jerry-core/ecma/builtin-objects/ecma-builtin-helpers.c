@@ -751,38 +751,53 @@ ecma_builtin_helper_string_find_index (ecma_string_t *original_str_p, /**< index
                                        ecma_string_t *search_str_p, /**< string's length */
                                        uint32_t start_pos) /**< start position */
 {
-  uint32_t match_found = UINT32_MAX;
-
   if (ecma_string_is_empty (search_str_p))
   {
     return start_pos;
   }
 
+  uint32_t match_found = UINT32_MAX;
+
   ECMA_STRING_TO_UTF8_STRING (search_str_p, search_str_utf8_p, search_str_size);
-  ECMA_STRING_TO_UTF8_STRING (original_str_p, original_str_utf8_p, original_str_size);
 
-  const lit_utf8_byte_t *str_current_p = original_str_utf8_p;
+  lit_utf8_size_t original_str_size;
+  uint8_t original_str_flags = ECMA_STRING_FLAG_IS_ASCII;
+  const lit_utf8_byte_t *original_str_utf8_p = ecma_string_get_chars (original_str_p,
+                                                                      &original_str_size,
+                                                                      NULL,
+                                                                      NULL,
+                                                                      &original_str_flags);
+
+  const bool is_ascii = (original_str_flags & ECMA_STRING_FLAG_IS_ASCII) != 0;
+  lit_utf8_size_t start_offset = start_pos;
 
-  for (ecma_number_t i = 0; i < start_pos; i++)
+  if (!is_ascii)
   {
-    lit_utf8_incr (&str_current_p);
+    start_offset = ecma_string_index_to_offset (original_str_p, original_str_utf8_p, original_str_size, start_pos);
   }
 
-  const lit_utf8_byte_t *original_end_p = original_str_utf8_p + original_str_size;
+  JERRY_ASSERT (start_offset <= original_str_size);
 
-  while (!((size_t) (original_end_p - str_current_p) < search_str_size))
+  const lit_utf8_byte_t *match_p = lit_utf8_find_substring (original_str_utf8_p + start_offset,
+                                                            original_str_size - start_offset,
+                                                            search_str_utf8_p,
+                                                            search_str_size);
+
+  if (match_p != NULL)
   {
-    if (memcmp (str_current_p , search_str_utf8_p, search_str_size) == 0)
+    match_found = (uint32_t) (match_p - original_str_utf8_p);
+
+    if (!is_ascii)
     {
-      match_found = start_pos;
-      break;
+      match_found = ecma_string_offset_to_index (original_str_p, original_str_utf8_p, original_str_size, match_found);
     }
+  }
 
-    lit_utf8_incr (&str_current_p);
-    start_pos++;
+  if (original_str_flags & ECMA_STRING_FLAG_MUST_BE_FREED)
+  {
+    jmem_heap_free_block ((void *) original_str_utf8_p, original_str_size);
   }
 
-  ECMA_FINALIZE_UTF8_STRING (original_str_utf8_p, original_str_size);
   ECMA_FINALIZE_UTF8_STRING (search_str_utf8_p, search_str_size);
 
   return match_found;
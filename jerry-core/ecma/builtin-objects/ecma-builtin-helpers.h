@@ -212,8 +212,48 @@ typedef struct
   ecma_stringbuilder_t result_builder;
 } ecma_json_stringify_context_t;
 
+/**
+ * Events reported by the incremental JSON parser
+ */
+typedef enum
+{
+  ECMA_JSON_PARSER_OBJECT_START, /**< an object is opened */
+  ECMA_JSON_PARSER_ARRAY_START, /**< an array is opened */
+  ECMA_JSON_PARSER_OBJECT_END, /**< a built object is closed */
+  ECMA_JSON_PARSER_ARRAY_END, /**< a built array is closed */
+} ecma_json_parser_event_t;
+
+/**
+ * Actions returned by the callback of the incremental JSON parser
+ */
+typedef enum
+{
+  ECMA_JSON_PARSER_KEEP, /**< build the container, or attach the closed container to its parent */
+  ECMA_JSON_PARSER_DISCARD, /**< only validate the container, or drop the closed container */
+} ecma_json_parser_action_t;
+
+/**
+ * Callback of the incremental JSON parser, which is called at object and array boundaries
+ */
+typedef ecma_json_parser_action_t (*ecma_json_parser_callback_t) (ecma_json_parser_event_t event,
+                                                                  ecma_value_t key,
+                                                                  ecma_value_t value,
+                                                                  uint32_t depth,
+                                                                  void *user_p);
+
+/**
+ * Incremental JSON parser
+ */
+typedef struct ecma_json_parser_t ecma_json_parser_t;
+
 ecma_value_t ecma_builtin_json_parse_buffer (const lit_utf8_byte_t * str_start_p,
                                              lit_utf8_size_t string_size);
+ecma_json_parser_t *ecma_builtin_json_parser_create (ecma_json_parser_callback_t callback_p, void *user_p);
+bool ecma_builtin_json_parser_feed (ecma_json_parser_t *parser_p,
+                                    const lit_utf8_byte_t *chunk_p,
+                                    lit_utf8_size_t chunk_size);
+ecma_value_t ecma_builtin_json_parser_finish (ecma_json_parser_t *parser_p);
+void ecma_builtin_json_parser_free (ecma_json_parser_t *parser_p);
 ecma_value_t ecma_builtin_json_stringify_no_opts (const ecma_value_t value);
 bool ecma_json_has_object_in_stack (ecma_json_occurence_stack_item_t *stack_p, ecma_object_t *object_p);
 
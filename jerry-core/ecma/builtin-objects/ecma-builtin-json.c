@@ -30,6 +30,14 @@
 #include "lit-char-helpers.h"
 #include "lit-globals.h"
 
+#if ENABLED (JERRY_SIMD_SCAN) && defined (__GNUC__) && defined (__SSE2__)
+#define ECMA_JSON_SIMD_SCAN_SSE2
+#include <emmintrin.h>
+#elif ENABLED (JERRY_SIMD_SCAN) && (defined (__ARM_NEON) || defined (__ARM_NEON__))
+#define ECMA_JSON_SIMD_SCAN_NEON
+#include <arm_neon.h>
+#endif /* ENABLED (JERRY_SIMD_SCAN) */
+
 #if ENABLED (JERRY_BUILTIN_JSON)
 
 #define ECMA_BUILTINS_INTERNAL
@@ -93,6 +101,128 @@ typedef struct
   } u;
 } ecma_json_token_t;
 
+/**
+ * Checks whether a byte must be processed by the JSON parser or stringifier.
+ */
+#define ECMA_JSON_IS_SPECIAL_BYTE(byte, surrogate_byte) \
+  ((byte) < LIT_CHAR_SP \
+   || (byte) == LIT_CHAR_DOUBLE_QUOTE \
+   || (byte) == LIT_CHAR_BACKSLASH \
+   || (byte) == (surrogate_byte))
+
+/**
+ * Find the first byte of a cesu-8 encoded string, which must be processed by
+ * the JSON parser or stringifier: control characters, quotes and backslashes.
+ * Optionally the first byte of the code units from 0xd000 to 0xdfff is also
+ * searched, which contain the surrogates.
+ *
+ * Note:
+ *   the search checks 16 bytes at once with SSE2 or NEON instructions,
+ *   and a machine word at a time otherwise
+ *
+ * @return pointer to the first special byte
+ *         end_p - if there is no special byte
+ */
+static const lit_utf8_byte_t *
+ecma_builtin_json_find_special_byte (const lit_utf8_byte_t *buf_p, /**< start of the buffer */
+                                     const lit_utf8_byte_t *end_p, /**< end of the buffer */
+                                     bool find_surrogates) /**< also find the surrogates */
+{
+  /* The quote never needs a separate check, so it is searched twice when surrogates are ignored. */
+  const lit_utf8_byte_t surrogate_byte = (find_surrogates ? LIT_UTF8_3_BYTE_MARKER | 0x0d : LIT_CHAR_DOUBLE_QUOTE);
+
+#if defined (ECMA_JSON_SIMD_SCAN_SSE2)
+  const __m128i quote_vector = _mm_set1_epi8 ((char) LIT_CHAR_DOUBLE_QUOTE);
+  const __m128i backslash_vector = _mm_set1_epi8 ((char) LIT_CHAR_BACKSLASH);
+  const __m128i surrogate_vector = _mm_set1_epi8 ((char) surrogate_byte);
+  const __m128i control_max_vector = _mm_set1_epi8 ((char) (LIT_CHAR_SP - 1));
+
+  while (end_p - buf_p >= 16)
+  {
+    const __m128i bytes = _mm_loadu_si128 ((const __m128i *) buf_p);
+
+    /* Unsigned bytes less than the space character are not changed by the minimum. */
+    __m128i special = _mm_cmpeq_epi8 (_mm_min_epu8 (bytes, control_max_vector), bytes);
+    special = _mm_or_si128 (special, _mm_cmpeq_epi8 (bytes, quote_vector));
+    special = _mm_or_si128 (special, _mm_cmpeq_epi8 (bytes, backslash_vector));
+    special = _mm_or_si128 (special, _mm_cmpeq_epi8 (bytes, surrogate_vector));
+
+    int mask = _mm_movemask_epi8 (special);
+
+    if (mask != 0)
+    {
+      return buf_p + __builtin_ctz ((unsigned int) mask);
+    }
+
+    buf_p += 16;
+  }
+#elif defined (ECMA_JSON_SIMD_SCAN_NEON)
+  const uint8x16_t quote_vector = vdupq_n_u8 (LIT_CHAR_DOUBLE_QUOTE);
+  const uint8x16_t backslash_vector = vdupq_n_u8 (LIT_CHAR_BACKSLASH);
+  const uint8x16_t surrogate_vector = vdupq_n_u8 (surrogate_byte);
+  const uint8x16_t control_max_vector = vdupq_n_u8 (LIT_CHAR_SP - 1);
+
+  while (end_p - buf_p >= 16)
+  {
+    const uint8x16_t bytes = vld1q_u8 (buf_p);
+
+    uint8x16_t special = vcleq_u8 (bytes, control_max_vector);
+    special = vorrq_u8 (special, vceqq_u8 (bytes, quote_vector));
+    special = vorrq_u8 (special, vceqq_u8 (bytes, backslash_vector));
+    special = vorrq_u8 (special, vceqq_u8 (bytes, surrogate_vector));
+
+    const uint64x2_t halves = vreinterpretq_u64_u8 (special);
+
+    if ((vgetq_lane_u64 (halves, 0) | vgetq_lane_u64 (halves, 1)) != 0)
+    {
+      /* The position is found by the byte loop below. */
+      break;
+    }
+
+    buf_p += 16;
+  }
+#else /* !ECMA_JSON_SIMD_SCAN_SSE2 && !ECMA_JSON_SIMD_SCAN_NEON */
+  /* Each byte of the word is checked by the 'has zero byte' bit trick:
+   * ((word - 0x01..01) & ~word & 0x80..80) is non-zero, if any byte of the word is zero.
+   * The borrows of the subtraction may also set the high bit of a byte above a zero
+   * byte, so the trick only tells whether the word has a special byte, and the byte
+   * loop below finds its position. */
+  const size_t ones = ((size_t) ~(size_t) 0) / 0xff;
+  const size_t high_bits = ones * 0x80;
+
+  while ((size_t) (end_p - buf_p) >= sizeof (size_t))
+  {
+    size_t word;
+    memcpy (&word, buf_p, sizeof (size_t));
+
+    const size_t quote_word = word ^ (ones * LIT_CHAR_DOUBLE_QUOTE);
+    const size_t backslash_word = word ^ (ones * LIT_CHAR_BACKSLASH);
+    const size_t surrogate_word = word ^ (ones * surrogate_byte);
+
+    /* Bytes less than the space character are found the same way, since no byte exceeds 0xff. */
+    size_t special = (word - ones * LIT_CHAR_SP) & ~word;
+    special |= (quote_word - ones) & ~quote_word;
+    special |= (backslash_word - ones) & ~backslash_word;
+    special |= (surrogate_word - ones) & ~surrogate_word;
+
+    if ((special & high_bits) != 0)
+    {
+      /* The position is found by the byte loop below. */
+      break;
+    }
+
+    buf_p += sizeof (size_t);
+  }
+#endif /* ECMA_JSON_SIMD_SCAN_SSE2 */
+
+  while (buf_p < end_p && !ECMA_JSON_IS_SPECIAL_BYTE (*buf_p, surrogate_byte))
+  {
+    buf_p++;
+  }
+
+  return buf_p;
+} /* ecma_builtin_json_find_special_byte */
+
 /**
  * Parse and extract string token.
  */
@@ -107,6 +237,8 @@ ecma_builtin_json_parse_string (ecma_json_token_t *token_p) /**< token argument
 
   while (true)
   {
+    current_p = ecma_builtin_json_find_special_byte (current_p, end_p, false);
+
     if (current_p >= end_p || *current_p <= 0x1f)
     {
       goto invalid_string;
@@ -117,84 +249,80 @@ ecma_builtin_json_parse_string (ecma_json_token_t *token_p) /**< token argument
       break;
     }
 
-    if (*current_p == LIT_CHAR_BACKSLASH)
-    {
-      ecma_stringbuilder_append_raw (&result_builder,
-                                     unappended_p,
-                                     (lit_utf8_size_t) (current_p - unappended_p));
+    JERRY_ASSERT (*current_p == LIT_CHAR_BACKSLASH);
 
-      current_p++;
+    ecma_stringbuilder_append_raw (&result_builder,
+                                   unappended_p,
+                                   (lit_utf8_size_t) (current_p - unappended_p));
+
+    current_p++;
 
-      /* If there is an escape sequence but there's no escapable character just return */
-      if (current_p >= end_p)
+    /* If there is an escape sequence but there's no escapable character just return */
+    if (current_p >= end_p)
+    {
+      goto invalid_string;
+    }
+
+    const lit_utf8_byte_t c = *current_p;
+    switch (c)
+    {
+      case LIT_CHAR_DOUBLE_QUOTE:
+      case LIT_CHAR_SLASH:
+      case LIT_CHAR_BACKSLASH:
       {
-        goto invalid_string;
+        ecma_stringbuilder_append_byte (&result_builder, c);
+        current_p++;
+        break;
       }
-
-      const lit_utf8_byte_t c = *current_p;
-      switch (c)
+      case LIT_CHAR_LOWERCASE_B:
       {
-        case LIT_CHAR_DOUBLE_QUOTE:
-        case LIT_CHAR_SLASH:
-        case LIT_CHAR_BACKSLASH:
-        {
-          ecma_stringbuilder_append_byte (&result_builder, c);
-          current_p++;
-          break;
-        }
-        case LIT_CHAR_LOWERCASE_B:
-        {
-          ecma_stringbuilder_append_byte (&result_builder, LIT_CHAR_BS);
-          current_p++;
-          break;
-        }
-        case LIT_CHAR_LOWERCASE_F:
-        {
-          ecma_stringbuilder_append_byte (&result_builder, LIT_CHAR_FF);
-          current_p++;
-          break;
-        }
-        case LIT_CHAR_LOWERCASE_N:
-        {
-          ecma_stringbuilder_append_byte (&result_builder, LIT_CHAR_LF);
-          current_p++;
-          break;
-        }
-        case LIT_CHAR_LOWERCASE_R:
-        {
-          ecma_stringbuilder_append_byte (&result_builder, LIT_CHAR_CR);
-          current_p++;
-          break;
-        }
-        case LIT_CHAR_LOWERCASE_T:
-        {
-          ecma_stringbuilder_append_byte (&result_builder, LIT_CHAR_TAB);
-          current_p++;
-          break;
-        }
-        case LIT_CHAR_LOWERCASE_U:
-        {
-          uint32_t hex_value = lit_char_hex_lookup (current_p + 1, end_p, ECMA_JSON_HEX_ESCAPE_SEQUENCE_LENGTH);
-          if (hex_value == UINT32_MAX)
-          {
-            goto invalid_string;
-          }
-
-          ecma_stringbuilder_append_char (&result_builder, (ecma_char_t) hex_value);
-          current_p += ECMA_JSON_HEX_ESCAPE_SEQUENCE_LENGTH + 1;
-          break;
-        }
-        default:
+        ecma_stringbuilder_append_byte (&result_builder, LIT_CHAR_BS);
+        current_p++;
+        break;
+      }
+      case LIT_CHAR_LOWERCASE_F:
+      {
+        ecma_stringbuilder_append_byte (&result_builder, LIT_CHAR_FF);
+        current_p++;
+        break;
+      }
+      case LIT_CHAR_LOWERCASE_N:
+      {
+        ecma_stringbuilder_append_byte (&result_builder, LIT_CHAR_LF);
+        current_p++;
+        break;
+      }
+      case LIT_CHAR_LOWERCASE_R:
+      {
+        ecma_stringbuilder_append_byte (&result_builder, LIT_CHAR_CR);
+        current_p++;
+        break;
+      }
+      case LIT_CHAR_LOWERCASE_T:
+      {
+        ecma_stringbuilder_append_byte (&result_builder, LIT_CHAR_TAB);
+        current_p++;
+        break;
+      }
+      case LIT_CHAR_LOWERCASE_U:
+      {
+        uint32_t hex_value = lit_char_hex_lookup (current_p + 1, end_p, ECMA_JSON_HEX_ESCAPE_SEQUENCE_LENGTH);
+        if (hex_value == UINT32_MAX)
         {
           goto invalid_string;
         }
-      }
 
-      unappended_p = current_p;
-      continue;
+        ecma_stringbuilder_append_char (&result_builder, (ecma_char_t) hex_value);
+        current_p += ECMA_JSON_HEX_ESCAPE_SEQUENCE_LENGTH + 1;
+        break;
+      }
+      default:
+      {
+        goto invalid_string;
+      }
     }
 
-    current_p++;
+    unappended_p = current_p;
   }
 
   ecma_stringbuilder_append_raw (&result_builder,
@@ -821,6 +949,690 @@ ecma_builtin_json_parse_buffer (const lit_utf8_byte_t * str_start_p, /**< String
   return ecma_raise_syntax_error (ECMA_ERR_MSG ("Invalid JSON format."));
 } /*ecma_builtin_json_parse_buffer*/
 
+/**
+ * Open container of the incremental JSON parser
+ */
+typedef struct
+{
+  ecma_value_t container; /**< object or array which is built, ECMA_VALUE_EMPTY if the container is discarded */
+  ecma_string_t *key_p; /**< name of the next property of an object, NULL if the name is not parsed yet */
+  uint32_t index; /**< number of values parsed in the container */
+  uint32_t length; /**< number of values stored in an array */
+  bool is_array; /**< true - if the container is an array */
+} ecma_json_parser_frame_t;
+
+/**
+ * States of the incremental JSON parser
+ */
+typedef enum
+{
+  ECMA_JSON_PARSER_EXPECT_VALUE, /**< a value is expected */
+  ECMA_JSON_PARSER_EXPECT_VALUE_OR_END, /**< a value or the end of an empty array is expected */
+  ECMA_JSON_PARSER_EXPECT_KEY, /**< a property name is expected */
+  ECMA_JSON_PARSER_EXPECT_KEY_OR_END, /**< a property name or the end of an empty object is expected */
+  ECMA_JSON_PARSER_EXPECT_COLON, /**< a colon is expected */
+  ECMA_JSON_PARSER_EXPECT_COMMA_OR_END, /**< a comma or the end of the current container is expected */
+  ECMA_JSON_PARSER_DONE, /**< the top level value is parsed, only whitespace can follow */
+  ECMA_JSON_PARSER_ERROR, /**< a syntax error is found or the parsing is finished */
+} ecma_json_parser_state_t;
+
+/**
+ * Minimum number of frames allocated by the incremental JSON parser
+ */
+#define ECMA_JSON_PARSER_MIN_FRAMES 8
+
+/**
+ * Minimum size of the buffer which holds a token split between two chunks
+ */
+#define ECMA_JSON_PARSER_MIN_PENDING_SIZE 32
+
+/**
+ * Incremental JSON parser
+ *
+ * The input is processed token by token, and the state between the chunks is
+ * stored in an explicit stack of open containers. Only the token which is split
+ * between two chunks is copied.
+ */
+struct ecma_json_parser_t
+{
+  ecma_json_parser_callback_t callback_p; /**< callback called at object and array boundaries, can be NULL */
+  void *user_p; /**< user pointer passed to the callback */
+  ecma_json_parser_frame_t *frames_p; /**< stack of the open containers */
+  uint32_t depth; /**< number of the open containers */
+  uint32_t frames_size; /**< number of the allocated frames */
+  lit_utf8_byte_t *pending_p; /**< start of a token which is continued in the next chunk */
+  lit_utf8_size_t pending_size; /**< size of the pending token */
+  lit_utf8_size_t pending_capacity; /**< allocated size of the pending buffer */
+  ecma_value_t result; /**< top level value */
+  uint8_t state; /**< ecma_json_parser_state_t */
+  bool pending_escape; /**< the pending string token ends with a backslash */
+};
+
+/**
+ * Checks whether a byte can be the part of a number or a literal token.
+ *
+ * @return true - if the byte is part of a number or a literal
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_builtin_json_is_word_byte (lit_utf8_byte_t byte) /**< input byte */
+{
+  return (lit_char_is_decimal_digit (byte)
+          || ((byte | 0x20) >= LIT_CHAR_LOWERCASE_A && (byte | 0x20) <= LIT_CHAR_LOWERCASE_Z)
+          || byte == LIT_CHAR_PLUS
+          || byte == LIT_CHAR_MINUS
+          || byte == LIT_CHAR_DOT);
+} /* ecma_builtin_json_is_word_byte */
+
+/**
+ * Finds the end of a number or a literal token.
+ *
+ * @return position after the token - if the token ends before end_p
+ *         NULL - otherwise
+ */
+static const lit_utf8_byte_t *
+ecma_builtin_json_find_word_end (const lit_utf8_byte_t *current_p, /**< current position */
+                                 const lit_utf8_byte_t *end_p) /**< end of the buffer */
+{
+  while (current_p < end_p)
+  {
+    if (!ecma_builtin_json_is_word_byte (*current_p))
+    {
+      return current_p;
+    }
+    current_p++;
+  }
+
+  return NULL;
+} /* ecma_builtin_json_find_word_end */
+
+/**
+ * Finds the end of a string token. Invalid control characters also
+ * terminate the token, since the token is rejected by the tokenizer.
+ *
+ * @return position after the closing quote - if the token ends before end_p
+ *         NULL - otherwise
+ */
+static const lit_utf8_byte_t *
+ecma_builtin_json_find_string_end (const lit_utf8_byte_t *current_p, /**< current position */
+                                   const lit_utf8_byte_t *end_p, /**< end of the buffer */
+                                   bool *escape_p) /**< [in/out] the previous byte is an unprocessed backslash */
+{
+  if (*escape_p)
+  {
+    if (current_p >= end_p)
+    {
+      return NULL;
+    }
+
+    current_p++;
+    *escape_p = false;
+  }
+
+  while (true)
+  {
+    current_p = ecma_builtin_json_find_special_byte (current_p, end_p, false);
+
+    if (current_p >= end_p)
+    {
+      return NULL;
+    }
+
+    if (*current_p != LIT_CHAR_BACKSLASH)
+    {
+      return current_p + 1;
+    }
+
+    current_p++;
+
+    if (current_p >= end_p)
+    {
+      *escape_p = true;
+      return NULL;
+    }
+
+    current_p++;
+  }
+} /* ecma_builtin_json_find_string_end */
+
+/**
+ * Appends bytes to the pending token of the incremental JSON parser.
+ */
+static void
+ecma_builtin_json_parser_append_pending (ecma_json_parser_t *parser_p, /**< parser */
+                                         const lit_utf8_byte_t *data_p, /**< data */
+                                         lit_utf8_size_t size) /**< size of the data */
+{
+  lit_utf8_size_t new_size = parser_p->pending_size + size;
+
+  if (new_size > parser_p->pending_capacity)
+  {
+    lit_utf8_size_t new_capacity = JERRY_MAX (parser_p->pending_capacity * 2, ECMA_JSON_PARSER_MIN_PENDING_SIZE);
+
+    while (new_capacity < new_size)
+    {
+      new_capacity *= 2;
+    }
+
+    if (parser_p->pending_p == NULL)
+    {
+      parser_p->pending_p = (lit_utf8_byte_t *) jmem_heap_alloc_block (new_capacity);
+    }
+    else
+    {
+      parser_p->pending_p = (lit_utf8_byte_t *) jmem_heap_realloc_block (parser_p->pending_p,
+                                                                         parser_p->pending_capacity,
+                                                                         new_capacity);
+    }
+
+    parser_p->pending_capacity = new_capacity;
+  }
+
+  memcpy (parser_p->pending_p + parser_p->pending_size, data_p, size);
+  parser_p->pending_size = new_size;
+} /* ecma_builtin_json_parser_append_pending */
+
+/**
+ * Releases the values held by the incremental JSON parser.
+ */
+static void
+ecma_builtin_json_parser_release_values (ecma_json_parser_t *parser_p) /**< parser */
+{
+  for (uint32_t i = 0; i < parser_p->depth; i++)
+  {
+    ecma_json_parser_frame_t *frame_p = parser_p->frames_p + i;
+
+    ecma_free_value (frame_p->container);
+
+    if (frame_p->key_p != NULL)
+    {
+      ecma_deref_ecma_string (frame_p->key_p);
+    }
+  }
+
+  parser_p->depth = 0;
+  ecma_free_value (parser_p->result);
+  parser_p->result = ECMA_VALUE_UNDEFINED;
+} /* ecma_builtin_json_parser_release_values */
+
+/**
+ * Gets the key of the next value of the innermost open container.
+ *
+ * @return property name for objects, index for arrays, undefined for the top level value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_json_parser_get_key (ecma_json_parser_t *parser_p) /**< parser */
+{
+  if (parser_p->depth == 0)
+  {
+    return ECMA_VALUE_UNDEFINED;
+  }
+
+  ecma_json_parser_frame_t *frame_p = parser_p->frames_p + parser_p->depth - 1;
+
+  if (frame_p->is_array)
+  {
+    return ecma_make_uint32_value (frame_p->index);
+  }
+
+  JERRY_ASSERT (frame_p->key_p != NULL);
+  ecma_ref_ecma_string (frame_p->key_p);
+  return ecma_make_string_value (frame_p->key_p);
+} /* ecma_builtin_json_parser_get_key */
+
+/**
+ * Calls the callback of the incremental JSON parser.
+ *
+ * @return action returned by the callback
+ */
+static ecma_json_parser_action_t
+ecma_builtin_json_parser_call (ecma_json_parser_t *parser_p, /**< parser */
+                               ecma_json_parser_event_t event, /**< event */
+                               ecma_value_t value) /**< closed container, undefined for start events */
+{
+  if (parser_p->callback_p == NULL)
+  {
+    return ECMA_JSON_PARSER_KEEP;
+  }
+
+  ecma_value_t key = ecma_builtin_json_parser_get_key (parser_p);
+  ecma_json_parser_action_t action = parser_p->callback_p (event, key, value, parser_p->depth, parser_p->user_p);
+  ecma_free_value (key);
+
+  return action;
+} /* ecma_builtin_json_parser_call */
+
+/**
+ * Adds a parsed value to the innermost open container,
+ * or stores it as the result if there is no open container.
+ */
+static void
+ecma_builtin_json_parser_add_value (ecma_json_parser_t *parser_p, /**< parser */
+                                    ecma_value_t value) /**< value, ECMA_VALUE_EMPTY if the value is dropped */
+{
+  if (parser_p->depth == 0)
+  {
+    parser_p->result = ecma_is_value_empty (value) ? ECMA_VALUE_UNDEFINED : value;
+    parser_p->state = ECMA_JSON_PARSER_DONE;
+    return;
+  }
+
+  ecma_json_parser_frame_t *frame_p = parser_p->frames_p + parser_p->depth - 1;
+
+  if (!ecma_is_value_empty (value))
+  {
+    if (!ecma_is_value_empty (frame_p->container))
+    {
+      ecma_object_t *container_p = ecma_get_object_from_value (frame_p->container);
+
+      if (frame_p->is_array)
+      {
+        ecma_value_t completion;
+        completion = ecma_builtin_helper_def_prop_by_index (container_p,
+                                                            frame_p->length,
+                                                            value,
+                                                            ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE);
+        JERRY_ASSERT (ecma_is_value_true (completion));
+        frame_p->length++;
+      }
+      else
+      {
+        ecma_builtin_json_define_value_property (container_p, frame_p->key_p, value);
+      }
+    }
+
+    ecma_free_value (value);
+  }
+
+  if (frame_p->key_p != NULL)
+  {
+    ecma_deref_ecma_string (frame_p->key_p);
+    frame_p->key_p = NULL;
+  }
+
+  frame_p->index++;
+  parser_p->state = ECMA_JSON_PARSER_EXPECT_COMMA_OR_END;
+} /* ecma_builtin_json_parser_add_value */
+
+/**
+ * Opens a new object or array.
+ */
+static void
+ecma_builtin_json_parser_open (ecma_json_parser_t *parser_p, /**< parser */
+                               bool is_array) /**< true - if an array is opened */
+{
+  ecma_json_parser_event_t event = is_array ? ECMA_JSON_PARSER_ARRAY_START : ECMA_JSON_PARSER_OBJECT_START;
+  ecma_json_parser_action_t action = ecma_builtin_json_parser_call (parser_p, event, ECMA_VALUE_UNDEFINED);
+
+  if (parser_p->depth == parser_p->frames_size)
+  {
+    uint32_t new_frames_size = JERRY_MAX (parser_p->frames_size * 2, ECMA_JSON_PARSER_MIN_FRAMES);
+    size_t new_size = new_frames_size * sizeof (ecma_json_parser_frame_t);
+
+    if (parser_p->frames_p == NULL)
+    {
+      parser_p->frames_p = (ecma_json_parser_frame_t *) jmem_heap_alloc_block (new_size);
+    }
+    else
+    {
+      size_t old_size = parser_p->frames_size * sizeof (ecma_json_parser_frame_t);
+      parser_p->frames_p = (ecma_json_parser_frame_t *) jmem_heap_realloc_block (parser_p->frames_p,
+                                                                                 old_size,
+                                                                                 new_size);
+    }
+
+    parser_p->frames_size = new_frames_size;
+  }
+
+  ecma_json_parser_frame_t *frame_p = parser_p->frames_p + parser_p->depth;
+  frame_p->container = ECMA_VALUE_EMPTY;
+  frame_p->key_p = NULL;
+  frame_p->index = 0;
+  frame_p->length = 0;
+  frame_p->is_array = is_array;
+
+  if (action == ECMA_JSON_PARSER_KEEP)
+  {
+    ecma_object_t *container_p = (is_array ? ecma_op_new_array_object (0)
+                                           : ecma_op_create_object_object_noarg ());
+    frame_p->container = ecma_make_object_value (container_p);
+  }
+
+  parser_p->depth++;
+  parser_p->state = is_array ? ECMA_JSON_PARSER_EXPECT_VALUE_OR_END : ECMA_JSON_PARSER_EXPECT_KEY_OR_END;
+} /* ecma_builtin_json_parser_open */
+
+/**
+ * Closes the innermost open object or array.
+ */
+static void
+ecma_builtin_json_parser_close (ecma_json_parser_t *parser_p) /**< parser */
+{
+  JERRY_ASSERT (parser_p->depth > 0);
+
+  parser_p->depth--;
+
+  ecma_json_parser_frame_t *frame_p = parser_p->frames_p + parser_p->depth;
+  ecma_value_t value = frame_p->container;
+
+  JERRY_ASSERT (frame_p->key_p == NULL);
+
+  if (!ecma_is_value_empty (value))
+  {
+    ecma_json_parser_event_t event = frame_p->is_array ? ECMA_JSON_PARSER_ARRAY_END : ECMA_JSON_PARSER_OBJECT_END;
+
+    if (ecma_builtin_json_parser_call (parser_p, event, value) == ECMA_JSON_PARSER_DISCARD)
+    {
+      ecma_free_value (value);
+      value = ECMA_VALUE_EMPTY;
+    }
+  }
+
+  ecma_builtin_json_parser_add_value (parser_p, value);
+} /* ecma_builtin_json_parser_close */
+
+/**
+ * Processes a complete token by the incremental JSON parser.
+ *
+ * @return true - if the token is valid at the current position
+ *         false - otherwise, and the parser is switched to error state
+ */
+static bool
+ecma_builtin_json_parser_process_token (ecma_json_parser_t *parser_p, /**< parser */
+                                        const lit_utf8_byte_t *token_start_p, /**< start of the token */
+                                        const lit_utf8_byte_t *token_end_p) /**< end of the token */
+{
+  ecma_json_token_t token;
+  token.current_p = token_start_p;
+  token.end_p = token_end_p;
+
+  ecma_builtin_json_parse_next_token (&token, true);
+
+  if (token.type == TOKEN_INVALID || token.current_p != token_end_p)
+  {
+    JERRY_ASSERT (token.type != TOKEN_STRING);
+    goto syntax_error;
+  }
+
+  switch (parser_p->state)
+  {
+    case ECMA_JSON_PARSER_EXPECT_VALUE_OR_END:
+    {
+      if (token.type == TOKEN_RIGHT_SQUARE)
+      {
+        ecma_builtin_json_parser_close (parser_p);
+        return true;
+      }
+      /* FALLTHRU */
+    }
+    case ECMA_JSON_PARSER_EXPECT_VALUE:
+    {
+      switch (token.type)
+      {
+        case TOKEN_LEFT_BRACE:
+        case TOKEN_LEFT_SQUARE:
+        {
+          ecma_builtin_json_parser_open (parser_p, token.type == TOKEN_LEFT_SQUARE);
+          return true;
+        }
+        case TOKEN_NUMBER:
+        case TOKEN_STRING:
+        case TOKEN_NULL:
+        case TOKEN_TRUE:
+        case TOKEN_FALSE:
+        {
+          ecma_builtin_json_parser_add_value (parser_p, ecma_builtin_json_parse_value (&token));
+          return true;
+        }
+        default:
+        {
+          break;
+        }
+      }
+      break;
+    }
+    case ECMA_JSON_PARSER_EXPECT_KEY_OR_END:
+    {
+      if (token.type == TOKEN_RIGHT_BRACE)
+      {
+        ecma_builtin_json_parser_close (parser_p);
+        return true;
+      }
+      /* FALLTHRU */
+    }
+    case ECMA_JSON_PARSER_EXPECT_KEY:
+    {
+      if (token.type == TOKEN_STRING)
+      {
+        parser_p->frames_p[parser_p->depth - 1].key_p = token.u.string_p;
+        parser_p->state = ECMA_JSON_PARSER_EXPECT_COLON;
+        return true;
+      }
+      break;
+    }
+    case ECMA_JSON_PARSER_EXPECT_COLON:
+    {
+      if (token.type == TOKEN_COLON)
+      {
+        parser_p->state = ECMA_JSON_PARSER_EXPECT_VALUE;
+        return true;
+      }
+      break;
+    }
+    case ECMA_JSON_PARSER_EXPECT_COMMA_OR_END:
+    {
+      ecma_json_parser_frame_t *frame_p = parser_p->frames_p + parser_p->depth - 1;
+
+      if (token.type == TOKEN_COMMA)
+      {
+        parser_p->state = frame_p->is_array ? ECMA_JSON_PARSER_EXPECT_VALUE : ECMA_JSON_PARSER_EXPECT_KEY;
+        return true;
+      }
+
+      if (token.type == (frame_p->is_array ? TOKEN_RIGHT_SQUARE : TOKEN_RIGHT_BRACE))
+      {
+        ecma_builtin_json_parser_close (parser_p);
+        return true;
+      }
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (parser_p->state == ECMA_JSON_PARSER_DONE);
+      break;
+    }
+  }
+
+  if (token.type == TOKEN_STRING)
+  {
+    ecma_deref_ecma_string (token.u.string_p);
+  }
+
+syntax_error:
+  ecma_builtin_json_parser_release_values (parser_p);
+  parser_p->state = ECMA_JSON_PARSER_ERROR;
+  return false;
+} /* ecma_builtin_json_parser_process_token */
+
+/**
+ * Creates an incremental JSON parser.
+ *
+ * The callback is called when an object or array is opened, and when a built
+ * object or array is closed. The callback decides whether the container is
+ * built and whether a closed container is attached to its parent, so only the
+ * retained subtrees are kept in the memory.
+ *
+ * @return new parser, which must be freed with ecma_builtin_json_parser_free
+ */
+ecma_json_parser_t *
+ecma_builtin_json_parser_create (ecma_json_parser_callback_t callback_p, /**< callback, can be NULL */
+                                 void *user_p) /**< user pointer passed to the callback */
+{
+  ecma_json_parser_t *parser_p = (ecma_json_parser_t *) jmem_heap_alloc_block (sizeof (ecma_json_parser_t));
+
+  parser_p->callback_p = callback_p;
+  parser_p->user_p = user_p;
+  parser_p->frames_p = NULL;
+  parser_p->depth = 0;
+  parser_p->frames_size = 0;
+  parser_p->pending_p = NULL;
+  parser_p->pending_size = 0;
+  parser_p->pending_capacity = 0;
+  parser_p->result = ECMA_VALUE_UNDEFINED;
+  parser_p->state = ECMA_JSON_PARSER_EXPECT_VALUE;
+  parser_p->pending_escape = false;
+
+  return parser_p;
+} /* ecma_builtin_json_parser_create */
+
+/**
+ * Passes the next chunk of the input to the incremental JSON parser.
+ *
+ * @return true - if no syntax error is found so far
+ *         false - otherwise
+ */
+bool
+ecma_builtin_json_parser_feed (ecma_json_parser_t *parser_p, /**< parser */
+                               const lit_utf8_byte_t *chunk_p, /**< chunk of the input */
+                               lit_utf8_size_t chunk_size) /**< size of the chunk */
+{
+  if (parser_p->state == ECMA_JSON_PARSER_ERROR)
+  {
+    return false;
+  }
+
+  const lit_utf8_byte_t *current_p = chunk_p;
+  const lit_utf8_byte_t *end_p = chunk_p + chunk_size;
+
+  if (parser_p->pending_size > 0)
+  {
+    const lit_utf8_byte_t *token_end_p;
+
+    if (parser_p->pending_p[0] == LIT_CHAR_DOUBLE_QUOTE)
+    {
+      token_end_p = ecma_builtin_json_find_string_end (current_p, end_p, &parser_p->pending_escape);
+    }
+    else
+    {
+      token_end_p = ecma_builtin_json_find_word_end (current_p, end_p);
+    }
+
+    if (token_end_p == NULL)
+    {
+      ecma_builtin_json_parser_append_pending (parser_p, current_p, chunk_size);
+      return true;
+    }
+
+    ecma_builtin_json_parser_append_pending (parser_p, current_p, (lit_utf8_size_t) (token_end_p - current_p));
+    current_p = token_end_p;
+
+    lit_utf8_size_t pending_size = parser_p->pending_size;
+    parser_p->pending_size = 0;
+
+    if (!ecma_builtin_json_parser_process_token (parser_p, parser_p->pending_p, parser_p->pending_p + pending_size))
+    {
+      return false;
+    }
+  }
+
+  while (true)
+  {
+    while (current_p < end_p
+           && (*current_p == LIT_CHAR_SP
+               || *current_p == LIT_CHAR_CR
+               || *current_p == LIT_CHAR_LF
+               || *current_p == LIT_CHAR_TAB))
+    {
+      current_p++;
+    }
+
+    if (current_p >= end_p)
+    {
+      return true;
+    }
+
+    const lit_utf8_byte_t *token_end_p = current_p + 1;
+
+    if (*current_p == LIT_CHAR_DOUBLE_QUOTE)
+    {
+      parser_p->pending_escape = false;
+      token_end_p = ecma_builtin_json_find_string_end (token_end_p, end_p, &parser_p->pending_escape);
+    }
+    else if (ecma_builtin_json_is_word_byte (*current_p))
+    {
+      token_end_p = ecma_builtin_json_find_word_end (token_end_p, end_p);
+    }
+
+    if (token_end_p == NULL)
+    {
+      /* The token is continued in the next chunk. */
+      ecma_builtin_json_parser_append_pending (parser_p, current_p, (lit_utf8_size_t) (end_p - current_p));
+      return true;
+    }
+
+    if (!ecma_builtin_json_parser_process_token (parser_p, current_p, token_end_p))
+    {
+      return false;
+    }
+
+    current_p = token_end_p;
+  }
+} /* ecma_builtin_json_parser_feed */
+
+/**
+ * Finishes the parsing of the input. Only ecma_builtin_json_parser_free
+ * can be called after this function.
+ *
+ * @return parsed value (undefined if the top level value is discarded)
+ *         ECMA_VALUE_EMPTY - if the input is invalid or incomplete
+ *         Returned value must be freed with ecma_free_value.
+ */
+ecma_value_t
+ecma_builtin_json_parser_finish (ecma_json_parser_t *parser_p) /**< parser */
+{
+  if (parser_p->state != ECMA_JSON_PARSER_ERROR && parser_p->pending_size > 0)
+  {
+    /* Numbers and literals at the end of the input are terminated by the end of the input. */
+    lit_utf8_size_t pending_size = parser_p->pending_size;
+    parser_p->pending_size = 0;
+    ecma_builtin_json_parser_process_token (parser_p, parser_p->pending_p, parser_p->pending_p + pending_size);
+  }
+
+  ecma_value_t result = ECMA_VALUE_EMPTY;
+
+  if (parser_p->state == ECMA_JSON_PARSER_DONE)
+  {
+    result = parser_p->result;
+    parser_p->result = ECMA_VALUE_UNDEFINED;
+  }
+
+  ecma_builtin_json_parser_release_values (parser_p);
+  parser_p->state = ECMA_JSON_PARSER_ERROR;
+  return result;
+} /* ecma_builtin_json_parser_finish */
+
+/**
+ * Frees an incremental JSON parser and the values held by it.
+ */
+void
+ecma_builtin_json_parser_free (ecma_json_parser_t *parser_p) /**< parser */
+{
+  ecma_builtin_json_parser_release_values (parser_p);
+
+  if (parser_p->frames_p != NULL)
+  {
+    jmem_heap_free_block (parser_p->frames_p, parser_p->frames_size * sizeof (ecma_json_parser_frame_t));
+  }
+
+  if (parser_p->pending_p != NULL)
+  {
+    jmem_heap_free_block (parser_p->pending_p, parser_p->pending_capacity);
+  }
+
+  jmem_heap_free_block (parser_p, sizeof (ecma_json_parser_t));
+} /* ecma_builtin_json_parser_free */
+
 /**
  * The JSON object's 'parse' routine
  *
@@ -885,8 +1697,16 @@ ecma_builtin_json_quote (ecma_stringbuilder_t *builder_p, /**< builder for the r
 
   ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_DOUBLE_QUOTE);
 
-  while (str_p < str_end_p)
+  while (true)
   {
+    /* Characters which are not escaped are copied in blocks. */
+    str_p = ecma_builtin_json_find_special_byte (str_p, str_end_p, ENABLED (JERRY_ESNEXT));
+
+    if (str_p >= str_end_p)
+    {
+      break;
+    }
+
     ecma_char_t c = lit_cesu8_read_next (&str_p);
 
     bool should_escape = false;
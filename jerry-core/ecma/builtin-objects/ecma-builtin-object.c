@@ -31,6 +31,7 @@
 #include "ecma-iterator-object.h"
 #include "ecma-function-object.h"
 #include "jcontext.h"
+#include "opcodes.h"
 #endif /* ENABLED (JERRY_ESNEXT) */
 
 #define ECMA_BUILTINS_INTERNAL
@@ -1269,21 +1270,7 @@ ecma_builtin_object_from_entries (ecma_value_t iterator) /**< object's iterator
       goto cleanup_iterator;
     }
 
-    ecma_property_value_t *prop;
-    ecma_property_t *property_p = ecma_find_named_property (obj_p, property_key);
-
-    if (property_p == NULL)
-    {
-      prop = ecma_create_named_data_property (obj_p,
-                                              property_key,
-                                              ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
-                                              NULL);
-      prop->value = ecma_copy_value_if_not_object (value);
-    }
-    else
-    {
-      ecma_named_data_property_assign_value (obj_p, ECMA_PROPERTY_VALUE_PTR (property_p), value);
-    }
+    opfunc_set_data_property (obj_p, property_key, value);
 
     ecma_deref_ecma_string (property_key);
     ecma_free_value (key);
@@ -573,68 +573,89 @@ ecma_builtin_string_prototype_object_replace_helper (ecma_value_t this_value, /*
     lit_utf8_size_t pos = 0;
     while (curr_p <= loop_end_p)
     {
-      if (!memcmp (curr_p, search_buf_p, search_size))
+      if (search_size != 0)
       {
-        const lit_utf8_size_t prefix_size = (lit_utf8_size_t) (curr_p - last_match_end_p);
-        ecma_stringbuilder_append_raw (&replace_ctx.builder, last_match_end_p, prefix_size);
+        const lit_utf8_byte_t *match_p = lit_utf8_find_substring (curr_p,
+                                                                  (lit_utf8_size_t) (input_end_p - curr_p),
+                                                                  search_buf_p,
+                                                                  search_size);
 
-        last_match_end_p = curr_p + search_size;
+        if (match_p == NULL)
+        {
+          break;
+        }
 
-        if (replace_ctx.replace_str_p == NULL)
+        if (input_flags & ECMA_STRING_FLAG_IS_ASCII)
         {
-          ecma_object_t *function_p = ecma_get_object_from_value (replace_value);
-
-          ecma_value_t args[] =
-          {
-            ecma_make_string_value (search_str_p),
-            ecma_make_uint32_value (pos),
-            ecma_make_string_value (input_str_p)
-          };
-
-          result = ecma_op_function_call (function_p,
-                                          ECMA_VALUE_UNDEFINED,
-                                          args,
-                                          3);
-
-          if (ECMA_IS_VALUE_ERROR (result))
-          {
-            ecma_stringbuilder_destroy (&replace_ctx.builder);
-            goto cleanup_replace;
-          }
-
-          ecma_string_t *const result_str_p = ecma_op_to_string (result);
-          ecma_free_value (result);
-
-          if (result_str_p == NULL)
-          {
-            ecma_stringbuilder_destroy (&replace_ctx.builder);
-            result = ECMA_VALUE_ERROR;
-            goto cleanup_replace;
-          }
-
-          ecma_stringbuilder_append (&replace_ctx.builder, result_str_p);
-          ecma_deref_ecma_string (result_str_p);
+          pos += (lit_utf8_size_t) (match_p - curr_p);
         }
         else
         {
-          replace_ctx.matched_p = curr_p;
-          replace_ctx.match_byte_pos = (lit_utf8_size_t) (curr_p - replace_ctx.string_p);
-
-          ecma_builtin_replace_substitute (&replace_ctx);
+          pos += lit_utf8_string_length (curr_p, (lit_utf8_size_t) (match_p - curr_p));
         }
 
-        if (!replace_all
-            || last_match_end_p == input_end_p)
+        curr_p = match_p;
+      }
+
+      const lit_utf8_size_t prefix_size = (lit_utf8_size_t) (curr_p - last_match_end_p);
+      ecma_stringbuilder_append_raw (&replace_ctx.builder, last_match_end_p, prefix_size);
+
+      last_match_end_p = curr_p + search_size;
+
+      if (replace_ctx.replace_str_p == NULL)
+      {
+        ecma_object_t *function_p = ecma_get_object_from_value (replace_value);
+
+        ecma_value_t args[] =
         {
-          break;
+          ecma_make_string_value (search_str_p),
+          ecma_make_uint32_value (pos),
+          ecma_make_string_value (input_str_p)
+        };
+
+        result = ecma_op_function_call (function_p,
+                                        ECMA_VALUE_UNDEFINED,
+                                        args,
+                                        3);
+
+        if (ECMA_IS_VALUE_ERROR (result))
+        {
+          ecma_stringbuilder_destroy (&replace_ctx.builder);
+          goto cleanup_replace;
         }
 
-        if (search_size != 0)
+        ecma_string_t *const result_str_p = ecma_op_to_string (result);
+        ecma_free_value (result);
+
+        if (result_str_p == NULL)
         {
-          curr_p = last_match_end_p;
-          pos += search_length;
-          continue;
+          ecma_stringbuilder_destroy (&replace_ctx.builder);
+          result = ECMA_VALUE_ERROR;
+          goto cleanup_replace;
         }
+
+        ecma_stringbuilder_append (&replace_ctx.builder, result_str_p);
+        ecma_deref_ecma_string (result_str_p);
+      }
+      else
+      {
+        replace_ctx.matched_p = curr_p;
+        replace_ctx.match_byte_pos = (lit_utf8_size_t) (curr_p - replace_ctx.string_p);
+
+        ecma_builtin_replace_substitute (&replace_ctx);
+      }
+
+      if (!replace_all
+          || last_match_end_p == input_end_p)
+      {
+        break;
+      }
+
+      if (search_size != 0)
+      {
+        curr_p = last_match_end_p;
+        pos += search_length;
+        continue;
       }
 
       pos++;
@@ -970,8 +991,23 @@ ecma_builtin_string_prototype_object_split (ecma_value_t this_value, /**< this a
 
   while (current_p < compare_end_p)
   {
-    if (!memcmp (current_p, separator_buffer_p, separator_size)
-        && (last_str_begin_p != current_p + separator_size))
+    if (separator_size != 0)
+    {
+      const lit_utf8_byte_t *match_p = lit_utf8_find_substring (current_p,
+                                                                (lit_utf8_size_t) (string_end_p - current_p),
+                                                                separator_buffer_p,
+                                                                separator_size);
+
+      if (match_p == NULL)
+      {
+        break;
+      }
+
+      current_p = match_p;
+    }
+
+    /* Empty separators do not match at the start of the current part. */
+    if (last_str_begin_p != current_p + separator_size)
     {
       ecma_string_t *substr_p = ecma_new_ecma_string_from_utf8 (last_str_begin_p,
                                                                 (lit_utf8_size_t) (current_p - last_str_begin_p));
@@ -477,6 +477,323 @@ ecma_builtin_typedarray_prototype_reverse (ecma_value_t this_arg, /**< this argu
   return ecma_copy_value (this_arg);
 } /* ecma_builtin_typedarray_prototype_reverse */
 
+/**
+ * Gets the element size of a non-BigInt TypedArray type.
+ *
+ * Note:
+ *      unlike ecma_typedarray_helper_get_shift_size, the result is a
+ *      constant when the type is a constant
+ *
+ * @return element size
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_number_element_size (ecma_typedarray_type_t id) /**< element type */
+{
+  switch (id)
+  {
+    case ECMA_INT8_ARRAY:
+    case ECMA_UINT8_ARRAY:
+    case ECMA_UINT8_CLAMPED_ARRAY:
+    {
+      return 1;
+    }
+    case ECMA_INT16_ARRAY:
+    case ECMA_UINT16_ARRAY:
+    {
+      return 2;
+    }
+    case ECMA_INT32_ARRAY:
+    case ECMA_UINT32_ARRAY:
+    case ECMA_FLOAT32_ARRAY:
+    {
+      return 4;
+    }
+    default:
+    {
+      JERRY_ASSERT (id == ECMA_FLOAT64_ARRAY);
+      return 8;
+    }
+  }
+} /* ecma_typedarray_number_element_size */
+
+/**
+ * Checks whether the elements of a non-BigInt TypedArray type are integers.
+ *
+ * @return true - if the elements are integers
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_is_integer_type (ecma_typedarray_type_t id) /**< element type */
+{
+  return id < ECMA_FLOAT32_ARRAY;
+} /* ecma_typedarray_is_integer_type */
+
+/**
+ * Reads an element of an integer TypedArray.
+ *
+ * @return element value
+ */
+static inline int64_t JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_read_integer (const lit_utf8_byte_t *src_p, /**< element */
+                              ecma_typedarray_type_t id) /**< element type */
+{
+  switch (id)
+  {
+    case ECMA_INT8_ARRAY:
+    {
+      return (int8_t) *src_p;
+    }
+    case ECMA_UINT8_ARRAY:
+    case ECMA_UINT8_CLAMPED_ARRAY:
+    {
+      return *src_p;
+    }
+    case ECMA_INT16_ARRAY:
+    {
+      int16_t num;
+      ECMA_TYPEDARRAY_GET_ELEMENT (src_p, num, int16_t);
+      return num;
+    }
+    case ECMA_UINT16_ARRAY:
+    {
+      uint16_t num;
+      ECMA_TYPEDARRAY_GET_ELEMENT (src_p, num, uint16_t);
+      return num;
+    }
+    case ECMA_INT32_ARRAY:
+    {
+      int32_t num;
+      ECMA_TYPEDARRAY_GET_ELEMENT (src_p, num, int32_t);
+      return num;
+    }
+    default:
+    {
+      JERRY_ASSERT (id == ECMA_UINT32_ARRAY);
+      uint32_t num;
+      ECMA_TYPEDARRAY_GET_ELEMENT (src_p, num, uint32_t);
+      return num;
+    }
+  }
+} /* ecma_typedarray_read_integer */
+
+/**
+ * Writes an integer into an element of an integer TypedArray
+ * other than Uint8ClampedArray. The value is truncated to the
+ * size of the element (modulo conversion).
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_write_integer (lit_utf8_byte_t *dst_p, /**< element */
+                               int64_t value, /**< element value */
+                               ecma_typedarray_type_t id) /**< element type */
+{
+  JERRY_ASSERT (ecma_typedarray_is_integer_type (id) && id != ECMA_UINT8_CLAMPED_ARRAY);
+
+  switch (ecma_typedarray_number_element_size (id))
+  {
+    case 1:
+    {
+      *dst_p = (lit_utf8_byte_t) value;
+      break;
+    }
+    case 2:
+    {
+      uint16_t num = (uint16_t) value;
+      ECMA_TYPEDARRAY_SET_ELEMENT (dst_p, num, uint16_t);
+      break;
+    }
+    default:
+    {
+      uint32_t num = (uint32_t) value;
+      ECMA_TYPEDARRAY_SET_ELEMENT (dst_p, num, uint32_t);
+      break;
+    }
+  }
+} /* ecma_typedarray_write_integer */
+
+/**
+ * Reads an element of a non-BigInt TypedArray as a number, without creating an ecma value.
+ *
+ * @return element value
+ */
+static inline ecma_number_t JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_read_number (const lit_utf8_byte_t *src_p, /**< element */
+                             ecma_typedarray_type_t id) /**< element type */
+{
+  if (ecma_typedarray_is_integer_type (id))
+  {
+    return (ecma_number_t) ecma_typedarray_read_integer (src_p, id);
+  }
+
+  if (id == ECMA_FLOAT32_ARRAY)
+  {
+    float num;
+    ECMA_TYPEDARRAY_GET_ELEMENT (src_p, num, float);
+    return (ecma_number_t) num;
+  }
+
+#if ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
+  JERRY_ASSERT (id == ECMA_FLOAT64_ARRAY);
+
+  double num;
+  ECMA_TYPEDARRAY_GET_ELEMENT (src_p, num, double);
+  return (ecma_number_t) num;
+#else /* !ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+  JERRY_UNREACHABLE ();
+  return 0;
+#endif /* ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+} /* ecma_typedarray_read_number */
+
+/**
+ * Writes a number into an element of a non-BigInt TypedArray, without creating an ecma value.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_write_number (lit_utf8_byte_t *dst_p, /**< element */
+                              ecma_number_t value, /**< element value */
+                              ecma_typedarray_type_t id) /**< element type */
+{
+  if (id == ECMA_FLOAT32_ARRAY)
+  {
+    float num = (float) value;
+    ECMA_TYPEDARRAY_SET_ELEMENT (dst_p, num, float);
+    return;
+  }
+
+#if ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
+  if (id == ECMA_FLOAT64_ARRAY)
+  {
+    double num = (double) value;
+    ECMA_TYPEDARRAY_SET_ELEMENT (dst_p, num, double);
+    return;
+  }
+#endif /* ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+
+  /* Integer conversions need range checks, which are done by the shared setter. */
+  ecma_set_typedarray_number_element (dst_p, value, id);
+} /* ecma_typedarray_write_number */
+
+/**
+ * Converts the elements of a non-BigInt TypedArray to another non-BigInt type.
+ *
+ * Note:
+ *      when the types are constants, the loop only contains the conversion of a single type pair
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_convert_loop (lit_utf8_byte_t *dst_p, /**< destination elements */
+                              ecma_typedarray_type_t dst_id, /**< destination type */
+                              const lit_utf8_byte_t *src_p, /**< source elements */
+                              ecma_typedarray_type_t src_id, /**< source type */
+                              uint32_t count) /**< number of elements */
+{
+  uint32_t dst_size = ecma_typedarray_number_element_size (dst_id);
+  uint32_t src_size = ecma_typedarray_number_element_size (src_id);
+  const lit_utf8_byte_t *src_end_p = src_p + count * src_size;
+
+  if (ecma_typedarray_is_integer_type (src_id)
+      && ecma_typedarray_is_integer_type (dst_id)
+      && dst_id != ECMA_UINT8_CLAMPED_ARRAY)
+  {
+    while (src_p < src_end_p)
+    {
+      ecma_typedarray_write_integer (dst_p, ecma_typedarray_read_integer (src_p, src_id), dst_id);
+      src_p += src_size;
+      dst_p += dst_size;
+    }
+    return;
+  }
+
+  while (src_p < src_end_p)
+  {
+    ecma_typedarray_write_number (dst_p, ecma_typedarray_read_number (src_p, src_id), dst_id);
+    src_p += src_size;
+    dst_p += dst_size;
+  }
+} /* ecma_typedarray_convert_loop */
+
+/**
+ * Copies the elements of a non-BigInt TypedArray into a non-BigInt TypedArray of a different type.
+ *
+ * Note:
+ *      the source and destination ranges must not overlap
+ */
+static void
+ecma_typedarray_convert_elements (lit_utf8_byte_t *dst_p, /**< destination elements */
+                                  ecma_typedarray_type_t dst_id, /**< destination type */
+                                  const lit_utf8_byte_t *src_p, /**< source elements */
+                                  ecma_typedarray_type_t src_id, /**< source type */
+                                  uint32_t count) /**< number of elements */
+{
+  JERRY_ASSERT (dst_id != src_id);
+
+  /* The conversions of raw (e.g. sensor or pixel) data to floating point
+   * numbers and back between the float types have their own loops. */
+  if (dst_id == ECMA_FLOAT32_ARRAY)
+  {
+    switch (src_id)
+    {
+      case ECMA_UINT8_ARRAY:
+      {
+        ecma_typedarray_convert_loop (dst_p, ECMA_FLOAT32_ARRAY, src_p, ECMA_UINT8_ARRAY, count);
+        return;
+      }
+      case ECMA_INT16_ARRAY:
+      {
+        ecma_typedarray_convert_loop (dst_p, ECMA_FLOAT32_ARRAY, src_p, ECMA_INT16_ARRAY, count);
+        return;
+      }
+      case ECMA_INT32_ARRAY:
+      {
+        ecma_typedarray_convert_loop (dst_p, ECMA_FLOAT32_ARRAY, src_p, ECMA_INT32_ARRAY, count);
+        return;
+      }
+#if ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
+      case ECMA_FLOAT64_ARRAY:
+      {
+        ecma_typedarray_convert_loop (dst_p, ECMA_FLOAT32_ARRAY, src_p, ECMA_FLOAT64_ARRAY, count);
+        return;
+      }
+#endif /* ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+      default:
+      {
+        break;
+      }
+    }
+  }
+#if ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
+  else if (dst_id == ECMA_FLOAT64_ARRAY)
+  {
+    switch (src_id)
+    {
+      case ECMA_UINT8_ARRAY:
+      {
+        ecma_typedarray_convert_loop (dst_p, ECMA_FLOAT64_ARRAY, src_p, ECMA_UINT8_ARRAY, count);
+        return;
+      }
+      case ECMA_INT16_ARRAY:
+      {
+        ecma_typedarray_convert_loop (dst_p, ECMA_FLOAT64_ARRAY, src_p, ECMA_INT16_ARRAY, count);
+        return;
+      }
+      case ECMA_INT32_ARRAY:
+      {
+        ecma_typedarray_convert_loop (dst_p, ECMA_FLOAT64_ARRAY, src_p, ECMA_INT32_ARRAY, count);
+        return;
+      }
+      case ECMA_FLOAT32_ARRAY:
+      {
+        ecma_typedarray_convert_loop (dst_p, ECMA_FLOAT64_ARRAY, src_p, ECMA_FLOAT32_ARRAY, count);
+        return;
+      }
+      default:
+      {
+        break;
+      }
+    }
+  }
+#endif /* ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+
+  ecma_typedarray_convert_loop (dst_p, dst_id, src_p, src_id, count);
+} /* ecma_typedarray_convert_elements */
+
 /**
  * The %TypedArray%.prototype object's 'set' routine for a typedArray source
  *
@@ -545,6 +862,34 @@ ecma_op_typedarray_set_with_typedarray (ecma_value_t this_arg, /**< this argumen
     memmove (target_info.buffer_p + target_byte_index, src_info.buffer_p,
              target_info.element_size * src_info.length);
   }
+#if ENABLED (JERRY_BUILTIN_BIGINT)
+  else if (!ECMA_TYPEDARRAY_IS_BIGINT_TYPE (src_info.id) && !ECMA_TYPEDARRAY_IS_BIGINT_TYPE (target_info.id))
+#else /* !ENABLED (JERRY_BUILTIN_BIGINT) */
+  else
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+  {
+    lit_utf8_byte_t *src_buffer_p = src_info.buffer_p;
+    lit_utf8_byte_t *target_buffer_p = target_info.buffer_p + target_byte_index;
+    uint32_t src_byte_length = src_info.element_size * src_info.length;
+    lit_utf8_byte_t *copy_p = NULL;
+
+    /* The source is cloned when it overlaps with the target, since the elements have different sizes. */
+    if (src_buffer_p < target_info.buffer_p + limit
+        && target_buffer_p < src_buffer_p + src_byte_length)
+    {
+      copy_p = (lit_utf8_byte_t *) jmem_heap_alloc_block (src_byte_length);
+      memcpy (copy_p, src_buffer_p, src_byte_length);
+      src_buffer_p = copy_p;
+    }
+
+    ecma_typedarray_convert_elements (target_buffer_p, target_info.id, src_buffer_p, src_info.id, src_info.length);
+
+    if (copy_p != NULL)
+    {
+      jmem_heap_free_block (copy_p, src_byte_length);
+    }
+  }
+#if ENABLED (JERRY_BUILTIN_BIGINT)
   else
   {
     ecma_typedarray_getter_fn_t src_typedarray_getter_cb = ecma_get_typedarray_getter_fn (src_info.id);
@@ -566,6 +911,7 @@ ecma_op_typedarray_set_with_typedarray (ecma_value_t this_arg, /**< this argumen
       target_byte_index += target_info.element_size;
     }
   }
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
 
   return ECMA_VALUE_UNDEFINED;
 } /* ecma_op_typedarray_set_with_typedarray */
@@ -999,13 +1345,11 @@ ecma_builtin_typedarray_prototype_fill (ecma_value_t this_arg, /**< this object
     subarray_length = end_index_uint32 - begin_index_uint32;
   }
 
-  ecma_typedarray_setter_fn_t typedarray_setter_cb = ecma_get_typedarray_setter_fn (info_p->id);
-  uint32_t byte_index = begin_index_uint32 * info_p->element_size;
-  uint32_t limit = byte_index + subarray_length * info_p->element_size;
-
-  while (byte_index < limit)
+  if (subarray_length > 0)
   {
-    ecma_value_t set_element = typedarray_setter_cb (info_p->buffer_p + byte_index, value_to_set);
+    /* Only the first element is converted, the others are copies of its bytes. */
+    lit_utf8_byte_t *start_p = info_p->buffer_p + begin_index_uint32 * info_p->element_size;
+    ecma_value_t set_element = ecma_set_typedarray_element (start_p, value_to_set, info_p->id);
 
     if (ECMA_IS_VALUE_ERROR (set_element))
     {
@@ -1013,7 +1357,23 @@ ecma_builtin_typedarray_prototype_fill (ecma_value_t this_arg, /**< this object
       return set_element;
     }
 
-    byte_index += info_p->element_size;
+    uint32_t byte_length = subarray_length * info_p->element_size;
+
+    if (info_p->element_size == 1)
+    {
+      memset (start_p + 1, *start_p, byte_length - 1);
+    }
+    else
+    {
+      uint32_t filled_length = info_p->element_size;
+
+      while (filled_length < byte_length)
+      {
+        uint32_t copy_length = JERRY_MIN (filled_length, byte_length - filled_length);
+        memcpy (start_p + filled_length, start_p, copy_length);
+        filled_length += copy_length;
+      }
+    }
   }
 
   ecma_free_value (value_to_set);
@@ -1115,67 +1475,684 @@ ecma_builtin_typedarray_prototype_sort_compare_helper (ecma_value_t lhs, /**< le
 } /* ecma_builtin_typedarray_prototype_sort_compare_helper */
 
 /**
- * The %TypedArray%.prototype object's 'sort' routine.
- *
- * See also:
- *          ES2015, 22.2.3.25, 22.1.3.24
+ * Ranges up to this length are sorted by insertion sort by the default comparison.
+ */
+#define ECMA_TYPEDARRAY_SORT_INSERTION_LIMIT 32
+
+/**
+ * Reads an element of a TypedArray as an unsigned integer.
  *
- * @return ecma value
- *         Returned value must be freed with ecma_free_value.
+ * @return element bits
  */
-static ecma_value_t
-ecma_builtin_typedarray_prototype_sort (ecma_value_t this_arg, /**< this argument */
-                                        ecma_typedarray_info_t *info_p, /**< object info */
-                                        ecma_value_t compare_func) /**< comparator fn */
+static inline uint64_t JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_sort_read_key (const lit_utf8_byte_t *src_p, /**< element */
+                               uint8_t element_size) /**< element size */
 {
-  JERRY_ASSERT (ecma_is_typedarray (this_arg));
-  JERRY_ASSERT (ecma_is_value_undefined (compare_func) || ecma_op_is_callable (compare_func));
+  switch (element_size)
+  {
+    case 1:
+    {
+      return *src_p;
+    }
+    case 2:
+    {
+      uint16_t key;
+      ECMA_TYPEDARRAY_GET_ELEMENT (src_p, key, uint16_t);
+      return key;
+    }
+    case 4:
+    {
+      uint32_t key;
+      ECMA_TYPEDARRAY_GET_ELEMENT (src_p, key, uint32_t);
+      return key;
+    }
+    default:
+    {
+      JERRY_ASSERT (element_size == 8);
+      uint64_t key;
+      ECMA_TYPEDARRAY_GET_ELEMENT (src_p, key, uint64_t);
+      return key;
+    }
+  }
+} /* ecma_typedarray_sort_read_key */
 
-  if (!info_p->length)
+/**
+ * Writes an element of a TypedArray as an unsigned integer.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_sort_write_key (lit_utf8_byte_t *dst_p, /**< element */
+                                uint8_t element_size, /**< element size */
+                                uint64_t key) /**< element bits */
+{
+  switch (element_size)
   {
-    return ecma_copy_value (this_arg);
+    case 1:
+    {
+      *dst_p = (lit_utf8_byte_t) key;
+      break;
+    }
+    case 2:
+    {
+      uint16_t value = (uint16_t) key;
+      ECMA_TYPEDARRAY_SET_ELEMENT (dst_p, value, uint16_t);
+      break;
+    }
+    case 4:
+    {
+      uint32_t value = (uint32_t) key;
+      ECMA_TYPEDARRAY_SET_ELEMENT (dst_p, value, uint32_t);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (element_size == 8);
+      ECMA_TYPEDARRAY_SET_ELEMENT (dst_p, key, uint64_t);
+      break;
+    }
   }
+} /* ecma_typedarray_sort_write_key */
 
-  ecma_value_t ret_value = ECMA_VALUE_EMPTY;
-  JMEM_DEFINE_LOCAL_ARRAY (values_buffer, info_p->length, ecma_value_t);
+/**
+ * Converts the elements of a TypedArray in place to unsigned integers which
+ * have the same order as the elements, or converts them back.
+ *
+ * Signed integers are converted by flipping their sign bit. Floating point
+ * numbers are converted by flipping their sign bit if they are positive, and
+ * all their bits if they are negative. NaN values are replaced by a positive
+ * quiet NaN, so they are greater than any other value.
+ */
+static void
+ecma_typedarray_sort_convert_keys (ecma_typedarray_info_t *info_p, /**< typedarray info */
+                                   bool to_keys) /**< true - convert elements to keys,
+                                                  *   false - convert keys to elements */
+{
+  uint8_t element_size = info_p->element_size;
+  uint64_t sign_bit = ((uint64_t) 1) << (element_size * 8 - 1);
+  uint64_t mask = (sign_bit << 1) - 1;
+  bool is_float = false;
+  uint64_t infinity = 0;
+  uint64_t quiet_nan = 0;
+
+  switch (info_p->id)
+  {
+    case ECMA_INT8_ARRAY:
+    case ECMA_INT16_ARRAY:
+    case ECMA_INT32_ARRAY:
+#if ENABLED (JERRY_BUILTIN_BIGINT)
+    case ECMA_BIGINT64_ARRAY:
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+    {
+      break;
+    }
+    case ECMA_FLOAT32_ARRAY:
+    {
+      is_float = true;
+      infinity = 0x7f800000;
+      quiet_nan = 0x7fc00000;
+      break;
+    }
+    case ECMA_FLOAT64_ARRAY:
+    {
+      is_float = true;
+      infinity = 0x7ff0000000000000ull;
+      quiet_nan = 0x7ff8000000000000ull;
+      break;
+    }
+    default:
+    {
+      /* Unsigned integers are their own keys. */
+      return;
+    }
+  }
 
-  uint32_t byte_index = 0, buffer_index = 0;
-  uint32_t limit = info_p->length * info_p->element_size;
+  lit_utf8_byte_t *current_p = info_p->buffer_p;
+  lit_utf8_byte_t *end_p = current_p + (info_p->length << info_p->shift);
 
-  ecma_typedarray_getter_fn_t typedarray_getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
-  /* Copy unsorted array into a native c array. */
-  while (byte_index < limit)
+  if (!is_float)
   {
-    JERRY_ASSERT (buffer_index < info_p->length);
-    ecma_value_t element_value = typedarray_getter_cb (info_p->buffer_p + byte_index);
-    values_buffer[buffer_index++] = element_value;
-    byte_index += info_p->element_size;
+    while (current_p < end_p)
+    {
+      uint64_t key = ecma_typedarray_sort_read_key (current_p, element_size);
+      ecma_typedarray_sort_write_key (current_p, element_size, key ^ sign_bit);
+      current_p += element_size;
+    }
+    return;
   }
 
-  JERRY_ASSERT (buffer_index == info_p->length);
+  while (current_p < end_p)
+  {
+    uint64_t bits = ecma_typedarray_sort_read_key (current_p, element_size);
 
-  const ecma_builtin_helper_sort_compare_fn_t sort_cb = &ecma_builtin_typedarray_prototype_sort_compare_helper;
+    if (to_keys)
+    {
+      if ((bits & ~sign_bit) > infinity)
+      {
+        bits = quiet_nan;
+      }
 
-  ecma_value_t sort_value = ecma_builtin_helper_array_merge_sort_helper (values_buffer,
-                                                                         (uint32_t) (info_p->length),
-                                                                         compare_func,
-                                                                         sort_cb);
+      bits = (bits & sign_bit) ? (~bits & mask) : (bits | sign_bit);
+    }
+    else
+    {
+      bits = (bits & sign_bit) ? (bits ^ sign_bit) : (~bits & mask);
+    }
 
-  if (ECMA_IS_VALUE_ERROR (sort_value))
-  {
-    ret_value = sort_value;
-    goto free_values;
+    ecma_typedarray_sort_write_key (current_p, element_size, bits);
+    current_p += element_size;
   }
+} /* ecma_typedarray_sort_convert_keys */
 
-  JERRY_ASSERT (sort_value == ECMA_VALUE_EMPTY);
+/**
+ * Sorts unsigned integer keys by insertion sort.
+ *
+ * Note: the element size is a constant after inlining, so the key accesses are not branching.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_sort_insertion (lit_utf8_byte_t *buffer_p, /**< keys */
+                                uint32_t length, /**< number of keys */
+                                uint8_t element_size) /**< key size */
+{
+  for (uint32_t i = 1; i < length; i++)
+  {
+    uint64_t key = ecma_typedarray_sort_read_key (buffer_p + i * element_size, element_size);
+    uint32_t j = i;
 
-  ecma_typedarray_setter_fn_t typedarray_setter_cb = ecma_get_typedarray_setter_fn (info_p->id);
+    while (j > 0)
+    {
+      uint64_t previous_key = ecma_typedarray_sort_read_key (buffer_p + (j - 1) * element_size, element_size);
 
-  byte_index = 0;
-  buffer_index = 0;
-  limit = info_p->length * info_p->element_size;
-  /* Put sorted values from the native array back into the typedarray buffer. */
-  while (byte_index < limit)
+      if (previous_key <= key)
+      {
+        break;
+      }
+
+      ecma_typedarray_sort_write_key (buffer_p + j * element_size, element_size, previous_key);
+      j--;
+    }
+
+    ecma_typedarray_sort_write_key (buffer_p + j * element_size, element_size, key);
+  }
+} /* ecma_typedarray_sort_insertion */
+
+/**
+ * Sorts unsigned integer keys by heap sort.
+ */
+static void
+ecma_typedarray_sort_heap (lit_utf8_byte_t *buffer_p, /**< keys */
+                           uint32_t length, /**< number of keys */
+                           uint8_t element_size) /**< key size */
+{
+  uint32_t start = length / 2;
+  uint32_t end = length;
+
+  while (end > 1)
+  {
+    uint32_t root;
+
+    if (start > 0)
+    {
+      /* Building the heap. */
+      root = --start;
+    }
+    else
+    {
+      /* Moving the largest key to the end. */
+      end--;
+      uint64_t largest_key = ecma_typedarray_sort_read_key (buffer_p, element_size);
+      uint64_t last_key = ecma_typedarray_sort_read_key (buffer_p + end * element_size, element_size);
+      ecma_typedarray_sort_write_key (buffer_p, element_size, last_key);
+      ecma_typedarray_sort_write_key (buffer_p + end * element_size, element_size, largest_key);
+      root = 0;
+    }
+
+    uint64_t root_key = ecma_typedarray_sort_read_key (buffer_p + root * element_size, element_size);
+
+    while (true)
+    {
+      uint32_t child = 2 * root + 1;
+
+      if (child >= end)
+      {
+        break;
+      }
+
+      uint64_t child_key = ecma_typedarray_sort_read_key (buffer_p + child * element_size, element_size);
+
+      if (child + 1 < end)
+      {
+        uint64_t right_key = ecma_typedarray_sort_read_key (buffer_p + (child + 1) * element_size, element_size);
+
+        if (right_key > child_key)
+        {
+          child++;
+          child_key = right_key;
+        }
+      }
+
+      if (child_key <= root_key)
+      {
+        break;
+      }
+
+      ecma_typedarray_sort_write_key (buffer_p + root * element_size, element_size, child_key);
+      root = child;
+    }
+
+    ecma_typedarray_sort_write_key (buffer_p + root * element_size, element_size, root_key);
+  }
+} /* ecma_typedarray_sort_heap */
+
+/**
+ * Partitions unsigned integer keys around the median of the first, middle and last keys.
+ *
+ * Note: the element size is a constant after inlining, so the key accesses are not branching.
+ *
+ * @return number of keys in the first part, which are less than or equal to the keys of the second part
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_sort_partition (lit_utf8_byte_t *buffer_p, /**< keys */
+                                uint32_t length, /**< number of keys */
+                                uint8_t element_size) /**< key size */
+{
+  lit_utf8_byte_t *first_p = buffer_p;
+  lit_utf8_byte_t *middle_p = buffer_p + (length / 2) * element_size;
+  lit_utf8_byte_t *last_p = buffer_p + (length - 1) * element_size;
+
+  uint64_t first_key = ecma_typedarray_sort_read_key (first_p, element_size);
+  uint64_t pivot = ecma_typedarray_sort_read_key (middle_p, element_size);
+  uint64_t last_key = ecma_typedarray_sort_read_key (last_p, element_size);
+  uint64_t tmp;
+
+  /* Sorting the three keys, so the first and last keys stop the scans below. */
+  if (pivot < first_key)
+  {
+    tmp = pivot;
+    pivot = first_key;
+    first_key = tmp;
+  }
+
+  if (last_key < pivot)
+  {
+    tmp = last_key;
+    last_key = pivot;
+    pivot = tmp;
+
+    if (pivot < first_key)
+    {
+      tmp = pivot;
+      pivot = first_key;
+      first_key = tmp;
+    }
+  }
+
+  ecma_typedarray_sort_write_key (first_p, element_size, first_key);
+  ecma_typedarray_sort_write_key (middle_p, element_size, pivot);
+  ecma_typedarray_sort_write_key (last_p, element_size, last_key);
+
+  lit_utf8_byte_t *left_p = first_p;
+  lit_utf8_byte_t *right_p = last_p;
+
+  while (true)
+  {
+    uint64_t left_key = ecma_typedarray_sort_read_key (left_p, element_size);
+
+    while (left_key < pivot)
+    {
+      left_p += element_size;
+      left_key = ecma_typedarray_sort_read_key (left_p, element_size);
+    }
+
+    uint64_t right_key = ecma_typedarray_sort_read_key (right_p, element_size);
+
+    while (right_key > pivot)
+    {
+      right_p -= element_size;
+      right_key = ecma_typedarray_sort_read_key (right_p, element_size);
+    }
+
+    if (left_p >= right_p)
+    {
+      return (uint32_t) ((right_p - buffer_p) / element_size) + 1;
+    }
+
+    ecma_typedarray_sort_write_key (left_p, element_size, right_key);
+    ecma_typedarray_sort_write_key (right_p, element_size, left_key);
+    left_p += element_size;
+    right_p -= element_size;
+  }
+} /* ecma_typedarray_sort_partition */
+
+/**
+ * Sorts unsigned integer keys in place by introsort: quicksort, which switches to
+ * heap sort when the partitions are too unbalanced, and to insertion sort for short ranges.
+ */
+static void
+ecma_typedarray_sort_intro (lit_utf8_byte_t *buffer_p, /**< keys */
+                            uint32_t length, /**< number of keys */
+                            uint8_t element_size, /**< key size */
+                            uint32_t depth_limit) /**< remaining number of partitioning levels */
+{
+  while (length > ECMA_TYPEDARRAY_SORT_INSERTION_LIMIT)
+  {
+    if (depth_limit == 0)
+    {
+      ecma_typedarray_sort_heap (buffer_p, length, element_size);
+      return;
+    }
+
+    depth_limit--;
+
+    uint32_t left_length;
+
+    switch (element_size)
+    {
+      case 2:
+      {
+        left_length = ecma_typedarray_sort_partition (buffer_p, length, 2);
+        break;
+      }
+      case 4:
+      {
+        left_length = ecma_typedarray_sort_partition (buffer_p, length, 4);
+        break;
+      }
+      default:
+      {
+        left_length = ecma_typedarray_sort_partition (buffer_p, length, 8);
+        break;
+      }
+    }
+
+    JERRY_ASSERT (left_length > 0 && left_length < length);
+
+    /* Recursion is used for the shorter part, so the stack depth is logarithmic. */
+    lit_utf8_byte_t *right_p = buffer_p + left_length * element_size;
+    uint32_t right_length = length - left_length;
+
+    if (left_length < right_length)
+    {
+      ecma_typedarray_sort_intro (buffer_p, left_length, element_size, depth_limit);
+      buffer_p = right_p;
+      length = right_length;
+    }
+    else
+    {
+      ecma_typedarray_sort_intro (right_p, right_length, element_size, depth_limit);
+      length = left_length;
+    }
+  }
+
+  switch (element_size)
+  {
+    case 2:
+    {
+      ecma_typedarray_sort_insertion (buffer_p, length, 2);
+      break;
+    }
+    case 4:
+    {
+      ecma_typedarray_sort_insertion (buffer_p, length, 4);
+      break;
+    }
+    default:
+    {
+      ecma_typedarray_sort_insertion (buffer_p, length, 8);
+      break;
+    }
+  }
+} /* ecma_typedarray_sort_intro */
+
+/**
+ * Counts the digits of the keys for all passes of the radix sort.
+ *
+ * Note: the element size is a constant after inlining, so the key accesses are not branching.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_sort_radix_count (const lit_utf8_byte_t *buffer_p, /**< keys */
+                                  const lit_utf8_byte_t *end_p, /**< end of the keys */
+                                  uint32_t *counts_p, /**< [out] counters of each digit */
+                                  uint8_t element_size) /**< key size */
+{
+  for (const lit_utf8_byte_t *current_p = buffer_p; current_p < end_p; current_p += element_size)
+  {
+    uint64_t key = ecma_typedarray_sort_read_key (current_p, element_size);
+
+    for (uint32_t digit = 0; digit < element_size; digit++)
+    {
+      counts_p[digit * 256 + ((key >> (digit * 8)) & 0xff)]++;
+    }
+  }
+} /* ecma_typedarray_sort_radix_count */
+
+/**
+ * Moves the keys to their positions by the current digit in a pass of the radix sort.
+ *
+ * Note: the element size is a constant after inlining, so the key accesses are not branching.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_sort_radix_scatter (const lit_utf8_byte_t *src_p, /**< source keys */
+                                    const lit_utf8_byte_t *src_end_p, /**< end of the source keys */
+                                    lit_utf8_byte_t *dst_p, /**< destination buffer */
+                                    uint32_t *positions_p, /**< next position of each digit */
+                                    uint32_t shift, /**< shift of the current digit */
+                                    uint8_t element_size) /**< key size */
+{
+  for (const lit_utf8_byte_t *current_p = src_p; current_p < src_end_p; current_p += element_size)
+  {
+    uint64_t key = ecma_typedarray_sort_read_key (current_p, element_size);
+    uint32_t index = positions_p[(key >> shift) & 0xff]++;
+    ecma_typedarray_sort_write_key (dst_p + index * element_size, element_size, key);
+  }
+} /* ecma_typedarray_sort_radix_scatter */
+
+/**
+ * Sorts 16 or 32 bit unsigned integer keys by least significant digit radix sort,
+ * where each byte is a digit. Digits which are the same for all keys are skipped,
+ * so small values stored in wide elements need fewer passes.
+ *
+ * @return true - if the keys are sorted
+ *         false - if the temporary buffer cannot be allocated
+ */
+static bool
+ecma_typedarray_sort_radix (lit_utf8_byte_t *buffer_p, /**< keys */
+                            uint32_t length, /**< number of keys */
+                            uint8_t element_size) /**< key size */
+{
+  JERRY_ASSERT (element_size == 2 || element_size == 4);
+
+  /* The counters of all digits are followed by the temporary buffer. */
+  size_t buffer_size = (size_t) length * element_size;
+  size_t counts_size = sizeof (uint32_t) * 256 * element_size;
+  uint32_t *counts_p = (uint32_t *) jmem_heap_alloc_block_null_on_error (counts_size + buffer_size);
+
+  if (counts_p == NULL)
+  {
+    return false;
+  }
+
+  memset (counts_p, 0, counts_size);
+
+  lit_utf8_byte_t *temp_p = ((lit_utf8_byte_t *) counts_p) + counts_size;
+  lit_utf8_byte_t *end_p = buffer_p + buffer_size;
+
+  if (element_size == 2)
+  {
+    ecma_typedarray_sort_radix_count (buffer_p, end_p, counts_p, 2);
+  }
+  else
+  {
+    ecma_typedarray_sort_radix_count (buffer_p, end_p, counts_p, 4);
+  }
+
+  uint64_t first_key = ecma_typedarray_sort_read_key (buffer_p, element_size);
+  lit_utf8_byte_t *src_p = buffer_p;
+
+  for (uint32_t digit = 0; digit < element_size; digit++)
+  {
+    uint32_t *digit_counts_p = counts_p + digit * 256;
+    uint32_t shift = digit * 8;
+
+    if (digit_counts_p[(first_key >> shift) & 0xff] == length)
+    {
+      /* The digit is the same for all keys. */
+      continue;
+    }
+
+    uint32_t position = 0;
+
+    for (uint32_t i = 0; i < 256; i++)
+    {
+      uint32_t count = digit_counts_p[i];
+      digit_counts_p[i] = position;
+      position += count;
+    }
+
+    lit_utf8_byte_t *dst_p = (src_p == buffer_p) ? temp_p : buffer_p;
+    lit_utf8_byte_t *src_end_p = src_p + buffer_size;
+
+    if (element_size == 2)
+    {
+      ecma_typedarray_sort_radix_scatter (src_p, src_end_p, dst_p, digit_counts_p, shift, 2);
+    }
+    else
+    {
+      ecma_typedarray_sort_radix_scatter (src_p, src_end_p, dst_p, digit_counts_p, shift, 4);
+    }
+
+    src_p = dst_p;
+  }
+
+  if (src_p != buffer_p)
+  {
+    memcpy (buffer_p, src_p, buffer_size);
+  }
+
+  jmem_heap_free_block (counts_p, counts_size + buffer_size);
+  return true;
+} /* ecma_typedarray_sort_radix */
+
+/**
+ * Sorts the elements of a TypedArray in place by the default comparison,
+ * without converting them to ecma values.
+ */
+static void
+ecma_typedarray_sort_default (ecma_typedarray_info_t *info_p) /**< typedarray info */
+{
+  uint32_t length = info_p->length;
+  uint8_t element_size = info_p->element_size;
+  lit_utf8_byte_t *buffer_p = info_p->buffer_p;
+
+  ecma_typedarray_sort_convert_keys (info_p, true);
+
+  if (length <= ECMA_TYPEDARRAY_SORT_INSERTION_LIMIT)
+  {
+    ecma_typedarray_sort_insertion (buffer_p, length, element_size);
+  }
+  else if (element_size == 1)
+  {
+    /* Counting sort, which needs no temporary buffer. */
+    uint32_t counts[256];
+    memset (counts, 0, sizeof (counts));
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+      counts[buffer_p[i]]++;
+    }
+
+    for (uint32_t i = 0; i < 256; i++)
+    {
+      memset (buffer_p, (int) i, counts[i]);
+      buffer_p += counts[i];
+    }
+  }
+  else if (info_p->id == ECMA_FLOAT32_ARRAY
+           || element_size == 8
+           || !ecma_typedarray_sort_radix (buffer_p, length, element_size))
+  {
+    /* Floating point keys are sorted in place, and so are integer keys
+     * when the temporary buffer of the radix sort cannot be allocated.
+     * Heap sort is used after 2 * log2 (length) levels of partitioning. */
+    uint32_t depth_limit = 0;
+
+    for (uint32_t i = length; i > 1; i >>= 1)
+    {
+      depth_limit += 2;
+    }
+
+    ecma_typedarray_sort_intro (buffer_p, length, element_size, depth_limit);
+  }
+
+  ecma_typedarray_sort_convert_keys (info_p, false);
+} /* ecma_typedarray_sort_default */
+
+/**
+ * The %TypedArray%.prototype object's 'sort' routine.
+ *
+ * See also:
+ *          ES2015, 22.2.3.25, 22.1.3.24
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_sort (ecma_value_t this_arg, /**< this argument */
+                                        ecma_typedarray_info_t *info_p, /**< object info */
+                                        ecma_value_t compare_func) /**< comparator fn */
+{
+  JERRY_ASSERT (ecma_is_typedarray (this_arg));
+  JERRY_ASSERT (ecma_is_value_undefined (compare_func) || ecma_op_is_callable (compare_func));
+
+  if (!info_p->length)
+  {
+    return ecma_copy_value (this_arg);
+  }
+
+  if (ecma_is_value_undefined (compare_func))
+  {
+    ecma_typedarray_sort_default (info_p);
+    return ecma_copy_value (this_arg);
+  }
+
+  ecma_value_t ret_value = ECMA_VALUE_EMPTY;
+  JMEM_DEFINE_LOCAL_ARRAY (values_buffer, info_p->length, ecma_value_t);
+
+  uint32_t byte_index = 0, buffer_index = 0;
+  uint32_t limit = info_p->length * info_p->element_size;
+
+  ecma_typedarray_getter_fn_t typedarray_getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
+  /* Copy unsorted array into a native c array. */
+  while (byte_index < limit)
+  {
+    JERRY_ASSERT (buffer_index < info_p->length);
+    ecma_value_t element_value = typedarray_getter_cb (info_p->buffer_p + byte_index);
+    values_buffer[buffer_index++] = element_value;
+    byte_index += info_p->element_size;
+  }
+
+  JERRY_ASSERT (buffer_index == info_p->length);
+
+  const ecma_builtin_helper_sort_compare_fn_t sort_cb = &ecma_builtin_typedarray_prototype_sort_compare_helper;
+
+  ecma_value_t sort_value = ecma_builtin_helper_array_merge_sort_helper (values_buffer,
+                                                                         (uint32_t) (info_p->length),
+                                                                         compare_func,
+                                                                         sort_cb);
+
+  if (ECMA_IS_VALUE_ERROR (sort_value))
+  {
+    ret_value = sort_value;
+    goto free_values;
+  }
+
+  JERRY_ASSERT (sort_value == ECMA_VALUE_EMPTY);
+
+  ecma_typedarray_setter_fn_t typedarray_setter_cb = ecma_get_typedarray_setter_fn (info_p->id);
+
+  byte_index = 0;
+  buffer_index = 0;
+  limit = info_p->length * info_p->element_size;
+  /* Put sorted values from the native array back into the typedarray buffer. */
+  while (byte_index < limit)
   {
     JERRY_ASSERT (buffer_index < info_p->length);
     ecma_value_t element_value = values_buffer[buffer_index++];
@@ -1264,6 +2241,162 @@ ecma_builtin_typedarray_prototype_find_helper (ecma_value_t this_arg, /**< this
   return is_find ? ECMA_VALUE_UNDEFINED : ecma_make_integer_value (-1);
 } /* ecma_builtin_typedarray_prototype_find_helper */
 
+/**
+ * Searches a number in the elements of a non-BigInt TypedArray.
+ *
+ * Note:
+ *      when the type is a constant, the loop only contains the comparison of a single type
+ *
+ * @return index of the first (or the last, if is_reverse is set) matching element, or UINT32_MAX
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_typedarray_search_loop (const lit_utf8_byte_t *buffer_p, /**< elements */
+                             ecma_typedarray_type_t id, /**< element type */
+                             uint32_t from_index, /**< first index to check */
+                             uint32_t length, /**< number of elements */
+                             ecma_number_t search_num, /**< number to search */
+                             bool is_reverse) /**< search backwards from the from_index */
+{
+  uint32_t element_size = ecma_typedarray_number_element_size (id);
+
+  if (!is_reverse)
+  {
+    for (uint32_t index = from_index; index < length; index++)
+    {
+      if (ecma_typedarray_read_number (buffer_p + index * element_size, id) == search_num)
+      {
+        return index;
+      }
+    }
+
+    return UINT32_MAX;
+  }
+
+  for (uint32_t index = from_index + 1; index > 0; index--)
+  {
+    if (ecma_typedarray_read_number (buffer_p + (index - 1) * element_size, id) == search_num)
+    {
+      return index - 1;
+    }
+  }
+
+  return UINT32_MAX;
+} /* ecma_typedarray_search_loop */
+
+/**
+ * Searches a number in a non-BigInt TypedArray, without creating ecma values for the elements.
+ *
+ * Note:
+ *      positive and negative zeros are equal, and NaN is only found when find_nan is set,
+ *      which gives the result of SameValueZero (find_nan is set) or strict equality comparison
+ *
+ * @return index of the first (or the last, if is_reverse is set) matching element
+ *         starting from the from_index, or UINT32_MAX if there is no such element
+ */
+static uint32_t
+ecma_typedarray_search_number (ecma_typedarray_info_t *info_p, /**< object info */
+                               ecma_number_t search_num, /**< number to search */
+                               uint32_t from_index, /**< first index to check */
+                               bool is_reverse, /**< search backwards from the from_index */
+                               bool find_nan) /**< NaN matches NaN elements */
+{
+  JERRY_ASSERT (from_index < info_p->length);
+
+  if (ecma_number_is_nan (search_num))
+  {
+    if (!find_nan || ecma_typedarray_is_integer_type (info_p->id))
+    {
+      return UINT32_MAX;
+    }
+
+    /* Only the includes routine searches NaN values, and they are rare, so this search is not specialized. */
+    JERRY_ASSERT (!is_reverse);
+
+    for (uint32_t index = from_index; index < info_p->length; index++)
+    {
+      ecma_number_t element = ecma_typedarray_read_number (info_p->buffer_p + (index << info_p->shift), info_p->id);
+
+      if (ecma_number_is_nan (element))
+      {
+        return index;
+      }
+    }
+
+    return UINT32_MAX;
+  }
+
+  if (info_p->element_size == 1)
+  {
+    ecma_number_t min = (info_p->id == ECMA_INT8_ARRAY) ? -128 : 0;
+
+    if (search_num < min || search_num > min + 255 || (ecma_number_t) (int32_t) search_num != search_num)
+    {
+      return UINT32_MAX;
+    }
+
+    if (!is_reverse)
+    {
+      lit_utf8_byte_t byte = (lit_utf8_byte_t) (int32_t) search_num;
+      const lit_utf8_byte_t *found_p = (const lit_utf8_byte_t *) memchr (info_p->buffer_p + from_index,
+                                                                           byte,
+                                                                           info_p->length - from_index);
+
+      return (found_p != NULL) ? (uint32_t) (found_p - info_p->buffer_p) : UINT32_MAX;
+    }
+  }
+
+  switch (info_p->id)
+  {
+    case ECMA_INT8_ARRAY:
+    {
+      return ecma_typedarray_search_loop (info_p->buffer_p, ECMA_INT8_ARRAY,
+                                          from_index, info_p->length, search_num, is_reverse);
+    }
+    case ECMA_UINT8_ARRAY:
+    case ECMA_UINT8_CLAMPED_ARRAY:
+    {
+      return ecma_typedarray_search_loop (info_p->buffer_p, ECMA_UINT8_ARRAY,
+                                          from_index, info_p->length, search_num, is_reverse);
+    }
+    case ECMA_INT16_ARRAY:
+    {
+      return ecma_typedarray_search_loop (info_p->buffer_p, ECMA_INT16_ARRAY,
+                                          from_index, info_p->length, search_num, is_reverse);
+    }
+    case ECMA_UINT16_ARRAY:
+    {
+      return ecma_typedarray_search_loop (info_p->buffer_p, ECMA_UINT16_ARRAY,
+                                          from_index, info_p->length, search_num, is_reverse);
+    }
+    case ECMA_INT32_ARRAY:
+    {
+      return ecma_typedarray_search_loop (info_p->buffer_p, ECMA_INT32_ARRAY,
+                                          from_index, info_p->length, search_num, is_reverse);
+    }
+    case ECMA_UINT32_ARRAY:
+    {
+      return ecma_typedarray_search_loop (info_p->buffer_p, ECMA_UINT32_ARRAY,
+                                          from_index, info_p->length, search_num, is_reverse);
+    }
+    case ECMA_FLOAT32_ARRAY:
+    {
+      return ecma_typedarray_search_loop (info_p->buffer_p, ECMA_FLOAT32_ARRAY,
+                                          from_index, info_p->length, search_num, is_reverse);
+    }
+    default:
+    {
+#if ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
+      JERRY_ASSERT (info_p->id == ECMA_FLOAT64_ARRAY);
+      return ecma_typedarray_search_loop (info_p->buffer_p, ECMA_FLOAT64_ARRAY,
+                                          from_index, info_p->length, search_num, is_reverse);
+#else /* !ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+      JERRY_UNREACHABLE ();
+      return UINT32_MAX;
+#endif /* ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+    }
+  }
+} /* ecma_typedarray_search_number */
+
 /**
  * The %TypedArray%.prototype object's 'indexOf' routine
  *
@@ -1314,12 +2447,20 @@ ecma_builtin_typedarray_prototype_index_of (ecma_typedarray_info_t *info_p, /**<
 
     /* 9. 10. */
     from_index = ((num_var >= 0) ? (uint32_t) num_var
-                                 : (uint32_t) (info_p->length + num_var));
+                                 : (uint32_t) JERRY_MAX (info_p->length + num_var, 0));
+  }
+
+  /* 11. */
+  if (!is_bigint)
+  {
+    uint32_t index = ecma_typedarray_search_number (info_p, ecma_get_number_from_value (args[0]),
+                                                    from_index, false, false);
+
+    return (index != UINT32_MAX) ? ecma_make_uint32_value (index) : ecma_make_integer_value (-1);
   }
 
   ecma_typedarray_getter_fn_t getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
 
-  /* 11. */
   for (int32_t position = (int32_t) from_index * info_p->element_size;
        (uint32_t) position < limit;
        position += info_p->element_size)
@@ -1393,9 +2534,17 @@ ecma_builtin_typedarray_prototype_last_index_of (ecma_typedarray_info_t *info_p,
                                  : (uint32_t) (info_p->length + num_var));
   }
 
+  /* 10. */
+  if (!is_bigint)
+  {
+    uint32_t index = ecma_typedarray_search_number (info_p, ecma_get_number_from_value (args[0]),
+                                                    from_index, true, false);
+
+    return (index != UINT32_MAX) ? ecma_make_uint32_value (index) : ecma_make_integer_value (-1);
+  }
+
   ecma_typedarray_getter_fn_t getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
 
-  /* 10. */
   for (int32_t position = (int32_t) from_index * info_p->element_size;
        position >= 0;
        position += -info_p->element_size)
@@ -1664,6 +2813,19 @@ ecma_builtin_typedarray_prototype_includes (ecma_typedarray_info_t *info_p, /**<
     }
   }
 
+  if (from_index >= info_p->length)
+  {
+    return ECMA_VALUE_FALSE;
+  }
+
+  if (!is_bigint)
+  {
+    uint32_t index = ecma_typedarray_search_number (info_p, ecma_get_number_from_value (args[0]),
+                                                    from_index, false, true);
+
+    return ecma_make_boolean_value (index != UINT32_MAX);
+  }
+
   ecma_typedarray_getter_fn_t getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
 
   uint32_t search_pos = (uint32_t) from_index * info_p->element_size;
@@ -83,6 +83,7 @@ ecma_op_create_arguments_object (vm_frame_ctx_shared_args_t *shared_p, /**< shar
 
   for (uint32_t i = 0; i < shared_p->arg_list_len; i++)
   {
+    ecma_gc_write_barrier (obj_p, shared_p->arg_list_p[i]);
     argv_p[i] = ecma_copy_value_if_not_object (shared_p->arg_list_p[i]);
   }
 
@@ -23,6 +23,7 @@
 #include "ecma-globals.h"
 #include "ecma-property-hashmap.h"
 #include "ecma-helpers.h"
+#include "ecma-lcache.h"
 #include "ecma-number-arithmetic.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
@@ -216,6 +217,7 @@ ecma_op_new_array_object_from_buffer (const ecma_value_t *args_p, /**< array ele
     for (uint32_t i = 0; i < length; i++)
     {
       JERRY_ASSERT (!ecma_is_value_array_hole (args_p[i]));
+      ecma_gc_write_barrier (object_p, args_p[i]);
       values_p[i] = ecma_copy_value_if_not_object (args_p[i]);
     }
 
@@ -239,6 +241,7 @@ ecma_op_new_array_object_from_buffer (const ecma_value_t *args_p, /**< array ele
                                                       ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
                                                       NULL);
       ecma_deref_ecma_string (prop_name_p);
+      ecma_gc_write_barrier (object_p, args_p[i]);
       prop_value_p->value = ecma_copy_value_if_not_object (args_p[i]);
     }
   }
@@ -288,6 +291,7 @@ ecma_op_new_array_object_from_collection (ecma_collection_t *collection_p, /**<
     {
       /* Strong references from the collection are no longer needed
          since GC will mark these object as a fast access mode array properties */
+      ecma_gc_write_barrier (object_p, buffer_p[i]);
       ecma_deref_if_object (buffer_p[i]);
     }
   }
@@ -382,6 +386,8 @@ ecma_fast_array_set_property (ecma_object_t *object_p, /**< fast access mode arr
   ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
   uint32_t old_length = ext_obj_p->u.array.length;
 
+  ecma_gc_write_barrier (object_p, value);
+
   ecma_value_t *values_p;
 
   if (JERRY_LIKELY (index < old_length))
@@ -916,6 +922,14 @@ ecma_delete_array_properties (ecma_object_t *object_p, /**< object */
           }
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
+#if ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0
+          if (ecma_lcache_proto_is_marked (object_p))
+          {
+            ecma_lcache_proto_invalidate (ecma_string_get_property_name_hash (current_prop_p->types[i],
+                                                                              prop_pair_p->names_cp[i]));
+          }
+#endif /* ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
+
           ecma_free_property (object_p, prop_pair_p->names_cp[i], current_prop_p->types + i);
           current_prop_p->types[i] = ECMA_PROPERTY_TYPE_DELETED;
           prop_pair_p->names_cp[i] = LIT_INTERNAL_MAGIC_STRING_DELETED;
@@ -321,65 +321,42 @@ ecma_big_uint_mul_digit (ecma_extended_primitive_t *value_p, /**< BigUInt value
 } /* ecma_big_uint_mul_digit */
 
 /**
- * Convert a BigUInt to a human readable number
- *
- * return char sequence on success, NULL otherwise
+ * Number of digits of the smallest radix power used by the divide and conquer string conversion
  */
-lit_utf8_byte_t *
-ecma_big_uint_to_string (ecma_extended_primitive_t *value_p, /**< BigUInt value */
-                         uint32_t radix, /**< radix number between 2 and 36 */
-                         uint32_t *char_start_p, /**< [out] start offset of numbers */
-                         uint32_t *char_size_p) /**< [out] size of the output buffer */
-{
-  uint32_t size = ECMA_BIGINT_GET_SIZE (value_p);
-
-  JERRY_ASSERT (radix >= 2 && radix <= 36);
-  JERRY_ASSERT (size > 0 && ECMA_BIGINT_GET_LAST_DIGIT (value_p, size) != 0);
-
-  uint32_t max_size = size * 8;
-
-  if (radix < 16)
-  {
-    if (radix >= 8)
-    {
-      /* Most frequent case. */
-      max_size = (max_size + 2) / 3;
-    }
-    else if (radix >= 4)
-    {
-      max_size = (max_size + 1) >> 1;
-    }
-  }
-  else if (radix < 32)
-  {
-    max_size = (max_size + 3) >> 2;
-  }
-  else
-  {
-    max_size = (max_size + 4) / 5;
-  }
+#define ECMA_BIG_UINT_TO_STRING_BASE_DIGITS 16
 
-  /* This space can be used to store a sign. */
-  max_size += (uint32_t) (2 * sizeof (ecma_bigint_digit_t) - 1);
-  max_size &= ~(uint32_t) (sizeof (ecma_bigint_digit_t) - 1);
-  *char_size_p = max_size;
-
-  lit_utf8_byte_t *result_p = (lit_utf8_byte_t *) jmem_heap_alloc_block_null_on_error (max_size);
-
-  if (JERRY_UNLIKELY (result_p == NULL))
-  {
-    return NULL;
-  }
+/**
+ * BigUInt values with at least this number of digits are converted by the divide and conquer algorithm
+ */
+#define ECMA_BIG_UINT_TO_STRING_SPLIT_DIGITS 64
 
-  memcpy (result_p, value_p + 1, size);
+/**
+ * Maximum number of radix powers used by the divide and conquer string conversion
+ */
+#define ECMA_BIG_UINT_TO_STRING_MAX_POWERS 24
 
-  ecma_bigint_digit_t *start_p = (ecma_bigint_digit_t *) (result_p + size);
-  ecma_bigint_digit_t *end_p = (ecma_bigint_digit_t *) result_p;
-  lit_utf8_byte_t *string_p = result_p + max_size;
+/**
+ * Convert the digits of a BigUInt value to characters
+ *
+ * Note:
+ *   the digits are destroyed during the conversion, and the leading
+ *   zero characters of the most significant part are not produced
+ *
+ * @return start of the characters
+ */
+static lit_utf8_byte_t *
+ecma_big_uint_digits_to_chars (ecma_bigint_digit_t *digits_p, /**< start of the digits */
+                               ecma_bigint_digit_t *digits_end_p, /**< end of the digits */
+                               uint32_t radix, /**< radix number between 2 and 36 */
+                               ecma_bigint_digit_t divisor, /**< power of the radix */
+                               uint32_t divisor_chars, /**< number of characters represented by the divisor */
+                               lit_utf8_byte_t *string_p) /**< end of the character buffer */
+{
+  JERRY_ASSERT (digits_end_p > digits_p && digits_end_p[-1] != 0);
 
   do
   {
-    ecma_bigint_digit_t *current_p = (ecma_bigint_digit_t *) start_p;
+    ecma_bigint_digit_t *current_p = digits_end_p;
     ecma_bigint_digit_t remainder = 0;
 
     if (sizeof (uintptr_t) == sizeof (ecma_bigint_two_digits_t))
@@ -388,21 +365,23 @@ ecma_big_uint_to_string (ecma_extended_primitive_t *value_p, /**< BigUInt value
       {
         ecma_bigint_two_digits_t result = *(--current_p) | ECMA_BIGINT_HIGH_DIGIT (remainder);
 
-        *current_p = (ecma_bigint_digit_t) (result / radix);
-        remainder = (ecma_bigint_digit_t) (result % radix);
+        *current_p = (ecma_bigint_digit_t) (result / divisor);
+        remainder = (ecma_bigint_digit_t) (result % divisor);
       }
-      while (current_p > end_p);
+      while (current_p > digits_p);
     }
     else
     {
-      if (ECMA_BIGINT_SIZE_IS_ODD ((uintptr_t) current_p - (uintptr_t) end_p))
+      JERRY_ASSERT (divisor == radix);
+
+      if (ECMA_BIGINT_SIZE_IS_ODD ((uintptr_t) current_p - (uintptr_t) digits_p))
       {
         ecma_bigint_digit_t result = *(--current_p);
         *current_p = result / radix;
         remainder = result % radix;
       }
 
-      while (current_p > end_p)
+      while (current_p > digits_p)
       {
         /* The following algorithm splits the 64 bit input into three numbers, extend
          * them with remainder, divide them by radix, and updates the three bit ranges
@@ -434,16 +413,304 @@ ecma_big_uint_to_string (ecma_extended_primitive_t *value_p, /**< BigUInt value
       }
     }
 
-    *(--string_p) = (lit_utf8_byte_t) ((remainder < 10) ? (remainder + LIT_CHAR_0)
-                                                        : (remainder + (LIT_CHAR_LOWERCASE_A - 10)));
-    JERRY_ASSERT (string_p >= (lit_utf8_byte_t *) start_p);
+    /* The divisor is less than 2^32, so at most one digit is removed. */
+    if (digits_end_p[-1] == 0)
+    {
+      digits_end_p--;
+    }
+
+    uint32_t char_count = divisor_chars;
+
+    do
+    {
+      ecma_bigint_digit_t digit = remainder % radix;
+      remainder /= radix;
+
+      *(--string_p) = (lit_utf8_byte_t) ((digit < 10) ? (digit + LIT_CHAR_0)
+                                                      : (digit + (LIT_CHAR_LOWERCASE_A - 10)));
+    }
+    while (--char_count > 0 && (remainder != 0 || digits_end_p > digits_p));
+  }
+  while (digits_end_p > digits_p);
+
+  return string_p;
+} /* ecma_big_uint_digits_to_chars */
+
+/**
+ * Context of the divide and conquer string conversion
+ */
+typedef struct
+{
+  ecma_extended_primitive_t *powers[ECMA_BIG_UINT_TO_STRING_MAX_POWERS]; /**< powers[i] is divisor
+                                                                          *   ^ (BASE_DIGITS * 2^i) */
+  uint32_t radix; /**< radix number between 2 and 36 */
+  ecma_bigint_digit_t divisor; /**< largest power of the radix which fits into a digit */
+  uint32_t divisor_chars; /**< number of characters represented by the divisor */
+  uint32_t base_chars; /**< number of characters represented by powers[0] */
+} ecma_big_uint_to_string_context_t;
+
+/**
+ * Convert a BigUInt value to a fixed number of characters padded with zeros
+ *
+ * The value must be less than powers[level] (less than the square of powers[level - 1]),
+ * and exactly (base_chars << level) characters are written before string_end_p.
+ *
+ * @return true on success, false if there is not enough memory
+ */
+static bool
+ecma_big_uint_to_string_split (ecma_big_uint_to_string_context_t *context_p, /**< conversion context */
+                               ecma_extended_primitive_t *value_p, /**< BigUInt value */
+                               uint32_t level, /**< split level */
+                               lit_utf8_byte_t *string_end_p) /**< end of the character buffer */
+{
+  uint32_t char_count = context_p->base_chars << level;
+  lit_utf8_byte_t *string_start_p = string_end_p - char_count;
+
+  if (value_p == ECMA_BIGINT_POINTER_TO_ZERO)
+  {
+    memset (string_start_p, LIT_CHAR_0, char_count);
+    return true;
+  }
+
+  if (level == 0)
+  {
+    ecma_bigint_digit_t digits[ECMA_BIG_UINT_TO_STRING_BASE_DIGITS];
+    uint32_t size = ECMA_BIGINT_GET_SIZE (value_p);
+
+    JERRY_ASSERT (size <= sizeof (digits));
+    memcpy (digits, ECMA_BIGINT_GET_DIGITS (value_p, 0), size);
+
+    lit_utf8_byte_t *string_p = ecma_big_uint_digits_to_chars (digits,
+                                                               digits + size / sizeof (ecma_bigint_digit_t),
+                                                               context_p->radix,
+                                                               context_p->divisor,
+                                                               context_p->divisor_chars,
+                                                               string_end_p);
+
+    JERRY_ASSERT (string_p >= string_start_p);
+    memset (string_start_p, LIT_CHAR_0, (size_t) (string_p - string_start_p));
+    return true;
+  }
+
+  ecma_extended_primitive_t *power_p = context_p->powers[level - 1];
+  lit_utf8_byte_t *string_mid_p = string_end_p - (char_count >> 1);
 
-    if (start_p[-1] == 0)
+  if (ecma_big_uint_compare (value_p, power_p) < 0)
+  {
+    memset (string_start_p, LIT_CHAR_0, char_count >> 1);
+    return ecma_big_uint_to_string_split (context_p, value_p, level - 1, string_end_p);
+  }
+
+  ecma_extended_primitive_t *quotient_p = ecma_big_uint_div_mod (value_p, power_p, false);
+
+  if (JERRY_UNLIKELY (quotient_p == NULL))
+  {
+    return false;
+  }
+
+  ecma_extended_primitive_t *product_p = ecma_big_uint_mul (quotient_p, power_p);
+
+  if (JERRY_UNLIKELY (product_p == NULL))
+  {
+    ecma_deref_bigint (quotient_p);
+    return false;
+  }
+
+  ecma_extended_primitive_t *remainder_p = ecma_big_uint_sub (value_p, product_p);
+  ecma_deref_bigint (product_p);
+
+  if (JERRY_UNLIKELY (remainder_p == NULL))
+  {
+    ecma_deref_bigint (quotient_p);
+    return false;
+  }
+
+  bool result = (ecma_big_uint_to_string_split (context_p, quotient_p, level - 1, string_mid_p)
+                 && ecma_big_uint_to_string_split (context_p, remainder_p, level - 1, string_end_p));
+
+  ecma_deref_bigint (quotient_p);
+
+  if (remainder_p != ECMA_BIGINT_POINTER_TO_ZERO)
+  {
+    ecma_deref_bigint (remainder_p);
+  }
+
+  return result;
+} /* ecma_big_uint_to_string_split */
+
+/**
+ * Convert a long BigUInt to a human readable number by splitting it with the powers of the radix
+ *
+ * return char sequence on success, NULL otherwise
+ */
+static lit_utf8_byte_t *
+ecma_big_uint_to_string_long (ecma_extended_primitive_t *value_p, /**< BigUInt value */
+                              uint32_t radix, /**< radix number between 2 and 36 */
+                              ecma_bigint_digit_t divisor, /**< largest power of the radix which fits into a digit */
+                              uint32_t divisor_chars, /**< number of characters represented by the divisor */
+                              uint32_t *char_start_p, /**< [out] start offset of numbers */
+                              uint32_t *char_size_p) /**< [out] size of the output buffer */
+{
+  ecma_big_uint_to_string_context_t context;
+  context.radix = radix;
+  context.divisor = divisor;
+  context.divisor_chars = divisor_chars;
+  context.base_chars = divisor_chars * ECMA_BIG_UINT_TO_STRING_BASE_DIGITS;
+
+  ecma_extended_primitive_t *power_p = ecma_bigint_create (sizeof (ecma_bigint_digit_t));
+
+  if (JERRY_UNLIKELY (power_p == NULL))
+  {
+    return NULL;
+  }
+
+  *ECMA_BIGINT_GET_DIGITS (power_p, 0) = divisor;
+
+  for (uint32_t i = 1; i < ECMA_BIG_UINT_TO_STRING_BASE_DIGITS && power_p != NULL; i++)
+  {
+    power_p = ecma_big_uint_mul_digit (power_p, divisor, 0);
+  }
+
+  uint32_t size = ECMA_BIGINT_GET_SIZE (value_p);
+  uint32_t power_count = 0;
+
+  while (power_p != NULL)
+  {
+    context.powers[power_count++] = power_p;
+
+    /* A value which has at most 2 * n - 2 digits is less than the square
+     * of any value with n digits, so no more powers are needed. */
+    uint32_t power_size = ECMA_BIGINT_GET_SIZE (power_p);
+
+    if (size <= 2 * (power_size - (uint32_t) sizeof (ecma_bigint_digit_t)))
     {
-      start_p--;
+      break;
     }
+
+    JERRY_ASSERT (power_count < ECMA_BIG_UINT_TO_STRING_MAX_POWERS);
+    power_p = ecma_big_uint_mul (power_p, power_p);
+  }
+
+  lit_utf8_byte_t *result_p = NULL;
+  uint32_t char_count = context.base_chars << power_count;
+
+  /* This space can be used to store a sign. */
+  uint32_t max_size = char_count + (uint32_t) (2 * sizeof (ecma_bigint_digit_t) - 1);
+  max_size &= ~(uint32_t) (sizeof (ecma_bigint_digit_t) - 1);
+
+  if (power_p != NULL)
+  {
+    result_p = (lit_utf8_byte_t *) jmem_heap_alloc_block_null_on_error (max_size);
+  }
+
+  if (result_p != NULL
+      && !ecma_big_uint_to_string_split (&context, value_p, power_count, result_p + max_size))
+  {
+    jmem_heap_free_block (result_p, max_size);
+    result_p = NULL;
+  }
+
+  for (uint32_t i = 0; i < power_count; i++)
+  {
+    ecma_deref_bigint (context.powers[i]);
+  }
+
+  if (JERRY_UNLIKELY (result_p == NULL))
+  {
+    return NULL;
+  }
+
+  lit_utf8_byte_t *string_p = result_p + max_size - char_count;
+
+  while (*string_p == LIT_CHAR_0)
+  {
+    string_p++;
   }
-  while (start_p > end_p);
+
+  *char_start_p = (uint32_t) (string_p - result_p);
+  *char_size_p = max_size;
+  return result_p;
+} /* ecma_big_uint_to_string_long */
+
+/**
+ * Convert a BigUInt to a human readable number
+ *
+ * return char sequence on success, NULL otherwise
+ */
+lit_utf8_byte_t *
+ecma_big_uint_to_string (ecma_extended_primitive_t *value_p, /**< BigUInt value */
+                         uint32_t radix, /**< radix number between 2 and 36 */
+                         uint32_t *char_start_p, /**< [out] start offset of numbers */
+                         uint32_t *char_size_p) /**< [out] size of the output buffer */
+{
+  uint32_t size = ECMA_BIGINT_GET_SIZE (value_p);
+
+  JERRY_ASSERT (radix >= 2 && radix <= 36);
+  JERRY_ASSERT (size > 0 && ECMA_BIGINT_GET_LAST_DIGIT (value_p, size) != 0);
+
+  ecma_bigint_digit_t divisor = radix;
+  uint32_t divisor_chars = 1;
+
+  if (sizeof (uintptr_t) == sizeof (ecma_bigint_two_digits_t))
+  {
+    /* Several characters are produced by a single division. */
+    while (divisor <= (~(ecma_bigint_digit_t) 0) / radix)
+    {
+      divisor *= radix;
+      divisor_chars++;
+    }
+  }
+
+  if (size >= ECMA_BIG_UINT_TO_STRING_SPLIT_DIGITS * sizeof (ecma_bigint_digit_t))
+  {
+    return ecma_big_uint_to_string_long (value_p, radix, divisor, divisor_chars, char_start_p, char_size_p);
+  }
+
+  uint32_t max_size = size * 8;
+
+  if (radix < 16)
+  {
+    if (radix >= 8)
+    {
+      /* Most frequent case. */
+      max_size = (max_size + 2) / 3;
+    }
+    else if (radix >= 4)
+    {
+      max_size = (max_size + 1) >> 1;
+    }
+  }
+  else if (radix < 32)
+  {
+    max_size = (max_size + 3) >> 2;
+  }
+  else
+  {
+    max_size = (max_size + 4) / 5;
+  }
+
+  /* This space can be used to store a sign. */
+  max_size += (uint32_t) (2 * sizeof (ecma_bigint_digit_t) - 1);
+  max_size &= ~(uint32_t) (sizeof (ecma_bigint_digit_t) - 1);
+  *char_size_p = max_size;
+
+  lit_utf8_byte_t *result_p = (lit_utf8_byte_t *) jmem_heap_alloc_block_null_on_error (max_size);
+
+  if (JERRY_UNLIKELY (result_p == NULL))
+  {
+    return NULL;
+  }
+
+  memcpy (result_p, value_p + 1, size);
+
+  /* The characters are written from the end of the buffer, and they never overwrite the remaining digits. */
+  lit_utf8_byte_t *string_p = ecma_big_uint_digits_to_chars ((ecma_bigint_digit_t *) result_p,
+                                                             (ecma_bigint_digit_t *) (result_p + size),
+                                                             radix,
+                                                             divisor,
+                                                             divisor_chars,
+                                                             result_p + max_size);
+  JERRY_ASSERT (string_p > result_p);
 
   *char_start_p = (uint32_t) (string_p - result_p);
   return result_p;
@@ -767,6 +1034,296 @@ ecma_big_uint_sub (ecma_extended_primitive_t *left_value_p, /**< left BigUInt va
   return ecma_big_uint_normalize_result (result_p, current_p);
 } /* ecma_big_uint_sub */
 
+#if JERRY_BIGINT_KARATSUBA_THRESHOLD > 0
+
+/**
+ * Add a digit sequence to another digit sequence
+ *
+ * @return carry of the addition
+ */
+static ecma_bigint_digit_t
+ecma_big_uint_add_digits (ecma_bigint_digit_t *destination_p, /**< [in/out] destination digits */
+                          uint32_t destination_count, /**< number of destination digits */
+                          const ecma_bigint_digit_t *source_p, /**< source digits */
+                          uint32_t source_count) /**< number of source digits */
+{
+  JERRY_ASSERT (source_count <= destination_count);
+
+  ecma_bigint_digit_t carry = 0;
+  uint32_t i = 0;
+
+  while (i < source_count)
+  {
+    ecma_bigint_two_digits_t sum = ((ecma_bigint_two_digits_t) destination_p[i]) + source_p[i] + carry;
+
+    destination_p[i++] = (ecma_bigint_digit_t) sum;
+    carry = (ecma_bigint_digit_t) (sum >> (8 * sizeof (ecma_bigint_digit_t)));
+  }
+
+  while (carry != 0 && i < destination_count)
+  {
+    carry = (++destination_p[i++] == 0);
+  }
+
+  return carry;
+} /* ecma_big_uint_add_digits */
+
+/**
+ * Subtract a digit sequence from another digit sequence
+ *
+ * @return borrow of the subtraction
+ */
+static ecma_bigint_digit_t
+ecma_big_uint_sub_digits (ecma_bigint_digit_t *destination_p, /**< [in/out] destination digits */
+                          uint32_t destination_count, /**< number of destination digits */
+                          const ecma_bigint_digit_t *source_p, /**< source digits */
+                          uint32_t source_count) /**< number of source digits */
+{
+  JERRY_ASSERT (source_count <= destination_count);
+
+  ecma_bigint_digit_t borrow = 0;
+  uint32_t i = 0;
+
+  while (i < source_count)
+  {
+    ecma_bigint_two_digits_t difference = ((ecma_bigint_two_digits_t) destination_p[i]) - source_p[i] - borrow;
+
+    destination_p[i++] = (ecma_bigint_digit_t) difference;
+    borrow = (ecma_bigint_digit_t) ((difference >> (8 * sizeof (ecma_bigint_digit_t))) != 0);
+  }
+
+  while (borrow != 0 && i < destination_count)
+  {
+    borrow = (destination_p[i++]-- == 0);
+  }
+
+  return borrow;
+} /* ecma_big_uint_sub_digits */
+
+/**
+ * Multiply two digit sequences with the schoolbook algorithm
+ */
+static void
+ecma_big_uint_mul_digits_schoolbook (ecma_bigint_digit_t *result_p, /**< [out] result digits */
+                                     const ecma_bigint_digit_t *left_p, /**< left digits */
+                                     uint32_t left_count, /**< number of left digits */
+                                     const ecma_bigint_digit_t *right_p, /**< right digits */
+                                     uint32_t right_count) /**< number of right digits */
+{
+  memset (result_p, 0, (left_count + right_count) * sizeof (ecma_bigint_digit_t));
+
+  for (uint32_t i = 0; i < right_count; i++)
+  {
+    ecma_bigint_two_digits_t right = right_p[i];
+
+    if (right == 0)
+    {
+      continue;
+    }
+
+    ecma_bigint_digit_t *destination_p = result_p + i;
+    ecma_bigint_digit_t carry = 0;
+
+    for (uint32_t j = 0; j < left_count; j++)
+    {
+      /* The maximum of (2^n - 1) * (2^n - 1) + 2 * (2^n - 1) is 2^2n - 1, so it cannot overflow. */
+      ecma_bigint_two_digits_t value = right * left_p[j] + destination_p[j] + carry;
+
+      destination_p[j] = (ecma_bigint_digit_t) value;
+      carry = (ecma_bigint_digit_t) (value >> (8 * sizeof (ecma_bigint_digit_t)));
+    }
+
+    destination_p[left_count] = carry;
+  }
+} /* ecma_big_uint_mul_digits_schoolbook */
+
+/**
+ * Multiply two digit sequences with the Karatsuba algorithm
+ *
+ * The result buffer must have space for left_count + right_count digits.
+ *
+ * @return true on success, false if the temporary buffers cannot be allocated
+ */
+static bool
+ecma_big_uint_mul_digits (ecma_bigint_digit_t *result_p, /**< [out] result digits */
+                          const ecma_bigint_digit_t *left_p, /**< left digits */
+                          uint32_t left_count, /**< number of left digits */
+                          const ecma_bigint_digit_t *right_p, /**< right digits */
+                          uint32_t right_count) /**< number of right digits */
+{
+  if (left_count < right_count)
+  {
+    const ecma_bigint_digit_t *tmp_p = left_p;
+    left_p = right_p;
+    right_p = tmp_p;
+
+    uint32_t tmp_count = left_count;
+    left_count = right_count;
+    right_count = tmp_count;
+  }
+
+  if (right_count < JERRY_BIGINT_KARATSUBA_THRESHOLD)
+  {
+    ecma_big_uint_mul_digits_schoolbook (result_p, left_p, left_count, right_p, right_count);
+    return true;
+  }
+
+  if (2 * right_count <= left_count)
+  {
+    /* Unbalanced operands: the left digits are multiplied in right_count sized chunks. */
+    size_t product_size = 2 * right_count * sizeof (ecma_bigint_digit_t);
+    ecma_bigint_digit_t *product_p = (ecma_bigint_digit_t *) jmem_heap_alloc_block_null_on_error (product_size);
+
+    if (JERRY_UNLIKELY (product_p == NULL))
+    {
+      return false;
+    }
+
+    uint32_t result_count = left_count + right_count;
+    memset (result_p, 0, result_count * sizeof (ecma_bigint_digit_t));
+
+    for (uint32_t offset = 0; offset < left_count; offset += right_count)
+    {
+      uint32_t chunk_count = JERRY_MIN (right_count, left_count - offset);
+
+      if (!ecma_big_uint_mul_digits (product_p, left_p + offset, chunk_count, right_p, right_count))
+      {
+        jmem_heap_free_block (product_p, product_size);
+        return false;
+      }
+
+      ecma_bigint_digit_t carry = ecma_big_uint_add_digits (result_p + offset,
+                                                            result_count - offset,
+                                                            product_p,
+                                                            chunk_count + right_count);
+      JERRY_ASSERT (carry == 0);
+      JERRY_UNUSED (carry);
+    }
+
+    jmem_heap_free_block (product_p, product_size);
+    return true;
+  }
+
+  /* The values are split into low and high parts: left = left_high * B^m + left_low,
+   * right = right_high * B^m + right_low, where B is the digit base. The product is
+   * low_product + (middle_product - low_product - high_product) * B^m + high_product * B^2m
+   * where the middle product is (left_low + left_high) * (right_low + right_high). */
+  uint32_t half_count = left_count / 2;
+  uint32_t left_high_count = left_count - half_count;
+  uint32_t right_high_count = right_count - half_count;
+  uint32_t left_sum_count = left_high_count + 1;
+  uint32_t right_sum_count = JERRY_MAX (half_count, right_high_count) + 1;
+  uint32_t middle_count = left_sum_count + right_sum_count;
+
+  JERRY_ASSERT (half_count > 0 && right_high_count > 0 && right_high_count <= left_high_count);
+
+  size_t buffer_size = 2 * middle_count * sizeof (ecma_bigint_digit_t);
+  ecma_bigint_digit_t *left_sum_p = (ecma_bigint_digit_t *) jmem_heap_alloc_block_null_on_error (buffer_size);
+
+  if (JERRY_UNLIKELY (left_sum_p == NULL))
+  {
+    return false;
+  }
+
+  ecma_bigint_digit_t *right_sum_p = left_sum_p + left_sum_count;
+  ecma_bigint_digit_t *middle_p = right_sum_p + right_sum_count;
+
+  memcpy (left_sum_p, left_p + half_count, left_high_count * sizeof (ecma_bigint_digit_t));
+  left_sum_p[left_high_count] = ecma_big_uint_add_digits (left_sum_p, left_high_count, left_p, half_count);
+
+  if (right_high_count >= half_count)
+  {
+    memcpy (right_sum_p, right_p + half_count, right_high_count * sizeof (ecma_bigint_digit_t));
+    right_sum_p[right_high_count] = ecma_big_uint_add_digits (right_sum_p, right_high_count, right_p, half_count);
+  }
+  else
+  {
+    memcpy (right_sum_p, right_p, half_count * sizeof (ecma_bigint_digit_t));
+    right_sum_p[half_count] = ecma_big_uint_add_digits (right_sum_p,
+                                                        half_count,
+                                                        right_p + half_count,
+                                                        right_high_count);
+  }
+
+  ecma_bigint_digit_t *high_product_p = result_p + 2 * half_count;
+  uint32_t high_product_count = left_high_count + right_high_count;
+
+  bool success = (ecma_big_uint_mul_digits (result_p, left_p, half_count, right_p, half_count)
+                  && ecma_big_uint_mul_digits (high_product_p,
+                                               left_p + half_count,
+                                               left_high_count,
+                                               right_p + half_count,
+                                               right_high_count)
+                  && ecma_big_uint_mul_digits (middle_p, left_sum_p, left_sum_count, right_sum_p, right_sum_count));
+
+  if (success)
+  {
+    ecma_bigint_digit_t carry;
+
+    carry = ecma_big_uint_sub_digits (middle_p, middle_count, result_p, 2 * half_count);
+    JERRY_ASSERT (carry == 0);
+    carry = ecma_big_uint_sub_digits (middle_p, middle_count, high_product_p, high_product_count);
+    JERRY_ASSERT (carry == 0);
+
+    /* The remaining middle value is less than B^(left_count + right_count - m). */
+    uint32_t add_count = left_count + right_count - half_count;
+
+    while (middle_count > add_count)
+    {
+      JERRY_ASSERT (middle_p[middle_count - 1] == 0);
+      middle_count--;
+    }
+
+    carry = ecma_big_uint_add_digits (result_p + half_count, add_count, middle_p, middle_count);
+    JERRY_ASSERT (carry == 0);
+    JERRY_UNUSED (carry);
+  }
+
+  jmem_heap_free_block (left_sum_p, buffer_size);
+  return success;
+} /* ecma_big_uint_mul_digits */
+
+/**
+ * Multiply two BigUInt values with the Karatsuba algorithm
+ *
+ * return new BigUInt value, NULL on error
+ */
+static ecma_extended_primitive_t *
+ecma_big_uint_mul_karatsuba (ecma_extended_primitive_t *left_value_p, /**< left BigUInt value */
+                             uint32_t left_size, /**< size of left BigUInt value */
+                             ecma_extended_primitive_t *right_value_p, /**< right BigUInt value */
+                             uint32_t right_size) /**< size of right BigUInt value */
+{
+  uint32_t result_size = left_size + right_size;
+  ecma_extended_primitive_t *result_p = ecma_bigint_create (result_size);
+
+  if (JERRY_UNLIKELY (result_p == NULL))
+  {
+    return NULL;
+  }
+
+  if (!ecma_big_uint_mul_digits (ECMA_BIGINT_GET_DIGITS (result_p, 0),
+                                 ECMA_BIGINT_GET_DIGITS (left_value_p, 0),
+                                 left_size / (uint32_t) sizeof (ecma_bigint_digit_t),
+                                 ECMA_BIGINT_GET_DIGITS (right_value_p, 0),
+                                 right_size / (uint32_t) sizeof (ecma_bigint_digit_t)))
+  {
+    ecma_deref_bigint (result_p);
+    return NULL;
+  }
+
+  ecma_bigint_digit_t *result_end_p = ECMA_BIGINT_GET_DIGITS (result_p, result_size);
+
+  if (result_end_p[-1] != 0)
+  {
+    return result_p;
+  }
+
+  return ecma_big_uint_normalize_result (result_p, result_end_p);
+} /* ecma_big_uint_mul_karatsuba */
+
+#endif /* JERRY_BIGINT_KARATSUBA_THRESHOLD > 0 */
+
 /**
  * Multiply two BigUInt values
  *
@@ -794,6 +1351,14 @@ ecma_big_uint_mul (ecma_extended_primitive_t *left_value_p, /**< left BigUInt va
     right_size = tmp_size;
   }
 
+#if JERRY_BIGINT_KARATSUBA_THRESHOLD > 0
+  if (right_size >= JERRY_BIGINT_KARATSUBA_THRESHOLD * sizeof (ecma_bigint_digit_t)
+      && left_size + right_size <= ECMA_BIGINT_MAX_SIZE)
+  {
+    return ecma_big_uint_mul_karatsuba (left_value_p, left_size, right_value_p, right_size);
+  }
+#endif /* JERRY_BIGINT_KARATSUBA_THRESHOLD > 0 */
+
   uint32_t result_size = left_size + right_size - (uint32_t) sizeof (ecma_bigint_digit_t);
 
   ecma_extended_primitive_t *result_p = ecma_bigint_create (result_size);
@@ -1128,7 +1693,9 @@ ecma_big_uint_div_mod (ecma_extended_primitive_t *dividend_value_p, /**< divider
       }
       else
       {
-        JERRY_ASSERT (dividend_end_p[0] == divisor_high && dividend_end_p[-1] < divisor_high);
+        /* The remaining dividend is less than the divisor, but its second
+         * highest digit can be greater than or equal to divisor_high. */
+        JERRY_ASSERT (dividend_end_p[0] == divisor_high);
 
         result_div = ~((ecma_bigint_digit_t) 0);
         result_mod = dividend_end_p[-1] + divisor_high;
@@ -1141,7 +1708,7 @@ ecma_big_uint_div_mod (ecma_extended_primitive_t *dividend_value_p, /**< divider
 
       ecma_bigint_two_digits_t low_digits = ((ecma_bigint_two_digits_t) result_div) * divisor_low;
 
-      while (low_digits > (ECMA_BIGINT_HIGH_DIGIT (result_mod) | divisor_low))
+      while (low_digits > (ECMA_BIGINT_HIGH_DIGIT (result_mod) | dividend_end_p[-2]))
       {
         result_div--;
         result_mod += divisor_high;
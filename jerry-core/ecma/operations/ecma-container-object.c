@@ -15,6 +15,7 @@
 #include "jcontext.h"
 #include "ecma-alloc.h"
 #include "ecma-array-object.h"
+#include "ecma-big-uint.h"
 #include "ecma-builtins.h"
 #include "ecma-builtin-helpers.h"
 #include "ecma-exceptions.h"
@@ -41,6 +42,7 @@
  * Note:
  *   The first element of the collection tracks the size of the buffer.
  *   ECMA_VALUE_EMPTY values are not calculated into the size.
+ *   The second element of the collection is the hash index of the buffer.
  *
  * @return pointer to the internal buffer
  */
@@ -48,11 +50,169 @@ static inline ecma_collection_t *
 ecma_op_create_internal_buffer (void)
 {
   ecma_collection_t *collection_p = ecma_new_collection ();
-  ecma_collection_push_back (collection_p, (ecma_value_t) 0);
+  ecma_value_t header[ECMA_CONTAINER_HEADER_SIZE] = { (ecma_value_t) 0, (ecma_value_t) 0 };
+  ecma_collection_append (collection_p, header, ECMA_CONTAINER_HEADER_SIZE);
+  ECMA_CONTAINER_SET_INDEX (collection_p, NULL);
 
   return collection_p;
 } /* ecma_op_create_internal_buffer */
 
+/**
+ * Calculate the hash of a key.
+ *
+ * Note:
+ *   keys which are equal according to SameValueZero have the same hash
+ *
+ * @return hash value
+ */
+static uint32_t
+ecma_op_container_hash (ecma_value_t key_arg) /**< key argument */
+{
+  uint32_t hash;
+
+  if (ecma_is_value_string (key_arg))
+  {
+    hash = ecma_string_hash (ecma_get_string_from_value (key_arg));
+  }
+  else if (ecma_is_value_integer_number (key_arg))
+  {
+    hash = (uint32_t) ecma_get_integer_from_value (key_arg);
+  }
+  else if (ecma_is_value_float_number (key_arg))
+  {
+    ecma_number_t num = ecma_get_float_from_value (key_arg);
+
+    if (ecma_number_is_nan (num))
+    {
+      hash = 0x7fc00000;
+    }
+    else if (num >= (ecma_number_t) INT32_MIN
+             && num <= (ecma_number_t) INT32_MAX
+             && num == (ecma_number_t) (int32_t) num)
+    {
+      /* Integral values must hash like the integer numbers, including -0. */
+      hash = (uint32_t) (int32_t) num;
+    }
+    else
+    {
+      uint32_t words[(sizeof (ecma_number_t) + sizeof (uint32_t) - 1) / sizeof (uint32_t)] = { 0 };
+      memcpy (words, &num, sizeof (ecma_number_t));
+      hash = 0;
+
+      for (uint32_t i = 0; i < sizeof (words) / sizeof (uint32_t); i++)
+      {
+        hash = (hash * 31) ^ words[i];
+      }
+    }
+  }
+#if ENABLED (JERRY_BUILTIN_BIGINT)
+  else if (ecma_is_value_bigint (key_arg))
+  {
+    hash = (uint32_t) key_arg;
+
+    if (key_arg != ECMA_BIGINT_ZERO)
+    {
+      ecma_extended_primitive_t *bigint_p = ecma_get_extended_primitive_from_value (key_arg);
+      uint32_t size = ECMA_BIGINT_GET_SIZE (bigint_p);
+      hash = bigint_p->u.bigint_sign_and_size;
+
+      for (uint32_t i = 0; i < size; i += (uint32_t) sizeof (ecma_bigint_digit_t))
+      {
+        hash = (hash * 31) ^ *ECMA_BIGINT_GET_DIGITS (bigint_p, i);
+      }
+    }
+  }
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+  else
+  {
+    /* Objects, symbols and simple values are compared by identity. */
+    hash = (uint32_t) key_arg;
+  }
+
+  hash *= 0x9e3779b1u;
+  return hash ^ (hash >> 16);
+} /* ecma_op_container_hash */
+
+/**
+ * Insert an entry offset into the hash index.
+ *
+ * Note:
+ *   the index must have a free slot
+ */
+static void
+ecma_op_internal_buffer_index_insert (ecma_container_index_t *index_p, /**< hash index */
+                                      uint32_t hash, /**< hash of the key */
+                                      uint32_t offset) /**< offset of the entry */
+{
+  uint32_t *slots_p = ECMA_CONTAINER_INDEX_SLOTS (index_p);
+  uint32_t mask = index_p->mask;
+  uint32_t slot = hash & mask;
+
+  while (slots_p[slot] != ECMA_CONTAINER_INDEX_EMPTY)
+  {
+    slot = (slot + 1) & mask;
+  }
+
+  slots_p[slot] = offset + ECMA_CONTAINER_INDEX_OFFSET_SHIFT;
+  index_p->used_count++;
+} /* ecma_op_internal_buffer_index_insert */
+
+/**
+ * Release the hash index of the internal buffer.
+ */
+static void
+ecma_op_internal_buffer_index_free (ecma_collection_t *container_p) /**< internal container pointer */
+{
+  ecma_container_index_t *index_p = ECMA_CONTAINER_GET_INDEX (container_p);
+
+  if (index_p != NULL)
+  {
+    jmem_heap_free_block (index_p, ECMA_CONTAINER_INDEX_BYTE_SIZE (index_p->mask));
+    ECMA_CONTAINER_SET_INDEX (container_p, NULL);
+  }
+} /* ecma_op_internal_buffer_index_free */
+
+/**
+ * Build a new hash index for the live entries of the internal buffer.
+ *
+ * Note:
+ *   the previous index (and all of its deleted slots) is released
+ */
+static void
+ecma_op_internal_buffer_index_rebuild (ecma_collection_t *container_p, /**< internal container pointer */
+                                       lit_magic_string_id_t lit_id) /**< class id */
+{
+  ecma_op_internal_buffer_index_free (container_p);
+
+  uint32_t size = ECMA_CONTAINER_GET_SIZE (container_p);
+  uint32_t slot_count = 2 * ECMA_CONTAINER_INDEX_MIN_SIZE;
+
+  while (slot_count < 2 * size)
+  {
+    slot_count <<= 1;
+  }
+
+  size_t byte_size = ECMA_CONTAINER_INDEX_BYTE_SIZE (slot_count - 1);
+  ecma_container_index_t *index_p = (ecma_container_index_t *) jmem_heap_alloc_block (byte_size);
+  index_p->mask = slot_count - 1;
+  index_p->used_count = 0;
+  memset (ECMA_CONTAINER_INDEX_SLOTS (index_p), 0, slot_count * sizeof (uint32_t));
+
+  uint8_t entry_size = ecma_op_container_entry_size (lit_id);
+  uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
+  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
+
+  for (uint32_t i = 0; i < entry_count; i += entry_size)
+  {
+    if (!ecma_is_value_empty (start_p[i]))
+    {
+      ecma_op_internal_buffer_index_insert (index_p, ecma_op_container_hash (start_p[i]), i);
+    }
+  }
+
+  ECMA_CONTAINER_SET_INDEX (container_p, index_p);
+} /* ecma_op_internal_buffer_index_rebuild */
+
 /**
  * Append values to the internal buffer.
  */
@@ -64,6 +224,14 @@ ecma_op_internal_buffer_append (ecma_collection_t *container_p, /**< internal co
 {
   JERRY_ASSERT (container_p != NULL);
 
+  uint8_t entry_size = ecma_op_container_entry_size (lit_id);
+
+  /* Grow the buffer geometrically, so appending is amortized constant time. */
+  if (container_p->capacity - container_p->item_count < entry_size)
+  {
+    ecma_collection_reserve (container_p, JERRY_MAX (container_p->item_count / 2, ECMA_COLLECTION_GROW_FACTOR));
+  }
+
   if (lit_id == LIT_MAGIC_STRING_WEAKMAP_UL || lit_id == LIT_MAGIC_STRING_MAP_UL)
   {
     ecma_value_t values[] = { ecma_copy_value_if_not_object (key_arg), ecma_copy_value_if_not_object (value_arg) };
@@ -74,7 +242,29 @@ ecma_op_internal_buffer_append (ecma_collection_t *container_p, /**< internal co
     ecma_collection_push_back (container_p, ecma_copy_value_if_not_object (key_arg));
   }
 
-  ECMA_CONTAINER_SET_SIZE (container_p, ECMA_CONTAINER_GET_SIZE (container_p) + 1);
+  uint32_t size = ECMA_CONTAINER_GET_SIZE (container_p) + 1;
+  ECMA_CONTAINER_SET_SIZE (container_p, size);
+
+  ecma_container_index_t *index_p = ECMA_CONTAINER_GET_INDEX (container_p);
+
+  if (index_p == NULL)
+  {
+    if (size >= ECMA_CONTAINER_INDEX_MIN_SIZE)
+    {
+      ecma_op_internal_buffer_index_rebuild (container_p, lit_id);
+    }
+    return;
+  }
+
+  /* Keep the load factor (including the deleted slots) below 3/4. */
+  if ((index_p->used_count + 1) * 4 > (index_p->mask + 1) * 3)
+  {
+    ecma_op_internal_buffer_index_rebuild (container_p, lit_id);
+    return;
+  }
+
+  uint32_t offset = ECMA_CONTAINER_ENTRY_COUNT (container_p) - entry_size;
+  ecma_op_internal_buffer_index_insert (index_p, ecma_op_container_hash (key_arg), offset);
 } /* ecma_op_internal_buffer_append */
 
 /**
@@ -106,6 +296,23 @@ ecma_op_internal_buffer_delete (ecma_collection_t *container_p, /**< internal co
   JERRY_ASSERT (container_p != NULL);
   JERRY_ASSERT (entry_p != NULL);
 
+  ecma_container_index_t *index_p = ECMA_CONTAINER_GET_INDEX (container_p);
+
+  if (index_p != NULL)
+  {
+    uint32_t *slots_p = ECMA_CONTAINER_INDEX_SLOTS (index_p);
+    uint32_t offset = (uint32_t) ((ecma_value_t *) entry_p - ECMA_CONTAINER_START (container_p));
+    uint32_t slot = ecma_op_container_hash (entry_p->key) & index_p->mask;
+
+    while (slots_p[slot] != offset + ECMA_CONTAINER_INDEX_OFFSET_SHIFT)
+    {
+      JERRY_ASSERT (slots_p[slot] != ECMA_CONTAINER_INDEX_EMPTY);
+      slot = (slot + 1) & index_p->mask;
+    }
+
+    slots_p[slot] = ECMA_CONTAINER_INDEX_DELETED;
+  }
+
   ecma_free_value_if_not_object (entry_p->key);
   entry_p->key = ECMA_VALUE_EMPTY;
 
@@ -130,9 +337,34 @@ ecma_op_internal_buffer_find (ecma_collection_t *container_p, /**< internal cont
 {
   JERRY_ASSERT (container_p != NULL);
 
+  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
+  ecma_container_index_t *index_p = ECMA_CONTAINER_GET_INDEX (container_p);
+
+  if (index_p != NULL)
+  {
+    uint32_t *slots_p = ECMA_CONTAINER_INDEX_SLOTS (index_p);
+    uint32_t slot = ecma_op_container_hash (key_arg) & index_p->mask;
+
+    while (slots_p[slot] != ECMA_CONTAINER_INDEX_EMPTY)
+    {
+      if (slots_p[slot] != ECMA_CONTAINER_INDEX_DELETED)
+      {
+        ecma_value_t *entry_p = start_p + (slots_p[slot] - ECMA_CONTAINER_INDEX_OFFSET_SHIFT);
+
+        if (ecma_op_same_value_zero (*entry_p, key_arg, false))
+        {
+          return entry_p;
+        }
+      }
+
+      slot = (slot + 1) & index_p->mask;
+    }
+
+    return NULL;
+  }
+
   uint8_t entry_size = ecma_op_container_entry_size (lit_id);
   uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
-  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
 
   for (uint32_t i = 0; i < entry_count; i += entry_size)
   {
@@ -355,6 +587,7 @@ ecma_op_container_free_entries (ecma_object_t *object_p) /**< collection object
   }
 
   ECMA_CONTAINER_SET_SIZE (container_p, 0);
+  ecma_op_internal_buffer_index_free (container_p);
 } /* ecma_op_container_free_entries */
 
 /**
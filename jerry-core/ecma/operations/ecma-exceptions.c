@@ -214,6 +214,23 @@ ecma_new_standard_error_with_message (ecma_standard_error_t error_type, /**< nat
   return new_error_obj_p;
 } /* ecma_new_standard_error_with_message */
 
+/**
+ * Throw an error object created by the engine.
+ */
+static void
+ecma_raise_new_error (ecma_object_t *error_obj_p) /**< error object */
+{
+#if ENABLED (JERRY_LINE_INFO)
+  if (JERRY_CONTEXT (vm_top_context_p) != NULL)
+  {
+    /* The error completion of the frame updates the position of the backtrace. */
+    JERRY_CONTEXT (vm_backtrace_error_p) = error_obj_p;
+  }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
+  jcontext_raise_exception (ecma_make_object_value (error_obj_p));
+} /* ecma_raise_new_error */
+
 /**
  * Raise a standard ecma-error with the given type and message.
  *
@@ -238,7 +255,7 @@ ecma_raise_standard_error (ecma_standard_error_t error_type, /**< error type */
     error_obj_p = ecma_new_standard_error (error_type);
   }
 
-  jcontext_raise_exception (ecma_make_object_value (error_obj_p));
+  ecma_raise_new_error (error_obj_p);
   return ECMA_VALUE_ERROR;
 } /* ecma_raise_standard_error */
 
@@ -324,7 +341,7 @@ ecma_raise_standard_error_with_format (ecma_standard_error_t error_type, /**< er
 
   ecma_deref_ecma_string (builder_str_p);
 
-  jcontext_raise_exception (ecma_make_object_value (error_obj_p));
+  ecma_raise_new_error (error_obj_p);
   return ECMA_VALUE_ERROR;
 } /* ecma_raise_standard_error_with_format */
 
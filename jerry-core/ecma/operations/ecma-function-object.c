@@ -28,6 +28,7 @@
 #include "ecma-proxy-object.h"
 #include "ecma-symbol-object.h"
 #include "jcontext.h"
+#include "js-parser.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -856,34 +857,53 @@ ecma_op_get_prototype_from_constructor (ecma_object_t *ctor_obj_p, /**< construc
   return proto_obj_p;
 } /* ecma_op_get_prototype_from_constructor */
 
+#if ENABLED (JERRY_PARSER)
+
 /**
- * Perform a JavaScript function object method call.
- *
- * The input function object should be a pure JavaScript method
+ * Generate the byte code of a function whose byte code generation was delayed,
+ * and replace the compiled code of the function object with the result.
  *
- * @return the result of the function call.
+ * @return compiled code - if success
+ *         NULL - otherwise (an exception is raised)
  */
-static ecma_value_t
-ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
-                              ecma_value_t this_arg_value, /**< 'this' argument's value */
-                              const ecma_value_t *arguments_list_p, /**< arguments list */
-                              uint32_t arguments_list_len) /**< length of arguments list */
+static const ecma_compiled_code_t * JERRY_ATTR_NOINLINE
+ecma_op_function_compile_lazy (ecma_extended_object_t *ext_func_p) /**< function object */
 {
-  JERRY_ASSERT (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_FUNCTION);
+  ecma_compiled_code_t *lazy_function_p;
+  lazy_function_p = (ecma_compiled_code_t *) ecma_op_function_get_compiled_code (ext_func_p);
 
-  if (JERRY_UNLIKELY (ecma_get_object_is_builtin (func_obj_p)))
+  ecma_compiled_code_t *bytecode_p = parser_compile_lazy_function (lazy_function_p);
+
+  if (JERRY_UNLIKELY (bytecode_p == NULL))
   {
-    return ecma_builtin_dispatch_call (func_obj_p, this_arg_value, arguments_list_p, arguments_list_len);
+    return NULL;
   }
 
-  vm_frame_ctx_shared_args_t shared_args;
-  shared_args.header.status_flags = VM_FRAME_CTX_SHARED_HAS_ARG_LIST;
-  shared_args.function_object_p = func_obj_p;
-  shared_args.arg_list_p = arguments_list_p;
-  shared_args.arg_list_len = arguments_list_len;
+  ecma_bytecode_ref (bytecode_p);
+  ECMA_SET_INTERNAL_VALUE_POINTER (ext_func_p->u.function.bytecode_cp, bytecode_p);
+  ecma_bytecode_deref (lazy_function_p);
+  return bytecode_p;
+} /* ecma_op_function_compile_lazy */
 
-  /* Entering Function Code (ECMA-262 v5, 10.4.3) */
-  ecma_extended_object_t *ext_func_p = (ecma_extended_object_t *) func_obj_p;
+#endif /* ENABLED (JERRY_PARSER) */
+
+/**
+ * Enter the code of a JavaScript function: resolve the 'this' binding and
+ * create the lexical environment of the function (ECMA-262 v5, 10.4.3).
+ *
+ * Note:
+ *      the byte code and the function object of the shared data must be set,
+ *      and ecma_op_function_leave must be called after the function is executed
+ *
+ * @return 'this' binding of the function
+ */
+ecma_value_t
+ecma_op_function_enter (vm_frame_ctx_shared_args_t *shared_args_p, /**< [in/out] shared data of the call */
+                        ecma_value_t this_arg_value, /**< 'this' argument's value */
+                        ecma_object_t **lex_env_p) /**< [out] lexical environment of the function */
+{
+  ecma_extended_object_t *ext_func_p = (ecma_extended_object_t *) shared_args_p->function_object_p;
+  uint16_t status_flags = shared_args_p->header.bytecode_header_p->status_flags;
 
   ecma_object_t *scope_p = ECMA_GET_NON_NULL_POINTER_FROM_POINTER_TAG (ecma_object_t,
                                                                        ext_func_p->u.function.scope_cp);
@@ -891,16 +911,11 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
   /* 8. */
   ecma_value_t this_binding = this_arg_value;
 
-  const ecma_compiled_code_t *bytecode_data_p = ecma_op_function_get_compiled_code (ext_func_p);
-  uint16_t status_flags = bytecode_data_p->status_flags;
-
-  shared_args.header.bytecode_header_p = bytecode_data_p;
-
   /* 1. */
 #if ENABLED (JERRY_ESNEXT)
   if (JERRY_UNLIKELY (CBC_FUNCTION_IS_ARROW (status_flags)))
   {
-    ecma_arrow_function_t *arrow_func_p = (ecma_arrow_function_t *) func_obj_p;
+    ecma_arrow_function_t *arrow_func_p = (ecma_arrow_function_t *) ext_func_p;
 
     if (ecma_is_value_undefined (arrow_func_p->new_target))
     {
@@ -914,7 +929,7 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
   }
   else
   {
-    shared_args.header.status_flags |= VM_FRAME_CTX_SHARED_NON_ARROW_FUNC;
+    shared_args_p->header.status_flags |= VM_FRAME_CTX_SHARED_NON_ARROW_FUNC;
 #endif /* ENABLED (JERRY_ESNEXT) */
 
     if (!(status_flags & CBC_CODE_FLAGS_STRICT_MODE))
@@ -929,7 +944,7 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
       {
         /* 3., 4. */
         this_binding = ecma_op_to_object (this_binding);
-        shared_args.header.status_flags |= VM_FRAME_CTX_SHARED_FREE_THIS;
+        shared_args_p->header.status_flags |= VM_FRAME_CTX_SHARED_FREE_THIS;
 
         JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (this_binding));
       }
@@ -941,14 +956,82 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
   /* 5. */
   if (!(status_flags & CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED))
   {
-    shared_args.header.status_flags |= VM_FRAME_CTX_SHARED_FREE_LOCAL_ENV;
+    shared_args_p->header.status_flags |= VM_FRAME_CTX_SHARED_FREE_LOCAL_ENV;
     scope_p = ecma_create_decl_lex_env (scope_p);
   }
 
+  *lex_env_p = scope_p;
+  return this_binding;
+} /* ecma_op_function_enter */
+
+/**
+ * Release the 'this' binding and the lexical environment created by ecma_op_function_enter.
+ */
+void
+ecma_op_function_leave (vm_frame_ctx_shared_args_t *shared_args_p, /**< shared data of the call */
+                        ecma_value_t this_binding, /**< 'this' binding of the function */
+                        ecma_object_t *lex_env_p) /**< lexical environment of the function */
+{
+  if (JERRY_UNLIKELY (shared_args_p->header.status_flags & VM_FRAME_CTX_SHARED_FREE_LOCAL_ENV))
+  {
+    ecma_deref_object (lex_env_p);
+  }
+
+  if (JERRY_UNLIKELY (shared_args_p->header.status_flags & VM_FRAME_CTX_SHARED_FREE_THIS))
+  {
+    ecma_free_value (this_binding);
+  }
+} /* ecma_op_function_leave */
+
+/**
+ * Perform a JavaScript function object method call.
+ *
+ * The input function object should be a pure JavaScript method
+ *
+ * @return the result of the function call.
+ */
+static ecma_value_t
+ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
+                              ecma_value_t this_arg_value, /**< 'this' argument's value */
+                              const ecma_value_t *arguments_list_p, /**< arguments list */
+                              uint32_t arguments_list_len) /**< length of arguments list */
+{
+  JERRY_ASSERT (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_FUNCTION);
+
+  if (JERRY_UNLIKELY (ecma_get_object_is_builtin (func_obj_p)))
+  {
+    return ecma_builtin_dispatch_call (func_obj_p, this_arg_value, arguments_list_p, arguments_list_len);
+  }
+
+  ecma_extended_object_t *ext_func_p = (ecma_extended_object_t *) func_obj_p;
+  const ecma_compiled_code_t *bytecode_data_p = ecma_op_function_get_compiled_code (ext_func_p);
+
+#if ENABLED (JERRY_PARSER)
+  if (JERRY_UNLIKELY (bytecode_data_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION))
+  {
+    bytecode_data_p = ecma_op_function_compile_lazy (ext_func_p);
+
+    if (JERRY_UNLIKELY (bytecode_data_p == NULL))
+    {
+      return ECMA_VALUE_ERROR;
+    }
+  }
+#endif /* ENABLED (JERRY_PARSER) */
+
+  vm_frame_ctx_shared_args_t shared_args;
+  shared_args.header.status_flags = VM_FRAME_CTX_SHARED_HAS_ARG_LIST;
+  shared_args.header.bytecode_header_p = bytecode_data_p;
+  shared_args.function_object_p = func_obj_p;
+  shared_args.arg_list_p = arguments_list_p;
+  shared_args.arg_list_len = arguments_list_len;
+
+  ecma_object_t *scope_p;
+  ecma_value_t this_binding = ecma_op_function_enter (&shared_args, this_arg_value, &scope_p);
+
   ecma_value_t ret_value;
 
 #if ENABLED (JERRY_ESNEXT)
-  if (JERRY_UNLIKELY (CBC_FUNCTION_GET_TYPE (status_flags) == CBC_FUNCTION_CONSTRUCTOR))
+  if (JERRY_UNLIKELY (CBC_FUNCTION_GET_TYPE (bytecode_data_p->status_flags) == CBC_FUNCTION_CONSTRUCTOR))
   {
     if (JERRY_CONTEXT (current_new_target) == NULL)
     {
@@ -991,16 +1074,7 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
 exit:
 #endif /* ENABLED (JERRY_ESNEXT) */
 
-  if (JERRY_UNLIKELY (shared_args.header.status_flags & VM_FRAME_CTX_SHARED_FREE_LOCAL_ENV))
-  {
-    ecma_deref_object (scope_p);
-  }
-
-  if (JERRY_UNLIKELY (shared_args.header.status_flags & VM_FRAME_CTX_SHARED_FREE_THIS))
-  {
-    ecma_free_value (this_binding);
-  }
-
+  ecma_op_function_leave (&shared_args, this_binding, scope_p);
   return ret_value;
 } /* ecma_op_function_call_simple */
 
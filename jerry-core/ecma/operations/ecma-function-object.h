@@ -83,6 +83,14 @@ ecma_op_get_prototype_from_constructor (ecma_object_t *ctor_obj_p, ecma_builtin_
 ecma_value_t
 ecma_op_function_has_instance (ecma_object_t *func_obj_p, ecma_value_t value);
 
+ecma_value_t
+ecma_op_function_enter (vm_frame_ctx_shared_args_t *shared_args_p, ecma_value_t this_arg_value,
+                        ecma_object_t **lex_env_p);
+
+void
+ecma_op_function_leave (vm_frame_ctx_shared_args_t *shared_args_p, ecma_value_t this_binding,
+                        ecma_object_t *lex_env_p);
+
 ecma_value_t
 ecma_op_function_call (ecma_object_t *func_obj_p, ecma_value_t this_arg_value,
                        const ecma_value_t *arguments_list_p, uint32_t arguments_list_len);
@@ -23,6 +23,7 @@
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -314,6 +315,32 @@ ecma_op_general_object_ordinary_value (ecma_object_t *obj_p, /**< the object */
  */
 #define ECMA_PROPERTY_TYPE_GENERIC ECMA_PROPERTY_TYPE_SPECIAL
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+
+/**
+ * Checks whether a property descriptor changes the type or the attributes of a named data property.
+ *
+ * @return true - if the type or any attribute is changed
+ *         false - otherwise
+ */
+static bool
+ecma_op_general_object_is_attribute_change (const ecma_property_descriptor_t *property_desc_p, /**< property
+                                                                                                *   descriptor */
+                                            ecma_property_t property) /**< named data property */
+{
+  uint32_t flags = property_desc_p->flags;
+
+  return ((flags & (ECMA_PROP_IS_GET_DEFINED | ECMA_PROP_IS_SET_DEFINED))
+          || ((flags & ECMA_PROP_IS_CONFIGURABLE_DEFINED)
+              && ((flags & ECMA_PROP_IS_CONFIGURABLE) != 0) != ecma_is_property_configurable (property))
+          || ((flags & ECMA_PROP_IS_ENUMERABLE_DEFINED)
+              && ((flags & ECMA_PROP_IS_ENUMERABLE) != 0) != ecma_is_property_enumerable (property))
+          || ((flags & ECMA_PROP_IS_WRITABLE_DEFINED)
+              && ((flags & ECMA_PROP_IS_WRITABLE) != 0) != ecma_is_property_writable (property)));
+} /* ecma_op_general_object_is_attribute_change */
+
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
 /**
  * [[DefineOwnProperty]] ecma general object's operation
  *
@@ -401,6 +428,7 @@ ecma_op_general_object_define_own_property (ecma_object_t *object_p, /**< the ob
       JERRY_ASSERT ((property_desc_p->flags & ECMA_PROP_IS_VALUE_DEFINED)
                     || ecma_is_value_undefined (property_desc_p->value));
 
+      ecma_gc_write_barrier (object_p, property_desc_p->value);
       new_prop_value_p->value = ecma_copy_value_if_not_object (property_desc_p->value);
     }
     else
@@ -459,6 +487,40 @@ ecma_op_general_object_define_own_property (ecma_object_t *object_p, /**< the ob
     return result;
   }
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ext_property_ref.property_p == NULL)
+  {
+    /* The property is described by the shape of the object. Its value can be
+     * changed in place, but changing its attributes requires a property pair. */
+    JERRY_ASSERT (ECMA_OBJECT_HAS_SHAPE (object_p) && current_property_type == ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+    if (ecma_op_general_object_is_attribute_change (property_desc_p, current_prop))
+    {
+      ecma_shape_convert_to_property_list (object_p, NULL);
+      ext_property_ref.property_p = ecma_find_named_property (object_p, property_name_p);
+      ext_property_ref.property_ref.value_p = ECMA_PROPERTY_VALUE_PTR (ext_property_ref.property_p);
+    }
+    else
+    {
+      if ((property_desc_p->flags & ECMA_PROP_IS_VALUE_DEFINED)
+          && (is_current_configurable || ecma_is_property_writable (current_prop)))
+      {
+        ecma_named_data_property_assign_value (object_p,
+                                               ext_property_ref.property_ref.value_p,
+                                               property_desc_p->value);
+      }
+      else if ((property_desc_p->flags & ECMA_PROP_IS_VALUE_DEFINED)
+               && !ecma_op_same_value (property_desc_p->value, ext_property_ref.property_ref.value_p->value))
+      {
+        /* 10. a. ii. */
+        return ecma_reject (property_desc_p->flags & ECMA_PROP_IS_THROW);
+      }
+
+      return ECMA_VALUE_TRUE;
+    }
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
   /* 8. */
   if (property_desc_type == ECMA_PROPERTY_TYPE_GENERIC)
   {
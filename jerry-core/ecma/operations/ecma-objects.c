@@ -28,6 +28,7 @@
 #include "ecma-objects-general.h"
 #include "ecma-objects.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 
 #if ENABLED (JERRY_BUILTIN_TYPEDARRAY)
@@ -235,6 +236,32 @@ ecma_op_object_get_own_property (ecma_object_t *object_p, /**< the object */
     }
   }
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    ecma_property_t shape_property;
+    ecma_property_value_t *value_p = ecma_shape_find_property (object_p, property_name_p, &shape_property);
+
+    if (value_p == NULL)
+    {
+      return ECMA_PROPERTY_TYPE_NOT_FOUND;
+    }
+
+    if (options & ECMA_PROPERTY_GET_EXT_REFERENCE)
+    {
+      /* The attributes are stored in the shared shape, so there is no property to modify. */
+      ((ecma_extended_property_ref_t *) property_ref_p)->property_p = NULL;
+    }
+
+    if (property_ref_p != NULL)
+    {
+      property_ref_p->value_p = value_p;
+    }
+
+    return shape_property;
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
   ecma_property_t *property_p = ecma_find_named_property (object_p, property_name_p);
 
   if (property_p == NULL)
@@ -580,6 +607,16 @@ ecma_op_object_find_own (ecma_value_t base_value, /**< base value */
     }
   }
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    ecma_property_t shape_property;
+    ecma_property_value_t *value_p = ecma_shape_find_property (object_p, property_name_p, &shape_property);
+
+    return (value_p != NULL) ? ecma_fast_copy_value (value_p->value) : ECMA_VALUE_NOT_FOUND;
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
   ecma_property_t *property_p = ecma_find_named_property (object_p, property_name_p);
 
   if (property_p == NULL)
@@ -753,6 +790,146 @@ ecma_op_object_find (ecma_object_t *object_p, /**< the object */
   return ECMA_VALUE_NOT_FOUND;
 } /* ecma_op_object_find */
 
+#if ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0
+
+/**
+ * Get the value of a named data or accessor property
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+ecma_op_object_get_property_value (ecma_value_t receiver, /**< receiver to invoke getter function */
+                                   ecma_property_t property, /**< type and flags of the property */
+                                   ecma_property_value_t *prop_value_p) /**< property value */
+{
+  if (ECMA_PROPERTY_GET_TYPE (property) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+  {
+    return ecma_fast_copy_value (prop_value_p->value);
+  }
+
+  JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (property) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
+
+  ecma_getter_setter_pointers_t *get_set_pair_p = ecma_get_named_accessor_property (prop_value_p);
+
+  if (get_set_pair_p->getter_cp == JMEM_CP_NULL)
+  {
+    return ECMA_VALUE_UNDEFINED;
+  }
+
+  ecma_object_t *getter_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, get_set_pair_p->getter_cp);
+
+  return ecma_op_function_call (getter_p, receiver, NULL, 0);
+} /* ecma_op_object_get_property_value */
+
+/**
+ * [[Get]] operation which continues the search on the prototype chain
+ *
+ * The properties found on the prototype chain are stored in LCache, so
+ * later searches from the same prototype do not walk the chain again.
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+ecma_op_object_get_from_prototype (ecma_object_t *proto_p, /**< first prototype of the object */
+                                   ecma_string_t *property_name_p, /**< property name */
+                                   ecma_value_t receiver) /**< receiver to invoke getter function */
+{
+  ecma_property_t property;
+  ecma_property_value_t *prop_value_p = ecma_lcache_proto_lookup (proto_p, property_name_p, &property);
+
+  if (prop_value_p != NULL)
+  {
+    return ecma_op_object_get_property_value (receiver, property, prop_value_p);
+  }
+
+  ecma_object_t *object_p = proto_p;
+  uint32_t epoch = JERRY_CONTEXT (lcache_proto_epoch);
+  bool is_cacheable = true;
+
+  while (true)
+  {
+#if ENABLED (JERRY_BUILTIN_PROXY)
+    if (ECMA_OBJECT_IS_PROXY (object_p))
+    {
+      return ecma_proxy_object_get (object_p, property_name_p, receiver);
+    }
+#endif /* ENABLED (JERRY_BUILTIN_PROXY) */
+
+    /* Creating or deleting a property of the object invalidates the stored result. */
+    ecma_lcache_proto_mark (object_p);
+
+    ecma_object_type_t type = ecma_get_object_type (object_p);
+    bool is_searched = false;
+
+    /* Fast access mode arrays may get new properties without creating them one by one. */
+    if (ecma_op_object_is_fast_array (object_p))
+    {
+      is_cacheable = false;
+    }
+#if ENABLED (JERRY_OBJECT_SHAPES)
+    else if (ECMA_OBJECT_HAS_SHAPE (object_p))
+    {
+      /* The shape is searched directly, since finding the property would convert it to a property pair. */
+      is_searched = is_cacheable;
+      ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, object_p->u1.property_list_cp);
+      ecma_shape_t *shape_p = ecma_shape_find (ECMA_SHAPE_GET_SHAPE (values_p), property_name_p);
+
+      if (shape_p != NULL)
+      {
+        if (is_cacheable && epoch == JERRY_CONTEXT (lcache_proto_epoch))
+        {
+          ecma_lcache_proto_insert_shape (proto_p, object_p, property_name_p, shape_p);
+        }
+
+        return ecma_fast_copy_value (ECMA_SHAPE_GET_VALUES (values_p)[shape_p->property_count - 1].value);
+      }
+    }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+    else if (type != ECMA_OBJECT_TYPE_PSEUDO_ARRAY && is_cacheable)
+    {
+      is_searched = true;
+      /* The property is stored in LCache before a getter can change the prototype chain. */
+      ecma_property_t *property_p = ecma_find_named_property (object_p, property_name_p);
+
+      if (property_p != NULL)
+      {
+        if (epoch == JERRY_CONTEXT (lcache_proto_epoch))
+        {
+          ecma_lcache_proto_insert (proto_p, object_p, property_name_p, property_p);
+        }
+
+        return ecma_op_object_get_property_value (receiver, *property_p, ECMA_PROPERTY_VALUE_PTR (property_p));
+      }
+    }
+
+    /* Ordinary objects have no virtual or lazily instantiated properties. */
+    if (!is_searched
+        || type != ECMA_OBJECT_TYPE_GENERAL
+        || ecma_get_object_is_builtin (object_p))
+    {
+      ecma_value_t value = ecma_op_object_find_own (receiver, object_p, property_name_p);
+
+      if (ecma_is_value_found (value))
+      {
+        return value;
+      }
+    }
+
+    jmem_cpointer_t proto_cp = ecma_op_ordinary_object_get_prototype_of (object_p);
+
+    if (proto_cp == JMEM_CP_NULL)
+    {
+      return ECMA_VALUE_UNDEFINED;
+    }
+
+    object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, proto_cp);
+  }
+} /* ecma_op_object_get_from_prototype */
+
+#endif /* ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
+
 /**
  * [[Get]] operation of ecma object
  *
@@ -817,6 +994,10 @@ ecma_op_object_get_with_receiver (ecma_object_t *object_p, /**< the object */
     }
 
     object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, proto_cp);
+
+#if ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0
+    return ecma_op_object_get_from_prototype (object_p, property_name_p, receiver);
+#endif /* ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
   }
 
   return ECMA_VALUE_UNDEFINED;
@@ -1169,6 +1350,7 @@ ecma_op_object_put_apply_receiver (ecma_value_t receiver, /**< receiver */
                                                       ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
                                                       NULL);
   JERRY_ASSERT (ecma_is_value_undefined (new_prop_value_p->value));
+  ecma_gc_write_barrier (receiver_obj_p, value);
   new_prop_value_p->value = ecma_copy_value_if_not_object (value);
 
   return ECMA_VALUE_TRUE;
@@ -1324,7 +1506,37 @@ ecma_op_object_put_with_receiver (ecma_object_t *object_p, /**< the object */
     }
   }
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  bool has_shape = ECMA_OBJECT_HAS_SHAPE (object_p);
+
+  if (has_shape)
+  {
+    ecma_property_t shape_property;
+    ecma_property_value_t *value_p = ecma_shape_find_property (object_p, property_name_p, &shape_property);
+
+    if (value_p != NULL)
+    {
+      if (!ecma_is_property_writable (shape_property))
+      {
+        return ecma_reject (is_throw);
+      }
+
+#if ENABLED (JERRY_ESNEXT)
+      if (ecma_make_object_value (object_p) != receiver)
+      {
+        return ecma_op_object_put_apply_receiver (receiver, property_name_p, value, is_throw);
+      }
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+      ecma_named_data_property_assign_value (object_p, value_p, value);
+      return ECMA_VALUE_TRUE;
+    }
+  }
+
+  ecma_property_t *property_p = has_shape ? NULL : ecma_find_named_property (object_p, property_name_p);
+#else /* !ENABLED (JERRY_OBJECT_SHAPES) */
   ecma_property_t *property_p = ecma_find_named_property (object_p, property_name_p);
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
 
   if (property_p == NULL)
   {
@@ -1547,6 +1759,7 @@ ecma_op_object_put_with_receiver (ecma_object_t *object_p, /**< the object */
                                                           NULL);
 
       JERRY_ASSERT (ecma_is_value_undefined (new_prop_value_p->value));
+      ecma_gc_write_barrier (object_p, value);
       new_prop_value_p->value = ecma_copy_value_if_not_object (value);
       return ECMA_VALUE_TRUE;
     }
@@ -2300,6 +2513,49 @@ ecma_object_sort_property_names (ecma_collection_t *prop_names_p, /**< prop name
   prop_names_p->capacity = all_prop_count;
 } /* ecma_object_sort_property_names */
 
+/**
+ * Append the name of a named data or accessor property to the [[OwnPropertyKeys]] collection
+ */
+static void
+ecma_object_push_own_property_name (ecma_collection_t *prop_names_p, /**< prop name collection */
+                                    ecma_property_counter_t *prop_counter_p, /**< prop counter */
+                                    ecma_property_t property, /**< property type, flags and name type */
+                                    jmem_cpointer_t name_cp) /**< property name */
+{
+  if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_MAGIC
+      && name_cp >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
+      && name_cp < LIT_MAGIC_STRING__COUNT)
+  {
+    /* Internal properties are never enumerated. */
+    return;
+  }
+
+  ecma_string_t *name_p = ecma_string_from_property_name (property, name_cp);
+
+  if (ecma_object_prop_name_is_duplicated (prop_names_p, name_p))
+  {
+    ecma_deref_ecma_string (name_p);
+    return;
+  }
+
+  if (ecma_string_get_array_index (name_p) != ECMA_STRING_NOT_ARRAY_INDEX)
+  {
+    prop_counter_p->array_index_named_props++;
+  }
+#if ENABLED (JERRY_ESNEXT)
+  else if (ecma_prop_name_is_symbol (name_p))
+  {
+    prop_counter_p->symbol_named_props++;
+  }
+#endif /* ENABLED (JERRY_ESNEXT) */
+  else
+  {
+    prop_counter_p->string_named_props++;
+  }
+
+  ecma_collection_push_back (prop_names_p, ecma_make_prop_name_value (name_p));
+} /* ecma_object_push_own_property_name */
+
 /**
  * Object's [[OwnPropertyKeys]] internal method
  *
@@ -2340,6 +2596,28 @@ ecma_op_object_own_property_keys (ecma_object_t *obj_p) /**< object */
 
   jmem_cpointer_t prop_iter_cp = obj_p->u1.property_list_cp;
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ECMA_OBJECT_HAS_SHAPE (obj_p))
+  {
+    /* The shapes are visited in reverse creation order, similar to the property pairs. */
+    ecma_shape_t *shape_p = ECMA_SHAPE_GET_SHAPE (ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, prop_iter_cp));
+
+    while (true)
+    {
+      ecma_object_push_own_property_name (prop_names_p, &prop_counter, shape_p->property, shape_p->name_cp);
+
+      if (shape_p->parent_cp == JMEM_CP_NULL)
+      {
+        break;
+      }
+
+      shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+    }
+
+    prop_iter_cp = JMEM_CP_NULL;
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
   if (prop_iter_cp != JMEM_CP_NULL)
   {
@@ -2366,40 +2644,7 @@ ecma_op_object_own_property_keys (ecma_object_t *obj_p) /**< object */
       {
         ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
 
-        if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_MAGIC
-            && prop_pair_p->names_cp[i] >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
-            && prop_pair_p->names_cp[i] < LIT_MAGIC_STRING__COUNT)
-        {
-          /* Internal properties are never enumerated. */
-          continue;
-        }
-
-        ecma_string_t *name_p = ecma_string_from_property_name (*property_p,
-                                                                prop_pair_p->names_cp[i]);
-
-        if (!ecma_object_prop_name_is_duplicated (prop_names_p, name_p))
-        {
-          if (ecma_string_get_array_index (name_p) != ECMA_STRING_NOT_ARRAY_INDEX)
-          {
-            prop_counter.array_index_named_props++;
-          }
-      #if ENABLED (JERRY_ESNEXT)
-          else if (ecma_prop_name_is_symbol (name_p))
-          {
-            prop_counter.symbol_named_props++;
-          }
-      #endif /* ENABLED (JERRY_ESNEXT) */
-          else
-          {
-            prop_counter.string_named_props++;
-          }
-
-          ecma_collection_push_back (prop_names_p, ecma_make_prop_name_value (name_p));
-        }
-        else
-        {
-          ecma_deref_ecma_string (name_p);
-        }
+        ecma_object_push_own_property_name (prop_names_p, &prop_counter, *property_p, prop_pair_p->names_cp[i]);
       }
     }
 
@@ -3117,6 +3362,10 @@ ecma_op_ordinary_object_set_prototype_of (ecma_object_t *obj_p, /**< base object
   /* 9. */
   ECMA_SET_POINTER (obj_p->u2.prototype_cp, new_proto_p);
 
+#if ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0
+  ecma_lcache_proto_invalidate_all ();
+#endif /* ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
+
   /* 10. */
   return ECMA_VALUE_TRUE;
 } /* ecma_op_ordinary_object_set_prototype_of */
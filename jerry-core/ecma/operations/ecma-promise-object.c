@@ -79,6 +79,8 @@ ecma_promise_set_result (ecma_object_t *obj_p, /**< points to promise object */
 
   JERRY_ASSERT (ext_object_p->u.class_prop.u.value == ECMA_VALUE_UNDEFINED);
 
+  /* The promise is often resolved through a resolving function without referencing it. */
+  ecma_gc_write_barrier (obj_p, result);
   ext_object_p->u.class_prop.u.value = result;
 } /* ecma_promise_set_result */
 
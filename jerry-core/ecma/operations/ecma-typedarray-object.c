@@ -39,40 +39,6 @@
  * @{
  */
 
-/**
- * Read and copy a number from a given buffer to a value.
- **/
-#define ECMA_TYPEDARRAY_GET_ELEMENT(src_p, num, type) \
-    do \
-    { \
-      if (JERRY_LIKELY ((((uintptr_t) (src_p)) & (sizeof (type) - 1)) == 0)) \
-      { \
-        num = *(type *) src_p; \
-      } \
-      else \
-      { \
-        memcpy (&num, src_p, sizeof (type)); \
-      } \
-    } \
-    while (0)
-
-/**
- * Copy a number from a value to the given buffer
- **/
-#define ECMA_TYPEDARRAY_SET_ELEMENT(src_p, num, type) \
-    do \
-    { \
-      if (JERRY_LIKELY ((((uintptr_t) (src_p)) & (sizeof (type) - 1)) == 0)) \
-      { \
-        *(type *) src_p = num; \
-      } \
-      else \
-      { \
-        memcpy (src_p, &num, sizeof (type)); \
-      } \
-    } \
-    while (0)
-
 /**
  * Read an int8_t value from the given arraybuffer
  */
@@ -224,6 +190,35 @@ ecma_typedarray_setter_number_to_uint32 (ecma_number_t value) /**< the number va
   return uint32_value;
 } /* ecma_typedarray_setter_number_to_uint32 */
 
+/**
+ * Normalize the given ecma_number_t to an uint8_t clamped value
+ *
+ * @return uint8_t value
+ */
+static uint8_t
+ecma_typedarray_setter_number_to_uint8_clamped (ecma_number_t value) /**< the number value to normalize */
+{
+  if (value > 255)
+  {
+    return 255;
+  }
+
+  if (!(value > 0))
+  {
+    return 0;
+  }
+
+  uint8_t clamped = (uint8_t) value;
+
+  if (clamped + 0.5 < value
+      || (clamped + 0.5 == value && (clamped % 2) == 1))
+  {
+    clamped++;
+  }
+
+  return clamped;
+} /* ecma_typedarray_setter_number_to_uint8_clamped */
+
 /**
  * Write an int8_t value into the given arraybuffer
  *
@@ -288,28 +283,7 @@ ecma_typedarray_set_uint8_clamped_element (lit_utf8_byte_t *dst_p, /**< the loca
     return to_num;
   }
 
-  uint8_t clamped;
-
-  if (result_num > 255)
-  {
-    clamped = 255;
-  }
-  else if (result_num <= 0)
-  {
-    clamped = 0;
-  }
-  else
-  {
-    clamped = (uint8_t) result_num;
-
-    if (clamped + 0.5 < result_num
-        || (clamped + 0.5 == result_num && (clamped % 2) == 1))
-    {
-      clamped ++;
-    }
-  }
-
-  *dst_p = (lit_utf8_byte_t) clamped;
+  *dst_p = (lit_utf8_byte_t) ecma_typedarray_setter_number_to_uint8_clamped (result_num);
   return ECMA_VALUE_TRUE;
 } /* ecma_typedarray_set_uint8_clamped_element */
 
@@ -648,6 +622,66 @@ ecma_set_typedarray_element (lit_utf8_byte_t *dst_p,
   return ecma_typedarray_setters[typedarray_id](dst_p, value);
 } /* ecma_set_typedarray_element */
 
+/**
+ * Write a number into a non-BigInt typedarray element
+ *
+ * Note:
+ *      unlike ecma_set_typedarray_element, the value is not converted with ToNumber,
+ *      so this operation cannot fail
+ */
+void
+ecma_set_typedarray_number_element (lit_utf8_byte_t *dst_p, /**< the location in the internal arraybuffer */
+                                    ecma_number_t value, /**< the number value to set */
+                                    ecma_typedarray_type_t typedarray_id) /**< typedarray id */
+{
+  switch (typedarray_id)
+  {
+    case ECMA_INT8_ARRAY:
+    case ECMA_UINT8_ARRAY:
+    {
+      *dst_p = (lit_utf8_byte_t) ecma_typedarray_setter_number_to_uint32 (value);
+      break;
+    }
+    case ECMA_UINT8_CLAMPED_ARRAY:
+    {
+      *dst_p = (lit_utf8_byte_t) ecma_typedarray_setter_number_to_uint8_clamped (value);
+      break;
+    }
+    case ECMA_INT16_ARRAY:
+    case ECMA_UINT16_ARRAY:
+    {
+      uint16_t num = (uint16_t) ecma_typedarray_setter_number_to_uint32 (value);
+      ECMA_TYPEDARRAY_SET_ELEMENT (dst_p, num, uint16_t);
+      break;
+    }
+    case ECMA_INT32_ARRAY:
+    case ECMA_UINT32_ARRAY:
+    {
+      uint32_t num = ecma_typedarray_setter_number_to_uint32 (value);
+      ECMA_TYPEDARRAY_SET_ELEMENT (dst_p, num, uint32_t);
+      break;
+    }
+    case ECMA_FLOAT32_ARRAY:
+    {
+      float num = (float) value;
+      ECMA_TYPEDARRAY_SET_ELEMENT (dst_p, num, float);
+      break;
+    }
+    default:
+    {
+#if ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
+      JERRY_ASSERT (typedarray_id == ECMA_FLOAT64_ARRAY);
+
+      double num = (double) value;
+      ECMA_TYPEDARRAY_SET_ELEMENT (dst_p, num, double);
+#else /* !ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+      JERRY_UNREACHABLE ();
+#endif /* ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+      break;
+    }
+  }
+} /* ecma_set_typedarray_number_element */
+
 /**
  * Get the element shift size of a TypedArray type.
  *
@@ -28,6 +28,40 @@
  * @{
  */
 
+/**
+ * Read and copy a number from a given buffer to a value.
+ **/
+#define ECMA_TYPEDARRAY_GET_ELEMENT(src_p, num, type) \
+    do \
+    { \
+      if (JERRY_LIKELY ((((uintptr_t) (src_p)) & (sizeof (type) - 1)) == 0)) \
+      { \
+        num = *(type *) src_p; \
+      } \
+      else \
+      { \
+        memcpy (&num, src_p, sizeof (type)); \
+      } \
+    } \
+    while (0)
+
+/**
+ * Copy a number from a value to the given buffer
+ **/
+#define ECMA_TYPEDARRAY_SET_ELEMENT(src_p, num, type) \
+    do \
+    { \
+      if (JERRY_LIKELY ((((uintptr_t) (src_p)) & (sizeof (type) - 1)) == 0)) \
+      { \
+        *(type *) src_p = num; \
+      } \
+      else \
+      { \
+        memcpy (src_p, &num, sizeof (type)); \
+      } \
+    } \
+    while (0)
+
 uint8_t ecma_typedarray_helper_get_shift_size (ecma_typedarray_type_t typedarray_id);
 ecma_typedarray_getter_fn_t ecma_get_typedarray_getter_fn (ecma_typedarray_type_t typedarray_id);
 ecma_typedarray_setter_fn_t ecma_get_typedarray_setter_fn (ecma_typedarray_type_t typedarray_id);
@@ -36,6 +70,9 @@ ecma_value_t ecma_get_typedarray_element (lit_utf8_byte_t *src_p,
 ecma_value_t ecma_set_typedarray_element (lit_utf8_byte_t *dst_p,
                                           ecma_value_t value,
                                           ecma_typedarray_type_t typedarray_id);
+void ecma_set_typedarray_number_element (lit_utf8_byte_t *dst_p,
+                                         ecma_number_t value,
+                                         ecma_typedarray_type_t typedarray_id);
 bool ecma_typedarray_helper_is_typedarray (ecma_builtin_id_t builtin_id);
 ecma_typedarray_type_t ecma_get_typedarray_id (ecma_object_t *obj_p);
 ecma_builtin_id_t ecma_typedarray_helper_get_prototype_id (ecma_typedarray_type_t typedarray_id);
@@ -114,7 +114,11 @@ typedef enum
 typedef enum
 {
   JERRY_PARSE_NO_OPTS = 0, /**< no options passed */
-  JERRY_PARSE_STRICT_MODE = (1 << 0) /**< enable strict mode */
+  JERRY_PARSE_STRICT_MODE = (1 << 0), /**< enable strict mode */
+  JERRY_PARSE_LAZY_FUNCTIONS = (1 << 1) /**< generate the byte code of simple functions on their first call,
+                                         *   the source buffer must stay valid until jerry_cleanup is called,
+                                         *   and the early errors of these functions are thrown by their first
+                                         *   call instead of the parser (non-conforming) */
 } jerry_parse_opts_t;
 
 /**
@@ -210,9 +214,44 @@ typedef struct
   size_t size; /**< heap total size */
   size_t allocated_bytes; /**< currently allocated bytes */
   size_t peak_allocated_bytes; /**< peak allocated bytes */
-  size_t reserved[4]; /**< padding for future extensions */
+  size_t gc_objects_scanned; /**< number of objects scanned by the last garbage collection */
+  size_t gc_mark_passes; /**< number of object list rescans by the last garbage collection */
+  size_t gc_time_us; /**< duration of the last garbage collection in microseconds */
+  size_t gc_max_time_us; /**< longest garbage collection in microseconds */
 } jerry_heap_stats_t;
 
+/**
+ * Description of the RegExp cache stats.
+ */
+typedef struct
+{
+  uint32_t size; /**< maximum number of cached regular expressions */
+  uint32_t count; /**< number of cached regular expressions */
+  uint32_t hits; /**< number of regular expression compilations served from the cache */
+  uint32_t misses; /**< number of regular expression compilations not found in the cache */
+} jerry_regexp_cache_stats_t;
+
+/**
+ * Description of the property hashmap stats.
+ */
+typedef struct
+{
+  size_t lookups; /**< number of property lookups in property hashmaps */
+  size_t hits; /**< number of property hashmap lookups which found the property */
+  size_t probes; /**< number of entries checked by the property hashmap lookups */
+} jerry_property_hashmap_stats_t;
+
+/**
+ * Description of the property lookup cache stats.
+ */
+typedef struct
+{
+  size_t lookups; /**< number of own property lookups in the lookup cache */
+  size_t hits; /**< number of own property lookups which found the property in the lookup cache */
+  size_t prototype_lookups; /**< number of prototype chain lookups in the lookup cache */
+  size_t prototype_hits; /**< number of prototype chain lookups which found the property in the lookup cache */
+} jerry_lcache_stats_t;
+
 /**
  * Type of an external function handler.
  */
@@ -349,9 +388,15 @@ void jerry_register_magic_strings (const jerry_char_t * const *ex_str_items_p,
                                    uint32_t count,
                                    const jerry_length_t *str_lengths_p);
 void jerry_gc (jerry_gc_mode_t mode);
+bool jerry_gc_step (uint32_t budget_objects);
 void *jerry_get_context_data (const jerry_context_data_manager_t *manager_p);
 
 bool jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p);
+bool jerry_get_lcache_stats (jerry_lcache_stats_t *out_stats_p);
+bool jerry_set_regexp_cache_size (uint32_t size);
+bool jerry_get_regexp_cache_stats (jerry_regexp_cache_stats_t *out_stats_p);
+bool jerry_set_property_hashmap_thresholds (uint32_t lookup_length, uint32_t miss_limit);
+bool jerry_get_property_hashmap_stats (jerry_property_hashmap_stats_t *out_stats_p);
 
 /**
  * Parser and executor functions.
@@ -633,6 +678,7 @@ jerry_value_t jerry_construct_object (const jerry_value_t func_obj_val, const je
 jerry_value_t jerry_get_object_keys (const jerry_value_t obj_val);
 jerry_value_t jerry_get_prototype (const jerry_value_t obj_val);
 jerry_value_t jerry_set_prototype (const jerry_value_t obj_val, const jerry_value_t proto_obj_val);
+bool jerry_object_optimize_for_lookup (const jerry_value_t obj_val);
 
 bool jerry_get_object_native_pointer (const jerry_value_t obj_val,
                                       void **out_native_pointer_p,
@@ -804,6 +850,44 @@ typedef enum
   JERRY_CONTAINER_TYPE_WEAKSET, /**< WeakSet type */
 } jerry_container_type_t;
 
+/**
+ * Events reported by the incremental JSON parser.
+ */
+typedef enum
+{
+  JERRY_JSON_PARSER_OBJECT_START, /**< an object is opened */
+  JERRY_JSON_PARSER_ARRAY_START, /**< an array is opened */
+  JERRY_JSON_PARSER_OBJECT_END, /**< a built object is closed */
+  JERRY_JSON_PARSER_ARRAY_END, /**< a built array is closed */
+} jerry_json_parser_event_t;
+
+/**
+ * Actions returned by the callback of the incremental JSON parser.
+ */
+typedef enum
+{
+  JERRY_JSON_PARSER_KEEP, /**< build the container, or attach the closed container to its parent */
+  JERRY_JSON_PARSER_DISCARD, /**< only validate the container, or drop the closed container */
+} jerry_json_parser_action_t;
+
+/**
+ * Callback of the incremental JSON parser, which is called at object and array boundaries.
+ *
+ * The key is a string for object properties, a number for array elements, and undefined
+ * for the top level value. The value is the closed container for end events, and undefined
+ * for start events.
+ */
+typedef jerry_json_parser_action_t (*jerry_json_parser_callback_t) (jerry_json_parser_event_t event,
+                                                                    const jerry_value_t key,
+                                                                    const jerry_value_t value,
+                                                                    uint32_t depth,
+                                                                    void *user_p);
+
+/**
+ * An opaque declaration of the incremental JSON parser.
+ */
+typedef struct jerry_json_parser_t jerry_json_parser_t;
+
 bool jerry_value_is_typedarray (jerry_value_t value);
 jerry_value_t jerry_create_typedarray (jerry_typedarray_type_t type_name, jerry_length_t length);
 jerry_value_t jerry_create_typedarray_for_arraybuffer_sz (jerry_typedarray_type_t type_name,
@@ -819,6 +903,12 @@ jerry_value_t jerry_get_typedarray_buffer (jerry_value_t value,
                                            jerry_length_t *byte_length);
 jerry_value_t jerry_json_parse (const jerry_char_t *string_p, jerry_size_t string_size);
 jerry_value_t jerry_json_stringify (const jerry_value_t object_to_stringify);
+jerry_json_parser_t *jerry_json_parser_create (jerry_json_parser_callback_t callback, void *user_p);
+jerry_value_t jerry_json_parser_feed (jerry_json_parser_t *parser_p,
+                                     const jerry_char_t *chunk_p,
+                                     jerry_size_t chunk_size);
+jerry_value_t jerry_json_parser_finish (jerry_json_parser_t *parser_p);
+void jerry_json_parser_free (jerry_json_parser_t *parser_p);
 jerry_value_t jerry_create_container (jerry_container_type_t container_type,
                                       const jerry_value_t *arguments_list_p,
                                       jerry_length_t arguments_list_len);
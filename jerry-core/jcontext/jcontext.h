@@ -75,6 +75,15 @@
  */
 #define CONFIG_ECMA_GC_NEW_OBJECTS_FRACTION (16)
 
+#if ENABLED (JERRY_GC_GENERATIONAL)
+/**
+ * Maximum number of old objects in the remembered set of the generational garbage collector.
+ *
+ * When the remembered set is full, the next garbage collection is a full (major) collection.
+ */
+#define CONFIG_ECMA_GC_REMEMBERED_SET_SIZE (256)
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
 #if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
 /**
  * Heap structure
@@ -127,10 +136,31 @@ struct jerry_context_t
   /* Update JERRY_CONTEXT_FIRST_MEMBER if the first non-external member changes */
   jmem_cpointer_t ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT]; /**< pointer to instances of built-in objects */
 #if ENABLED (JERRY_BUILTIN_REGEXP)
-  re_compiled_code_t *re_cache[RE_CACHE_SIZE]; /**< regex cache */
+  re_cache_entry_t *re_cache_p; /**< regex cache entries followed by the bucket list
+                                 *   (NULL, if the cache is empty) */
 #endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
   jmem_cpointer_t ecma_gc_objects_cp; /**< List of currently alive objects. */
+  jmem_cpointer_t ecma_gc_mark_stack[JERRY_GC_MARK_STACK_SIZE]; /**< visited objects whose references
+                                                                 *   are not marked yet */
+  jmem_cpointer_t ecma_gc_black_cp; /**< list of marked objects during a GC cycle */
+  jmem_cpointer_t ecma_gc_black_end_cp; /**< last object of the marked object list */
+  jmem_cpointer_t ecma_gc_white_gray_cp; /**< list of unmarked or partially marked objects during a GC cycle */
+  jmem_cpointer_t ecma_gc_root_cursor_cp; /**< next root object in the marked object list to be scanned */
+  jmem_cpointer_t ecma_gc_rescan_prev_cp; /**< object preceding the next object of the white-gray list
+                                           *   during a rescan (JMEM_CP_NULL: start of the list) */
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  jmem_cpointer_t ecma_gc_young_cp[JERRY_GC_PROMOTION_AGE]; /**< lists of young objects: the k-th list contains
+                                                             *   the objects which survived k minor collections
+                                                             *   (the first list is used during minor collections) */
+  jmem_cpointer_t ecma_gc_old_cp; /**< list of old objects */
+  jmem_cpointer_t ecma_gc_remembered_set[CONFIG_ECMA_GC_REMEMBERED_SET_SIZE]; /**< old objects which may
+                                                                               *   reference young objects */
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
   jmem_heap_free_t *jmem_heap_list_skip_p; /**< This is used to speed up deallocation. */
+#if ENABLED (JERRY_MEM_SEGREGATED_FIT)
+  uint32_t jmem_heap_bins[JMEM_HEAP_BIN_COUNT]; /**< free region offsets of the size-class bins */
+  uint32_t jmem_heap_binned_size; /**< size of the regions pushed onto the bins since the last consolidation */
+#endif /* ENABLED (JERRY_MEM_SEGREGATED_FIT) */
   jmem_pools_chunk_t *jmem_free_8_byte_chunk_p; /**< list of free eight byte pool chunks */
 #if ENABLED (JERRY_CPOINTER_32_BIT)
   jmem_pools_chunk_t *jmem_free_16_byte_chunk_p; /**< list of free sixteen byte pool chunks */
@@ -138,6 +168,10 @@ struct jerry_context_t
   const lit_utf8_byte_t * const *lit_magic_string_ex_array; /**< array of external magic strings */
   const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< external magic string lengths */
   jmem_cpointer_t string_list_first_cp; /**< first item of the literal string list */
+  ecma_string_position_cache_t string_position_cache; /**< last position converted in a non-ASCII string */
+#if ENABLED (JERRY_LITERAL_HASHMAP)
+  ecma_value_t *lit_hashmap_p; /**< hashmap of the literal storage (NULL, if not allocated) */
+#endif /* ENABLED (JERRY_LITERAL_HASHMAP) */
 #if ENABLED (JERRY_ESNEXT)
   jmem_cpointer_t symbol_list_first_cp; /**< first item of the global symbol list */
 #endif /* ENABLED (JERRY_ESNEXT) */
@@ -146,6 +180,9 @@ struct jerry_context_t
   jmem_cpointer_t bigint_list_first_cp; /**< first item of the literal bigint list */
 #endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
   jmem_cpointer_t ecma_global_env_cp; /**< global lexical environment */
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  jmem_cpointer_t ecma_shape_roots_cp; /**< list of the shapes with a single property */
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
 #if ENABLED (JERRY_ESNEXT)
   jmem_cpointer_t ecma_global_scope_cp; /**< global lexical scope */
 #endif /* ENABLED (JERRY_ESNEXT) */
@@ -156,27 +193,60 @@ struct jerry_context_t
 #endif /* ENABLED (JERRY_MODULE_SYSTEM) */
 
   vm_frame_ctx_t *vm_top_context_p; /**< top (current) interpreter context */
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+  vm_frame_segment_t *vm_frame_segment_p; /**< top segment of the frame stack */
+  vm_frame_segment_t *vm_frame_free_segment_p; /**< empty segment kept for reuse */
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
+#if ENABLED (JERRY_DEBUGGER) || ENABLED (JERRY_LINE_INFO)
+  const uint8_t *vm_exception_byte_code_p; /**< Location of the currently executed byte code if an
+                                            *   error occours while the vm_loop is suspended */
+#endif /* ENABLED (JERRY_DEBUGGER) || ENABLED (JERRY_LINE_INFO) */
+#if ENABLED (JERRY_LINE_INFO)
+  ecma_object_t *vm_backtrace_error_p; /**< error object whose backtrace is created while the top frame
+                                        *   executes an instruction, NULL if there is no such error */
+#endif /* ENABLED (JERRY_LINE_INFO) */
   jerry_context_data_header_t *context_data_p; /**< linked list of user-provided context-specific pointers */
   size_t ecma_gc_objects_number; /**< number of currently allocated objects */
   size_t ecma_gc_new_objects; /**< number of newly allocated objects since last GC session */
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  size_t ecma_gc_old_objects; /**< number of old objects */
+  size_t ecma_gc_old_limit; /**< a major collection is performed when the number of old objects exceeds this limit */
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
   size_t jmem_heap_allocated_size; /**< size of allocated regions */
   size_t jmem_heap_limit; /**< current limit of heap usage, that is upon being reached,
                            *   causes call of "try give memory back" callbacks */
   ecma_value_t error_value; /**< currently thrown error value */
   uint32_t lit_magic_string_ex_count; /**< external magic strings count */
+#if ENABLED (JERRY_LITERAL_HASHMAP)
+  uint32_t lit_hashmap_mask; /**< number of literal hashmap slots minus one */
+  uint32_t lit_storage_count; /**< number of literals in the literal storage */
+#endif /* ENABLED (JERRY_LITERAL_HASHMAP) */
   uint32_t jerry_init_flags; /**< run-time configuration flags */
   uint32_t status_flags; /**< run-time flags (the top 8 bits are used for passing class parsing options) */
-#if (JERRY_GC_MARK_LIMIT != 0)
-  uint32_t ecma_gc_mark_recursion_limit; /**< GC mark recursion limit */
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+  uint32_t ecma_gc_mark_stack_top; /**< number of objects on the GC mark stack */
+  bool ecma_gc_mark_stack_overflow; /**< an object could not be pushed onto the full GC mark stack */
+  bool ecma_gc_rescan_active; /**< the white-gray list is being rescanned */
+  bool ecma_gc_incremental; /**< an incremental GC cycle is in progress */
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  uint32_t ecma_gc_remembered_count; /**< number of objects in the remembered set */
+  bool ecma_gc_minor; /**< a minor collection is in progress */
+  bool ecma_gc_major_pending; /**< the next collection must be a major collection */
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
 
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
   uint8_t ecma_prop_hashmap_alloc_state; /**< property hashmap allocation state: 0-4,
                                           *   if !0 property hashmap allocation is disabled */
+  uint16_t ecma_prop_hashmap_lookup_steps; /**< property pairs visited by a lookup which creates a hashmap */
+  uint16_t ecma_prop_hashmap_miss_limit; /**< property pairs visited by slow lookups which create a hashmap */
+  uint16_t ecma_prop_hashmap_misses; /**< property pairs visited by slow lookups since the last hashmap creation */
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
 #if ENABLED (JERRY_BUILTIN_REGEXP)
-  uint8_t re_cache_idx; /**< evicted item index when regex cache is full (round-robin) */
+  uint32_t re_cache_size; /**< maximum number of entries in the regex cache */
+  uint32_t re_cache_count; /**< number of used entries in the regex cache */
+  uint32_t re_cache_clock; /**< increased on each use of a regex cache entry (least recently used eviction) */
+  uint32_t re_cache_hits; /**< number of regex compilations served from the cache */
+  uint32_t re_cache_misses; /**< number of regex compilations not found in the cache */
 #endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
 
 #if ENABLED (JERRY_BUILTIN_PROMISE)
@@ -202,8 +272,6 @@ struct jerry_context_t
   jerry_debugger_transport_header_t *debugger_transport_header_p; /**< head of transport protocol chain */
   uint8_t *debugger_send_buffer_payload_p; /**< start where the outgoing message can be written */
   vm_frame_ctx_t *debugger_stop_context; /**< stop only if the current context is equal to this context */
-  const uint8_t *debugger_exception_byte_code_p; /**< Location of the currently executed byte code if an
-                                                  *   error occours while the vm_loop is suspended */
   jmem_cpointer_t debugger_byte_code_free_head; /**< head of byte code free linked list */
   jmem_cpointer_t debugger_byte_code_free_tail; /**< tail of byte code free linked list */
   uint32_t debugger_flags; /**< debugger flags */
@@ -215,14 +283,34 @@ struct jerry_context_t
 
 #if ENABLED (JERRY_MEM_STATS)
   jmem_heap_stats_t jmem_heap_stats; /**< heap's memory usage statistics */
+  ecma_gc_stats_t ecma_gc_stats; /**< garbage collector statistics */
+#if ENABLED (JERRY_PROPRETY_HASHMAP)
+  ecma_prop_hashmap_stats_t ecma_prop_hashmap_stats; /**< property hashmap statistics */
+#endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
+#if ENABLED (JERRY_LCACHE)
+  ecma_lcache_stats_t lcache_stats; /**< LCache statistics */
+#endif /* ENABLED (JERRY_LCACHE) */
 #endif /* ENABLED (JERRY_MEM_STATS) */
 
   /* This must be at the end of the context for performance reasons */
 #if ENABLED (JERRY_LCACHE)
   /** hash table for caching the last access of properties */
   ecma_lcache_hash_entry_t lcache[ECMA_LCACHE_HASH_ROWS_COUNT][ECMA_LCACHE_HASH_ROW_LENGTH];
+#if JERRY_LCACHE_PROTOTYPE_ROWS > 0
+  /** hash table for caching the properties found on the prototype chain */
+  ecma_lcache_proto_entry_t lcache_proto[ECMA_LCACHE_PROTO_ROWS_COUNT][ECMA_LCACHE_PROTO_ROW_LENGTH];
+  uint32_t lcache_proto_epoch; /**< incremented when the prototype chain results become invalid */
+  uint32_t lcache_proto_filter[ECMA_LCACHE_PROTO_FILTER_BITS / 32]; /**< objects on the prototype chains
+                                                                     *   searched since the last epoch */
+#endif /* JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
 #endif /* ENABLED (JERRY_LCACHE) */
 
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+  /** inline cache tables of the compiled codes, hashed by their address */
+  vm_inline_cache_table_t *vm_inline_cache_tables[VM_INLINE_CACHE_BUCKETS];
+  uint32_t vm_inline_cache_epoch; /**< incremented when the cached objects or shapes may be freed */
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
+
 #if ENABLED (JERRY_ESNEXT)
   /**
    * Allowed values and it's meaning:
@@ -54,6 +54,7 @@
  * @}
  */
 
+#if !ENABLED (JERRY_MEM_SEGREGATED_FIT)
 /**
  * Get end of region
  *
@@ -64,6 +65,742 @@ jmem_heap_get_region_end (jmem_heap_free_t *curr_p) /**< current region */
 {
   return (jmem_heap_free_t *) ((uint8_t *) curr_p + curr_p->size);
 } /* jmem_heap_get_region_end */
+#endif /* !ENABLED (JERRY_MEM_SEGREGATED_FIT) */
+
+#if ENABLED (JERRY_MEM_SEGREGATED_FIT)
+/**
+ * Largest region size which is stored in the size-class bins
+ */
+#define JMEM_HEAP_BIN_LIMIT (JMEM_HEAP_BIN_COUNT * JMEM_ALIGNMENT)
+
+/**
+ * Size of the bitmap which marks the first and the last granule of the regions in the large block tree
+ *
+ * Note:
+ *      the bitmap is stored at the end of the heap area
+ */
+#define JMEM_HEAP_BITMAP_SIZE \
+  JERRY_ALIGNUP (((JMEM_HEAP_AREA_SIZE >> JMEM_ALIGNMENT_LOG) + 7) >> 3, JMEM_ALIGNMENT)
+
+/**
+ * Size of the heap area which can be allocated in segregated-fit mode
+ */
+#define JMEM_HEAP_FIT_AREA_SIZE (JMEM_HEAP_AREA_SIZE - JMEM_HEAP_BITMAP_SIZE)
+
+/**
+ * Size of the regions which must be pushed onto the bins before a failed allocation consolidates the heap
+ *
+ * Note:
+ *      the consolidation scans the whole bitmap, so its cost is spread over the frees
+ *      of at least this many bytes, otherwise the heap is only consolidated after
+ *      a garbage collection
+ */
+#define JMEM_HEAP_CONSOLIDATE_LIMIT (JMEM_HEAP_FIT_AREA_SIZE / 16)
+
+/**
+ * Free region node of the large block tree
+ *
+ * The tree is a treap ordered by (size, offset) pairs, where the heap priority
+ * of a node is derived from its offset, so no extra storage is needed for it.
+ *
+ * Note:
+ *      the size of the region is also stored in its last four bytes, which
+ *      allows finding the start of the region from its right neighbour
+ */
+typedef struct
+{
+  jmem_heap_free_t header; /**< region header (next_offset is unused) */
+  uint32_t child_offset[2]; /**< offsets of the left and right children */
+} jmem_heap_tree_node_t;
+
+/**
+ * Minimum size of a region stored in the large block tree (node and size footer)
+ */
+#define JMEM_HEAP_TREE_MIN_SIZE \
+  JERRY_ALIGNUP (sizeof (jmem_heap_tree_node_t) + sizeof (uint32_t), JMEM_ALIGNMENT)
+
+JERRY_STATIC_ASSERT (JMEM_HEAP_TREE_MIN_SIZE <= JMEM_HEAP_BIN_LIMIT,
+                     large_block_tree_regions_must_not_be_larger_than_bin_regions);
+
+/**
+ * Get the tree node stored at the given offset
+ */
+#define JMEM_HEAP_TREE_NODE(offset) ((jmem_heap_tree_node_t *) JMEM_HEAP_GET_ADDR_FROM_OFFSET (offset))
+
+/**
+ * Get the granule index of a heap address
+ *
+ * @return index of the JMEM_ALIGNMENT sized unit of the heap area
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_get_granule (const void *addr_p) /**< heap address */
+{
+  return (uint32_t) (((const uint8_t *) addr_p - JERRY_HEAP_CONTEXT (area)) >> JMEM_ALIGNMENT_LOG);
+} /* jmem_heap_get_granule */
+
+/**
+ * Get the bitmap of the large block tree
+ *
+ * @return pointer to the first word of the bitmap
+ */
+static inline uint32_t * JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_get_bitmap (void)
+{
+  return (uint32_t *) (JERRY_HEAP_CONTEXT (area) + JMEM_HEAP_FIT_AREA_SIZE);
+} /* jmem_heap_get_bitmap */
+
+/**
+ * Check whether the granule is the first or the last granule of a region in the large block tree
+ *
+ * @return true - if the granule is a boundary of a tree region,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_bitmap_test (uint32_t granule) /**< granule index */
+{
+  return (jmem_heap_get_bitmap ()[granule >> 5] & (1u << (granule & 0x1f))) != 0;
+} /* jmem_heap_bitmap_test */
+
+/**
+ * Set or clear the boundary bits of a region in the large block tree
+ */
+static void
+jmem_heap_bitmap_update (const jmem_heap_free_t *region_p, /**< region */
+                         uint32_t size, /**< size of the region */
+                         bool is_set) /**< true - set the bits, false - clear them */
+{
+  uint32_t *bitmap_p = jmem_heap_get_bitmap ();
+  uint32_t first = jmem_heap_get_granule (region_p);
+  uint32_t last = first + (size >> JMEM_ALIGNMENT_LOG) - 1;
+
+  if (is_set)
+  {
+    bitmap_p[first >> 5] |= (1u << (first & 0x1f));
+    bitmap_p[last >> 5] |= (1u << (last & 0x1f));
+  }
+  else
+  {
+    bitmap_p[first >> 5] &= ~(1u << (first & 0x1f));
+    bitmap_p[last >> 5] &= ~(1u << (last & 0x1f));
+  }
+} /* jmem_heap_bitmap_update */
+
+/**
+ * Compute the treap priority of a tree node
+ *
+ * @return priority
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_tree_priority (uint32_t offset) /**< node offset */
+{
+  offset *= 0x9e3779b1u;
+  return offset ^ (offset >> 15);
+} /* jmem_heap_tree_priority */
+
+/**
+ * Compare the (size, offset) keys of two tree nodes
+ *
+ * @return true - if the first key is less than the second one,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_tree_key_less (uint32_t size1, /**< size of the first node */
+                         uint32_t offset1, /**< offset of the first node */
+                         uint32_t size2, /**< size of the second node */
+                         uint32_t offset2) /**< offset of the second node */
+{
+  return size1 < size2 || (size1 == size2 && offset1 < offset2);
+} /* jmem_heap_tree_key_less */
+
+/**
+ * Get the size of a tree node
+ *
+ * @return size of the region
+ */
+static uint32_t
+jmem_heap_tree_get_size (uint32_t offset) /**< node offset */
+{
+  jmem_heap_tree_node_t *node_p = JMEM_HEAP_TREE_NODE (offset);
+
+  JMEM_VALGRIND_DEFINED_SPACE (node_p, sizeof (jmem_heap_tree_node_t));
+  uint32_t size = node_p->header.size;
+  JMEM_VALGRIND_NOACCESS_SPACE (node_p, sizeof (jmem_heap_tree_node_t));
+
+  return size;
+} /* jmem_heap_tree_get_size */
+
+/**
+ * Get a child of a tree node
+ *
+ * @return offset of the child
+ */
+static uint32_t
+jmem_heap_tree_get_child (uint32_t offset, /**< node offset */
+                          uint32_t index) /**< 0 - left child, 1 - right child */
+{
+  jmem_heap_tree_node_t *node_p = JMEM_HEAP_TREE_NODE (offset);
+
+  JMEM_VALGRIND_DEFINED_SPACE (node_p, sizeof (jmem_heap_tree_node_t));
+  uint32_t child_offset = node_p->child_offset[index];
+  JMEM_VALGRIND_NOACCESS_SPACE (node_p, sizeof (jmem_heap_tree_node_t));
+
+  return child_offset;
+} /* jmem_heap_tree_get_child */
+
+/**
+ * Set a child of a tree node, or the root of the tree when the parent is JMEM_HEAP_END_OF_LIST
+ */
+static void
+jmem_heap_tree_set_child (uint32_t parent_offset, /**< parent node offset */
+                          uint32_t index, /**< 0 - left child, 1 - right child */
+                          uint32_t child_offset) /**< new child offset */
+{
+  if (parent_offset == JMEM_HEAP_END_OF_LIST)
+  {
+    JMEM_VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+    JERRY_HEAP_CONTEXT (first).next_offset = child_offset;
+    JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+    return;
+  }
+
+  jmem_heap_tree_node_t *node_p = JMEM_HEAP_TREE_NODE (parent_offset);
+
+  JMEM_VALGRIND_DEFINED_SPACE (node_p, sizeof (jmem_heap_tree_node_t));
+  node_p->child_offset[index] = child_offset;
+  JMEM_VALGRIND_NOACCESS_SPACE (node_p, sizeof (jmem_heap_tree_node_t));
+} /* jmem_heap_tree_set_child */
+
+/**
+ * Get the root of the large block tree
+ *
+ * @return offset of the root node
+ */
+static uint32_t
+jmem_heap_tree_get_root (void)
+{
+  JMEM_VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+  uint32_t root_offset = JERRY_HEAP_CONTEXT (first).next_offset;
+  JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+
+  return root_offset;
+} /* jmem_heap_tree_get_root */
+
+/**
+ * Insert a free region into the large block tree
+ */
+static void
+jmem_heap_tree_insert (jmem_heap_free_t *region_p, /**< region */
+                       uint32_t size) /**< size of the region */
+{
+  JERRY_ASSERT (size >= JMEM_HEAP_TREE_MIN_SIZE && size % JMEM_ALIGNMENT == 0);
+
+  const uint32_t offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (region_p);
+  const uint32_t priority = jmem_heap_tree_priority (offset);
+  jmem_heap_tree_node_t *node_p = (jmem_heap_tree_node_t *) region_p;
+  uint32_t *footer_p = (uint32_t *) ((uint8_t *) region_p + size) - 1;
+
+  JMEM_VALGRIND_DEFINED_SPACE (node_p, sizeof (jmem_heap_tree_node_t));
+  node_p->header.size = size;
+  node_p->header.next_offset = JMEM_HEAP_END_OF_LIST;
+  JMEM_VALGRIND_NOACCESS_SPACE (node_p, sizeof (jmem_heap_tree_node_t));
+
+  JMEM_VALGRIND_DEFINED_SPACE (footer_p, sizeof (uint32_t));
+  *footer_p = size;
+  JMEM_VALGRIND_NOACCESS_SPACE (footer_p, sizeof (uint32_t));
+
+  jmem_heap_bitmap_update (region_p, size, true);
+
+  /* Find the insertion point: the first node with lower priority. */
+  uint32_t parent_offset = JMEM_HEAP_END_OF_LIST;
+  uint32_t parent_index = 0;
+  uint32_t current_offset = jmem_heap_tree_get_root ();
+
+  while (current_offset != JMEM_HEAP_END_OF_LIST
+         && jmem_heap_tree_priority (current_offset) >= priority)
+  {
+    const uint32_t current_size = jmem_heap_tree_get_size (current_offset);
+
+    parent_offset = current_offset;
+    parent_index = jmem_heap_tree_key_less (current_size, current_offset, size, offset) ? 1 : 0;
+    current_offset = jmem_heap_tree_get_child (current_offset, parent_index);
+  }
+
+  /* Split the subtree at the insertion point into the children of the new node. */
+  uint32_t left_offset = offset;
+  uint32_t left_index = 0;
+  uint32_t right_offset = offset;
+  uint32_t right_index = 1;
+
+  while (current_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    if (jmem_heap_tree_key_less (jmem_heap_tree_get_size (current_offset), current_offset, size, offset))
+    {
+      jmem_heap_tree_set_child (left_offset, left_index, current_offset);
+      left_offset = current_offset;
+      left_index = 1;
+      current_offset = jmem_heap_tree_get_child (current_offset, 1);
+    }
+    else
+    {
+      jmem_heap_tree_set_child (right_offset, right_index, current_offset);
+      right_offset = current_offset;
+      right_index = 0;
+      current_offset = jmem_heap_tree_get_child (current_offset, 0);
+    }
+  }
+
+  jmem_heap_tree_set_child (left_offset, left_index, JMEM_HEAP_END_OF_LIST);
+  jmem_heap_tree_set_child (right_offset, right_index, JMEM_HEAP_END_OF_LIST);
+  jmem_heap_tree_set_child (parent_offset, parent_index, offset);
+} /* jmem_heap_tree_insert */
+
+/**
+ * Remove a free region from the large block tree
+ */
+static void
+jmem_heap_tree_remove (uint32_t offset) /**< node offset */
+{
+  const uint32_t size = jmem_heap_tree_get_size (offset);
+
+  uint32_t parent_offset = JMEM_HEAP_END_OF_LIST;
+  uint32_t parent_index = 0;
+  uint32_t current_offset = jmem_heap_tree_get_root ();
+
+  while (current_offset != offset)
+  {
+    JERRY_ASSERT (current_offset != JMEM_HEAP_END_OF_LIST);
+
+    const uint32_t current_size = jmem_heap_tree_get_size (current_offset);
+
+    parent_offset = current_offset;
+    parent_index = jmem_heap_tree_key_less (current_size, current_offset, size, offset) ? 1 : 0;
+    current_offset = jmem_heap_tree_get_child (current_offset, parent_index);
+  }
+
+  /* Merge the two subtrees of the removed node. */
+  uint32_t left_offset = jmem_heap_tree_get_child (offset, 0);
+  uint32_t right_offset = jmem_heap_tree_get_child (offset, 1);
+
+  while (left_offset != JMEM_HEAP_END_OF_LIST && right_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    if (jmem_heap_tree_priority (left_offset) >= jmem_heap_tree_priority (right_offset))
+    {
+      jmem_heap_tree_set_child (parent_offset, parent_index, left_offset);
+      parent_offset = left_offset;
+      parent_index = 1;
+      left_offset = jmem_heap_tree_get_child (left_offset, 1);
+    }
+    else
+    {
+      jmem_heap_tree_set_child (parent_offset, parent_index, right_offset);
+      parent_offset = right_offset;
+      parent_index = 0;
+      right_offset = jmem_heap_tree_get_child (right_offset, 0);
+    }
+  }
+
+  jmem_heap_tree_set_child (parent_offset,
+                            parent_index,
+                            (left_offset != JMEM_HEAP_END_OF_LIST) ? left_offset : right_offset);
+
+  jmem_heap_bitmap_update (JMEM_HEAP_GET_ADDR_FROM_OFFSET (offset), size, false);
+} /* jmem_heap_tree_remove */
+
+/**
+ * Find the smallest region in the large block tree which is at least as big as the requested size
+ *
+ * @return offset of the region - if found,
+ *         JMEM_HEAP_END_OF_LIST - otherwise
+ */
+static uint32_t
+jmem_heap_tree_find_best_fit (uint32_t size) /**< requested size */
+{
+  uint32_t best_offset = JMEM_HEAP_END_OF_LIST;
+  uint32_t current_offset = jmem_heap_tree_get_root ();
+
+  while (current_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    const uint32_t current_size = jmem_heap_tree_get_size (current_offset);
+
+    if (current_size < size)
+    {
+      current_offset = jmem_heap_tree_get_child (current_offset, 1);
+      continue;
+    }
+
+    best_offset = current_offset;
+    current_offset = jmem_heap_tree_get_child (current_offset, 0);
+  }
+
+  return best_offset;
+} /* jmem_heap_tree_find_best_fit */
+
+/**
+ * Push a free region onto the size-class bin of its size
+ *
+ * Note:
+ *      regions in the bins are not coalesced until the heap is consolidated
+ */
+static void
+jmem_heap_bin_push (jmem_heap_free_t *region_p, /**< region */
+                    uint32_t size) /**< size of the region */
+{
+  JERRY_ASSERT (size > 0 && size <= JMEM_HEAP_BIN_LIMIT && size % JMEM_ALIGNMENT == 0);
+
+  uint32_t *bin_p = JERRY_CONTEXT (jmem_heap_bins) + (size >> JMEM_ALIGNMENT_LOG) - 1;
+
+  JMEM_VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_free_t));
+  region_p->size = size;
+  region_p->next_offset = *bin_p;
+  JMEM_VALGRIND_NOACCESS_SPACE (region_p, sizeof (jmem_heap_free_t));
+
+  *bin_p = JMEM_HEAP_GET_OFFSET_FROM_ADDR (region_p);
+
+  if (JERRY_CONTEXT (jmem_heap_binned_size) < JMEM_HEAP_CONSOLIDATE_LIMIT)
+  {
+    JERRY_CONTEXT (jmem_heap_binned_size) += size;
+  }
+} /* jmem_heap_bin_push */
+
+/**
+ * Pop a free region from a size-class bin
+ *
+ * @return pointer to the region - if the bin is not empty,
+ *         NULL - otherwise
+ */
+static jmem_heap_free_t *
+jmem_heap_bin_pop (uint32_t size) /**< size of the region */
+{
+  JERRY_ASSERT (size > 0 && size <= JMEM_HEAP_BIN_LIMIT && size % JMEM_ALIGNMENT == 0);
+
+  uint32_t *bin_p = JERRY_CONTEXT (jmem_heap_bins) + (size >> JMEM_ALIGNMENT_LOG) - 1;
+
+  if (*bin_p == JMEM_HEAP_END_OF_LIST)
+  {
+    return NULL;
+  }
+
+  jmem_heap_free_t *region_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (*bin_p);
+  JERRY_ASSERT (jmem_is_heap_pointer (region_p));
+
+  JMEM_VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_free_t));
+  JERRY_ASSERT (region_p->size == size);
+  *bin_p = region_p->next_offset;
+  JMEM_VALGRIND_NOACCESS_SPACE (region_p, sizeof (jmem_heap_free_t));
+
+  return region_p;
+} /* jmem_heap_bin_pop */
+
+/**
+ * Coalesce a free region with its free neighbours in the large block tree, and store the result
+ *
+ * Note:
+ *      the result is pushed onto a bin if it is too small for the tree
+ */
+static void
+jmem_heap_release_region (jmem_heap_free_t *region_p, /**< region */
+                          uint32_t size) /**< size of the region */
+{
+  JERRY_ASSERT ((uintptr_t) region_p % JMEM_ALIGNMENT == 0);
+  JERRY_ASSERT (size > 0 && size % JMEM_ALIGNMENT == 0);
+
+  uint8_t *region_end_p = (uint8_t *) region_p + size;
+
+  if (region_end_p < JERRY_HEAP_CONTEXT (area) + JMEM_HEAP_FIT_AREA_SIZE
+      && jmem_heap_bitmap_test (jmem_heap_get_granule (region_end_p)))
+  {
+    const uint32_t next_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (region_end_p);
+    size += jmem_heap_tree_get_size (next_offset);
+    jmem_heap_tree_remove (next_offset);
+  }
+
+  if ((uint8_t *) region_p > JERRY_HEAP_CONTEXT (area)
+      && jmem_heap_bitmap_test (jmem_heap_get_granule (region_p) - 1))
+  {
+    uint32_t *footer_p = (uint32_t *) region_p - 1;
+
+    JMEM_VALGRIND_DEFINED_SPACE (footer_p, sizeof (uint32_t));
+    const uint32_t prev_size = *footer_p;
+    JMEM_VALGRIND_NOACCESS_SPACE (footer_p, sizeof (uint32_t));
+
+    region_p = (jmem_heap_free_t *) ((uint8_t *) region_p - prev_size);
+    JERRY_ASSERT (jmem_heap_tree_get_size (JMEM_HEAP_GET_OFFSET_FROM_ADDR (region_p)) == prev_size);
+
+    jmem_heap_tree_remove (JMEM_HEAP_GET_OFFSET_FROM_ADDR (region_p));
+    size += prev_size;
+  }
+
+  if (size < JMEM_HEAP_TREE_MIN_SIZE)
+  {
+    jmem_heap_bin_push (region_p, size);
+    return;
+  }
+
+  jmem_heap_tree_insert (region_p, size);
+} /* jmem_heap_release_region */
+
+/**
+ * Set the bits of a granule range in the bitmap
+ */
+static void
+jmem_heap_bitmap_set_range (uint32_t first, /**< first granule */
+                            uint32_t end) /**< granule after the last one */
+{
+  uint32_t *bitmap_p = jmem_heap_get_bitmap ();
+
+  while (first < end)
+  {
+    uint32_t count = JERRY_MIN (32 - (first & 0x1f), end - first);
+    uint32_t mask = (count == 32) ? 0xffffffffu : (((1u << count) - 1) << (first & 0x1f));
+
+    bitmap_p[first >> 5] |= mask;
+    first += count;
+  }
+} /* jmem_heap_bitmap_set_range */
+
+/**
+ * Rebuild the free structures, so every adjacent free region is coalesced, including the binned ones
+ *
+ * Note:
+ *      this is a slow path, which is only taken when an allocation request cannot be satisfied
+ *      (see JMEM_HEAP_CONSOLIDATE_LIMIT)
+ *
+ * @return true - if regions were pushed onto the bins since the last consolidation,
+ *         false - otherwise
+ */
+static bool
+jmem_heap_consolidate (void)
+{
+  /* The regions left in the bins by the last consolidation cannot be coalesced. */
+  if (JERRY_CONTEXT (jmem_heap_binned_size) == 0)
+  {
+    return false;
+  }
+
+  /* Mark every free granule in the bitmap: the tree is emptied first, since removing
+   * a node only clears the boundary bits of that node. */
+  uint32_t root_offset;
+
+  while ((root_offset = jmem_heap_tree_get_root ()) != JMEM_HEAP_END_OF_LIST)
+  {
+    const uint32_t size = jmem_heap_tree_get_size (root_offset);
+    const uint32_t first = jmem_heap_get_granule (JMEM_HEAP_GET_ADDR_FROM_OFFSET (root_offset));
+
+    jmem_heap_tree_remove (root_offset);
+    jmem_heap_bitmap_set_range (first, first + (size >> JMEM_ALIGNMENT_LOG));
+  }
+
+  for (uint32_t i = 0; i < JMEM_HEAP_BIN_COUNT; i++)
+  {
+    uint32_t current_offset = JERRY_CONTEXT (jmem_heap_bins)[i];
+    JERRY_CONTEXT (jmem_heap_bins)[i] = JMEM_HEAP_END_OF_LIST;
+
+    while (current_offset != JMEM_HEAP_END_OF_LIST)
+    {
+      jmem_heap_free_t *region_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (current_offset);
+      const uint32_t first = jmem_heap_get_granule (region_p);
+
+      JMEM_VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_free_t));
+      current_offset = region_p->next_offset;
+      JMEM_VALGRIND_NOACCESS_SPACE (region_p, sizeof (jmem_heap_free_t));
+
+      jmem_heap_bitmap_set_range (first, first + (i + 1));
+    }
+  }
+
+  /* Turn each run of free granules into a single region. The bits of a run are cleared
+   * before the region is stored, and storing the region only sets bits inside the run. */
+  uint32_t *bitmap_p = jmem_heap_get_bitmap ();
+  const uint32_t granule_count = JMEM_HEAP_FIT_AREA_SIZE >> JMEM_ALIGNMENT_LOG;
+  uint32_t granule = 0;
+
+  while (granule < granule_count)
+  {
+    if (bitmap_p[granule >> 5] == 0 && (granule & 0x1f) == 0)
+    {
+      granule += 32;
+      continue;
+    }
+
+    if (!jmem_heap_bitmap_test (granule))
+    {
+      granule++;
+      continue;
+    }
+
+    uint32_t run_end = granule;
+
+    do
+    {
+      bitmap_p[run_end >> 5] &= ~(1u << (run_end & 0x1f));
+      run_end++;
+    }
+    while (run_end < granule_count && jmem_heap_bitmap_test (run_end));
+
+    jmem_heap_free_t *region_p = (jmem_heap_free_t *) (JERRY_HEAP_CONTEXT (area) + (granule << JMEM_ALIGNMENT_LOG));
+    const uint32_t size = (run_end - granule) << JMEM_ALIGNMENT_LOG;
+
+    if (size < JMEM_HEAP_TREE_MIN_SIZE)
+    {
+      jmem_heap_bin_push (region_p, size);
+    }
+    else
+    {
+      jmem_heap_tree_insert (region_p, size);
+    }
+
+    granule = run_end;
+  }
+
+  JERRY_CONTEXT (jmem_heap_binned_size) = 0;
+  return true;
+} /* jmem_heap_consolidate */
+
+/**
+ * Allocate a region in segregated-fit mode
+ *
+ * @return pointer to the allocated region - if successful,
+ *         NULL - if there is not enough memory
+ */
+static jmem_heap_free_t *
+jmem_heap_fit_alloc (uint32_t required_size) /**< aligned size of the region */
+{
+  if (required_size <= JMEM_HEAP_BIN_LIMIT)
+  {
+    jmem_heap_free_t *region_p = jmem_heap_bin_pop (required_size);
+
+    if (region_p != NULL)
+    {
+      return region_p;
+    }
+  }
+
+  uint32_t offset = jmem_heap_tree_find_best_fit (required_size);
+
+  if (JERRY_UNLIKELY (offset == JMEM_HEAP_END_OF_LIST))
+  {
+    if (JERRY_CONTEXT (jmem_heap_binned_size) < JMEM_HEAP_CONSOLIDATE_LIMIT
+        || !jmem_heap_consolidate ())
+    {
+      return NULL;
+    }
+
+    if (required_size <= JMEM_HEAP_BIN_LIMIT)
+    {
+      jmem_heap_free_t *region_p = jmem_heap_bin_pop (required_size);
+
+      if (region_p != NULL)
+      {
+        return region_p;
+      }
+    }
+
+    offset = jmem_heap_tree_find_best_fit (required_size);
+
+    if (offset == JMEM_HEAP_END_OF_LIST)
+    {
+      return NULL;
+    }
+  }
+
+  jmem_heap_free_t *region_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (offset);
+  JERRY_ASSERT (jmem_is_heap_pointer (region_p));
+
+  const uint32_t remaining_size = jmem_heap_tree_get_size (offset) - required_size;
+  jmem_heap_tree_remove (offset);
+
+  if (remaining_size > 0)
+  {
+    /* The right neighbour cannot be in the tree, since tree regions are always coalesced. */
+    jmem_heap_free_t *remaining_p = (jmem_heap_free_t *) ((uint8_t *) region_p + required_size);
+
+    if (remaining_size < JMEM_HEAP_TREE_MIN_SIZE)
+    {
+      jmem_heap_bin_push (remaining_p, remaining_size);
+    }
+    else
+    {
+      jmem_heap_tree_insert (remaining_p, remaining_size);
+    }
+  }
+
+  return region_p;
+} /* jmem_heap_fit_alloc */
+
+/**
+ * Try to extend an allocated region in place in segregated-fit mode
+ *
+ * @return true - if the region has been extended,
+ *         false - otherwise
+ */
+static bool
+jmem_heap_fit_extend (jmem_heap_free_t *block_p, /**< allocated region */
+                      uint32_t old_size, /**< aligned size of the region */
+                      uint32_t required_size) /**< number of extra bytes */
+{
+  uint8_t *block_end_p = (uint8_t *) block_p + old_size;
+
+  if (block_end_p >= JERRY_HEAP_CONTEXT (area) + JMEM_HEAP_FIT_AREA_SIZE
+      || !jmem_heap_bitmap_test (jmem_heap_get_granule (block_end_p)))
+  {
+    return false;
+  }
+
+  const uint32_t next_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (block_end_p);
+  const uint32_t next_size = jmem_heap_tree_get_size (next_offset);
+
+  if (next_size < required_size)
+  {
+    return false;
+  }
+
+  jmem_heap_tree_remove (next_offset);
+
+  if (next_size > required_size)
+  {
+    jmem_heap_free_t *remaining_p = (jmem_heap_free_t *) (block_end_p + required_size);
+    const uint32_t remaining_size = next_size - required_size;
+
+    if (remaining_size < JMEM_HEAP_TREE_MIN_SIZE)
+    {
+      jmem_heap_bin_push (remaining_p, remaining_size);
+    }
+    else
+    {
+      jmem_heap_tree_insert (remaining_p, remaining_size);
+    }
+  }
+
+  return true;
+} /* jmem_heap_fit_extend */
+
+/**
+ * Free a region in segregated-fit mode
+ */
+static void
+jmem_heap_fit_free (jmem_heap_free_t *block_p, /**< region */
+                    uint32_t size) /**< aligned size of the region */
+{
+  JMEM_VALGRIND_NOACCESS_SPACE (block_p, size);
+
+  if (size <= JMEM_HEAP_BIN_LIMIT)
+  {
+    uint8_t *block_end_p = (uint8_t *) block_p + size;
+
+    /* Small regions are only binned when they cannot be coalesced immediately. */
+    if ((block_end_p >= JERRY_HEAP_CONTEXT (area) + JMEM_HEAP_FIT_AREA_SIZE
+         || !jmem_heap_bitmap_test (jmem_heap_get_granule (block_end_p)))
+        && ((uint8_t *) block_p == JERRY_HEAP_CONTEXT (area)
+            || !jmem_heap_bitmap_test (jmem_heap_get_granule (block_p) - 1)))
+    {
+      jmem_heap_bin_push (block_p, size);
+      return;
+    }
+  }
+
+  jmem_heap_release_region (block_p, size);
+} /* jmem_heap_fit_free */
+#endif /* ENABLED (JERRY_MEM_SEGREGATED_FIT) */
 #endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
 
 /**
@@ -81,6 +818,25 @@ jmem_heap_init (void)
 
   JERRY_CONTEXT (jmem_heap_limit) = CONFIG_GC_LIMIT;
 
+#if ENABLED (JERRY_MEM_SEGREGATED_FIT)
+  for (uint32_t i = 0; i < JMEM_HEAP_BIN_COUNT; i++)
+  {
+    JERRY_CONTEXT (jmem_heap_bins)[i] = JMEM_HEAP_END_OF_LIST;
+  }
+
+  JERRY_CONTEXT (jmem_heap_binned_size) = 0;
+  JERRY_HEAP_CONTEXT (first).size = 0;
+  JERRY_HEAP_CONTEXT (first).next_offset = JMEM_HEAP_END_OF_LIST;
+
+  JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+  JMEM_VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (area), JMEM_HEAP_AREA_SIZE);
+
+  /* The bitmap is never handed out, so it is always accessible. */
+  JMEM_VALGRIND_DEFINED_SPACE (jmem_heap_get_bitmap (), JMEM_HEAP_BITMAP_SIZE);
+  memset (jmem_heap_get_bitmap (), 0, JMEM_HEAP_BITMAP_SIZE);
+
+  jmem_heap_tree_insert ((jmem_heap_free_t *) JERRY_HEAP_CONTEXT (area), JMEM_HEAP_FIT_AREA_SIZE);
+#else /* !ENABLED (JERRY_MEM_SEGREGATED_FIT) */
   jmem_heap_free_t *const region_p = (jmem_heap_free_t *) JERRY_HEAP_CONTEXT (area);
 
   region_p->size = JMEM_HEAP_AREA_SIZE;
@@ -93,6 +849,7 @@ jmem_heap_init (void)
 
   JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
   JMEM_VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (area), JMEM_HEAP_AREA_SIZE);
+#endif /* ENABLED (JERRY_MEM_SEGREGATED_FIT) */
 
 #endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
   JMEM_HEAP_STAT_INIT ();
@@ -127,6 +884,19 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
   const size_t required_size = ((size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT) * JMEM_ALIGNMENT;
   jmem_heap_free_t *data_space_p = NULL;
 
+#if ENABLED (JERRY_MEM_SEGREGATED_FIT)
+  data_space_p = jmem_heap_fit_alloc ((uint32_t) required_size);
+
+  if (JERRY_LIKELY (data_space_p != NULL))
+  {
+    JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
+
+    while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
+    {
+      JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
+    }
+  }
+#else /* !ENABLED (JERRY_MEM_SEGREGATED_FIT) */
   JMEM_VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
 
   /* Fast path for 8 byte chunks, first region is guaranteed to be sufficient. */
@@ -238,6 +1008,7 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
   }
 
   JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+#endif /* ENABLED (JERRY_MEM_SEGREGATED_FIT) */
 
   JERRY_ASSERT ((uintptr_t) data_space_p % JMEM_ALIGNMENT == 0);
   JMEM_VALGRIND_MALLOCLIKE_SPACE (data_space_p, size);
@@ -296,6 +1067,14 @@ jmem_heap_gc_and_alloc_block (const size_t size, /**< required memory size */
     pressure++;
     ecma_free_unused_memory (pressure);
     data_space_p = jmem_heap_alloc (size);
+
+#if ENABLED (JERRY_MEM_SEGREGATED_FIT)
+    /* The cost of the consolidation is negligible compared to the garbage collection. */
+    if (data_space_p == NULL && jmem_heap_consolidate ())
+    {
+      data_space_p = jmem_heap_alloc (size);
+    }
+#endif /* ENABLED (JERRY_MEM_SEGREGATED_FIT) */
   }
 
   return data_space_p;
@@ -352,7 +1131,7 @@ jmem_heap_alloc_block_null_on_error (const size_t size) /**< required memory siz
   return block_p;
 } /* jmem_heap_alloc_block_null_on_error */
 
-#if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+#if !ENABLED (JERRY_SYSTEM_ALLOCATOR) && !ENABLED (JERRY_MEM_SEGREGATED_FIT)
 /**
  * Finds the block in the free block list which preceeds the argument block
  *
@@ -446,7 +1225,7 @@ jmem_heap_insert_block (jmem_heap_free_t *block_p, /**< block to insert */
   JMEM_VALGRIND_NOACCESS_SPACE (block_p, sizeof (jmem_heap_free_t));
   JMEM_VALGRIND_NOACCESS_SPACE (next_p, sizeof (jmem_heap_free_t));
 } /* jmem_heap_insert_block */
-#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) && !ENABLED (JERRY_MEM_SEGREGATED_FIT) */
 
 /**
  * Internal method for freeing a memory block.
@@ -467,8 +1246,12 @@ jmem_heap_free_block_internal (void *ptr, /**< pointer to beginning of data spac
   const size_t aligned_size = (size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT * JMEM_ALIGNMENT;
 
   jmem_heap_free_t *const block_p = (jmem_heap_free_t *) ptr;
+#if ENABLED (JERRY_MEM_SEGREGATED_FIT)
+  jmem_heap_fit_free (block_p, (uint32_t) aligned_size);
+#else /* !ENABLED (JERRY_MEM_SEGREGATED_FIT) */
   jmem_heap_free_t *const prev_p = jmem_heap_find_prev (block_p);
   jmem_heap_insert_block (block_p, prev_p, aligned_size);
+#endif /* ENABLED (JERRY_MEM_SEGREGATED_FIT) */
 
   JERRY_CONTEXT (jmem_heap_allocated_size) -= aligned_size;
 
@@ -518,9 +1301,15 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
     JMEM_VALGRIND_RESIZE_SPACE (block_p, old_size, new_size);
     JMEM_HEAP_STAT_FREE (old_size);
     JMEM_HEAP_STAT_ALLOC (new_size);
+#if ENABLED (JERRY_MEM_SEGREGATED_FIT)
+    jmem_heap_free_t *const tail_p = (jmem_heap_free_t *) ((uint8_t *) block_p + aligned_new_size);
+    JMEM_VALGRIND_NOACCESS_SPACE (tail_p, aligned_old_size - aligned_new_size);
+    jmem_heap_release_region (tail_p, (uint32_t) (aligned_old_size - aligned_new_size));
+#else /* !ENABLED (JERRY_MEM_SEGREGATED_FIT) */
     jmem_heap_insert_block ((jmem_heap_free_t *) ((uint8_t *) block_p + aligned_new_size),
                             jmem_heap_find_prev (block_p),
                             aligned_old_size - aligned_new_size);
+#endif /* ENABLED (JERRY_MEM_SEGREGATED_FIT) */
 
     JERRY_CONTEXT (jmem_heap_allocated_size) -= (aligned_old_size - aligned_new_size);
     while (JERRY_CONTEXT (jmem_heap_allocated_size) + CONFIG_GC_LIMIT <= JERRY_CONTEXT (jmem_heap_limit))
@@ -543,6 +1332,14 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
   ecma_gc_run ();
 #endif /* ENABLED (JERRY_MEM_GC_BEFORE_EACH_ALLOC) */
 
+#if ENABLED (JERRY_MEM_SEGREGATED_FIT)
+  if (jmem_heap_fit_extend (block_p, (uint32_t) aligned_old_size, (uint32_t) required_size))
+  {
+    /* The extension will be marked as undefined space. */
+    JMEM_VALGRIND_RESIZE_SPACE (block_p, old_size, new_size);
+    ret_block_p = block_p;
+  }
+#else /* !ENABLED (JERRY_MEM_SEGREGATED_FIT) */
   jmem_heap_free_t *prev_p = jmem_heap_find_prev (block_p);
   JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
   jmem_heap_free_t * const next_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
@@ -619,11 +1416,14 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
       JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
     }
   }
+#endif /* ENABLED (JERRY_MEM_SEGREGATED_FIT) */
 
   if (ret_block_p != NULL)
   {
     /* Managed to extend the block. Update memory usage and the skip pointer. */
+#if !ENABLED (JERRY_MEM_SEGREGATED_FIT)
     JERRY_CONTEXT (jmem_heap_list_skip_p) = prev_p;
+#endif /* !ENABLED (JERRY_MEM_SEGREGATED_FIT) */
     JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
 
     while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
@@ -639,12 +1439,17 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
     JERRY_CONTEXT (jmem_heap_allocated_size) -= aligned_old_size;
     ret_block_p = jmem_heap_alloc_block_internal (new_size);
 
+#if ENABLED (JERRY_MEM_SEGREGATED_FIT)
+    memcpy (ret_block_p, block_p, old_size);
+    jmem_heap_fit_free (block_p, (uint32_t) aligned_old_size);
+#else /* !ENABLED (JERRY_MEM_SEGREGATED_FIT) */
     /* jmem_heap_alloc_block_internal may trigger garbage collection, which can create new free blocks
      * in the heap structure, so we need to look up the previous block again. */
     prev_p = jmem_heap_find_prev (block_p);
 
     memcpy (ret_block_p, block_p, old_size);
     jmem_heap_insert_block (block_p, prev_p, aligned_old_size);
+#endif /* ENABLED (JERRY_MEM_SEGREGATED_FIT) */
     /* jmem_heap_alloc_block_internal will call JMEM_VALGRIND_MALLOCLIKE_SPACE */
     JMEM_VALGRIND_FREELIKE_SPACE (block_p);
   }
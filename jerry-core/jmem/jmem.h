@@ -139,6 +139,15 @@ typedef struct
   uint32_t size; /**< Size of region */
 } jmem_heap_free_t;
 
+#if ENABLED (JERRY_MEM_SEGREGATED_FIT)
+/**
+ * Number of size-class bins of the segregated-fit allocator
+ *
+ * Bin N holds free regions of (N + 1) * JMEM_ALIGNMENT bytes.
+ */
+#define JMEM_HEAP_BIN_COUNT 16
+#endif /* ENABLED (JERRY_MEM_SEGREGATED_FIT) */
+
 void jmem_init (void);
 void jmem_finalize (void);
 
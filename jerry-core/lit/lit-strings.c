@@ -915,3 +915,99 @@ bool lit_compare_utf8_strings_relational (const lit_utf8_byte_t *string1_p, /**<
 
   return (string1_pos >= string1_end_p && string2_pos < string2_end_p);
 } /* lit_compare_utf8_strings_relational */
+
+/**
+ * Minimum size of search patterns which are found by the Boyer-Moore-Horspool algorithm.
+ * Shorter patterns are found by searching their first byte.
+ */
+#define LIT_FIND_SKIP_TABLE_MIN_PATTERN_SIZE 4
+
+/**
+ * Minimum size of the searched buffer, which makes filling the skip table worthwhile.
+ */
+#define LIT_FIND_SKIP_TABLE_MIN_BUFFER_SIZE 256
+
+/**
+ * Find the first occurrence of a byte sequence in a cesu-8 encoded string
+ *
+ * Note:
+ *   a match always starts at the beginning of a code unit, because the first
+ *   byte of a cesu-8 encoded code unit never equals to a continuation byte
+ *
+ * @return pointer to the first byte of the first occurrence
+ *         NULL - if the pattern is not found
+ */
+const lit_utf8_byte_t *
+lit_utf8_find_substring (const lit_utf8_byte_t *buf_p, /**< cesu-8 string */
+                         lit_utf8_size_t buf_size, /**< size of the string */
+                         const lit_utf8_byte_t *pattern_p, /**< cesu-8 string to be found */
+                         lit_utf8_size_t pattern_size) /**< size of the pattern */
+{
+  if (pattern_size == 0)
+  {
+    return buf_p;
+  }
+
+  if (pattern_size > buf_size)
+  {
+    return NULL;
+  }
+
+  /* Last position where the pattern can start. */
+  const lit_utf8_byte_t *last_p = buf_p + (buf_size - pattern_size);
+
+  if (pattern_size < LIT_FIND_SKIP_TABLE_MIN_PATTERN_SIZE
+      || buf_size < LIT_FIND_SKIP_TABLE_MIN_BUFFER_SIZE)
+  {
+    const lit_utf8_byte_t first_byte = pattern_p[0];
+
+    while (buf_p <= last_p)
+    {
+      buf_p = (const lit_utf8_byte_t *) memchr (buf_p, first_byte, (size_t) (last_p - buf_p) + 1);
+
+      if (buf_p == NULL)
+      {
+        return NULL;
+      }
+
+      if (memcmp (buf_p + 1, pattern_p + 1, pattern_size - 1) == 0)
+      {
+        return buf_p;
+      }
+
+      buf_p++;
+    }
+
+    return NULL;
+  }
+
+  /* Boyer-Moore-Horspool search: the shift is computed from the byte aligned to the
+   * last byte of the pattern. Shifts are limited to 255, which only makes them shorter. */
+  uint8_t skip_table[256];
+  const lit_utf8_size_t last_index = pattern_size - 1;
+  const uint8_t max_shift = (uint8_t) JERRY_MIN (pattern_size, UINT8_MAX);
+
+  memset (skip_table, max_shift, sizeof (skip_table));
+
+  for (lit_utf8_size_t i = 0; i < last_index; i++)
+  {
+    skip_table[pattern_p[i]] = (uint8_t) JERRY_MIN (last_index - i, UINT8_MAX);
+  }
+
+  const lit_utf8_byte_t last_byte = pattern_p[last_index];
+
+  while (buf_p <= last_p)
+  {
+    const lit_utf8_byte_t current_byte = buf_p[last_index];
+
+    if (current_byte == last_byte
+        && memcmp (buf_p, pattern_p, last_index) == 0)
+    {
+      return buf_p;
+    }
+
+    buf_p += skip_table[current_byte];
+  }
+
+  return NULL;
+} /* lit_utf8_find_substring */
@@ -122,6 +122,8 @@ lit_code_point_t lit_convert_surrogate_pair_to_code_point (ecma_char_t high_surr
 
 bool lit_compare_utf8_strings_relational (const lit_utf8_byte_t *string1_p, lit_utf8_size_t string1_size,
                                           const lit_utf8_byte_t *string2_p, lit_utf8_size_t string2_size);
+const lit_utf8_byte_t *lit_utf8_find_substring (const lit_utf8_byte_t *buf_p, lit_utf8_size_t buf_size,
+                                                const lit_utf8_byte_t *pattern_p, lit_utf8_size_t pattern_size);
 
 uint8_t lit_utf16_encode_code_point (lit_code_point_t cp, ecma_char_t *cu_p);
 
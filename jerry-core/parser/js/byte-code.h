@@ -102,6 +102,14 @@
   CBC_OPCODE (name ## _TWO_LITERALS, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 1, \
               (VM_OC_ ## group) | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_STACK)
 
+#define CBC_BINARY_MOV_IDENT_OPERATION(name, group) \
+  CBC_OPCODE (name ## _MOV_IDENT, CBC_HAS_LITERAL_ARG, -2, \
+              (VM_OC_ ## group) | VM_OC_GET_STACK_STACK | VM_OC_PUT_IDENT) \
+  CBC_OPCODE (name ## _RIGHT_LITERAL_MOV_IDENT, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, -1, \
+              (VM_OC_ ## group) | VM_OC_GET_STACK_LITERAL | VM_OC_PUT_IDENT) \
+  CBC_OPCODE (name ## _TWO_LITERALS_MOV_IDENT, CBC_HAS_LITERAL_ARG2, 0, \
+              (VM_OC_ ## group) | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_IDENT)
+
 #define CBC_UNARY_LVALUE_OPERATION(name, group) \
   CBC_OPCODE (name, CBC_NO_FLAG, -2, \
               (VM_OC_PROP_ ## group) | VM_OC_GET_STACK_STACK | VM_OC_PUT_REFERENCE) \
@@ -177,6 +185,18 @@
   CBC_OPCODE (name ## _3, CBC_HAS_BRANCH_ARG, stack, \
               (vm_oc) | VM_OC_GET_BRANCH | VM_OC_BACKWARD_BRANCH)
 
+/**
+ * Backward branch which compares two literals and branches if the comparison is true.
+ * The branch argument precedes the literal arguments.
+ */
+#define CBC_BACKWARD_BRANCH_TWO_LITERALS(name, vm_oc) \
+  CBC_OPCODE (name, CBC_HAS_BRANCH_ARG | CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
+              (vm_oc) | VM_OC_GET_BRANCH | VM_OC_BACKWARD_BRANCH) \
+  CBC_OPCODE (name ## _2, CBC_HAS_BRANCH_ARG | CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
+              (vm_oc) | VM_OC_GET_BRANCH | VM_OC_BACKWARD_BRANCH) \
+  CBC_OPCODE (name ## _3, CBC_HAS_BRANCH_ARG | CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
+              (vm_oc) | VM_OC_GET_BRANCH | VM_OC_BACKWARD_BRANCH)
+
 #define CBC_BRANCH_OFFSET_LENGTH(opcode) \
   ((opcode) & 0x3)
 
@@ -258,6 +278,22 @@
               VM_OC_PUSH_NULL | VM_OC_PUT_STACK) \
   CBC_FORWARD_BRANCH (CBC_BLOCK_CREATE_CONTEXT, \
                       PARSER_BLOCK_CONTEXT_STACK_ALLOCATION, VM_OC_BLOCK_CREATE_CONTEXT) \
+  CBC_OPCODE (CBC_PUSH_UNDEFINED, CBC_NO_FLAG, 1, \
+              VM_OC_PUSH_UNDEFINED | VM_OC_PUT_STACK) \
+  CBC_BACKWARD_BRANCH_TWO_LITERALS (CBC_BRANCH_IF_LESS_TWO_LITERALS_BACKWARD, \
+                                    VM_OC_BRANCH_IF_LESS) \
+  CBC_OPCODE (CBC_PUSH_TRUE, CBC_NO_FLAG, 1, \
+              VM_OC_PUSH_TRUE | VM_OC_PUT_STACK) \
+  CBC_BACKWARD_BRANCH_TWO_LITERALS (CBC_BRANCH_IF_GREATER_TWO_LITERALS_BACKWARD, \
+                                    VM_OC_BRANCH_IF_GREATER) \
+  CBC_OPCODE (CBC_PUSH_FALSE, CBC_NO_FLAG, 1, \
+              VM_OC_PUSH_FALSE | VM_OC_PUT_STACK) \
+  CBC_BACKWARD_BRANCH_TWO_LITERALS (CBC_BRANCH_IF_LESS_EQUAL_TWO_LITERALS_BACKWARD, \
+                                    VM_OC_BRANCH_IF_LESS_EQUAL) \
+  CBC_OPCODE (CBC_PUSH_THIS, CBC_NO_FLAG, 1, \
+              VM_OC_PUSH_THIS | VM_OC_PUT_STACK) \
+  CBC_BACKWARD_BRANCH_TWO_LITERALS (CBC_BRANCH_IF_GREATER_EQUAL_TWO_LITERALS_BACKWARD, \
+                                    VM_OC_BRANCH_IF_GREATER_EQUAL) \
   \
   /* Basic opcodes. Note: These 4 opcodes must me in this order */ \
   CBC_OPCODE (CBC_PUSH_LITERAL, CBC_HAS_LITERAL_ARG, 1, \
@@ -268,14 +304,6 @@
               VM_OC_PUSH_TWO | VM_OC_GET_THIS_LITERAL) \
   CBC_OPCODE (CBC_PUSH_THREE_LITERALS, CBC_HAS_LITERAL_ARG2, 3, \
               VM_OC_PUSH_THREE | VM_OC_GET_LITERAL_LITERAL) \
-  CBC_OPCODE (CBC_PUSH_UNDEFINED, CBC_NO_FLAG, 1, \
-              VM_OC_PUSH_UNDEFINED | VM_OC_PUT_STACK) \
-  CBC_OPCODE (CBC_PUSH_TRUE, CBC_NO_FLAG, 1, \
-              VM_OC_PUSH_TRUE | VM_OC_PUT_STACK) \
-  CBC_OPCODE (CBC_PUSH_FALSE, CBC_NO_FLAG, 1, \
-              VM_OC_PUSH_FALSE | VM_OC_PUT_STACK) \
-  CBC_OPCODE (CBC_PUSH_THIS, CBC_NO_FLAG, 1, \
-              VM_OC_PUSH_THIS | VM_OC_PUT_STACK) \
   CBC_OPCODE (CBC_PUSH_NUMBER_0, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_0 | VM_OC_PUT_STACK) \
   CBC_OPCODE (CBC_PUSH_NUMBER_POS_BYTE, CBC_HAS_BYTE_ARG, 1, \
@@ -607,7 +635,7 @@
   CBC_OPCODE (CBC_EXT_GET_TAGGED_TEMPLATE_LITERAL, CBC_HAS_BYTE_ARG, 1, \
               VM_OC_GET_TEMPLATE_OBJECT | VM_OC_PUT_STACK) \
   CBC_OPCODE (CBC_EXT_LINE, CBC_NO_FLAG, 0, \
-              VM_OC_LINE) \
+              VM_OC_NONE) \
   CBC_OPCODE (CBC_EXT_THROW_REFERENCE_ERROR, CBC_NO_FLAG, 1, \
               VM_OC_THROW_REFERENCE_ERROR) \
   CBC_OPCODE (CBC_EXT_THROW_SYNTAX_ERROR, CBC_HAS_LITERAL_ARG, 1, \
@@ -797,6 +825,30 @@
   CBC_OPCODE (CBC_EXT_PUSH_NEW_TARGET, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_NEW_TARGET | VM_OC_PUT_STACK) \
   \
+  /* Binary opcodes with register result (same order as the binary opcodes). */ \
+  CBC_BINARY_MOV_IDENT_OPERATION (CBC_EXT_BIT_OR, \
+                                  BIT_OR) \
+  CBC_BINARY_MOV_IDENT_OPERATION (CBC_EXT_BIT_XOR, \
+                                  BIT_XOR) \
+  CBC_BINARY_MOV_IDENT_OPERATION (CBC_EXT_BIT_AND, \
+                                  BIT_AND) \
+  CBC_BINARY_MOV_IDENT_OPERATION (CBC_EXT_LEFT_SHIFT, \
+                                  LEFT_SHIFT) \
+  CBC_BINARY_MOV_IDENT_OPERATION (CBC_EXT_RIGHT_SHIFT, \
+                                  RIGHT_SHIFT) \
+  CBC_BINARY_MOV_IDENT_OPERATION (CBC_EXT_UNS_RIGHT_SHIFT, \
+                                  UNS_RIGHT_SHIFT) \
+  CBC_BINARY_MOV_IDENT_OPERATION (CBC_EXT_ADD, \
+                                  ADD) \
+  CBC_BINARY_MOV_IDENT_OPERATION (CBC_EXT_SUBTRACT, \
+                                  SUB) \
+  CBC_BINARY_MOV_IDENT_OPERATION (CBC_EXT_MULTIPLY, \
+                                  MUL) \
+  CBC_BINARY_MOV_IDENT_OPERATION (CBC_EXT_DIVIDE, \
+                                  DIV) \
+  CBC_BINARY_MOV_IDENT_OPERATION (CBC_EXT_MODULO, \
+                                  MOD) \
+  \
   /* Last opcode (not a real opcode). */ \
   CBC_OPCODE (CBC_EXT_END, CBC_NO_FLAG, 0, \
               VM_OC_NONE)
@@ -869,6 +921,32 @@ typedef struct
   uint16_t padding;                 /**< an unused value */
 } cbc_uint16_arguments_t;
 
+/**
+ * Compiled code of a function whose byte code is generated on its first call.
+ *
+ * The arguments header describes a function without registers and byte code,
+ * and the resource name is its only literal. The argument list and the body
+ * are parsed the same way as the arguments of the Function constructor.
+ *
+ * Note: the function name of the compiled code (if any) is stored after this structure
+ */
+typedef struct
+{
+  cbc_uint16_arguments_t header;    /**< arguments header */
+  ecma_value_t resource_name;       /**< resource name */
+  ecma_value_t compiled_code;       /**< compiled code after the first call (internal pointer, can be NULL) */
+  const uint8_t *source_p;          /**< start of the argument list in the source code passed to the parser
+                                     *   (not copied: the caller of jerry_parse keeps it alive, see
+                                     *   JERRY_PARSE_LAZY_FUNCTIONS) */
+  uint32_t arguments_size;          /**< size of the argument list */
+  uint32_t body_offset;             /**< offset of the function body from source_p */
+  uint32_t body_size;               /**< size of the function body */
+  uint32_t arguments_line;          /**< start line of the argument list */
+  uint32_t arguments_column;        /**< start column of the argument list */
+  uint32_t body_line;               /**< start line of the function body */
+  uint32_t body_column;             /**< start column of the function body */
+} cbc_lazy_function_t;
+
 /**
  * Compact byte code status flags.
  */
@@ -884,6 +962,9 @@ typedef enum
   CBC_CODE_FLAGS_STATIC_FUNCTION = (1u << 7), /**< this function is a static snapshot function */
   CBC_CODE_FLAGS_DEBUGGER_IGNORE = (1u << 8), /**< this function should be ignored by debugger */
   CBC_CODE_FLAGS_LEXICAL_BLOCK_NEEDED = (1u << 9), /**< compiled code needs a lexical block */
+  CBC_CODE_FLAGS_LAZY_FUNCTION = (1u << 10), /**< compiled code is a cbc_lazy_function_t which has no
+                                              *   byte code yet (see ECMA_PARSE_LAZY_FUNCTIONS) */
+  CBC_CODE_FLAGS_HAS_LINE_INFO = (1u << 11), /**< this function has a line info block (see ecma-line-info.c) */
 
   /* Bits from bit 12 is reserved for function types (see CBC_FUNCTION_TYPE_SHIFT).
    * Note: the last bits are used for type flags because < and >= operators can be used to
@@ -195,6 +195,7 @@ typedef enum
   LEXER_PROPERTY_GETTER,         /**< property getter function */
   LEXER_PROPERTY_SETTER,         /**< property setter function */
   LEXER_COMMA_SEP_LIST,          /**< comma separated bracketed expression list */
+  LEXER_ASSIGN_REGISTER,         /**< compound assignment of a register */
 #if ENABLED (JERRY_ESNEXT)
   LEXER_ASSIGN_GROUP_EXPR,       /**< indetifier for the assignment is located in a group expression */
   LEXER_ASSIGN_CONST,            /**< a const binding is reassigned */
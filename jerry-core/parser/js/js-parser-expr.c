@@ -115,12 +115,111 @@ JERRY_STATIC_ASSERT (sizeof (parser_binary_precedence_table) == 36,
                      parser_binary_precedence_table_should_have_36_values_in_es51);
 #endif /* ENABLED (JERRY_ESNEXT) */
 
+JERRY_STATIC_ASSERT (CBC_EXT_LEFT_SHIFT_MOV_IDENT == CBC_EXT_BIT_AND_TWO_LITERALS_MOV_IDENT + 1
+                     && (CBC_EXT_BIT_AND_TWO_LITERALS_MOV_IDENT - CBC_EXT_BIT_OR_MOV_IDENT
+                         == CBC_BIT_AND_TWO_LITERALS - CBC_BIT_OR)
+                     && (CBC_EXT_MODULO_TWO_LITERALS_MOV_IDENT - CBC_EXT_LEFT_SHIFT_MOV_IDENT
+                         == CBC_MODULO_TWO_LITERALS - CBC_LEFT_SHIFT),
+                     binary_mov_ident_opcodes_must_follow_the_order_of_binary_opcodes);
+
+/**
+ * Try to merge a binary operation and the assignment of its result to a register.
+ *
+ * @return true - if the two operations are merged, false - otherwise
+ */
+static bool
+parser_merge_binary_mov_ident (parser_context_t *context_p, /**< context */
+                               uint16_t literal_index) /**< register index */
+{
+  uint16_t opcode = context_p->last_cbc_opcode;
+
+  if (literal_index < PARSER_REGISTER_START)
+  {
+    return false;
+  }
+
+  if (opcode >= CBC_BIT_OR && opcode <= CBC_BIT_AND_TWO_LITERALS)
+  {
+    opcode = (uint16_t) (CBC_EXT_BIT_OR_MOV_IDENT + (opcode - CBC_BIT_OR));
+  }
+  else if (opcode >= CBC_LEFT_SHIFT && opcode <= CBC_MODULO_TWO_LITERALS)
+  {
+    opcode = (uint16_t) (CBC_EXT_LEFT_SHIFT_MOV_IDENT + (opcode - CBC_LEFT_SHIFT));
+  }
+  else
+  {
+    return false;
+  }
+
+  uint8_t flags = cbc_flags[context_p->last_cbc_opcode];
+
+  if (flags & CBC_HAS_LITERAL_ARG2)
+  {
+    context_p->last_cbc.third_literal_index = literal_index;
+  }
+  else if (flags & CBC_HAS_LITERAL_ARG)
+  {
+    context_p->last_cbc.value = literal_index;
+  }
+  else
+  {
+    context_p->last_cbc.literal_index = literal_index;
+  }
+
+  context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (opcode);
+  return true;
+} /* parser_merge_binary_mov_ident */
+
+/**
+ * Split a merged binary operation into the binary operation
+ * and the assignment of its result to a register.
+ */
+static void
+parser_split_binary_mov_ident (parser_context_t *context_p) /**< context */
+{
+  JERRY_ASSERT (PARSER_IS_BINARY_MOV_IDENT (context_p->last_cbc_opcode));
+
+  uint16_t opcode = (uint16_t) PARSER_GET_EXT_OPCODE (context_p->last_cbc_opcode);
+  uint8_t flags = cbc_ext_flags[opcode];
+  uint16_t literal_index;
+
+  if (opcode <= CBC_EXT_BIT_AND_TWO_LITERALS_MOV_IDENT)
+  {
+    opcode = (uint16_t) (CBC_BIT_OR + (opcode - CBC_EXT_BIT_OR_MOV_IDENT));
+  }
+  else
+  {
+    opcode = (uint16_t) (CBC_LEFT_SHIFT + (opcode - CBC_EXT_LEFT_SHIFT_MOV_IDENT));
+  }
+
+  if (!(flags & CBC_HAS_LITERAL_ARG))
+  {
+    literal_index = context_p->last_cbc.third_literal_index;
+  }
+  else if (flags & CBC_HAS_LITERAL_ARG2)
+  {
+    literal_index = context_p->last_cbc.value;
+  }
+  else
+  {
+    literal_index = context_p->last_cbc.literal_index;
+  }
+
+  context_p->last_cbc_opcode = opcode;
+  parser_emit_cbc_literal (context_p, CBC_ASSIGN_SET_IDENT, literal_index);
+} /* parser_split_binary_mov_ident */
+
 /**
  * Generate byte code for operators with lvalue.
  */
 static inline void
 parser_push_result (parser_context_t *context_p) /**< context */
 {
+  if (PARSER_IS_BINARY_MOV_IDENT (context_p->last_cbc_opcode))
+  {
+    parser_split_binary_mov_ident (context_p);
+  }
+
   if (CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode))
   {
     JERRY_ASSERT (CBC_SAME_ARGS (context_p->last_cbc_opcode, context_p->last_cbc_opcode + 1));
@@ -2960,14 +3059,49 @@ parser_append_binary_token (parser_context_t *context_p) /**< context */
     {
       parser_check_invalid_assign (context_p);
 
-      parser_emit_ident_reference (context_p, CBC_PUSH_IDENT_REFERENCE);
+      uint16_t literal_index;
+
+      switch (context_p->last_cbc_opcode)
+      {
+        case CBC_PUSH_TWO_LITERALS:
+        {
+          literal_index = context_p->last_cbc.value;
+          break;
+        }
+        case CBC_PUSH_THREE_LITERALS:
+        {
+          literal_index = context_p->last_cbc.third_literal_index;
+          break;
+        }
+        default:
+        {
+          literal_index = context_p->last_cbc.literal_index;
+          break;
+        }
+      }
 
+      if (literal_index >= PARSER_REGISTER_START
 #if ENABLED (JERRY_ESNEXT)
-      if (scanner_literal_is_const_reg (context_p, context_p->last_cbc.literal_index))
+          && !scanner_literal_is_const_reg (context_p, literal_index)
+#endif /* ENABLED (JERRY_ESNEXT) */
+          )
       {
-        parser_stack_push_uint8 (context_p, LEXER_ASSIGN_CONST);
+        /* The current value of the register is kept on the stack, and
+         * the result is assigned to the register by CBC_ASSIGN_SET_IDENT. */
+        parser_stack_push_uint16 (context_p, literal_index);
+        parser_stack_push_uint8 (context_p, LEXER_ASSIGN_REGISTER);
       }
+      else
+      {
+        parser_emit_ident_reference (context_p, CBC_PUSH_IDENT_REFERENCE);
+
+#if ENABLED (JERRY_ESNEXT)
+        if (scanner_literal_is_const_reg (context_p, context_p->last_cbc.literal_index))
+        {
+          parser_stack_push_uint8 (context_p, LEXER_ASSIGN_CONST);
+        }
 #endif /* ENABLED (JERRY_ESNEXT) */
+      }
     }
     else if (PARSER_IS_PUSH_PROP (context_p->last_cbc_opcode))
     {
@@ -3115,6 +3249,12 @@ parser_process_binary_opcodes (parser_context_t *context_p, /**< context */
           continue;
         }
 
+        if (opcode == CBC_ASSIGN_SET_IDENT
+            && parser_merge_binary_mov_ident (context_p, index))
+        {
+          continue;
+        }
+
         parser_emit_cbc_literal (context_p, (uint16_t) opcode, index);
 
         if (opcode == CBC_ASSIGN_PROP_THIS_LITERAL
@@ -3135,7 +3275,15 @@ parser_process_binary_opcodes (parser_context_t *context_p, /**< context */
     }
     else if (LEXER_IS_BINARY_LVALUE_OP_TOKEN (token))
     {
-      parser_stack_push_uint8 (context_p, CBC_ASSIGN);
+      opcode = CBC_ASSIGN;
+
+      if (context_p->stack_top_uint8 == LEXER_ASSIGN_REGISTER)
+      {
+        parser_stack_pop_uint8 (context_p);
+        opcode = CBC_ASSIGN_SET_IDENT;
+      }
+
+      parser_stack_push_uint8 (context_p, (uint8_t) opcode);
       parser_stack_push_uint8 (context_p, LEXER_ASSIGN);
       parser_stack_push_uint8 (context_p, lexer_convert_binary_lvalue_token_to_binary (token));
       continue;
@@ -3840,7 +3988,8 @@ parser_process_ternary_expression (parser_context_t *context_p) /**< context */
 static void
 parser_process_expression_sequence (parser_context_t *context_p) /**< context */
 {
-  if (!CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode))
+  if (!CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode)
+      && !PARSER_IS_BINARY_MOV_IDENT (context_p->last_cbc_opcode))
   {
     parser_emit_cbc (context_p, CBC_POP);
   }
@@ -3902,6 +4051,11 @@ parser_parse_block_expression (parser_context_t *context_p, /**< context */
 {
   parser_parse_expression (context_p, options | PARSE_EXPR_NO_PUSH_RESULT);
 
+  if (PARSER_IS_BINARY_MOV_IDENT (context_p->last_cbc_opcode))
+  {
+    parser_split_binary_mov_ident (context_p);
+  }
+
   if (CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode))
   {
     JERRY_ASSERT (CBC_SAME_ARGS (context_p->last_cbc_opcode, context_p->last_cbc_opcode + 2));
@@ -3923,7 +4077,8 @@ parser_parse_expression_statement (parser_context_t *context_p, /**< context */
 {
   parser_parse_expression (context_p, options | PARSE_EXPR_NO_PUSH_RESULT);
 
-  if (!CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode))
+  if (!CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode)
+      && !PARSER_IS_BINARY_MOV_IDENT (context_p->last_cbc_opcode))
   {
     parser_emit_cbc (context_p, CBC_POP);
   }
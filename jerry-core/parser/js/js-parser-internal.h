@@ -281,6 +281,10 @@ typedef struct
    || (opcode) == PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_LITERAL_PUSH_NUMBER_POS_BYTE) \
    || (opcode) == PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_LITERAL_PUSH_NUMBER_NEG_BYTE))
 
+#define PARSER_IS_BINARY_MOV_IDENT(opcode) \
+  ((opcode) >= PARSER_TO_EXT_OPCODE (CBC_EXT_BIT_OR_MOV_IDENT) \
+   && (opcode) <= PARSER_TO_EXT_OPCODE (CBC_EXT_MODULO_TWO_LITERALS_MOV_IDENT))
+
 #define PARSER_IS_MUTABLE_PUSH_LITERAL(opcode) \
   ((opcode) >= CBC_PUSH_LITERAL && (opcode) <= CBC_PUSH_THIS_LITERAL)
 
@@ -571,6 +575,8 @@ typedef struct
   scanner_info_t *active_scanner_info_p;      /**< currently active scanner info block */
   scanner_info_t *skipped_scanner_info_p;     /**< next scanner info block */
   scanner_info_t *skipped_scanner_info_end_p; /**< currently active scanner info block */
+  scanner_lazy_function_t *lazy_function_p;   /**< functions whose byte code generation can be delayed */
+  const cbc_lazy_function_t *lazy_compiled_code_p; /**< lazy function whose byte code is generated (can be NULL) */
 
   /* Compact byte code members. */
   cbc_argument_t last_cbc;                    /**< argument of the last cbc */
@@ -820,6 +826,9 @@ void scanner_release_switch_cases (scanner_case_info_t *case_p);
 void scanner_seek (parser_context_t *context_p);
 void scanner_reverse_info_list (parser_context_t *context_p);
 void scanner_cleanup (parser_context_t *context_p);
+void scanner_release_function (parser_context_t *context_p, const uint8_t *source_end_p);
+void scanner_release_lazy_functions (parser_context_t *context_p, const uint8_t *source_end_p);
+void scanner_set_start_position (parser_context_t *context_p, bool is_function_body);
 
 bool scanner_is_context_needed (parser_context_t *context_p, parser_check_context_type_t check_type);
 #if ENABLED (JERRY_ESNEXT)
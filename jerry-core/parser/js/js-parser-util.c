@@ -457,6 +457,9 @@ parser_emit_cbc_push_number (parser_context_t *context_p, /**< context */
 
 /**
  * Append a line info data
+ *
+ * Note: these instructions are removed from the final byte code by
+ *       the post processing, which stores them in the line info block
  */
 void
 parser_emit_line_info (parser_context_t *context_p, /**< context */
@@ -621,6 +624,44 @@ parser_emit_cbc_backward_branch (parser_context_t *context_p, /**< context */
   const char *name;
 #endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
 
+  if (opcode == CBC_BRANCH_IF_TRUE_BACKWARD)
+  {
+    /* A relation of two literals followed by a backward branch is merged into
+     * a single opcode, since this is the condition of most loops. */
+    switch (context_p->last_cbc_opcode)
+    {
+      case CBC_LESS_TWO_LITERALS:
+      {
+        opcode = CBC_BRANCH_IF_LESS_TWO_LITERALS_BACKWARD;
+        break;
+      }
+      case CBC_GREATER_TWO_LITERALS:
+      {
+        opcode = CBC_BRANCH_IF_GREATER_TWO_LITERALS_BACKWARD;
+        break;
+      }
+      case CBC_LESS_EQUAL_TWO_LITERALS:
+      {
+        opcode = CBC_BRANCH_IF_LESS_EQUAL_TWO_LITERALS_BACKWARD;
+        break;
+      }
+      case CBC_GREATER_EQUAL_TWO_LITERALS:
+      {
+        opcode = CBC_BRANCH_IF_GREATER_EQUAL_TWO_LITERALS_BACKWARD;
+        break;
+      }
+      default:
+      {
+        break;
+      }
+    }
+
+    if (opcode != CBC_BRANCH_IF_TRUE_BACKWARD)
+    {
+      context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+    }
+  }
+
   if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
   {
     parser_flush_cbc (context_p);
@@ -665,7 +706,15 @@ parser_emit_cbc_backward_branch (parser_context_t *context_p, /**< context */
 #if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
   if (context_p->is_show_opcodes)
   {
-    JERRY_DEBUG_MSG ("  [%3d] %s\n", (int) context_p->stack_depth, name);
+    JERRY_DEBUG_MSG ("  [%3d] %s", (int) context_p->stack_depth, name);
+
+    if (flags & CBC_HAS_LITERAL_ARG)
+    {
+      parser_print_literal (context_p, context_p->last_cbc.literal_index);
+      parser_print_literal (context_p, context_p->last_cbc.value);
+    }
+
+    JERRY_DEBUG_MSG ("\n");
   }
 #endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
 
@@ -699,6 +748,25 @@ parser_emit_cbc_backward_branch (parser_context_t *context_p, /**< context */
   }
 
   PARSER_APPEND_TO_BYTE_CODE (context_p, offset & 0xff);
+
+  if (flags & CBC_HAS_LITERAL_ARG)
+  {
+    /* The literal arguments are the arguments of the merged relation opcode. */
+    JERRY_ASSERT (flags & CBC_HAS_LITERAL_ARG2);
+
+    uint16_t literal_index = context_p->last_cbc.literal_index;
+
+    parser_emit_two_bytes (context_p,
+                           (uint8_t) (literal_index & 0xff),
+                           (uint8_t) (literal_index >> 8));
+
+    literal_index = context_p->last_cbc.value;
+
+    parser_emit_two_bytes (context_p,
+                           (uint8_t) (literal_index & 0xff),
+                           (uint8_t) (literal_index >> 8));
+    context_p->byte_code_size += 4;
+  }
 } /* parser_emit_cbc_backward_branch */
 
 #undef PARSER_CHECK_LAST_POSITION
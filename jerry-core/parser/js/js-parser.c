@@ -16,6 +16,7 @@
 #include "debugger.h"
 #include "ecma-exceptions.h"
 #include "ecma-helpers.h"
+#include "ecma-line-info.h"
 #include "ecma-literal-storage.h"
 #include "ecma-module.h"
 #include "jcontext.h"
@@ -770,24 +771,23 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
       flags = cbc_ext_flags[ext_opcode];
       JERRY_DEBUG_MSG (" %3d : %s", (int) cbc_offset, cbc_ext_names[ext_opcode]);
       byte_code_p += 2;
+    }
 
-#if ENABLED (JERRY_LINE_INFO)
-      if (ext_opcode == CBC_EXT_LINE)
-      {
-        uint32_t value = 0;
-        uint8_t byte;
-
-        do
-        {
-          byte = *byte_code_p++;
-          value = (value << 7) | (byte & CBC_LOWER_SEVEN_BIT_MASK);
-        }
-        while (byte & CBC_HIGHEST_BIT_MASK);
+    if (flags & CBC_HAS_BRANCH_ARG)
+    {
+      size_t branch_offset_length = (opcode != CBC_EXT_OPCODE ? CBC_BRANCH_OFFSET_LENGTH (opcode)
+                                                              : CBC_BRANCH_OFFSET_LENGTH (ext_opcode));
+      size_t offset = 0;
 
-        JERRY_DEBUG_MSG (" %d\n", (int) value);
-        continue;
+      do
+      {
+        offset = (offset << 8) | *byte_code_p++;
       }
-#endif /* ENABLED (JERRY_LINE_INFO) */
+      while (--branch_offset_length > 0);
+
+      JERRY_DEBUG_MSG (" offset:%d(->%d)",
+                       (int) offset,
+                       (int) (cbc_offset + (CBC_BRANCH_IS_FORWARD (flags) ? offset : -offset)));
     }
 
     if (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
@@ -831,23 +831,6 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
       byte_code_p++;
     }
 
-    if (flags & CBC_HAS_BRANCH_ARG)
-    {
-      size_t branch_offset_length = (opcode != CBC_EXT_OPCODE ? CBC_BRANCH_OFFSET_LENGTH (opcode)
-                                                              : CBC_BRANCH_OFFSET_LENGTH (ext_opcode));
-      size_t offset = 0;
-
-      do
-      {
-        offset = (offset << 8) | *byte_code_p++;
-      }
-      while (--branch_offset_length > 0);
-
-      JERRY_DEBUG_MSG (" offset:%d(->%d)",
-                       (int) offset,
-                       (int) (cbc_offset + (CBC_BRANCH_IS_FORWARD (flags) ? offset : -offset)));
-    }
-
     JERRY_DEBUG_MSG ("\n");
   }
 } /* parse_print_final_cbc */
@@ -959,6 +942,16 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   ecma_compiled_code_t *compiled_code_p;
   ecma_value_t *literal_pool_p;
   uint8_t *dst_p;
+#if ENABLED (JERRY_LINE_INFO)
+  uint32_t line_info_count = 0;
+  uint8_t *line_info_buffer_p = NULL;
+  uint8_t *line_info_end_p = NULL;
+  uint8_t *line_info_p = NULL;
+  uint32_t line_info_offset = 0;
+  uint32_t line_info_line = 0;
+  uint32_t line_info_last_offset = 0;
+  uint32_t line_info_last_line = 0;
+#endif /* ENABLED (JERRY_LINE_INFO) */
 
 #if ENABLED (JERRY_ESNEXT)
   if ((context_p->status_flags & (PARSER_IS_FUNCTION | PARSER_LEXICAL_BLOCK_NEEDED))
@@ -1086,16 +1079,18 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 #if ENABLED (JERRY_LINE_INFO)
         if (ext_opcode == CBC_EXT_LINE)
         {
+          /* Line info instructions are moved into the line info block. */
           uint8_t last_byte = 0;
 
           do
           {
             last_byte = page_p->bytes[offset];
             PARSER_NEXT_BYTE (page_p, offset);
-            length++;
           }
           while (last_byte & CBC_HIGHEST_BIT_MASK);
 
+          length -= 2;
+          line_info_count++;
           continue;
         }
 #endif /* ENABLED (JERRY_LINE_INFO) */
@@ -1127,6 +1122,52 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       }
     }
 
+    if (flags & CBC_HAS_BRANCH_ARG)
+    {
+      bool prefix_zero = true;
+
+      /* The leading zeroes are dropped from the stream.
+       * Although dropping these zeroes for backward
+       * branches are unnecessary, we use the same
+       * code path for simplicity. */
+      JERRY_ASSERT (branch_offset_length > 0 && branch_offset_length <= 3);
+
+      while (--branch_offset_length > 0)
+      {
+        uint8_t byte = page_p->bytes[offset];
+        if (byte > 0 || !prefix_zero)
+        {
+          prefix_zero = false;
+          length++;
+        }
+        else
+        {
+          JERRY_ASSERT (CBC_BRANCH_IS_FORWARD (flags));
+        }
+        PARSER_NEXT_BYTE (page_p, offset);
+      }
+
+      if (last_opcode == (cbc_opcode_t) (CBC_JUMP_FORWARD + PARSER_MAX_BRANCH_LENGTH - 1)
+          && prefix_zero
+          && page_p->bytes[offset] == PARSER_MAX_BRANCH_LENGTH + 1)
+      {
+        /* Uncoditional jumps which jump right after the instruction
+         * are effectively NOPs. These jumps are removed from the
+         * stream. The 1 byte long CBC_JUMP_FORWARD form marks these
+         * instructions, since this form is constructed during post
+         * processing and cannot be emitted directly. */
+        *opcode_p = CBC_JUMP_FORWARD;
+        length--;
+      }
+      else
+      {
+        /* Other last bytes are always copied. */
+        length++;
+      }
+
+      PARSER_NEXT_BYTE (page_p, offset);
+    }
+
     while (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
     {
       uint8_t *first_byte = page_p->bytes + offset;
@@ -1192,52 +1233,6 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       PARSER_NEXT_BYTE (page_p, offset);
       length++;
     }
-
-    if (flags & CBC_HAS_BRANCH_ARG)
-    {
-      bool prefix_zero = true;
-
-      /* The leading zeroes are dropped from the stream.
-       * Although dropping these zeroes for backward
-       * branches are unnecessary, we use the same
-       * code path for simplicity. */
-      JERRY_ASSERT (branch_offset_length > 0 && branch_offset_length <= 3);
-
-      while (--branch_offset_length > 0)
-      {
-        uint8_t byte = page_p->bytes[offset];
-        if (byte > 0 || !prefix_zero)
-        {
-          prefix_zero = false;
-          length++;
-        }
-        else
-        {
-          JERRY_ASSERT (CBC_BRANCH_IS_FORWARD (flags));
-        }
-        PARSER_NEXT_BYTE (page_p, offset);
-      }
-
-      if (last_opcode == (cbc_opcode_t) (CBC_JUMP_FORWARD + PARSER_MAX_BRANCH_LENGTH - 1)
-          && prefix_zero
-          && page_p->bytes[offset] == PARSER_MAX_BRANCH_LENGTH + 1)
-      {
-        /* Uncoditional jumps which jump right after the instruction
-         * are effectively NOPs. These jumps are removed from the
-         * stream. The 1 byte long CBC_JUMP_FORWARD form marks these
-         * instructions, since this form is constructed during post
-         * processing and cannot be emitted directly. */
-        *opcode_p = CBC_JUMP_FORWARD;
-        length--;
-      }
-      else
-      {
-        /* Other last bytes are always copied. */
-        length++;
-      }
-
-      PARSER_NEXT_BYTE (page_p, offset);
-    }
   }
 
   if (!(context_p->status_flags & PARSER_NO_END_LABEL)
@@ -1293,6 +1288,13 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   }
 #endif /* ENABLED (JERRY_ESNEXT) */
 
+#if ENABLED (JERRY_LINE_INFO)
+  if (line_info_count > 0)
+  {
+    total_size += sizeof (ecma_value_t);
+  }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
 #if ENABLED (JERRY_SNAPSHOT_SAVE)
   total_size_used = total_size;
 #endif /* ENABLED (JERRY_SNAPSHOT_SAVE) */
@@ -1312,6 +1314,16 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   jmem_stats_allocate_byte_code_bytes (total_size);
 #endif /* ENABLED (JERRY_MEM_STATS) */
 
+#if ENABLED (JERRY_LINE_INFO)
+  if (line_info_count > 0)
+  {
+    /* Line info is not essential, so it is omitted when the memory is low. */
+    line_info_buffer_p = (uint8_t *) jmem_heap_alloc_block_null_on_error (line_info_count
+                                                                          * ECMA_LINE_INFO_ENTRY_MAX_SIZE);
+    line_info_end_p = line_info_buffer_p;
+  }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
   byte_code_p = (uint8_t *) compiled_code_p;
   compiled_code_p->size = (uint16_t) (total_size >> JMEM_ALIGNMENT_LOG);
   compiled_code_p->refs = 1;
@@ -1468,6 +1480,53 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     opcode = (cbc_opcode_t) (*branch_mark_p);
     branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
 
+#if ENABLED (JERRY_LINE_INFO)
+    if (opcode == CBC_EXT_OPCODE)
+    {
+      uint8_t *ext_opcode_p = (offset + 1 < PARSER_CBC_STREAM_PAGE_SIZE ? branch_mark_p + 1
+                                                                          : page_p->next_p->bytes);
+
+      if (*ext_opcode_p == CBC_EXT_LINE)
+      {
+        /* These opcodes are deleted from the stream and their
+         * lines are recorded in the line info block instead. */
+        uint32_t line = 0;
+        uint8_t last_byte;
+
+        PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
+        PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
+
+        do
+        {
+          last_byte = page_p->bytes[offset];
+          line = (line << 7) | (last_byte & CBC_LOWER_SEVEN_BIT_MASK);
+          PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
+        }
+        while (last_byte & CBC_HIGHEST_BIT_MASK);
+
+        uint32_t current_offset = (uint32_t) (dst_p - byte_code_p);
+
+        /* The pending entry is dropped when it is followed by another entry with
+         * the same offset or when it does not change the line of the previous entry. */
+        if (current_offset != line_info_offset
+            && line_info_line != line_info_last_line
+            && line_info_end_p != NULL)
+        {
+          line_info_end_p = ecma_line_info_encode_entry (line_info_end_p,
+                                                         line_info_offset - line_info_last_offset,
+                                                         line_info_line,
+                                                         line_info_last_line);
+          line_info_last_offset = line_info_offset;
+          line_info_last_line = line_info_line;
+        }
+
+        line_info_offset = current_offset;
+        line_info_line = line;
+        continue;
+      }
+    }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
     if (opcode == CBC_JUMP_FORWARD)
     {
       /* These opcodes are deleted from the stream. */
@@ -1509,30 +1568,43 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       opcode_p++;
       real_offset++;
       PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
+    }
 
-#if ENABLED (JERRY_LINE_INFO)
-      if (ext_opcode == CBC_EXT_LINE)
-      {
-        uint8_t last_byte = 0;
+    /* Only literal and call arguments can be combined, and
+     * the branch argument precedes the literal arguments. */
+    JERRY_ASSERT (!(flags & CBC_HAS_BRANCH_ARG)
+                   || !(flags & CBC_HAS_BYTE_ARG));
 
-        do
-        {
-          last_byte = page_p->bytes[offset];
-          *dst_p++ = last_byte;
+    if (flags & CBC_HAS_BRANCH_ARG)
+    {
+      *branch_mark_p |= CBC_HIGHEST_BIT_MASK;
+      bool prefix_zero = true;
+
+      /* The leading zeroes are dropped from the stream. */
+      JERRY_ASSERT (branch_offset_length > 0 && branch_offset_length <= 3);
 
+      while (--branch_offset_length > 0)
+      {
+        uint8_t byte = page_p->bytes[offset];
+        if (byte > 0 || !prefix_zero)
+        {
+          prefix_zero = false;
+          *dst_p++ = page_p->bytes[offset];
           real_offset++;
-          PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
         }
-        while (last_byte & CBC_HIGHEST_BIT_MASK);
-
-        continue;
+        else
+        {
+          /* When a leading zero is dropped, the branch
+           * offset length must be decreased as well. */
+          (*opcode_p)--;
+        }
+        PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
       }
-#endif /* ENABLED (JERRY_LINE_INFO) */
-    }
 
-    /* Only literal and call arguments can be combined. */
-    JERRY_ASSERT (!(flags & CBC_HAS_BRANCH_ARG)
-                   || !(flags & (CBC_HAS_BYTE_ARG | CBC_HAS_LITERAL_ARG)));
+      *dst_p++ = page_p->bytes[offset];
+      real_offset++;
+      PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
+    }
 
     while (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
     {
@@ -1585,38 +1657,6 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
       continue;
     }
-
-    if (flags & CBC_HAS_BRANCH_ARG)
-    {
-      *branch_mark_p |= CBC_HIGHEST_BIT_MASK;
-      bool prefix_zero = true;
-
-      /* The leading zeroes are dropped from the stream. */
-      JERRY_ASSERT (branch_offset_length > 0 && branch_offset_length <= 3);
-
-      while (--branch_offset_length > 0)
-      {
-        uint8_t byte = page_p->bytes[offset];
-        if (byte > 0 || !prefix_zero)
-        {
-          prefix_zero = false;
-          *dst_p++ = page_p->bytes[offset];
-          real_offset++;
-        }
-        else
-        {
-          /* When a leading zero is dropped, the branch
-           * offset length must be decreased as well. */
-          (*opcode_p)--;
-        }
-        PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
-      }
-
-      *dst_p++ = page_p->bytes[offset];
-      real_offset++;
-      PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
-      continue;
-    }
   }
 
 #if ENABLED (JERRY_DEBUGGER)
@@ -1643,6 +1683,39 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   }
   JERRY_ASSERT (dst_p == byte_code_p + length);
 
+#if ENABLED (JERRY_LINE_INFO)
+  if (line_info_buffer_p != NULL)
+  {
+    if (line_info_line != line_info_last_line)
+    {
+      line_info_end_p = ecma_line_info_encode_entry (line_info_end_p,
+                                                     line_info_offset - line_info_last_offset,
+                                                     line_info_line,
+                                                     line_info_last_line);
+    }
+
+    uint32_t entries_size = (uint32_t) (line_info_end_p - line_info_buffer_p);
+    size_t line_info_size = ecma_line_info_get_block_size (entries_size);
+
+    if (entries_size > 0)
+    {
+      line_info_p = (uint8_t *) jmem_heap_alloc_block_null_on_error (line_info_size);
+    }
+
+    if (line_info_p != NULL)
+    {
+      uint8_t *entries_p = ecma_line_info_encode_value (line_info_p, entries_size);
+      memcpy (entries_p, line_info_buffer_p, entries_size);
+
+#if ENABLED (JERRY_MEM_STATS)
+      jmem_stats_allocate_byte_code_bytes (line_info_size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+    }
+
+    jmem_heap_free_block (line_info_buffer_p, line_info_count * ECMA_LINE_INFO_ENTRY_MAX_SIZE);
+  }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
   parse_update_branches (context_p, byte_code_p);
 
   parser_cbc_stream_free (&context_p->byte_code);
@@ -1724,10 +1797,23 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   if (context_p->tagged_template_literal_cp != JMEM_CP_NULL)
   {
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_HAS_TAGGED_LITERALS;
-    base_p[-1] = (ecma_value_t) context_p->tagged_template_literal_cp;
+    *(--base_p) = (ecma_value_t) context_p->tagged_template_literal_cp;
   }
 #endif /* ENABLED (JERRY_ESNEXT) */
 
+#if ENABLED (JERRY_LINE_INFO)
+  if (line_info_count > 0)
+  {
+    base_p[-1] = ECMA_VALUE_EMPTY;
+
+    if (line_info_p != NULL)
+    {
+      compiled_code_p->status_flags |= CBC_CODE_FLAGS_HAS_LINE_INFO;
+      ECMA_SET_INTERNAL_VALUE_POINTER (base_p[-1], line_info_p);
+    }
+  }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
 #if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
   if (context_p->is_show_opcodes)
   {
@@ -2163,6 +2249,8 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
                      size_t source_size, /**< size of the source code */
                      ecma_value_t resource_name, /**< resource name */
                      uint32_t parse_opts, /**< ecma_parse_opts_t option bits */
+                     const cbc_lazy_function_t *lazy_function_p, /**< lazy function whose byte code
+                                                                  *   is generated (can be NULL) */
                      parser_error_location_t *error_location_p) /**< error location */
 {
   parser_context_t context;
@@ -2220,6 +2308,8 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
   context.active_scanner_info_p = NULL;
   context.skipped_scanner_info_p = NULL;
   context.skipped_scanner_info_end_p = NULL;
+  context.lazy_function_p = NULL;
+  context.lazy_compiled_code_p = lazy_function_p;
 
   context.last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
 
@@ -2291,8 +2381,7 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
   }
 
   context.u.allocated_buffer_p = NULL;
-  context.line = 1;
-  context.column = 1;
+  scanner_set_start_position (&context, arg_list_p == NULL);
   context.token.flags = 0;
 
   parser_stack_init (&context);
@@ -2337,8 +2426,7 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
 
       context.source_p = source_p;
       context.source_end_p = source_p + source_size;
-      context.line = 1;
-      context.column = 1;
+      scanner_set_start_position (&context, true);
 
       lexer_next_token (&context);
     }
@@ -2436,6 +2524,8 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
   }
   PARSER_TRY_END
 
+  scanner_release_lazy_functions (&context, NULL);
+
   if (context.scope_stack_p != NULL)
   {
     parser_free (context.scope_stack_p, context.scope_stack_size * sizeof (parser_scope_stack_t));
@@ -2591,6 +2681,173 @@ parser_restore_context (parser_context_t *context_p, /**< context */
 #endif /* !JERRY_NDEBUG */
 } /* parser_restore_context */
 
+#if ENABLED (JERRY_ESNEXT)
+
+/**
+ * Status flags of functions whose byte code generation cannot be delayed.
+ */
+#define PARSER_NO_LAZY_FUNCTION \
+  (PARSER_IS_PROPERTY_GETTER | PARSER_IS_PROPERTY_SETTER | PARSER_INSIDE_WITH | PARSER_IS_ARROW_FUNCTION \
+   | PARSER_IS_GENERATOR_FUNCTION | PARSER_IS_ASYNC_FUNCTION | PARSER_CLASS_CONSTRUCTOR | PARSER_IS_METHOD)
+
+#else /* !ENABLED (JERRY_ESNEXT) */
+
+/**
+ * Status flags of functions whose byte code generation cannot be delayed.
+ */
+#define PARSER_NO_LAZY_FUNCTION \
+  (PARSER_IS_PROPERTY_GETTER | PARSER_IS_PROPERTY_SETTER | PARSER_INSIDE_WITH)
+
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+/**
+ * Skip the argument list and the body of a function whose byte code generation
+ * is delayed until its first call, and create a cbc_lazy_function_t for it.
+ *
+ * Note:
+ *      the current token must be the left parenthesis of the argument list
+ *
+ * @return compiled code - if the byte code generation of the function is delayed
+ *         NULL - otherwise
+ */
+static ecma_compiled_code_t *
+parser_create_lazy_function (parser_context_t *context_p) /**< context */
+{
+  const uint8_t *arguments_start_p = context_p->source_p;
+
+  JERRY_ASSERT (context_p->token.type == LEXER_LEFT_PAREN);
+
+  /* Functions which precede the current function were either parsed
+   * already, or were skipped together with their enclosing function. */
+  scanner_release_lazy_functions (context_p, arguments_start_p);
+
+  scanner_lazy_function_t *lazy_function_p = context_p->lazy_function_p;
+
+  if (lazy_function_p == NULL
+      || lazy_function_p->source_p != arguments_start_p
+      || (context_p->status_flags & PARSER_NO_LAZY_FUNCTION))
+  {
+    return NULL;
+  }
+
+  JERRY_ASSERT (context_p->next_scanner_info_p->source_p == arguments_start_p
+                && context_p->next_scanner_info_p->type == SCANNER_TYPE_FUNCTION);
+
+  uint16_t status_flags = (CBC_CODE_FLAGS_UINT16_ARGUMENTS
+                           | CBC_CODE_FLAGS_LAZY_FUNCTION
+                           | CBC_CODE_FLAGS_DEBUGGER_IGNORE
+                           | CBC_FUNCTION_TO_TYPE_BITS (CBC_FUNCTION_NORMAL));
+
+  if ((context_p->status_flags & PARSER_IS_STRICT)
+      || (context_p->next_scanner_info_p->u8_arg & SCANNER_FUNCTION_IS_STRICT))
+  {
+    status_flags |= CBC_CODE_FLAGS_STRICT_MODE;
+  }
+
+  /* The scanner has already checked that the argument list contains identifiers only. */
+  parser_line_counter_t arguments_line = context_p->line;
+  parser_line_counter_t arguments_column = context_p->column;
+  uint32_t argument_count = 0;
+
+  lexer_next_token (context_p);
+
+  while (context_p->token.type != LEXER_RIGHT_PAREN)
+  {
+    if (context_p->token.type == LEXER_EOS)
+    {
+      parser_raise_error (context_p, PARSER_ERR_RIGHT_PAREN_EXPECTED);
+    }
+
+    if (context_p->token.type != LEXER_COMMA)
+    {
+      argument_count++;
+    }
+
+    lexer_next_token (context_p);
+  }
+
+  if (argument_count >= PARSER_MAXIMUM_NUMBER_OF_REGISTERS)
+  {
+    parser_raise_error (context_p, PARSER_ERR_ARGUMENT_LIMIT_REACHED);
+  }
+
+  const uint8_t *arguments_end_p = context_p->source_p - 1;
+
+  lexer_next_token (context_p);
+
+  if (context_p->token.type != LEXER_LEFT_BRACE)
+  {
+    parser_raise_error (context_p, PARSER_ERR_LEFT_BRACE_EXPECTED);
+  }
+
+  const uint8_t *body_start_p = context_p->source_p;
+  parser_line_counter_t body_line = context_p->line;
+  parser_line_counter_t body_column = context_p->column;
+  scanner_location_t end_location = lazy_function_p->end_location;
+  const uint8_t *body_end_p = end_location.source_p;
+
+  scanner_release_function (context_p, body_end_p);
+
+  size_t total_size = sizeof (cbc_lazy_function_t);
+#if ENABLED (JERRY_ESNEXT)
+  total_size += sizeof (ecma_value_t);
+#endif /* ENABLED (JERRY_ESNEXT) */
+  total_size = JERRY_ALIGNUP (total_size, JMEM_ALIGNMENT);
+
+  cbc_lazy_function_t *compiled_code_p = (cbc_lazy_function_t *) parser_malloc (context_p, total_size);
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_allocate_byte_code_bytes (total_size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  memset (compiled_code_p, 0, total_size);
+
+  cbc_uint16_arguments_t *args_p = &compiled_code_p->header;
+  args_p->header.size = (uint16_t) (total_size >> JMEM_ALIGNMENT_LOG);
+  args_p->header.refs = 1;
+  args_p->header.status_flags = status_flags;
+  args_p->argument_end = (uint16_t) argument_count;
+  args_p->register_end = (uint16_t) argument_count;
+  args_p->ident_end = (uint16_t) argument_count;
+  args_p->const_literal_end = (uint16_t) argument_count;
+  args_p->literal_end = (uint16_t) argument_count;
+
+#if ENABLED (JERRY_RESOURCE_NAME)
+  /* The resource name is the only literal. */
+  args_p->const_literal_end++;
+  args_p->literal_end++;
+  compiled_code_p->resource_name = context_p->resource_name;
+#else /* !ENABLED (JERRY_RESOURCE_NAME) */
+  compiled_code_p->resource_name = ecma_make_magic_string_value (LIT_MAGIC_STRING_RESOURCE_ANON);
+#endif /* ENABLED (JERRY_RESOURCE_NAME) */
+
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (compiled_code_p->compiled_code, NULL);
+  compiled_code_p->source_p = arguments_start_p;
+  compiled_code_p->arguments_size = (uint32_t) (arguments_end_p - arguments_start_p);
+  compiled_code_p->body_offset = (uint32_t) (body_start_p - arguments_start_p);
+  compiled_code_p->body_size = (uint32_t) (body_end_p - body_start_p);
+  compiled_code_p->arguments_line = arguments_line;
+  compiled_code_p->arguments_column = arguments_column;
+  compiled_code_p->body_line = body_line;
+  compiled_code_p->body_column = body_column;
+
+#if ENABLED (JERRY_ESNEXT)
+  ecma_value_t *func_name_p = ecma_compiled_code_resolve_function_name ((ecma_compiled_code_t *) compiled_code_p);
+  *func_name_p = ECMA_VALUE_EMPTY;
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+  /* Continue parsing at the closing brace of the function body. */
+  scanner_set_location (context_p, &end_location);
+  lexer_next_token (context_p);
+
+  JERRY_ASSERT (context_p->token.type == LEXER_RIGHT_BRACE);
+
+  /* The functions nested into this function are dropped as well. */
+  scanner_release_lazy_functions (context_p, body_end_p);
+
+  return (ecma_compiled_code_t *) compiled_code_p;
+} /* parser_create_lazy_function */
+
 /**
  * Parse function code
  *
@@ -2637,6 +2894,25 @@ parser_parse_function (parser_context_t *context_p, /**< context */
     parser_raise_error (context_p, PARSER_ERR_ARGUMENT_LIST_EXPECTED);
   }
 
+  if (context_p->lazy_function_p != NULL)
+  {
+    compiled_code_p = parser_create_lazy_function (context_p);
+
+    if (compiled_code_p != NULL)
+    {
+#if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
+      if (context_p->is_show_opcodes)
+      {
+        JERRY_DEBUG_MSG ("  Byte code generation is delayed until the first call\n\n"
+                         "--- Function parsing end ---\n\n");
+      }
+#endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
+
+      parser_restore_context (context_p, &saved_context);
+      return compiled_code_p;
+    }
+  }
+
   lexer_next_token (context_p);
 
   parser_parse_function_arguments (context_p, LEXER_RIGHT_PAREN);
@@ -3127,6 +3403,129 @@ parser_raise_error (parser_context_t *context_p, /**< context */
   JERRY_ASSERT (0);
 } /* parser_raise_error */
 
+/**
+ * Raise the exception which corresponds to a parser error.
+ */
+static void
+parser_throw_error (const parser_error_location_t *error_location_p, /**< error location */
+                    ecma_value_t resource_name) /**< resource name */
+{
+  if (error_location_p->error == PARSER_ERR_OUT_OF_MEMORY)
+  {
+    /* It is unlikely that memory can be allocated in an out-of-memory
+     * situation. However, a simple value can still be thrown. */
+    jcontext_raise_exception (ECMA_VALUE_NULL);
+    return;
+  }
+
+#if ENABLED (JERRY_ERROR_MESSAGES)
+  ecma_string_t *err_str_p;
+
+#if !ENABLED (JERRY_ESNEXT)
+  if (error_location_p->error == PARSER_ERR_INVALID_REGEXP)
+  {
+    ecma_value_t error = jcontext_take_exception ();
+    ecma_property_t *prop_p = ecma_find_named_property (ecma_get_object_from_value (error),
+                                                        ecma_get_magic_string (LIT_MAGIC_STRING_MESSAGE));
+    ecma_free_value (error);
+    JERRY_ASSERT (prop_p);
+    err_str_p = ecma_get_string_from_value (ECMA_PROPERTY_VALUE_PTR (prop_p)->value);
+    ecma_ref_ecma_string (err_str_p);
+  }
+  else
+#endif /* !ENABLED (JERRY_ESNEXT) */
+  {
+    const lit_utf8_byte_t *err_bytes_p = (const lit_utf8_byte_t *) parser_error_to_string (error_location_p->error);
+    lit_utf8_size_t err_bytes_size = lit_zt_utf8_string_size (err_bytes_p);
+    err_str_p = ecma_new_ecma_string_from_utf8 (err_bytes_p, err_bytes_size);
+  }
+  ecma_value_t err_str_val = ecma_make_string_value (err_str_p);
+  ecma_value_t line_str_val = ecma_make_uint32_value (error_location_p->line);
+  ecma_value_t col_str_val = ecma_make_uint32_value (error_location_p->column);
+
+  ecma_raise_standard_error_with_format (ECMA_ERROR_SYNTAX,
+                                         "% [%:%:%]",
+                                         err_str_val,
+                                         resource_name,
+                                         line_str_val,
+                                         col_str_val);
+
+  ecma_free_value (col_str_val);
+  ecma_free_value (line_str_val);
+  ecma_deref_ecma_string (err_str_p);
+#else /* !ENABLED (JERRY_ERROR_MESSAGES) */
+  JERRY_UNUSED (resource_name);
+
+#if !ENABLED (JERRY_ESNEXT)
+  if (error_location_p->error != PARSER_ERR_INVALID_REGEXP)
+#endif /* !ENABLED (JERRY_ESNEXT) */
+  {
+    ecma_raise_syntax_error ("");
+  }
+#endif /* ENABLED (JERRY_ERROR_MESSAGES) */
+} /* parser_throw_error */
+
+/**
+ * Generate the byte code of a function whose byte code generation
+ * was delayed until its first call (see ECMA_PARSE_LAZY_FUNCTIONS).
+ *
+ * Note:
+ *      the compiled code is owned by the lazy function
+ *
+ * @return compiled code - if success
+ *         NULL - otherwise (an exception is raised)
+ */
+ecma_compiled_code_t *
+parser_compile_lazy_function (ecma_compiled_code_t *bytecode_p) /**< lazy function */
+{
+  JERRY_ASSERT (bytecode_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION);
+
+  cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) bytecode_p;
+  ecma_compiled_code_t *compiled_code_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_compiled_code_t,
+                                                                               lazy_function_p->compiled_code);
+
+  if (compiled_code_p != NULL)
+  {
+    return compiled_code_p;
+  }
+
+  const uint8_t *source_p = lazy_function_p->source_p;
+  uint32_t parse_opts = ECMA_PARSE_LAZY_FUNCTIONS;
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE)
+  {
+    parse_opts |= ECMA_PARSE_STRICT_MODE;
+  }
+
+#if ENABLED (JERRY_ESNEXT)
+  parse_opts |= ECMA_PARSE_ALLOW_NEW_TARGET;
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+  parser_error_location_t parser_error;
+
+  compiled_code_p = parser_parse_source (source_p,
+                                         lazy_function_p->arguments_size,
+                                         source_p + lazy_function_p->body_offset,
+                                         lazy_function_p->body_size,
+                                         lazy_function_p->resource_name,
+                                         parse_opts,
+                                         lazy_function_p,
+                                         &parser_error);
+
+  if (JERRY_UNLIKELY (compiled_code_p == NULL))
+  {
+    parser_throw_error (&parser_error, lazy_function_p->resource_name);
+    return NULL;
+  }
+
+#if ENABLED (JERRY_ESNEXT)
+  *ecma_compiled_code_resolve_function_name (compiled_code_p) = *ecma_compiled_code_resolve_function_name (bytecode_p);
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+  ECMA_SET_INTERNAL_VALUE_POINTER (lazy_function_p->compiled_code, compiled_code_p);
+  return compiled_code_p;
+} /* parser_compile_lazy_function */
+
 #endif /* ENABLED (JERRY_PARSER) */
 
 /**
@@ -3166,6 +3565,7 @@ parser_parse_script (const uint8_t *arg_list_p, /**< function argument list */
                                                           source_size,
                                                           resource_name,
                                                           parse_opts,
+                                                          NULL,
                                                           &parser_error);
 
   if (JERRY_UNLIKELY (bytecode_p == NULL))
@@ -3183,58 +3583,7 @@ parser_parse_script (const uint8_t *arg_list_p, /**< function argument list */
     }
 #endif /* ENABLED (JERRY_DEBUGGER) */
 
-    if (parser_error.error == PARSER_ERR_OUT_OF_MEMORY)
-    {
-      /* It is unlikely that memory can be allocated in an out-of-memory
-       * situation. However, a simple value can still be thrown. */
-      jcontext_raise_exception (ECMA_VALUE_NULL);
-      return NULL;
-    }
-
-#if ENABLED (JERRY_ERROR_MESSAGES)
-    ecma_string_t *err_str_p;
-
-#if !ENABLED (JERRY_ESNEXT)
-    if (parser_error.error == PARSER_ERR_INVALID_REGEXP)
-    {
-      ecma_value_t error = jcontext_take_exception ();
-      ecma_property_t *prop_p = ecma_find_named_property (ecma_get_object_from_value (error),
-                                                          ecma_get_magic_string (LIT_MAGIC_STRING_MESSAGE));
-      ecma_free_value (error);
-      JERRY_ASSERT (prop_p);
-      err_str_p = ecma_get_string_from_value (ECMA_PROPERTY_VALUE_PTR (prop_p)->value);
-      ecma_ref_ecma_string (err_str_p);
-    }
-    else
-#endif /* !ENABLED (JERRY_ESNEXT) */
-    {
-      const lit_utf8_byte_t *err_bytes_p = (const lit_utf8_byte_t *) parser_error_to_string (parser_error.error);
-      lit_utf8_size_t err_bytes_size = lit_zt_utf8_string_size (err_bytes_p);
-      err_str_p = ecma_new_ecma_string_from_utf8 (err_bytes_p, err_bytes_size);
-    }
-    ecma_value_t err_str_val = ecma_make_string_value (err_str_p);
-    ecma_value_t line_str_val = ecma_make_uint32_value (parser_error.line);
-    ecma_value_t col_str_val = ecma_make_uint32_value (parser_error.column);
-
-    ecma_raise_standard_error_with_format (ECMA_ERROR_SYNTAX,
-                                           "% [%:%:%]",
-                                           err_str_val,
-                                           resource_name,
-                                           line_str_val,
-                                           col_str_val);
-
-    ecma_free_value (col_str_val);
-    ecma_free_value (line_str_val);
-    ecma_deref_ecma_string (err_str_p);
-#else /* !ENABLED (JERRY_ERROR_MESSAGES) */
-#if !ENABLED (JERRY_ESNEXT)
-    if (parser_error.error != PARSER_ERR_INVALID_REGEXP)
-#endif /* !ENABLED (JERRY_ESNEXT) */
-    {
-      ecma_raise_syntax_error ("");
-    }
-#endif /* ENABLED (JERRY_ERROR_MESSAGES) */
-
+    parser_throw_error (&parser_error, resource_name);
     return NULL;
   }
 
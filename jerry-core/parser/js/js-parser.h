@@ -209,6 +209,10 @@ parser_parse_script (const uint8_t *arg_list_p,
                      ecma_value_t resource_name,
                      uint32_t parse_opts);
 
+#if ENABLED (JERRY_PARSER)
+ecma_compiled_code_t *parser_compile_lazy_function (ecma_compiled_code_t *bytecode_p);
+#endif /* ENABLED (JERRY_PARSER) */
+
 #if ENABLED (JERRY_ERROR_MESSAGES)
 const char *parser_error_to_string (parser_error_t);
 #endif /* ENABLED (JERRY_ERROR_MESSAGES) */
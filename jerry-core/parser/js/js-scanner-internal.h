@@ -402,6 +402,7 @@ scanner_info_t *scanner_insert_info_before (parser_context_t *context_p, const u
 scanner_literal_pool_t *scanner_push_literal_pool (parser_context_t *context_p, scanner_context_t *scanner_context_p,
                                                    uint16_t status_flags);
 void scanner_pop_literal_pool (parser_context_t *context_p, scanner_context_t *scanner_context_p);
+void scanner_add_lazy_function (parser_context_t *context_p, scanner_context_t *scanner_context_p);
 #if ENABLED (JERRY_ESNEXT)
 void scanner_filter_arguments (parser_context_t *context_p, scanner_context_t *scanner_context_p);
 void scanner_construct_global_block (parser_context_t *context_p, scanner_context_t *scanner_context_p);
@@ -1148,6 +1148,67 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
 
 #if ENABLED (JERRY_ESNEXT)
 
+/**
+ * Literal pool flags of functions whose byte code generation cannot be delayed.
+ */
+#define SCANNER_LITERAL_POOL_NO_LAZY_FUNCTION \
+  (SCANNER_LITERAL_POOL_IN_WITH | SCANNER_LITERAL_POOL_ARROW | SCANNER_LITERAL_POOL_GENERATOR \
+   | SCANNER_LITERAL_POOL_ASYNC | SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT | SCANNER_LITERAL_POOL_HAS_SUPER_REFERENCE)
+
+#else /* !ENABLED (JERRY_ESNEXT) */
+
+/**
+ * Literal pool flags of functions whose byte code generation cannot be delayed.
+ */
+#define SCANNER_LITERAL_POOL_NO_LAZY_FUNCTION SCANNER_LITERAL_POOL_IN_WITH
+
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+/**
+ * Record a function whose byte code generation can be delayed until its first call.
+ *
+ * Note:
+ *      must be called before the literal pool of the function is popped
+ */
+void
+scanner_add_lazy_function (parser_context_t *context_p, /**< context */
+                           scanner_context_t *scanner_context_p) /**< scanner context */
+{
+  scanner_literal_pool_t *literal_pool_p = scanner_context_p->active_literal_pool_p;
+
+  JERRY_ASSERT (context_p->token.type == LEXER_RIGHT_BRACE);
+  JERRY_ASSERT (literal_pool_p->status_flags & SCANNER_LITERAL_POOL_FUNCTION);
+
+  if (!(context_p->global_status_flags & ECMA_PARSE_LAZY_FUNCTIONS)
+      || (literal_pool_p->status_flags & SCANNER_LITERAL_POOL_NO_LAZY_FUNCTION)
+      || literal_pool_p->source_p == NULL)
+  {
+    return;
+  }
+
+  scanner_lazy_function_t *lazy_function_p;
+  lazy_function_p = (scanner_lazy_function_t *) scanner_malloc (context_p, sizeof (scanner_lazy_function_t));
+
+  lazy_function_p->source_p = literal_pool_p->source_p;
+  lazy_function_p->end_location.source_p = context_p->source_p - 1;
+  lazy_function_p->end_location.line = context_p->token.line;
+  lazy_function_p->end_location.column = context_p->token.column;
+
+  /* The list is sorted in descending order by the start position, since
+   * the nested functions are closed before their enclosing function. */
+  scanner_lazy_function_t **prev_p = &context_p->lazy_function_p;
+
+  while (*prev_p != NULL && (*prev_p)->source_p > lazy_function_p->source_p)
+  {
+    prev_p = &(*prev_p)->next_p;
+  }
+
+  lazy_function_p->next_p = *prev_p;
+  *prev_p = lazy_function_p;
+} /* scanner_add_lazy_function */
+
+#if ENABLED (JERRY_ESNEXT)
+
 /**
  * Filter out the arguments from a literal pool.
  */
@@ -1852,6 +1913,67 @@ scanner_reverse_info_list (parser_context_t *context_p) /**< context */
   context_p->next_scanner_info_p = last_scanner_info_p;
 } /* scanner_reverse_info_list */
 
+/**
+ * Release a scanner info block.
+ */
+static void
+scanner_free_info (scanner_info_t *info_p) /**< scanner info block */
+{
+  size_t size = sizeof (scanner_info_t);
+
+  switch (info_p->type)
+  {
+    case SCANNER_TYPE_FUNCTION:
+    case SCANNER_TYPE_BLOCK:
+    {
+      size = scanner_get_stream_size (info_p, sizeof (scanner_info_t));
+      break;
+    }
+    case SCANNER_TYPE_WHILE:
+    case SCANNER_TYPE_FOR_IN:
+#if ENABLED (JERRY_ESNEXT)
+    case SCANNER_TYPE_FOR_OF:
+#endif /* ENABLED (JERRY_ESNEXT) */
+    case SCANNER_TYPE_CASE:
+#if ENABLED (JERRY_ESNEXT)
+    case SCANNER_TYPE_INITIALIZER:
+    case SCANNER_TYPE_CLASS_FIELD_INITIALIZER_END:
+#endif /* ENABLED (JERRY_ESNEXT) */
+    {
+      size = sizeof (scanner_location_info_t);
+      break;
+    }
+    case SCANNER_TYPE_FOR:
+    {
+      size = sizeof (scanner_for_info_t);
+      break;
+    }
+    case SCANNER_TYPE_SWITCH:
+    {
+      scanner_release_switch_cases (((scanner_switch_info_t *) info_p)->case_p);
+      size = sizeof (scanner_switch_info_t);
+      break;
+    }
+    default:
+    {
+#if ENABLED (JERRY_ESNEXT)
+      JERRY_ASSERT (info_p->type == SCANNER_TYPE_END_ARGUMENTS
+                    || info_p->type == SCANNER_TYPE_LITERAL_FLAGS
+                    || info_p->type == SCANNER_TYPE_CLASS_CONSTRUCTOR
+                    || info_p->type == SCANNER_TYPE_LET_EXPRESSION
+                    || info_p->type == SCANNER_TYPE_ERR_REDECLARED
+                    || info_p->type == SCANNER_TYPE_ERR_ASYNC_FUNCTION
+                    || info_p->type == SCANNER_TYPE_EXPORT_MODULE_SPECIFIER);
+#else /* !ENABLED (JERRY_ESNEXT) */
+      JERRY_ASSERT (info_p->type == SCANNER_TYPE_END_ARGUMENTS);
+#endif /* ENABLED (JERRY_ESNEXT) */
+      break;
+    }
+  }
+
+  scanner_free (info_p, size);
+} /* scanner_free_info */
+
 /**
  * Release unused scanner info blocks.
  * This should happen only if an error is occured.
@@ -1872,64 +1994,13 @@ scanner_cleanup (parser_context_t *context_p) /**< context */
   {
     scanner_info_t *next_scanner_info_p = scanner_info_p->next_p;
 
-    size_t size = sizeof (scanner_info_t);
-
-    switch (scanner_info_p->type)
+    if (scanner_info_p->type == SCANNER_TYPE_END)
     {
-      case SCANNER_TYPE_END:
-      {
-        scanner_info_p = context_p->active_scanner_info_p;
-        continue;
-      }
-      case SCANNER_TYPE_FUNCTION:
-      case SCANNER_TYPE_BLOCK:
-      {
-        size = scanner_get_stream_size (scanner_info_p, sizeof (scanner_info_t));
-        break;
-      }
-      case SCANNER_TYPE_WHILE:
-      case SCANNER_TYPE_FOR_IN:
-#if ENABLED (JERRY_ESNEXT)
-      case SCANNER_TYPE_FOR_OF:
-#endif /* ENABLED (JERRY_ESNEXT) */
-      case SCANNER_TYPE_CASE:
-#if ENABLED (JERRY_ESNEXT)
-      case SCANNER_TYPE_INITIALIZER:
-      case SCANNER_TYPE_CLASS_FIELD_INITIALIZER_END:
-#endif /* ENABLED (JERRY_ESNEXT) */
-      {
-        size = sizeof (scanner_location_info_t);
-        break;
-      }
-      case SCANNER_TYPE_FOR:
-      {
-        size = sizeof (scanner_for_info_t);
-        break;
-      }
-      case SCANNER_TYPE_SWITCH:
-      {
-        scanner_release_switch_cases (((scanner_switch_info_t *) scanner_info_p)->case_p);
-        size = sizeof (scanner_switch_info_t);
-        break;
-      }
-      default:
-      {
-#if ENABLED (JERRY_ESNEXT)
-        JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS
-                      || scanner_info_p->type == SCANNER_TYPE_LITERAL_FLAGS
-                      || scanner_info_p->type == SCANNER_TYPE_CLASS_CONSTRUCTOR
-                      || scanner_info_p->type == SCANNER_TYPE_LET_EXPRESSION
-                      || scanner_info_p->type == SCANNER_TYPE_ERR_REDECLARED
-                      || scanner_info_p->type == SCANNER_TYPE_ERR_ASYNC_FUNCTION
-                      || scanner_info_p->type == SCANNER_TYPE_EXPORT_MODULE_SPECIFIER);
-#else /* !ENABLED (JERRY_ESNEXT) */
-        JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS);
-#endif /* ENABLED (JERRY_ESNEXT) */
-        break;
-      }
+      scanner_info_p = context_p->active_scanner_info_p;
+      continue;
     }
 
-    scanner_free (scanner_info_p, size);
+    scanner_free_info (scanner_info_p);
     scanner_info_p = next_scanner_info_p;
   }
 
@@ -1937,6 +2008,78 @@ scanner_cleanup (parser_context_t *context_p) /**< context */
   context_p->active_scanner_info_p = NULL;
 } /* scanner_cleanup */
 
+/**
+ * Release the scanner info blocks of a function whose byte code generation is delayed.
+ */
+void
+scanner_release_function (parser_context_t *context_p, /**< context */
+                          const uint8_t *source_end_p) /**< end of the function body */
+{
+  scanner_info_t *info_p = context_p->next_scanner_info_p;
+
+  JERRY_ASSERT (info_p->type == SCANNER_TYPE_FUNCTION);
+
+  do
+  {
+    scanner_info_t *next_info_p = info_p->next_p;
+    scanner_free_info (info_p);
+    info_p = next_info_p;
+  }
+  while (info_p->type != SCANNER_TYPE_END && info_p->source_p < source_end_p);
+
+  context_p->next_scanner_info_p = info_p;
+} /* scanner_release_function */
+
+/**
+ * Release the functions whose byte code generation can be delayed and
+ * start before the given source position (all functions if it is NULL).
+ */
+void
+scanner_release_lazy_functions (parser_context_t *context_p, /**< context */
+                                const uint8_t *source_end_p) /**< end position (can be NULL) */
+{
+  scanner_lazy_function_t *lazy_function_p = context_p->lazy_function_p;
+
+  while (lazy_function_p != NULL
+         && (source_end_p == NULL || lazy_function_p->source_p < source_end_p))
+  {
+    scanner_lazy_function_t *next_p = lazy_function_p->next_p;
+    scanner_free (lazy_function_p, sizeof (scanner_lazy_function_t));
+    lazy_function_p = next_p;
+  }
+
+  context_p->lazy_function_p = lazy_function_p;
+} /* scanner_release_lazy_functions */
+
+/**
+ * Set the line and column of the first character of the source code.
+ *
+ * Note:
+ *      the source code of lazy functions does not start at the beginning of a line
+ */
+void
+scanner_set_start_position (parser_context_t *context_p, /**< context */
+                            bool is_function_body) /**< function body or argument list */
+{
+  const cbc_lazy_function_t *lazy_function_p = context_p->lazy_compiled_code_p;
+
+  if (JERRY_LIKELY (lazy_function_p == NULL))
+  {
+    context_p->line = 1;
+    context_p->column = 1;
+  }
+  else if (is_function_body)
+  {
+    context_p->line = (parser_line_counter_t) lazy_function_p->body_line;
+    context_p->column = (parser_line_counter_t) lazy_function_p->body_column;
+  }
+  else
+  {
+    context_p->line = (parser_line_counter_t) lazy_function_p->arguments_line;
+    context_p->column = (parser_line_counter_t) lazy_function_p->arguments_column;
+  }
+} /* scanner_set_start_position */
+
 /**
  * Checks whether a context needs to be created for a block.
  *
@@ -2108,6 +2108,11 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
           break;
         }
 
+        if (context_p->stack_top_uint8 == SCAN_STACK_FUNCTION_STATEMENT)
+        {
+          scanner_add_lazy_function (context_p, scanner_context_p);
+        }
+
 #if ENABLED (JERRY_ESNEXT)
         if (context_p->stack_top_uint8 != SCAN_STACK_CLASS_STATEMENT)
         {
@@ -2141,6 +2146,12 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
         {
           scanner_context_p->mode = SCAN_MODE_PRIMARY_EXPRESSION_END;
         }
+        else
+        {
+          scanner_add_lazy_function (context_p, scanner_context_p);
+        }
+#else /* !ENABLED (JERRY_ESNEXT) */
+        scanner_add_lazy_function (context_p, scanner_context_p);
 #endif /* ENABLED (JERRY_ESNEXT) */
 
         scanner_pop_literal_pool (context_p, scanner_context_p);
@@ -2482,8 +2493,7 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 
   PARSER_TRY (context_p->try_buffer)
   {
-    context_p->line = 1;
-    context_p->column = 1;
+    scanner_set_start_position (context_p, arg_list_p == NULL);
 
     if (arg_list_p == NULL)
     {
@@ -3085,8 +3095,7 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
             context_p->next_scanner_info_p = scanner_info_p;
             context_p->source_p = source_p;
             context_p->source_end_p = source_end_p;
-            context_p->line = 1;
-            context_p->column = 1;
+            scanner_set_start_position (context_p, true);
 
 #if ENABLED (JERRY_ESNEXT)
             scanner_filter_arguments (context_p, &scanner_context);
@@ -3478,6 +3487,7 @@ scan_completed:
         scanner_free (literal_pool_p, sizeof (scanner_literal_pool_t));
       }
 
+      scanner_release_lazy_functions (context_p, NULL);
       parser_stack_free (context_p);
       return;
     }
@@ -3490,6 +3500,18 @@ scan_completed:
 #endif /* ENABLED (JERRY_ESNEXT) */
   scanner_reverse_info_list (context_p);
 
+  /* The parser processes the lazy functions in ascending order. */
+  scanner_lazy_function_t *lazy_function_p = context_p->lazy_function_p;
+  context_p->lazy_function_p = NULL;
+
+  while (lazy_function_p != NULL)
+  {
+    scanner_lazy_function_t *next_p = lazy_function_p->next_p;
+    lazy_function_p->next_p = context_p->lazy_function_p;
+    context_p->lazy_function_p = lazy_function_p;
+    lazy_function_p = next_p;
+  }
+
 #if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
   if (context_p->is_show_opcodes)
   {
@@ -124,6 +124,16 @@ typedef struct
   scanner_case_info_t *case_p; /**< list of switch cases */
 } scanner_switch_info_t;
 
+/**
+ * Function whose byte code generation can be delayed until its first call.
+ */
+typedef struct scanner_lazy_function_t
+{
+  struct scanner_lazy_function_t *next_p; /**< next lazy function */
+  const uint8_t *source_p; /**< start of the argument list (same as the source_p of its function info) */
+  scanner_location_t end_location; /**< location of the closing brace of the function body */
+} scanner_lazy_function_t;
+
 /*
  * Description of compressed streams.
  *
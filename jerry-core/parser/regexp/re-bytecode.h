@@ -32,9 +32,9 @@
  */
 
 /**
-  * Size of the RegExp bytecode cache
-  */
-#define RE_CACHE_SIZE 8u
+ * Maximum number of entries in the RegExp bytecode cache
+ */
+#define RE_CACHE_MAX_SIZE 1024u
 
 /**
  * Maximum value that can be encoded in the RegExp bytecode as a single byte.
@@ -100,6 +100,17 @@ typedef struct
   ecma_value_t source;               /**< original RegExp pattern */
 } re_compiled_code_t;
 
+/**
+ * Entry of the RegExp bytecode cache
+ */
+typedef struct
+{
+  re_compiled_code_t *bytecode_p; /**< cached bytecode */
+  uint32_t hash; /**< hash of the pattern and the flags */
+  uint32_t last_use; /**< value of the cache clock when the entry was last used */
+  uint16_t next_index; /**< index + 1 of the next entry in the same bucket, 0 if there is no next entry */
+} re_cache_entry_t;
+
 void re_initialize_regexp_bytecode (re_compiler_ctx_t *re_ctx_p);
 uint32_t re_bytecode_size (re_compiler_ctx_t *re_ctx_p);
 
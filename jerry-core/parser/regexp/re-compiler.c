@@ -37,6 +37,70 @@
  * @{
  */
 
+/**
+ * Get the number of buckets of a RegExp cache.
+ *
+ * @return number of buckets (always a power of 2)
+ */
+static uint32_t
+re_cache_get_bucket_count (uint32_t cache_size) /**< maximum number of entries */
+{
+  uint32_t bucket_count = 1;
+
+  while (bucket_count < cache_size)
+  {
+    bucket_count <<= 1;
+  }
+
+  return bucket_count;
+} /* re_cache_get_bucket_count */
+
+/**
+ * Get the allocation size of a RegExp cache. The bucket list is stored after the entries.
+ *
+ * @return allocation size
+ */
+static size_t
+re_cache_get_alloc_size (uint32_t cache_size) /**< maximum number of entries */
+{
+  return (cache_size * sizeof (re_cache_entry_t)
+          + re_cache_get_bucket_count (cache_size) * sizeof (uint16_t));
+} /* re_cache_get_alloc_size */
+
+/**
+ * Compute the cache hash of a pattern and flags pair.
+ *
+ * @return hash value
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+re_cache_hash (ecma_string_t *pattern_str_p, /**< pattern string */
+               uint16_t flags) /**< flags */
+{
+  return (uint32_t) ecma_string_hash (pattern_str_p) ^ flags;
+} /* re_cache_hash */
+
+/**
+ * Mark a RegExp cache entry as the most recently used one.
+ */
+static void
+re_cache_touch (re_cache_entry_t *entry_p) /**< cache entry */
+{
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (re_cache_clock) == UINT32_MAX))
+  {
+    /* The order of the entries is forgotten when the clock overflows. */
+    re_cache_entry_t *entries_p = JERRY_CONTEXT (re_cache_p);
+
+    for (uint32_t i = 0; i < JERRY_CONTEXT (re_cache_count); i++)
+    {
+      entries_p[i].last_use = 0;
+    }
+
+    JERRY_CONTEXT (re_cache_clock) = 0;
+  }
+
+  entry_p->last_use = ++JERRY_CONTEXT (re_cache_clock);
+} /* re_cache_touch */
+
 /**
  * Search for the given pattern in the RegExp cache.
  *
@@ -45,55 +109,153 @@
  */
 static re_compiled_code_t *
 re_cache_lookup (ecma_string_t *pattern_str_p, /**< pattern string */
-                 uint16_t flags) /**< flags */
+                 uint16_t flags, /**< flags */
+                 uint32_t hash) /**< hash of the pattern and flags */
 {
-  re_compiled_code_t **cache_p = JERRY_CONTEXT (re_cache);
+  re_cache_entry_t *entries_p = JERRY_CONTEXT (re_cache_p);
 
-  for (uint8_t idx = 0u; idx < RE_CACHE_SIZE; idx++)
+  if (entries_p == NULL)
   {
-    re_compiled_code_t *cached_bytecode_p = cache_p[idx];
+    return NULL;
+  }
 
-    if (cached_bytecode_p == NULL)
-    {
-      break;
-    }
+  uint32_t cache_size = JERRY_CONTEXT (re_cache_size);
+  uint16_t *buckets_p = (uint16_t *) (entries_p + cache_size);
+  uint32_t index = buckets_p[hash & (re_cache_get_bucket_count (cache_size) - 1)];
 
-    ecma_string_t *cached_pattern_str_p = ecma_get_string_from_value (cached_bytecode_p->source);
+  while (index != 0)
+  {
+    re_cache_entry_t *entry_p = entries_p + index - 1;
+    re_compiled_code_t *cached_bytecode_p = entry_p->bytecode_p;
 
-    if (cached_bytecode_p->header.status_flags == flags
-        && ecma_compare_ecma_strings (cached_pattern_str_p, pattern_str_p))
+    if (entry_p->hash == hash
+        && cached_bytecode_p->header.status_flags == flags
+        && ecma_compare_ecma_strings (ecma_get_string_from_value (cached_bytecode_p->source), pattern_str_p))
     {
+      re_cache_touch (entry_p);
       return cached_bytecode_p;
     }
+
+    index = entry_p->next_index;
   }
 
   return NULL;
 } /* re_cache_lookup */
 
 /**
- * Run garbage collection in RegExp cache.
+ * Insert a bytecode into the RegExp cache. When the cache is full,
+ * the least recently used entry is evicted.
  */
-void
-re_cache_gc (void)
+static void
+re_cache_insert (re_compiled_code_t *bytecode_p, /**< bytecode */
+                 uint32_t hash) /**< hash of the pattern and flags */
 {
-  re_compiled_code_t **cache_p = JERRY_CONTEXT (re_cache);
+  uint32_t cache_size = JERRY_CONTEXT (re_cache_size);
+
+  if (cache_size == 0)
+  {
+    return;
+  }
+
+  uint32_t bucket_count = re_cache_get_bucket_count (cache_size);
+  re_cache_entry_t *entries_p = JERRY_CONTEXT (re_cache_p);
 
-  for (uint32_t i = 0u; i < RE_CACHE_SIZE; i++)
+  if (entries_p == NULL)
   {
-    const re_compiled_code_t *cached_bytecode_p = cache_p[i];
+    entries_p = (re_cache_entry_t *) jmem_heap_alloc_block_null_on_error (re_cache_get_alloc_size (cache_size));
 
-    if (cached_bytecode_p == NULL)
+    if (entries_p == NULL)
     {
-      break;
+      return;
     }
 
-    ecma_bytecode_deref ((ecma_compiled_code_t *) cached_bytecode_p);
-    cache_p[i] = NULL;
+    memset (entries_p + cache_size, 0, bucket_count * sizeof (uint16_t));
+    JERRY_CONTEXT (re_cache_p) = entries_p;
   }
 
-  JERRY_CONTEXT (re_cache_idx) = 0;
+  uint16_t *buckets_p = (uint16_t *) (entries_p + cache_size);
+  uint32_t bucket_mask = bucket_count - 1;
+  re_cache_entry_t *entry_p;
+
+  if (JERRY_CONTEXT (re_cache_count) < cache_size)
+  {
+    entry_p = entries_p + JERRY_CONTEXT (re_cache_count);
+    JERRY_CONTEXT (re_cache_count)++;
+  }
+  else
+  {
+    entry_p = entries_p;
+
+    for (uint32_t i = 1; i < cache_size; i++)
+    {
+      if (entries_p[i].last_use < entry_p->last_use)
+      {
+        entry_p = entries_p + i;
+      }
+    }
+
+    uint16_t evicted_index = (uint16_t) (entry_p - entries_p + 1);
+    uint16_t *index_p = buckets_p + (entry_p->hash & bucket_mask);
+
+    while (*index_p != evicted_index)
+    {
+      JERRY_ASSERT (*index_p != 0);
+      index_p = &entries_p[*index_p - 1].next_index;
+    }
+
+    *index_p = entry_p->next_index;
+    ecma_bytecode_deref ((ecma_compiled_code_t *) entry_p->bytecode_p);
+  }
+
+  ecma_bytecode_ref ((ecma_compiled_code_t *) bytecode_p);
+
+  uint16_t *bucket_p = buckets_p + (hash & bucket_mask);
+
+  entry_p->bytecode_p = bytecode_p;
+  entry_p->hash = hash;
+  entry_p->next_index = *bucket_p;
+  *bucket_p = (uint16_t) (entry_p - entries_p + 1);
+
+  re_cache_touch (entry_p);
+} /* re_cache_insert */
+
+/**
+ * Run garbage collection in RegExp cache.
+ */
+void
+re_cache_gc (void)
+{
+  re_cache_entry_t *entries_p = JERRY_CONTEXT (re_cache_p);
+
+  if (entries_p == NULL)
+  {
+    return;
+  }
+
+  for (uint32_t i = 0; i < JERRY_CONTEXT (re_cache_count); i++)
+  {
+    ecma_bytecode_deref ((ecma_compiled_code_t *) entries_p[i].bytecode_p);
+  }
+
+  jmem_heap_free_block (entries_p, re_cache_get_alloc_size (JERRY_CONTEXT (re_cache_size)));
+
+  JERRY_CONTEXT (re_cache_p) = NULL;
+  JERRY_CONTEXT (re_cache_count) = 0;
+  JERRY_CONTEXT (re_cache_clock) = 0;
 } /* re_cache_gc */
 
+/**
+ * Change the maximum number of entries of the RegExp cache. The cache is emptied.
+ */
+void
+re_cache_set_size (uint32_t cache_size) /**< maximum number of entries */
+{
+  JERRY_ASSERT (cache_size <= RE_CACHE_MAX_SIZE);
+
+  re_cache_gc ();
+  JERRY_CONTEXT (re_cache_size) = cache_size;
+} /* re_cache_set_size */
+
 /**
  * Compilation of RegExp bytecode
  *
@@ -104,14 +266,18 @@ re_compiled_code_t *
 re_compile_bytecode (ecma_string_t *pattern_str_p, /**< pattern */
                      uint16_t flags) /**< flags */
 {
-  re_compiled_code_t *cached_bytecode_p = re_cache_lookup (pattern_str_p, flags);
+  uint32_t hash = re_cache_hash (pattern_str_p, flags);
+  re_compiled_code_t *cached_bytecode_p = re_cache_lookup (pattern_str_p, flags, hash);
 
   if (cached_bytecode_p != NULL)
   {
+    JERRY_CONTEXT (re_cache_hits)++;
     ecma_bytecode_ref ((ecma_compiled_code_t *) cached_bytecode_p);
     return cached_bytecode_p;
   }
 
+  JERRY_CONTEXT (re_cache_misses)++;
+
   re_compiler_ctx_t re_ctx;
   re_ctx.flags = flags;
   re_ctx.captures_count = 1;
@@ -144,8 +310,7 @@ re_compile_bytecode (ecma_string_t *pattern_str_p, /**< pattern */
                                                                                            re_ctx.bytecode_size,
                                                                                            final_size);
 
-  /* Bytecoded will be inserted into the cache and returned to the caller, so refcount is implicitly set to 2. */
-  re_compiled_code_p->header.refs = 2;
+  re_compiled_code_p->header.refs = 1;
   re_compiled_code_p->header.size = (uint16_t) (final_size >> JMEM_ALIGNMENT_LOG);
   re_compiled_code_p->header.status_flags = re_ctx.flags;
 
@@ -161,15 +326,7 @@ re_compile_bytecode (ecma_string_t *pattern_str_p, /**< pattern */
   }
 #endif /* ENABLED (JERRY_REGEXP_DUMP_BYTE_CODE) */
 
-  uint8_t cache_idx = JERRY_CONTEXT (re_cache_idx);
-
-  if (JERRY_CONTEXT (re_cache)[cache_idx] != NULL)
-  {
-    ecma_bytecode_deref ((ecma_compiled_code_t *) JERRY_CONTEXT (re_cache)[cache_idx]);
-  }
-
-  JERRY_CONTEXT (re_cache)[cache_idx] = re_compiled_code_p;
-  JERRY_CONTEXT (re_cache_idx) = (uint8_t) (cache_idx + 1) % RE_CACHE_SIZE;
+  re_cache_insert (re_compiled_code_p, hash);
 
   return re_compiled_code_p;
 } /* re_compile_bytecode */
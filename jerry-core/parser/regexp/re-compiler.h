@@ -35,6 +35,7 @@ re_compiled_code_t *
 re_compile_bytecode (ecma_string_t *pattern_str_p, uint16_t flags);
 
 void re_cache_gc (void);
+void re_cache_set_size (uint32_t cache_size);
 
 /**
  * @}
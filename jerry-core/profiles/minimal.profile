@@ -1,3 +1,5 @@
 JERRY_BUILTINS=0
 JERRY_ESNEXT=0
 JERRY_UNICODE_CASE_CONVERSION=0
+JERRY_LITERAL_HASHMAP=0
+JERRY_VM_COMPUTED_GOTO=0
@@ -24,10 +24,12 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-iterator-object.h"
+#include "ecma-lcache.h"
 #include "ecma-lex-env.h"
 #include "ecma-objects.h"
 #include "ecma-promise-object.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 #include "opcodes.h"
 #include "vm-defines.h"
@@ -129,6 +131,31 @@ opfunc_set_data_property (ecma_object_t *object_p, /**< object */
 {
   JERRY_ASSERT (!ecma_op_object_is_fast_array (object_p));
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    ecma_property_t shape_property;
+    ecma_property_value_t *value_p = ecma_shape_find_property (object_p, prop_name_p, &shape_property);
+
+    if (value_p == NULL)
+    {
+      value_p = ecma_create_named_data_property (object_p,
+                                                 prop_name_p,
+                                                 ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
+                                                 NULL);
+      ecma_named_data_property_assign_value (object_p, value_p, value);
+      return;
+    }
+
+    if ((shape_property & ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE)
+        == ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE)
+    {
+      ecma_named_data_property_assign_value (object_p, value_p, value);
+      return;
+    }
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
   ecma_property_t *property_p = ecma_find_named_property (object_p, prop_name_p);
   ecma_property_value_t *prop_value_p;
 
@@ -601,6 +628,7 @@ opfunc_append_array (ecma_value_t *stack_top_p, /**< current stack top */
       {
         filled_holes++;
 
+        ecma_gc_write_barrier (array_obj_p, stack_top_p[i]);
         ecma_deref_if_object (stack_top_p[i]);
       }
     }
@@ -713,11 +741,15 @@ opfunc_create_executable_object (vm_frame_ctx_t *frame_ctx_p, /**< frame context
   *new_frame_ctx_p = *frame_ctx_p;
   new_frame_ctx_p->shared_p = new_shared_p;
 
-  /* The old register values are discarded. */
+  /* The frame is copied only once: the executable object is resumed by running
+   * the byte code on this copy. Only the registers and the used part of the
+   * stack are copied, the old register values are discarded. */
   ecma_value_t *new_registers_p = VM_GET_REGISTERS (new_frame_ctx_p);
-  memcpy (new_registers_p, VM_GET_REGISTERS (frame_ctx_p), size);
-
   size_t stack_top = (size_t) (frame_ctx_p->stack_top_p - VM_GET_REGISTERS (frame_ctx_p));
+
+  JERRY_ASSERT (stack_top * sizeof (ecma_value_t) <= size);
+  memcpy (new_registers_p, VM_GET_REGISTERS (frame_ctx_p), stack_top * sizeof (ecma_value_t));
+
   ecma_value_t *new_stack_top_p = new_registers_p + stack_top;
 
   new_frame_ctx_p->stack_top_p = new_stack_top_p;
@@ -1180,6 +1212,9 @@ ecma_op_implicit_constructor_handler_heritage_cb (const ecma_value_t function_ob
       {
         ECMA_SET_POINTER (ecma_get_object_from_value (result)->u2.prototype_cp,
                           ecma_get_object_from_value (proto_value));
+#if ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0
+        ecma_lcache_proto_invalidate_all ();
+#endif /* ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
       }
 
       ecma_value_t fields_value = opfunc_init_class_fields (function_obj, result);
@@ -1250,6 +1285,8 @@ opfunc_set_home_object (ecma_object_t *func_p, /**< function object */
   {
     JERRY_ASSERT (!ecma_get_object_is_builtin (func_p));
 
+    /* The methods are not referenced, they are found through the properties of the class. */
+    ecma_gc_write_barrier (func_p, ecma_make_object_value (parent_env_p));
     ECMA_SET_NON_NULL_POINTER_TAG (((ecma_extended_object_t *) func_p)->u.function.scope_cp, parent_env_p, 0);
   }
 } /* opfunc_set_home_object */
@@ -1408,6 +1445,13 @@ static void
 opfunc_set_class_attributes (ecma_object_t *obj_p, /**< object */
                              ecma_object_t *parent_env_p) /**< parent environment */
 {
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ECMA_OBJECT_HAS_SHAPE (obj_p))
+  {
+    ecma_shape_convert_to_property_list (obj_p, NULL);
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
   jmem_cpointer_t prop_iter_cp = obj_p->u1.property_list_cp;
 
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
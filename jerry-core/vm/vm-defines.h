@@ -49,6 +49,10 @@ typedef enum
   VM_FRAME_CTX_SHARED_HERITAGE_PRESENT = (1 << 5),    /**< class heritage present */
   VM_FRAME_CTX_SHARED_HAS_CLASS_FIELDS = (1 << 6),    /**< has class fields */
 #endif /* ENABLED (JERRY_ESNEXT) */
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+  VM_FRAME_CTX_SHARED_CALL_FRAME = (1 << 7),          /**< frame is a vm_call_frame_t which returns
+                                                       *   to the frame of the caller */
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
 } vm_frame_ctx_shared_flags_t;
 
 /**
@@ -102,6 +106,63 @@ typedef enum
   VM_FRAME_CTX_IS_STRICT = (1 << 2),                  /**< strict mode */
 } vm_frame_ctx_flags_t;
 
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+
+/**
+ * Number of hash buckets of the inline cache tables (must be a power of 2).
+ */
+#define VM_INLINE_CACHE_BUCKETS 64
+
+/**
+ * Initial number of entries of an inline cache table (must be a power of 2).
+ */
+#define VM_INLINE_CACHE_INITIAL_SIZE 8
+
+/**
+ * Position of the inline cache entries which do not describe an own data property.
+ */
+#define VM_INLINE_CACHE_NOT_FOUND UINT16_MAX
+
+/**
+ * Inline cache entry of a named property access.
+ */
+typedef struct
+{
+  uint32_t offset;                                    /**< offset of the instruction in the byte code
+                                                       *   plus one, 0 for unused entries */
+  uint32_t epoch;                                     /**< value of vm_inline_cache_epoch when the
+                                                       *   object or shape of the entry is stored */
+  jmem_cpointer_t object_cp;                          /**< last object whose property is found */
+  jmem_cpointer_t pair_cp;                            /**< property pair of the last object which
+                                                       *   contains the property */
+  uint16_t position;                                  /**< index of the property pair multiplied by two,
+                                                       *   plus the index of the property in the pair */
+  uint16_t skip_count;                                /**< number of lookups skipped when the
+                                                       *   position is VM_INLINE_CACHE_NOT_FOUND */
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  jmem_cpointer_t shape_cp;                           /**< shape of the object, JMEM_CP_NULL if
+                                                       *   the object has a property pair list */
+  jmem_cpointer_t name_cp;                            /**< name of the property when the object
+                                                       *   has a shape (kept alive by the shape) */
+  ecma_property_t property;                           /**< type and flags of the property when
+                                                       *   the object has a shape */
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+} vm_inline_cache_entry_t;
+
+/**
+ * Inline cache entries of the instructions of a compiled code.
+ */
+typedef struct vm_inline_cache_table_t
+{
+  struct vm_inline_cache_table_t *next_p;             /**< next table in the same hash bucket */
+  const ecma_compiled_code_t *bytecode_p;             /**< compiled code of the instructions */
+  vm_inline_cache_entry_t *entries_p;                 /**< open addressed hash table of the entries */
+  uint32_t size;                                      /**< number of entries (power of 2) */
+  uint32_t count;                                     /**< number of used entries */
+} vm_inline_cache_table_t;
+
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
+
 /**
  * Context of interpreter, related to a JS stack frame
  */
@@ -116,12 +177,13 @@ typedef struct vm_frame_ctx_t
   struct vm_frame_ctx_t *prev_context_p;              /**< previous context */
   ecma_value_t this_binding;                          /**< this binding */
   ecma_value_t block_result;                          /**< block result */
-#if ENABLED (JERRY_LINE_INFO)
-  uint32_t current_line;                              /**< currently executed line */
-#endif /* ENABLED (JERRY_LINE_INFO) */
   uint16_t context_depth;                             /**< current context depth */
   uint8_t status_flags;                               /**< combination of vm_frame_ctx_flags_t bits */
   uint8_t call_operation;                             /**< perform a call or construct operation */
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+  vm_inline_cache_table_t *inline_cache_p;            /**< inline cache table of the byte code,
+                                                       *   NULL until the first property access */
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
   /* Registers start immediately after the frame context. */
 } vm_frame_ctx_t;
 
@@ -151,6 +213,55 @@ typedef struct
   vm_frame_ctx_t frame_ctx; /**< frame context part */
 } vm_executable_object_t;
 
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+
+/**
+ * Minimum size of a frame stack segment.
+ */
+#define VM_FRAME_SEGMENT_SIZE 4096
+
+/**
+ * Segment of the frame stack allocated on the engine heap.
+ *
+ * The frames are allocated in LIFO order right after the header.
+ */
+typedef struct vm_frame_segment_t
+{
+  struct vm_frame_segment_t *prev_p; /**< previous segment */
+  uint32_t size; /**< size of the segment including the header */
+  uint32_t top; /**< offset of the first free byte */
+} vm_frame_segment_t;
+
+/**
+ * Number of object references kept free for the frame of a call: the calls are
+ * stopped when the reference counter of an object held by a call exceeds the
+ * maximum minus this value.
+ */
+#define VM_CALL_FRAME_REF_RESERVE 32
+
+/**
+ * Frame of a function called by the byte code, which is executed
+ * by the vm_execute of the caller instead of a recursive vm_run.
+ */
+typedef struct
+{
+  vm_frame_ctx_shared_args_t shared_args; /**< shared part */
+  ecma_object_t *lex_env_p; /**< lexical environment of the function */
+#if ENABLED (JERRY_ESNEXT)
+  ecma_object_t *old_new_target_p; /**< new.target of the caller */
+#endif /* ENABLED (JERRY_ESNEXT) */
+  uint32_t size; /**< size of the call frame including the registers and the stack */
+  vm_frame_ctx_t frame_ctx; /**< frame context part */
+} vm_call_frame_t;
+
+/**
+ * Get the call frame of a frame context.
+ */
+#define VM_GET_CALL_FRAME(frame_ctx_p) \
+  ((vm_call_frame_t *) ((uintptr_t) (frame_ctx_p) - (uintptr_t) offsetof (vm_call_frame_t, frame_ctx)))
+
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
+
 /**
  * @}
  * @}
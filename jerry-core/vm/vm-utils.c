@@ -15,6 +15,7 @@
 
 #include "ecma-array-object.h"
 #include "ecma-helpers.h"
+#include "ecma-line-info.h"
 #include "jcontext.h"
 #include "lit-char-helpers.h"
 #include "vm.h"
@@ -51,6 +52,123 @@ vm_is_direct_eval_form_call (void)
   return (JERRY_CONTEXT (status_flags) & ECMA_STATUS_DIRECT_EVAL) != 0;
 } /* vm_is_direct_eval_form_call */
 
+#if ENABLED (JERRY_LINE_INFO)
+
+/**
+ * Get the line of the instruction which is executed by a frame.
+ *
+ * @return line number - if available
+ *         0 - otherwise
+ */
+static uint32_t
+vm_get_current_line (const vm_frame_ctx_t *context_p) /**< frame context */
+{
+  const ecma_compiled_code_t *bytecode_header_p = context_p->shared_p->bytecode_header_p;
+
+  if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_HAS_LINE_INFO))
+  {
+    return 0;
+  }
+
+  const uint8_t *byte_code_end_p = (const uint8_t *) bytecode_header_p;
+  byte_code_end_p += ((size_t) bytecode_header_p->size) << JMEM_ALIGNMENT_LOG;
+  const uint8_t *byte_code_p = context_p->byte_code_p;
+  uint32_t offset = 0;
+
+  /* The byte code pointer refers to a static byte code sequence when a call throws an error. */
+  if (byte_code_p < context_p->byte_code_start_p || byte_code_p >= byte_code_end_p)
+  {
+    byte_code_p = JERRY_CONTEXT (vm_exception_byte_code_p);
+  }
+
+  if (byte_code_p >= context_p->byte_code_start_p && byte_code_p < byte_code_end_p)
+  {
+    offset = (uint32_t) (byte_code_p - context_p->byte_code_start_p);
+  }
+
+  return ecma_line_info_get_line (ecma_compiled_code_get_line_info (bytecode_header_p), offset);
+} /* vm_get_current_line */
+
+/**
+ * Create the backtrace entry of a frame.
+ *
+ * @return position of the frame in "resource:line" form
+ */
+static ecma_string_t *
+vm_get_backtrace_entry (const vm_frame_ctx_t *context_p) /**< frame context */
+{
+  ecma_value_t resource_name = ecma_get_resource_name (context_p->shared_p->bytecode_header_p);
+  ecma_string_t *str_p = ecma_get_string_from_value (resource_name);
+  ecma_stringbuilder_t builder = ecma_stringbuilder_create ();
+
+  if (ecma_string_is_empty (str_p))
+  {
+    ecma_stringbuilder_append_raw (&builder, (const lit_utf8_byte_t *)"<unknown>:", 10);
+  }
+  else
+  {
+    ecma_stringbuilder_append (&builder, str_p);
+    ecma_stringbuilder_append_byte (&builder, LIT_CHAR_COLON);
+  }
+
+  ecma_string_t *line_str_p = ecma_new_ecma_string_from_uint32 (vm_get_current_line (context_p));
+  ecma_stringbuilder_append (&builder, line_str_p);
+  ecma_deref_ecma_string (line_str_p);
+
+  return ecma_stringbuilder_finalize (&builder);
+} /* vm_get_backtrace_entry */
+
+/**
+ * Update the first backtrace entry of an error raised while the frame executed an instruction.
+ *
+ * The frames do not save their position before each instruction, so the backtrace of an error
+ * raised by an instruction refers to the last call of the frame. The position is corrected when
+ * the error reaches the error completion of the frame.
+ */
+void
+vm_update_backtrace (const vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  ecma_object_t *error_obj_p = JERRY_CONTEXT (vm_backtrace_error_p);
+  JERRY_CONTEXT (vm_backtrace_error_p) = NULL;
+
+  if (jcontext_has_pending_abort ()
+      || JERRY_CONTEXT (error_value) != ecma_make_object_value (error_obj_p))
+  {
+    return;
+  }
+
+  /* The "stack" identifier is not a magic string. */
+  ecma_string_t *stack_str_p = ecma_new_ecma_string_from_utf8 ((const lit_utf8_byte_t *) "stack", 5);
+  ecma_property_t *property_p = ecma_find_named_property (error_obj_p, stack_str_p);
+  ecma_deref_ecma_string (stack_str_p);
+
+  if (property_p == NULL || ECMA_PROPERTY_GET_TYPE (*property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA)
+  {
+    return;
+  }
+
+  ecma_value_t backtrace_value = ECMA_PROPERTY_VALUE_PTR (property_p)->value;
+
+  if (!ecma_is_value_object (backtrace_value))
+  {
+    return;
+  }
+
+  ecma_object_t *array_p = ecma_get_object_from_value (backtrace_value);
+
+  if (!ecma_op_object_is_fast_array (array_p)
+      || ((ecma_extended_object_t *) array_p)->u.array.length == 0)
+  {
+    return;
+  }
+
+  ecma_string_t *entry_str_p = vm_get_backtrace_entry (frame_ctx_p);
+  ecma_fast_array_set_property (array_p, 0, ecma_make_string_value (entry_str_p));
+  ecma_deref_ecma_string (entry_str_p);
+} /* vm_update_backtrace */
+
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
 /**
  * Get backtrace. The backtrace is an array of strings where
  * each string contains the position of the corresponding frame.
@@ -74,25 +192,7 @@ vm_get_backtrace (uint32_t max_depth) /**< maximum backtrace depth, 0 = unlimite
 
   while (context_p != NULL)
   {
-    ecma_value_t resource_name = ecma_get_resource_name (context_p->shared_p->bytecode_header_p);
-    ecma_string_t *str_p = ecma_get_string_from_value (resource_name);
-    ecma_stringbuilder_t builder = ecma_stringbuilder_create ();
-
-    if (ecma_string_is_empty (str_p))
-    {
-      ecma_stringbuilder_append_raw (&builder, (const lit_utf8_byte_t *)"<unknown>:", 10);
-    }
-    else
-    {
-      ecma_stringbuilder_append (&builder, str_p);
-      ecma_stringbuilder_append_byte (&builder, LIT_CHAR_COLON);
-    }
-
-    ecma_string_t *line_str_p = ecma_new_ecma_string_from_uint32 (context_p->current_line);
-    ecma_stringbuilder_append (&builder, line_str_p);
-    ecma_deref_ecma_string (line_str_p);
-
-    ecma_string_t *builder_str_p = ecma_stringbuilder_finalize (&builder);
+    ecma_string_t *builder_str_p = vm_get_backtrace_entry (context_p);
     ecma_fast_array_set_property (array_p, index, ecma_make_string_value (builder_str_p));
     ecma_deref_ecma_string (builder_str_p);
 
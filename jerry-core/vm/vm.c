@@ -34,6 +34,7 @@
 #include "ecma-objects-general.h"
 #include "ecma-promise-object.h"
 #include "ecma-regexp-object.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 #include "opcodes.h"
 #include "vm.h"
@@ -46,6 +47,454 @@
  * @{
  */
 
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+
+/**
+ * Number of lookups skipped by an inline cache entry after
+ * the property is not found as an own data property.
+ */
+#define VM_INLINE_CACHE_SKIP_COUNT 16
+
+/**
+ * Get the hash bucket of the inline cache table of a compiled code.
+ */
+#define VM_INLINE_CACHE_GET_BUCKET(bytecode_p) \
+  (JERRY_CONTEXT (vm_inline_cache_tables) \
+   + ((((uintptr_t) (bytecode_p)) >> JMEM_ALIGNMENT_LOG) & (VM_INLINE_CACHE_BUCKETS - 1)))
+
+/**
+ * Get the inline cache table of a compiled code, and create it if it does not exist.
+ *
+ * @return pointer to the table - if the instructions of the compiled code can be cached
+ *         NULL - otherwise
+ */
+static vm_inline_cache_table_t *
+vm_inline_cache_get_table (const ecma_compiled_code_t *bytecode_p) /**< compiled code */
+{
+  /* Static snapshot functions are never freed, and their instructions may continue in other buffers. */
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION)
+  {
+    return NULL;
+  }
+
+  vm_inline_cache_table_t *table_p = *VM_INLINE_CACHE_GET_BUCKET (bytecode_p);
+
+  while (table_p != NULL)
+  {
+    if (table_p->bytecode_p == bytecode_p)
+    {
+      return table_p;
+    }
+
+    table_p = table_p->next_p;
+  }
+
+  const size_t entries_size = VM_INLINE_CACHE_INITIAL_SIZE * sizeof (vm_inline_cache_entry_t);
+  table_p = (vm_inline_cache_table_t *) jmem_heap_alloc_block_null_on_error (sizeof (vm_inline_cache_table_t));
+
+  if (JERRY_UNLIKELY (table_p == NULL))
+  {
+    return NULL;
+  }
+
+  vm_inline_cache_entry_t *entries_p = (vm_inline_cache_entry_t *) jmem_heap_alloc_block_null_on_error (entries_size);
+
+  if (JERRY_UNLIKELY (entries_p == NULL))
+  {
+    jmem_heap_free_block (table_p, sizeof (vm_inline_cache_table_t));
+    return NULL;
+  }
+
+  memset (entries_p, 0, entries_size);
+
+  /* The allocations above may free other tables of the same bucket. */
+  vm_inline_cache_table_t **bucket_p = VM_INLINE_CACHE_GET_BUCKET (bytecode_p);
+
+  table_p->next_p = *bucket_p;
+  table_p->bytecode_p = bytecode_p;
+  table_p->entries_p = entries_p;
+  table_p->size = VM_INLINE_CACHE_INITIAL_SIZE;
+  table_p->count = 0;
+  *bucket_p = table_p;
+  return table_p;
+} /* vm_inline_cache_get_table */
+
+/**
+ * Double the number of entries of an inline cache table.
+ *
+ * @return true - if the table is resized
+ *         false - otherwise
+ */
+static bool
+vm_inline_cache_grow_table (vm_inline_cache_table_t *table_p) /**< inline cache table */
+{
+  uint32_t new_size = table_p->size * 2;
+  size_t entries_size = new_size * sizeof (vm_inline_cache_entry_t);
+  vm_inline_cache_entry_t *entries_p = (vm_inline_cache_entry_t *) jmem_heap_alloc_block_null_on_error (entries_size);
+
+  if (JERRY_UNLIKELY (entries_p == NULL))
+  {
+    return false;
+  }
+
+  memset (entries_p, 0, entries_size);
+
+  uint32_t mask = new_size - 1;
+
+  for (uint32_t i = 0; i < table_p->size; i++)
+  {
+    vm_inline_cache_entry_t *entry_p = table_p->entries_p + i;
+
+    if (entry_p->offset != 0)
+    {
+      uint32_t index = entry_p->offset & mask;
+
+      while (entries_p[index].offset != 0)
+      {
+        index = (index + 1) & mask;
+      }
+
+      entries_p[index] = *entry_p;
+    }
+  }
+
+  jmem_heap_free_block (table_p->entries_p, table_p->size * sizeof (vm_inline_cache_entry_t));
+  table_p->entries_p = entries_p;
+  table_p->size = new_size;
+  return true;
+} /* vm_inline_cache_grow_table */
+
+/**
+ * Get the inline cache entry of an instruction, and create it if it does not exist.
+ *
+ * @return pointer to the entry - if the instruction can be cached
+ *         NULL - otherwise
+ */
+static vm_inline_cache_entry_t *
+vm_inline_cache_get_entry (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                           const uint8_t *byte_code_p) /**< instruction which accesses the property */
+{
+  vm_inline_cache_table_t *table_p = frame_ctx_p->inline_cache_p;
+
+  if (JERRY_UNLIKELY (table_p == NULL))
+  {
+    table_p = vm_inline_cache_get_table (frame_ctx_p->shared_p->bytecode_header_p);
+
+    if (table_p == NULL)
+    {
+      return NULL;
+    }
+
+    frame_ctx_p->inline_cache_p = table_p;
+  }
+
+  uint32_t offset = (uint32_t) (byte_code_p - frame_ctx_p->byte_code_start_p) + 1;
+  uint32_t mask = table_p->size - 1;
+  uint32_t index = offset & mask;
+
+  while (table_p->entries_p[index].offset != offset)
+  {
+    if (table_p->entries_p[index].offset == 0)
+    {
+      /* The table is kept at most three quarters full. */
+      if ((table_p->count + 1) * 4 > table_p->size * 3)
+      {
+        if (!vm_inline_cache_grow_table (table_p))
+        {
+          return NULL;
+        }
+
+        mask = table_p->size - 1;
+        index = offset & mask;
+
+        while (table_p->entries_p[index].offset != 0)
+        {
+          index = (index + 1) & mask;
+        }
+      }
+
+      vm_inline_cache_entry_t *entry_p = table_p->entries_p + index;
+
+      entry_p->offset = offset;
+      entry_p->object_cp = JMEM_CP_NULL;
+      entry_p->position = VM_INLINE_CACHE_NOT_FOUND;
+      entry_p->skip_count = 0;
+#if ENABLED (JERRY_OBJECT_SHAPES)
+      entry_p->shape_cp = JMEM_CP_NULL;
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+      table_p->count++;
+      return entry_p;
+    }
+
+    index = (index + 1) & mask;
+  }
+
+  return table_p->entries_p + index;
+} /* vm_inline_cache_get_entry */
+
+/**
+ * Free the inline cache table of a compiled code.
+ */
+void
+vm_inline_cache_free_table (const ecma_compiled_code_t *bytecode_p) /**< compiled code */
+{
+  vm_inline_cache_table_t **table_p_p = VM_INLINE_CACHE_GET_BUCKET (bytecode_p);
+
+  while (*table_p_p != NULL)
+  {
+    vm_inline_cache_table_t *table_p = *table_p_p;
+
+    if (table_p->bytecode_p == bytecode_p)
+    {
+      *table_p_p = table_p->next_p;
+      jmem_heap_free_block (table_p->entries_p, table_p->size * sizeof (vm_inline_cache_entry_t));
+      jmem_heap_free_block (table_p, sizeof (vm_inline_cache_table_t));
+      return;
+    }
+
+    table_p_p = &table_p->next_p;
+  }
+} /* vm_inline_cache_free_table */
+
+/**
+ * Invalidate the objects and shapes stored in the inline cache entries.
+ *
+ * Note:
+ *   must be called before a freed property pair or shape can be reused
+ */
+void
+vm_inline_cache_invalidate_all (void)
+{
+  if (JERRY_LIKELY (++JERRY_CONTEXT (vm_inline_cache_epoch) != 0))
+  {
+    return;
+  }
+
+  /* The old entries must not match after the epoch is wrapped around. */
+  for (uint32_t i = 0; i < VM_INLINE_CACHE_BUCKETS; i++)
+  {
+    for (vm_inline_cache_table_t *table_p = JERRY_CONTEXT (vm_inline_cache_tables)[i];
+         table_p != NULL;
+         table_p = table_p->next_p)
+    {
+      for (uint32_t j = 0; j < table_p->size; j++)
+      {
+        table_p->entries_p[j].object_cp = JMEM_CP_NULL;
+#if ENABLED (JERRY_OBJECT_SHAPES)
+        table_p->entries_p[j].shape_cp = JMEM_CP_NULL;
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+      }
+    }
+  }
+} /* vm_inline_cache_invalidate_all */
+
+/**
+ * Find an own data property using the inline cache of an instruction.
+ *
+ * Each instruction has its own entry in the inline cache table of its compiled code.
+ * The entry stores the property pair of the last object, so the next access of the
+ * same object reads the pair directly. Objects created by the same code have the same
+ * property layout, so the property of other objects is first searched at the cached
+ * position of their property lists. The name of the property is always compared, so
+ * the entries only need to be invalidated when property pairs or shapes are freed.
+ * When the object has a shape, the position is valid for all objects with the same shape.
+ *
+ * @return pointer to the property value - if the property is an own data property of an ordinary object
+ *         NULL - otherwise
+ */
+static ecma_property_value_t *
+vm_inline_cache_find (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                      const uint8_t *byte_code_p, /**< instruction which accesses the property */
+                      ecma_value_t object, /**< base object */
+                      ecma_value_t property, /**< property name */
+                      ecma_property_t *property_type_p) /**< [out] type and flags of the property */
+{
+  if (!ecma_is_value_object (object) || !ecma_is_value_string (property))
+  {
+    return NULL;
+  }
+
+  ecma_object_t *object_p = ecma_get_object_from_value (object);
+
+  /* Other objects may have properties which are not stored in the property list. */
+  if ((object_p->type_flags_refs & ECMA_OBJECT_TYPE_MASK) != ECMA_OBJECT_TYPE_GENERAL)
+  {
+    return NULL;
+  }
+
+  JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
+
+  vm_inline_cache_entry_t *entry_p = vm_inline_cache_get_entry (frame_ctx_p, byte_code_p);
+
+  if (JERRY_UNLIKELY (entry_p == NULL))
+  {
+    return NULL;
+  }
+
+  ecma_string_t *name_p = ecma_get_string_from_value (property);
+  ecma_property_t name_type = ECMA_DIRECT_STRING_PTR;
+  jmem_cpointer_t name_cp;
+
+  if (ECMA_IS_DIRECT_STRING (name_p))
+  {
+    name_type = (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (name_p);
+    name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p);
+  }
+  else
+  {
+    ECMA_SET_NON_NULL_POINTER (name_cp, name_p);
+  }
+
+  jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ECMA_OBJECT_HAS_SHAPE (object_p))
+  {
+    ecma_shape_values_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_values_t, prop_iter_cp);
+
+    if (entry_p->shape_cp == values_p->header.next_property_cp
+        && entry_p->epoch == JERRY_CONTEXT (vm_inline_cache_epoch)
+        && entry_p->name_cp == name_cp
+        && ECMA_PROPERTY_GET_NAME_TYPE (entry_p->property) == name_type)
+    {
+      *property_type_p = entry_p->property;
+      return ECMA_SHAPE_GET_VALUES (values_p) + entry_p->position;
+    }
+
+    if (entry_p->position == VM_INLINE_CACHE_NOT_FOUND && entry_p->skip_count > 0)
+    {
+      entry_p->skip_count--;
+      return NULL;
+    }
+
+    entry_p->object_cp = JMEM_CP_NULL;
+    entry_p->position = VM_INLINE_CACHE_NOT_FOUND;
+    entry_p->skip_count = VM_INLINE_CACHE_SKIP_COUNT;
+    entry_p->shape_cp = JMEM_CP_NULL;
+
+    ecma_shape_t *shape_p = ecma_shape_find (ECMA_SHAPE_GET_SHAPE (values_p), name_p);
+
+    if (shape_p == NULL)
+    {
+      return NULL;
+    }
+
+    /* The name of the shape is compared, since it is kept alive by the shape. */
+    entry_p->epoch = JERRY_CONTEXT (vm_inline_cache_epoch);
+    entry_p->position = (uint16_t) (shape_p->property_count - 1);
+    entry_p->shape_cp = values_p->header.next_property_cp;
+    entry_p->name_cp = shape_p->name_cp;
+    entry_p->property = shape_p->property;
+
+    *property_type_p = shape_p->property;
+    return ECMA_SHAPE_GET_VALUES (values_p) + entry_p->position;
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+  jmem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  if (entry_p->position != VM_INLINE_CACHE_NOT_FOUND)
+  {
+    ecma_property_header_t *prop_iter_p = NULL;
+
+    if (entry_p->object_cp == object_cp && entry_p->epoch == JERRY_CONTEXT (vm_inline_cache_epoch))
+    {
+      /* The property pair of the object is not freed until the epoch is changed. */
+      prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, entry_p->pair_cp);
+    }
+    else
+    {
+      for (uint32_t i = entry_p->position >> 1; i > 0 && prop_iter_cp != JMEM_CP_NULL; i--)
+      {
+        prop_iter_cp = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp)->next_property_cp;
+      }
+
+      if (prop_iter_cp != JMEM_CP_NULL)
+      {
+        prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+      }
+    }
+
+    uint32_t property_index = entry_p->position & 0x1;
+
+    if (prop_iter_p != NULL
+        && ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p)
+        && ((ecma_property_pair_t *) prop_iter_p)->names_cp[property_index] == name_cp
+        && ECMA_PROPERTY_GET_NAME_TYPE (prop_iter_p->types[property_index]) == name_type
+        && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types[property_index]) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+    {
+      if (entry_p->object_cp != object_cp)
+      {
+        entry_p->epoch = JERRY_CONTEXT (vm_inline_cache_epoch);
+        entry_p->object_cp = object_cp;
+        ECMA_SET_NON_NULL_POINTER (entry_p->pair_cp, prop_iter_p);
+      }
+
+      *property_type_p = prop_iter_p->types[property_index];
+      return ((ecma_property_pair_t *) prop_iter_p)->values + property_index;
+    }
+
+    prop_iter_cp = object_p->u1.property_list_cp;
+  }
+  else if (entry_p->skip_count > 0)
+  {
+    entry_p->skip_count--;
+    return NULL;
+  }
+
+  entry_p->object_cp = JMEM_CP_NULL;
+  entry_p->position = VM_INLINE_CACHE_NOT_FOUND;
+  entry_p->skip_count = VM_INLINE_CACHE_SKIP_COUNT;
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  entry_p->shape_cp = JMEM_CP_NULL;
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+#if ENABLED (JERRY_PROPRETY_HASHMAP)
+  if (prop_iter_cp != JMEM_CP_NULL
+      && !ECMA_PROPERTY_IS_PROPERTY_PAIR (ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp)))
+  {
+    /* Properties of large objects are found by the hashmap. */
+    return NULL;
+  }
+#endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
+
+  uint32_t position = 0;
+
+  while (prop_iter_cp != JMEM_CP_NULL && position < VM_INLINE_CACHE_NOT_FOUND - 1)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    for (uint32_t property_index = 0; property_index < ECMA_PROPERTY_PAIR_ITEM_COUNT; property_index++)
+    {
+      if (((ecma_property_pair_t *) prop_iter_p)->names_cp[property_index] == name_cp
+          && ECMA_PROPERTY_GET_NAME_TYPE (prop_iter_p->types[property_index]) == name_type)
+      {
+        if (ECMA_PROPERTY_GET_TYPE (prop_iter_p->types[property_index]) != ECMA_PROPERTY_TYPE_NAMEDDATA)
+        {
+          return NULL;
+        }
+
+        entry_p->epoch = JERRY_CONTEXT (vm_inline_cache_epoch);
+        entry_p->object_cp = object_cp;
+        entry_p->pair_cp = prop_iter_cp;
+        entry_p->position = (uint16_t) (position + property_index);
+        *property_type_p = prop_iter_p->types[property_index];
+        return ((ecma_property_pair_t *) prop_iter_p)->values + property_index;
+      }
+    }
+
+    position += ECMA_PROPERTY_PAIR_ITEM_COUNT;
+    prop_iter_cp = prop_iter_p->next_property_cp;
+  }
+
+  return NULL;
+} /* vm_inline_cache_find */
+
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
+
 /**
  * Get the value of object[property].
  *
@@ -141,6 +590,33 @@ vm_op_get_value (ecma_value_t object, /**< base object */
   return get_value_result;
 } /* vm_op_get_value */
 
+/**
+ * Get the value of object[property] accessed by an instruction with a literal property name.
+ *
+ * @return ecma value
+ */
+static inline ecma_value_t JERRY_ATTR_ALWAYS_INLINE
+vm_op_get_literal_value (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                         const uint8_t *byte_code_p, /**< instruction which accesses the property */
+                         ecma_value_t object, /**< base object */
+                         ecma_value_t property) /**< property name */
+{
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+  ecma_property_t property_type;
+  ecma_property_value_t *value_p = vm_inline_cache_find (frame_ctx_p, byte_code_p, object, property, &property_type);
+
+  if (value_p != NULL)
+  {
+    return ecma_fast_copy_value (value_p->value);
+  }
+#else /* !ENABLED (JERRY_VM_INLINE_CACHE) */
+  JERRY_UNUSED (frame_ctx_p);
+  JERRY_UNUSED (byte_code_p);
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
+
+  return vm_op_get_value (object, property);
+} /* vm_op_get_literal_value */
+
 /**
  * Set the value of object[property].
  *
@@ -151,7 +627,9 @@ vm_op_get_value (ecma_value_t object, /**< base object */
  *         if the property setting is unsuccessful
  */
 static ecma_value_t
-vm_op_set_value (ecma_value_t base, /**< base object */
+vm_op_set_value (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                 const uint8_t *byte_code_p, /**< instruction which sets the property */
+                 ecma_value_t base, /**< base object */
                  ecma_value_t property, /**< property name */
                  ecma_value_t value, /**< ecma value */
                  bool is_strict) /**< strict mode */
@@ -210,6 +688,26 @@ vm_op_set_value (ecma_value_t base, /**< base object */
   {
     object_p = ecma_get_object_from_value (base);
 
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+    ecma_property_t cached_property;
+    ecma_property_value_t *cached_value_p = vm_inline_cache_find (frame_ctx_p,
+                                                                  byte_code_p,
+                                                                  base,
+                                                                  property,
+                                                                  &cached_property);
+
+    if (cached_value_p != NULL && ecma_is_property_writable (cached_property))
+    {
+      ecma_named_data_property_assign_value (object_p, cached_value_p, value);
+      ecma_deref_object (object_p);
+      ecma_deref_ecma_string (ecma_get_string_from_value (property));
+      return ECMA_VALUE_TRUE;
+    }
+#else /* !ENABLED (JERRY_VM_INLINE_CACHE) */
+    JERRY_UNUSED (frame_ctx_p);
+    JERRY_UNUSED (byte_code_p);
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
+
     if (JERRY_UNLIKELY (!ecma_is_value_prop_name (property)))
     {
       property_p = ecma_op_to_string (property);
@@ -603,6 +1101,9 @@ vm_super_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       {
         ECMA_SET_POINTER (ecma_get_object_from_value (completion_value)->u2.prototype_cp,
                           ecma_get_object_from_value (proto_value));
+#if ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0
+        ecma_lcache_proto_invalidate_all ();
+#endif /* ENABLED (JERRY_LCACHE) && JERRY_LCACHE_PROTOTYPE_ROWS > 0 */
       }
       ecma_free_value (proto_value);
     }
@@ -641,9 +1142,9 @@ vm_super_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
   if (JERRY_UNLIKELY (ECMA_IS_VALUE_ERROR (completion_value)))
   {
-#if ENABLED (JERRY_DEBUGGER)
-    JERRY_CONTEXT (debugger_exception_byte_code_p) = frame_ctx_p->byte_code_p;
-#endif /* ENABLED (JERRY_DEBUGGER) */
+#if ENABLED (JERRY_DEBUGGER) || ENABLED (JERRY_LINE_INFO)
+    JERRY_CONTEXT (vm_exception_byte_code_p) = frame_ctx_p->byte_code_p;
+#endif /* ENABLED (JERRY_DEBUGGER) || ENABLED (JERRY_LINE_INFO) */
     frame_ctx_p->byte_code_p = (uint8_t *) vm_error_byte_code_p;
   }
   else
@@ -737,9 +1238,9 @@ vm_spread_operation (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
   if (JERRY_UNLIKELY (ECMA_IS_VALUE_ERROR (completion_value)))
   {
-#if ENABLED (JERRY_DEBUGGER)
-    JERRY_CONTEXT (debugger_exception_byte_code_p) = frame_ctx_p->byte_code_p;
-#endif /* ENABLED (JERRY_DEBUGGER) */
+#if ENABLED (JERRY_DEBUGGER) || ENABLED (JERRY_LINE_INFO)
+    JERRY_CONTEXT (vm_exception_byte_code_p) = frame_ctx_p->byte_code_p;
+#endif /* ENABLED (JERRY_DEBUGGER) || ENABLED (JERRY_LINE_INFO) */
     frame_ctx_p->byte_code_p = (uint8_t *) vm_error_byte_code_p;
   }
   else
@@ -767,12 +1268,12 @@ vm_spread_operation (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #endif /* ENABLED (JERRY_ESNEXT) */
 
 /**
- * 'Function call' opcode handler.
- *
- * See also: ECMA-262 v5, 11.2.3
+ * Finish a function call: the arguments are released and the result is
+ * stored, or the exception handling is started when the call failed.
  */
 static void
-opfunc_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+opfunc_call_complete (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                      ecma_value_t completion_value) /**< result of the call */
 {
   const uint8_t *byte_code_p = frame_ctx_p->byte_code_p + 1;
   uint8_t opcode = byte_code_p[-1];
@@ -790,24 +1291,6 @@ opfunc_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   bool is_call_prop = ((opcode - CBC_CALL) % 6) >= 3;
 
   ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p - arguments_list_len;
-  ecma_value_t this_value = is_call_prop ? stack_top_p[-3] : ECMA_VALUE_UNDEFINED;
-  ecma_value_t func_value = stack_top_p[-1];
-  ecma_value_t completion_value;
-
-  if (!ecma_is_value_object (func_value)
-      || !ecma_op_object_is_callable (ecma_get_object_from_value (func_value)))
-  {
-    completion_value = ecma_raise_type_error (ECMA_ERR_MSG ("Expected a function."));
-  }
-  else
-  {
-    ecma_object_t *func_obj_p = ecma_get_object_from_value (func_value);
-
-    completion_value = ecma_op_function_call (func_obj_p,
-                                              this_value,
-                                              stack_top_p,
-                                              arguments_list_len);
-  }
 
   JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_DIRECT_EVAL;
 
@@ -825,9 +1308,9 @@ opfunc_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
   if (JERRY_UNLIKELY (ECMA_IS_VALUE_ERROR (completion_value)))
   {
-#if ENABLED (JERRY_DEBUGGER)
-    JERRY_CONTEXT (debugger_exception_byte_code_p) = frame_ctx_p->byte_code_p;
-#endif /* ENABLED (JERRY_DEBUGGER) */
+#if ENABLED (JERRY_DEBUGGER) || ENABLED (JERRY_LINE_INFO)
+    JERRY_CONTEXT (vm_exception_byte_code_p) = frame_ctx_p->byte_code_p;
+#endif /* ENABLED (JERRY_DEBUGGER) || ENABLED (JERRY_LINE_INFO) */
     frame_ctx_p->byte_code_p = (uint8_t *) vm_error_byte_code_p;
   }
   else
@@ -852,6 +1335,52 @@ opfunc_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   }
 
   frame_ctx_p->stack_top_p = stack_top_p;
+} /* opfunc_call_complete */
+
+/**
+ * 'Function call' opcode handler.
+ *
+ * See also: ECMA-262 v5, 11.2.3
+ */
+static void
+opfunc_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  const uint8_t *byte_code_p = frame_ctx_p->byte_code_p;
+  uint8_t opcode = byte_code_p[0];
+  uint32_t arguments_list_len;
+
+  if (opcode >= CBC_CALL0)
+  {
+    arguments_list_len = (unsigned int) ((opcode - CBC_CALL0) / 6);
+  }
+  else
+  {
+    arguments_list_len = byte_code_p[1];
+  }
+
+  bool is_call_prop = ((opcode - CBC_CALL) % 6) >= 3;
+
+  ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p - arguments_list_len;
+  ecma_value_t this_value = is_call_prop ? stack_top_p[-3] : ECMA_VALUE_UNDEFINED;
+  ecma_value_t func_value = stack_top_p[-1];
+  ecma_value_t completion_value;
+
+  if (!ecma_is_value_object (func_value)
+      || !ecma_op_object_is_callable (ecma_get_object_from_value (func_value)))
+  {
+    completion_value = ecma_raise_type_error (ECMA_ERR_MSG ("Expected a function."));
+  }
+  else
+  {
+    ecma_object_t *func_obj_p = ecma_get_object_from_value (func_value);
+
+    completion_value = ecma_op_function_call (func_obj_p,
+                                              this_value,
+                                              stack_top_p,
+                                              arguments_list_len);
+  }
+
+  opfunc_call_complete (frame_ctx_p, completion_value);
 } /* opfunc_call */
 
 /**
@@ -902,9 +1431,9 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
   if (JERRY_UNLIKELY (ECMA_IS_VALUE_ERROR (completion_value)))
   {
-#if ENABLED (JERRY_DEBUGGER)
-    JERRY_CONTEXT (debugger_exception_byte_code_p) = frame_ctx_p->byte_code_p;
-#endif /* ENABLED (JERRY_DEBUGGER) */
+#if ENABLED (JERRY_DEBUGGER) || ENABLED (JERRY_LINE_INFO)
+    JERRY_CONTEXT (vm_exception_byte_code_p) = frame_ctx_p->byte_code_p;
+#endif /* ENABLED (JERRY_DEBUGGER) || ENABLED (JERRY_LINE_INFO) */
     frame_ctx_p->byte_code_p = (uint8_t *) vm_error_byte_code_p;
   }
   else
@@ -980,6 +1509,21 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   } \
   while (0)
 
+#if ENABLED (JERRY_LINE_INFO)
+
+/**
+ * Save the position of the current instruction into the frame before it calls a function
+ * which may create an error (e.g. a valueOf method or a getter), so the backtrace of the
+ * error refers to the line of the instruction.
+ */
+#define VM_SAVE_POSITION() frame_ctx_p->byte_code_p = byte_code_start_p
+
+#else /* !ENABLED (JERRY_LINE_INFO) */
+
+#define VM_SAVE_POSITION()
+
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
 /**
  * Store the original value for post increase/decrease operators
  *
@@ -1015,6 +1559,291 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
     opcode_data &= (uint32_t) ~VM_OC_PUT_BLOCK; \
   }
 
+/**
+ * Store the result of the fast path of an arithmetic operator
+ *
+ * The result is pushed onto the stack, except for the binary opcodes which
+ * assign their result to a register (e.g. CBC_EXT_ADD_MOV_IDENT).
+ *
+ * @param value result
+ */
+#define ARITHMETIC_PUT_RESULT(value) \
+  { \
+    ecma_value_t arithmetic_result = (value); \
+    if (JERRY_LIKELY (!(opcode_data & VM_OC_PUT_IDENT))) \
+    { \
+      *stack_top_p++ = arithmetic_result; \
+      continue; \
+    } \
+    uint16_t register_index; \
+    READ_LITERAL_INDEX (register_index); \
+    JERRY_ASSERT (register_index < register_end); \
+    ecma_fast_free_value (VM_GET_REGISTER (frame_ctx_p, register_index)); \
+    VM_GET_REGISTER (frame_ctx_p, register_index) = arithmetic_result; \
+    continue; \
+  }
+
+#if ENABLED (JERRY_VM_COMPUTED_GOTO)
+
+/**
+ * Byte code instructions which have their own handler in the threaded dispatch of vm_loop.
+ *
+ * Each definition is a (group, operands) pair: the handler decodes the operands of the
+ * instruction (see VM_THREADED_DECODE_* below) and jumps to the code of the VM_OC group.
+ * All other instructions are dispatched by the switch statement of vm_loop.
+ */
+#define VM_THREADED_CBC_POP (VM_OC_POP, NONE)
+#define VM_THREADED_CBC_PUSH_LITERAL (VM_OC_PUSH, LITERAL)
+#define VM_THREADED_CBC_PUSH_TWO_LITERALS (VM_OC_PUSH_TWO, LITERAL_LITERAL)
+#define VM_THREADED_CBC_PUSH_UNDEFINED (VM_OC_PUSH_UNDEFINED, NONE)
+#define VM_THREADED_CBC_PUSH_NUMBER_0 (VM_OC_PUSH_0, NONE)
+#define VM_THREADED_CBC_PUSH_NUMBER_POS_BYTE (VM_OC_PUSH_POS_BYTE, NONE)
+#define VM_THREADED_CBC_PUSH_PROP (VM_OC_PROP_GET, STACK_STACK)
+#define VM_THREADED_CBC_PUSH_PROP_LITERAL (VM_OC_PROP_GET, STACK_LITERAL)
+#define VM_THREADED_CBC_PUSH_PROP_LITERAL_LITERAL (VM_OC_PROP_GET, LITERAL_LITERAL)
+#define VM_THREADED_CBC_PUSH_PROP_THIS_LITERAL (VM_OC_PROP_GET, THIS_LITERAL)
+#define VM_THREADED_CBC_ASSIGN_SET_IDENT (VM_OC_ASSIGN, STACK)
+#define VM_THREADED_CBC_ASSIGN_SET_IDENT_BLOCK (VM_OC_ASSIGN, STACK)
+#define VM_THREADED_CBC_ASSIGN_LITERAL_SET_IDENT (VM_OC_ASSIGN, LITERAL)
+#define VM_THREADED_CBC_ASSIGN_PROP_LITERAL (VM_OC_ASSIGN_PROP, LITERAL)
+#define VM_THREADED_CBC_MOV_IDENT (VM_OC_MOV_IDENT, STACK)
+#define VM_THREADED_CBC_PRE_INCR_IDENT (VM_OC_PRE_INCR, LITERAL)
+#define VM_THREADED_CBC_PRE_DECR_IDENT (VM_OC_PRE_INCR, LITERAL)
+#define VM_THREADED_CBC_POST_INCR_IDENT (VM_OC_PRE_INCR, LITERAL)
+#define VM_THREADED_CBC_POST_DECR_IDENT (VM_OC_PRE_INCR, LITERAL)
+#define VM_THREADED_CBC_ADD (VM_OC_ADD, STACK_STACK)
+#define VM_THREADED_CBC_ADD_RIGHT_LITERAL (VM_OC_ADD, STACK_LITERAL)
+#define VM_THREADED_CBC_ADD_TWO_LITERALS (VM_OC_ADD, LITERAL_LITERAL)
+#define VM_THREADED_CBC_SUBTRACT (VM_OC_SUB, STACK_STACK)
+#define VM_THREADED_CBC_SUBTRACT_RIGHT_LITERAL (VM_OC_SUB, STACK_LITERAL)
+#define VM_THREADED_CBC_SUBTRACT_TWO_LITERALS (VM_OC_SUB, LITERAL_LITERAL)
+#define VM_THREADED_CBC_MULTIPLY (VM_OC_MUL, STACK_STACK)
+#define VM_THREADED_CBC_MULTIPLY_RIGHT_LITERAL (VM_OC_MUL, STACK_LITERAL)
+#define VM_THREADED_CBC_MULTIPLY_TWO_LITERALS (VM_OC_MUL, LITERAL_LITERAL)
+#define VM_THREADED_CBC_BIT_OR (VM_OC_BIT_OR, STACK_STACK)
+#define VM_THREADED_CBC_BIT_OR_RIGHT_LITERAL (VM_OC_BIT_OR, STACK_LITERAL)
+#define VM_THREADED_CBC_BIT_OR_TWO_LITERALS (VM_OC_BIT_OR, LITERAL_LITERAL)
+#define VM_THREADED_CBC_BIT_XOR (VM_OC_BIT_XOR, STACK_STACK)
+#define VM_THREADED_CBC_BIT_XOR_RIGHT_LITERAL (VM_OC_BIT_XOR, STACK_LITERAL)
+#define VM_THREADED_CBC_BIT_XOR_TWO_LITERALS (VM_OC_BIT_XOR, LITERAL_LITERAL)
+#define VM_THREADED_CBC_BIT_AND (VM_OC_BIT_AND, STACK_STACK)
+#define VM_THREADED_CBC_BIT_AND_RIGHT_LITERAL (VM_OC_BIT_AND, STACK_LITERAL)
+#define VM_THREADED_CBC_BIT_AND_TWO_LITERALS (VM_OC_BIT_AND, LITERAL_LITERAL)
+#define VM_THREADED_CBC_LEFT_SHIFT (VM_OC_LEFT_SHIFT, STACK_STACK)
+#define VM_THREADED_CBC_LEFT_SHIFT_RIGHT_LITERAL (VM_OC_LEFT_SHIFT, STACK_LITERAL)
+#define VM_THREADED_CBC_LEFT_SHIFT_TWO_LITERALS (VM_OC_LEFT_SHIFT, LITERAL_LITERAL)
+#define VM_THREADED_CBC_RIGHT_SHIFT (VM_OC_RIGHT_SHIFT, STACK_STACK)
+#define VM_THREADED_CBC_RIGHT_SHIFT_RIGHT_LITERAL (VM_OC_RIGHT_SHIFT, STACK_LITERAL)
+#define VM_THREADED_CBC_RIGHT_SHIFT_TWO_LITERALS (VM_OC_RIGHT_SHIFT, LITERAL_LITERAL)
+#define VM_THREADED_CBC_UNS_RIGHT_SHIFT (VM_OC_UNS_RIGHT_SHIFT, STACK_STACK)
+#define VM_THREADED_CBC_UNS_RIGHT_SHIFT_RIGHT_LITERAL (VM_OC_UNS_RIGHT_SHIFT, STACK_LITERAL)
+#define VM_THREADED_CBC_UNS_RIGHT_SHIFT_TWO_LITERALS (VM_OC_UNS_RIGHT_SHIFT, LITERAL_LITERAL)
+#define VM_THREADED_CBC_MODULO (VM_OC_MOD, STACK_STACK)
+#define VM_THREADED_CBC_MODULO_RIGHT_LITERAL (VM_OC_MOD, STACK_LITERAL)
+#define VM_THREADED_CBC_MODULO_TWO_LITERALS (VM_OC_MOD, LITERAL_LITERAL)
+#define VM_THREADED_CBC_STRICT_EQUAL (VM_OC_STRICT_EQUAL, STACK_STACK)
+#define VM_THREADED_CBC_STRICT_EQUAL_RIGHT_LITERAL (VM_OC_STRICT_EQUAL, STACK_LITERAL)
+#define VM_THREADED_CBC_STRICT_EQUAL_TWO_LITERALS (VM_OC_STRICT_EQUAL, LITERAL_LITERAL)
+#define VM_THREADED_CBC_STRICT_NOT_EQUAL (VM_OC_STRICT_NOT_EQUAL, STACK_STACK)
+#define VM_THREADED_CBC_STRICT_NOT_EQUAL_RIGHT_LITERAL (VM_OC_STRICT_NOT_EQUAL, STACK_LITERAL)
+#define VM_THREADED_CBC_STRICT_NOT_EQUAL_TWO_LITERALS (VM_OC_STRICT_NOT_EQUAL, LITERAL_LITERAL)
+#define VM_THREADED_CBC_LESS (VM_OC_LESS, STACK_STACK)
+#define VM_THREADED_CBC_LESS_RIGHT_LITERAL (VM_OC_LESS, STACK_LITERAL)
+#define VM_THREADED_CBC_LESS_TWO_LITERALS (VM_OC_LESS, LITERAL_LITERAL)
+#define VM_THREADED_CBC_GREATER (VM_OC_GREATER, STACK_STACK)
+#define VM_THREADED_CBC_GREATER_RIGHT_LITERAL (VM_OC_GREATER, STACK_LITERAL)
+#define VM_THREADED_CBC_GREATER_TWO_LITERALS (VM_OC_GREATER, LITERAL_LITERAL)
+#define VM_THREADED_CBC_LESS_EQUAL (VM_OC_LESS_EQUAL, STACK_STACK)
+#define VM_THREADED_CBC_LESS_EQUAL_RIGHT_LITERAL (VM_OC_LESS_EQUAL, STACK_LITERAL)
+#define VM_THREADED_CBC_LESS_EQUAL_TWO_LITERALS (VM_OC_LESS_EQUAL, LITERAL_LITERAL)
+#define VM_THREADED_CBC_GREATER_EQUAL (VM_OC_GREATER_EQUAL, STACK_STACK)
+#define VM_THREADED_CBC_GREATER_EQUAL_RIGHT_LITERAL (VM_OC_GREATER_EQUAL, STACK_LITERAL)
+#define VM_THREADED_CBC_GREATER_EQUAL_TWO_LITERALS (VM_OC_GREATER_EQUAL, LITERAL_LITERAL)
+#define VM_THREADED_CBC_JUMP_FORWARD (VM_OC_JUMP, BRANCH)
+#define VM_THREADED_CBC_BRANCH_IF_TRUE_FORWARD (VM_OC_BRANCH_IF_TRUE, BRANCH)
+#define VM_THREADED_CBC_BRANCH_IF_FALSE_FORWARD (VM_OC_BRANCH_IF_TRUE, BRANCH)
+#if !ENABLED (JERRY_VM_EXEC_STOP)
+/* Backward branches must call the exec stop callback, which is done by the generic code. */
+#define VM_THREADED_CBC_JUMP_BACKWARD (VM_OC_JUMP, BRANCH)
+#define VM_THREADED_CBC_BRANCH_IF_TRUE_BACKWARD (VM_OC_BRANCH_IF_TRUE, BRANCH)
+#define VM_THREADED_CBC_BRANCH_IF_FALSE_BACKWARD (VM_OC_BRANCH_IF_TRUE, BRANCH)
+#define VM_THREADED_CBC_BRANCH_IF_LESS_TWO_LITERALS_BACKWARD (VM_OC_BRANCH_IF_LESS, BRANCH)
+#define VM_THREADED_CBC_BRANCH_IF_GREATER_TWO_LITERALS_BACKWARD (VM_OC_BRANCH_IF_LESS, BRANCH)
+#define VM_THREADED_CBC_BRANCH_IF_LESS_EQUAL_TWO_LITERALS_BACKWARD (VM_OC_BRANCH_IF_LESS, BRANCH)
+#define VM_THREADED_CBC_BRANCH_IF_GREATER_EQUAL_TWO_LITERALS_BACKWARD (VM_OC_BRANCH_IF_LESS, BRANCH)
+#endif /* !ENABLED (JERRY_VM_EXEC_STOP) */
+#define VM_THREADED_CBC_CALL (VM_OC_CALL, NONE)
+#define VM_THREADED_CBC_CALL_PUSH_RESULT (VM_OC_CALL, NONE)
+#define VM_THREADED_CBC_CALL_PROP_PUSH_RESULT (VM_OC_CALL, NONE)
+#define VM_THREADED_CBC_CALL0 (VM_OC_CALL, NONE)
+#define VM_THREADED_CBC_CALL0_PUSH_RESULT (VM_OC_CALL, NONE)
+#define VM_THREADED_CBC_CALL0_PROP_PUSH_RESULT (VM_OC_CALL, NONE)
+#define VM_THREADED_CBC_CALL1 (VM_OC_CALL, NONE)
+#define VM_THREADED_CBC_CALL1_PUSH_RESULT (VM_OC_CALL, NONE)
+#define VM_THREADED_CBC_CALL1_PROP_PUSH_RESULT (VM_OC_CALL, NONE)
+#define VM_THREADED_CBC_CALL2_PUSH_RESULT (VM_OC_CALL, NONE)
+#define VM_THREADED_CBC_RETURN (VM_OC_RETURN, STACK)
+#define VM_THREADED_CBC_RETURN_WITH_LITERAL (VM_OC_RETURN, LITERAL)
+#define VM_THREADED_CBC_EXT_ADD_MOV_IDENT (VM_OC_ADD, STACK_STACK)
+#define VM_THREADED_CBC_EXT_ADD_RIGHT_LITERAL_MOV_IDENT (VM_OC_ADD, STACK_LITERAL)
+#define VM_THREADED_CBC_EXT_ADD_TWO_LITERALS_MOV_IDENT (VM_OC_ADD, LITERAL_LITERAL)
+#define VM_THREADED_CBC_EXT_SUBTRACT_MOV_IDENT (VM_OC_SUB, STACK_STACK)
+#define VM_THREADED_CBC_EXT_SUBTRACT_RIGHT_LITERAL_MOV_IDENT (VM_OC_SUB, STACK_LITERAL)
+#define VM_THREADED_CBC_EXT_SUBTRACT_TWO_LITERALS_MOV_IDENT (VM_OC_SUB, LITERAL_LITERAL)
+#define VM_THREADED_CBC_EXT_MULTIPLY_MOV_IDENT (VM_OC_MUL, STACK_STACK)
+#define VM_THREADED_CBC_EXT_MULTIPLY_RIGHT_LITERAL_MOV_IDENT (VM_OC_MUL, STACK_LITERAL)
+#define VM_THREADED_CBC_EXT_MULTIPLY_TWO_LITERALS_MOV_IDENT (VM_OC_MUL, LITERAL_LITERAL)
+#define VM_THREADED_CBC_EXT_BIT_OR_MOV_IDENT (VM_OC_BIT_OR, STACK_STACK)
+#define VM_THREADED_CBC_EXT_BIT_OR_RIGHT_LITERAL_MOV_IDENT (VM_OC_BIT_OR, STACK_LITERAL)
+#define VM_THREADED_CBC_EXT_BIT_OR_TWO_LITERALS_MOV_IDENT (VM_OC_BIT_OR, LITERAL_LITERAL)
+#define VM_THREADED_CBC_EXT_BIT_XOR_MOV_IDENT (VM_OC_BIT_XOR, STACK_STACK)
+#define VM_THREADED_CBC_EXT_BIT_XOR_RIGHT_LITERAL_MOV_IDENT (VM_OC_BIT_XOR, STACK_LITERAL)
+#define VM_THREADED_CBC_EXT_BIT_XOR_TWO_LITERALS_MOV_IDENT (VM_OC_BIT_XOR, LITERAL_LITERAL)
+#define VM_THREADED_CBC_EXT_BIT_AND_MOV_IDENT (VM_OC_BIT_AND, STACK_STACK)
+#define VM_THREADED_CBC_EXT_BIT_AND_RIGHT_LITERAL_MOV_IDENT (VM_OC_BIT_AND, STACK_LITERAL)
+#define VM_THREADED_CBC_EXT_BIT_AND_TWO_LITERALS_MOV_IDENT (VM_OC_BIT_AND, LITERAL_LITERAL)
+#define VM_THREADED_CBC_EXT_LEFT_SHIFT_MOV_IDENT (VM_OC_LEFT_SHIFT, STACK_STACK)
+#define VM_THREADED_CBC_EXT_LEFT_SHIFT_RIGHT_LITERAL_MOV_IDENT (VM_OC_LEFT_SHIFT, STACK_LITERAL)
+#define VM_THREADED_CBC_EXT_LEFT_SHIFT_TWO_LITERALS_MOV_IDENT (VM_OC_LEFT_SHIFT, LITERAL_LITERAL)
+#define VM_THREADED_CBC_EXT_RIGHT_SHIFT_MOV_IDENT (VM_OC_RIGHT_SHIFT, STACK_STACK)
+#define VM_THREADED_CBC_EXT_RIGHT_SHIFT_RIGHT_LITERAL_MOV_IDENT (VM_OC_RIGHT_SHIFT, STACK_LITERAL)
+#define VM_THREADED_CBC_EXT_RIGHT_SHIFT_TWO_LITERALS_MOV_IDENT (VM_OC_RIGHT_SHIFT, LITERAL_LITERAL)
+#define VM_THREADED_CBC_EXT_UNS_RIGHT_SHIFT_MOV_IDENT (VM_OC_UNS_RIGHT_SHIFT, STACK_STACK)
+#define VM_THREADED_CBC_EXT_UNS_RIGHT_SHIFT_RIGHT_LITERAL_MOV_IDENT (VM_OC_UNS_RIGHT_SHIFT, STACK_LITERAL)
+#define VM_THREADED_CBC_EXT_UNS_RIGHT_SHIFT_TWO_LITERALS_MOV_IDENT (VM_OC_UNS_RIGHT_SHIFT, LITERAL_LITERAL)
+#define VM_THREADED_CBC_EXT_MODULO_MOV_IDENT (VM_OC_MOD, STACK_STACK)
+#define VM_THREADED_CBC_EXT_MODULO_RIGHT_LITERAL_MOV_IDENT (VM_OC_MOD, STACK_LITERAL)
+#define VM_THREADED_CBC_EXT_MODULO_TWO_LITERALS_MOV_IDENT (VM_OC_MOD, LITERAL_LITERAL)
+
+/**
+ * Helper macros for selecting the handler of an opcode at compile time: VM_THREADED_HAS_HANDLER
+ * expands to 1 if VM_THREADED_<opcode> is defined above, and to 0 otherwise.
+ */
+#define VM_THREADED_SECOND(first, second, ...) second
+#define VM_THREADED_SECOND_EXPAND(...) VM_THREADED_SECOND (__VA_ARGS__)
+#define VM_THREADED_PROBE(...) ~, 1
+#define VM_THREADED_IS_DEFINED(definition) VM_THREADED_SECOND_EXPAND (VM_THREADED_PROBE definition, 0, ~)
+#define VM_THREADED_HAS_HANDLER(opcode) VM_THREADED_IS_DEFINED (VM_THREADED_ ## opcode)
+#define VM_THREADED_CONCAT(a, b) VM_THREADED_CONCAT_EXPAND (a, b)
+#define VM_THREADED_CONCAT_EXPAND(a, b) a ## b
+#define VM_THREADED_GET_GROUP(group, operands) group
+#define VM_THREADED_GET_OPERANDS(group, operands) operands
+
+/**
+ * Address of the handler of an opcode.
+ */
+#define VM_THREADED_ADDRESS_0(opcode) &&vm_threaded_generic,
+#define VM_THREADED_ADDRESS_1(opcode) &&vm_threaded_ ## opcode,
+
+/**
+ * Address of the handler of an extended opcode.
+ */
+#define VM_THREADED_EXT_ADDRESS_0(opcode) &&vm_threaded_ext_generic,
+#define VM_THREADED_EXT_ADDRESS_1(opcode) &&vm_threaded_ ## opcode,
+
+/**
+ * Handler of an opcode: decodes the operands and jumps to the code of the VM_OC group.
+ */
+#define VM_THREADED_HANDLER_0(opcode, decode)
+#define VM_THREADED_HANDLER_1(opcode, decode) \
+  VM_THREADED_HANDLER_UNPACK (opcode, \
+                              decode, \
+                              VM_THREADED_GET_GROUP VM_THREADED_ ## opcode, \
+                              VM_THREADED_GET_OPERANDS VM_THREADED_ ## opcode)
+#define VM_THREADED_HANDLER_UNPACK(opcode, decode, group, operands) \
+  VM_THREADED_HANDLER_EXPAND (opcode, decode, group, operands)
+#define VM_THREADED_HANDLER_EXPAND(opcode, decode, group, operands) \
+  VM_THREADED_HANDLER (opcode, decode, group, operands)
+#define VM_THREADED_HANDLER(opcode, decode, group, operands) \
+  vm_threaded_ ## opcode: \
+  { \
+    JERRY_ASSERT (VM_OC_GET_ARGS_INDEX (decode) == VM_OC_GET_ ## operands); \
+    VM_THREADED_DECODE_ ## operands (opcode, decode); \
+    opcode_data = (decode); \
+    goto vm_threaded_ ## group; \
+  }
+
+/**
+ * Read a literal index, and fall back to the generic operand decoding unless the
+ * literal is a register or a constant (identifiers must be resolved, and object
+ * literals must be constructed, which are done by the generic code).
+ */
+#define VM_THREADED_READ_LITERAL_INDEX(literal_index, decode) \
+  READ_LITERAL_INDEX (literal_index); \
+  if (JERRY_UNLIKELY ((literal_index) >= register_end \
+                      && ((literal_index) < ident_end || (literal_index) >= const_literal_end))) \
+  { \
+    byte_code_p = byte_code_start_p + (byte_code_start_p[0] == CBC_EXT_OPCODE ? 2 : 1); \
+    opcode_data = (decode); \
+    goto vm_threaded_decode; \
+  }
+
+/**
+ * Get the value of a literal accepted by VM_THREADED_READ_LITERAL_INDEX.
+ */
+#define VM_THREADED_GET_LITERAL(literal_index) \
+  ecma_fast_copy_value ((literal_index) < register_end ? VM_GET_REGISTER (frame_ctx_p, literal_index) \
+                                                       : literal_start_p[literal_index])
+
+/**
+ * Operand decoders of the handlers (see the operand decoding of vm_loop).
+ */
+#define VM_THREADED_DECODE_NONE(opcode, decode) \
+  left_value = ECMA_VALUE_UNDEFINED; \
+  right_value = ECMA_VALUE_UNDEFINED
+#define VM_THREADED_DECODE_STACK(opcode, decode) \
+  JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end); \
+  left_value = *(--stack_top_p); \
+  right_value = ECMA_VALUE_UNDEFINED
+#define VM_THREADED_DECODE_STACK_STACK(opcode, decode) \
+  JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end + 1); \
+  right_value = *(--stack_top_p); \
+  left_value = *(--stack_top_p)
+#define VM_THREADED_DECODE_LITERAL(opcode, decode) \
+  uint16_t literal_index; \
+  VM_THREADED_READ_LITERAL_INDEX (literal_index, decode); \
+  left_value = VM_THREADED_GET_LITERAL (literal_index); \
+  right_value = ECMA_VALUE_UNDEFINED
+#define VM_THREADED_DECODE_LITERAL_LITERAL(opcode, decode) \
+  uint16_t literal_index; \
+  uint16_t second_literal_index; \
+  VM_THREADED_READ_LITERAL_INDEX (literal_index, decode); \
+  VM_THREADED_READ_LITERAL_INDEX (second_literal_index, decode); \
+  left_value = VM_THREADED_GET_LITERAL (literal_index); \
+  right_value = VM_THREADED_GET_LITERAL (second_literal_index)
+#define VM_THREADED_DECODE_STACK_LITERAL(opcode, decode) \
+  JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end); \
+  uint16_t literal_index; \
+  VM_THREADED_READ_LITERAL_INDEX (literal_index, decode); \
+  right_value = VM_THREADED_GET_LITERAL (literal_index); \
+  left_value = *(--stack_top_p)
+#define VM_THREADED_DECODE_THIS_LITERAL(opcode, decode) \
+  uint16_t literal_index; \
+  VM_THREADED_READ_LITERAL_INDEX (literal_index, decode); \
+  right_value = VM_THREADED_GET_LITERAL (literal_index); \
+  left_value = ecma_copy_value (frame_ctx_p->this_binding)
+#define VM_THREADED_DECODE_BRANCH(opcode, decode) \
+  JERRY_ASSERT (CBC_BRANCH_OFFSET_LENGTH (opcode) == 1); \
+  left_value = ECMA_VALUE_UNDEFINED; \
+  right_value = ECMA_VALUE_UNDEFINED; \
+  branch_offset_length = 1; \
+  branch_offset = *(byte_code_p++); \
+  if ((decode) & VM_OC_BACKWARD_BRANCH) \
+  { \
+    branch_offset = -branch_offset; \
+  }
+
+/**
+ * Label of the code of a VM_OC group in the switch statement of vm_loop.
+ */
+#define VM_THREADED_CASE(group) vm_threaded_ ## group:
+
+#else /* !ENABLED (JERRY_VM_COMPUTED_GOTO) */
+
+#define VM_THREADED_CASE(group)
+
+#endif /* ENABLED (JERRY_VM_COMPUTED_GOTO) */
+
 /**
  * Run generic byte code.
  *
@@ -1025,6 +1854,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 {
   const ecma_compiled_code_t *bytecode_header_p = frame_ctx_p->shared_p->bytecode_header_p;
   const uint8_t *byte_code_p = frame_ctx_p->byte_code_p;
+  const uint8_t *byte_code_start_p = byte_code_p;
   ecma_value_t *literal_start_p = frame_ctx_p->literal_start_p;
 
   ecma_value_t *stack_top_p;
@@ -1040,6 +1870,29 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   ecma_value_t result = ECMA_VALUE_EMPTY;
   bool is_strict = ((bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0);
 
+#if ENABLED (JERRY_VM_COMPUTED_GOTO)
+#define CBC_OPCODE(arg1, arg2, arg3, arg4) \
+  VM_THREADED_CONCAT (VM_THREADED_ADDRESS_, VM_THREADED_HAS_HANDLER (arg1)) (arg1)
+
+  /* Handler addresses of the opcodes. */
+  __extension__ static const void * const vm_threaded_handlers[] =
+  {
+    CBC_OPCODE_LIST
+  };
+
+#undef CBC_OPCODE
+#define CBC_OPCODE(arg1, arg2, arg3, arg4) \
+  VM_THREADED_CONCAT (VM_THREADED_EXT_ADDRESS_, VM_THREADED_HAS_HANDLER (arg1)) (arg1)
+
+  /* Handler addresses of the extended opcodes. */
+  __extension__ static const void * const vm_threaded_ext_handlers[] =
+  {
+    CBC_EXT_OPCODE_LIST
+  };
+
+#undef CBC_OPCODE
+#endif /* ENABLED (JERRY_VM_COMPUTED_GOTO) */
+
   /* Prepare for byte code execution. */
   if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING))
   {
@@ -1075,18 +1928,51 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
     /* Internal loop for byte code execution. */
     while (true)
     {
-      const uint8_t *byte_code_start_p = byte_code_p;
+      byte_code_start_p = byte_code_p;
       uint8_t opcode = *byte_code_p++;
       uint32_t opcode_data = opcode;
 
+#if ENABLED (JERRY_VM_COMPUTED_GOTO)
+      JERRY_ASSERT (opcode <= CBC_END);
+      __extension__ ({ goto *vm_threaded_handlers[opcode]; });
+
+#define CBC_OPCODE(arg1, arg2, arg3, arg4) \
+  VM_THREADED_CONCAT (VM_THREADED_HANDLER_, VM_THREADED_HAS_HANDLER (arg1)) (arg1, arg4)
+
+      CBC_OPCODE_LIST
+
+#undef CBC_OPCODE
+
+vm_threaded_generic:
+#endif /* ENABLED (JERRY_VM_COMPUTED_GOTO) */
       if (opcode == CBC_EXT_OPCODE)
       {
         opcode = *byte_code_p++;
+
+#if ENABLED (JERRY_VM_COMPUTED_GOTO)
+        JERRY_ASSERT (opcode < CBC_EXT_END);
+        __extension__ ({ goto *vm_threaded_ext_handlers[opcode]; });
+
+#define CBC_OPCODE(arg1, arg2, arg3, arg4) \
+  VM_THREADED_CONCAT (VM_THREADED_HANDLER_, VM_THREADED_HAS_HANDLER (arg1)) (arg1, arg4)
+
+        CBC_EXT_OPCODE_LIST
+
+#undef CBC_OPCODE
+
+vm_threaded_ext_generic:
+#endif /* ENABLED (JERRY_VM_COMPUTED_GOTO) */
         opcode_data = (uint32_t) ((CBC_END + 1) + opcode);
       }
 
       opcode_data = vm_decode_table[opcode_data];
 
+#if ENABLED (JERRY_VM_COMPUTED_GOTO)
+vm_threaded_decode:
+#endif /* ENABLED (JERRY_VM_COMPUTED_GOTO) */
+      /* The handlers of the threaded dispatch save the position on their slow paths. */
+      VM_SAVE_POSITION ();
+
       left_value = ECMA_VALUE_UNDEFINED;
       right_value = ECMA_VALUE_UNDEFINED;
 
@@ -1201,6 +2087,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       switch (VM_OC_GROUP_GET_INDEX (opcode_data))
       {
         case VM_OC_POP:
+        VM_THREADED_CASE (VM_OC_POP)
         {
           JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
           ecma_free_value (*(--stack_top_p));
@@ -1213,11 +2100,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
         case VM_OC_PUSH:
+        VM_THREADED_CASE (VM_OC_PUSH)
         {
           *stack_top_p++ = left_value;
           continue;
         }
         case VM_OC_PUSH_TWO:
+        VM_THREADED_CASE (VM_OC_PUSH_TWO)
         {
           *stack_top_p++ = left_value;
           *stack_top_p++ = right_value;
@@ -1238,6 +2127,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
         case VM_OC_PUSH_UNDEFINED:
+        VM_THREADED_CASE (VM_OC_PUSH_UNDEFINED)
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           continue;
@@ -1263,11 +2153,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
         case VM_OC_PUSH_0:
+        VM_THREADED_CASE (VM_OC_PUSH_0)
         {
           *stack_top_p++ = ecma_make_integer_value (0);
           continue;
         }
         case VM_OC_PUSH_POS_BYTE:
+        VM_THREADED_CASE (VM_OC_PUSH_POS_BYTE)
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (number + 1);
@@ -1508,6 +2400,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_free_value_if_not_object (property_value_p->value);
           }
 
+          ecma_gc_write_barrier (prev_lex_env_p, lit_value);
           property_value_p->value = lit_value;
           ecma_deref_object (ecma_get_object_from_value (lit_value));
           continue;
@@ -1682,6 +2575,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                         && ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
           JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (property_p)->value == ECMA_VALUE_UNINITIALIZED);
 
+          ecma_gc_write_barrier (frame_ctx_p->lex_env_p, left_value);
           ECMA_PROPERTY_VALUE_PTR (property_p)->value = left_value;
 
           if (ecma_is_value_object (left_value))
@@ -2796,8 +3690,18 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
         case VM_OC_PROP_GET:
+        VM_THREADED_CASE (VM_OC_PROP_GET)
         {
-          result = vm_op_get_value (left_value, right_value);
+          VM_SAVE_POSITION ();
+
+          if (opcode == CBC_PUSH_PROP)
+          {
+            result = vm_op_get_value (left_value, right_value);
+          }
+          else
+          {
+            result = vm_op_get_literal_value (frame_ctx_p, byte_code_start_p, left_value, right_value);
+          }
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2836,8 +3740,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         case VM_OC_PROP_POST_INCR:
         case VM_OC_PROP_POST_DECR:
         {
-          result = vm_op_get_value (left_value,
-                                    right_value);
+          if (opcode >= CBC_PUSH_PROP_LITERAL_REFERENCE && opcode <= CBC_PUSH_PROP_THIS_LITERAL_REFERENCE)
+          {
+            result = vm_op_get_literal_value (frame_ctx_p, byte_code_start_p, left_value, right_value);
+          }
+          else
+          {
+            result = vm_op_get_value (left_value, right_value);
+          }
 
           if (opcode < CBC_PRE_INCR)
           {
@@ -2864,6 +3774,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         case VM_OC_PRE_DECR:
         case VM_OC_POST_INCR:
         case VM_OC_POST_DECR:
+        VM_THREADED_CASE (VM_OC_PRE_INCR)
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
           ecma_number_t result_number;
@@ -2911,6 +3822,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           else
           {
+            VM_SAVE_POSITION ();
             result = ecma_op_to_numeric (left_value, &result_number, ECMA_TO_NUMERIC_ALLOW_BIGINT);
 
             if (ECMA_IS_VALUE_ERROR (result))
@@ -2984,12 +3896,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           break;
         }
         case VM_OC_ASSIGN:
+        VM_THREADED_CASE (VM_OC_ASSIGN)
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
         case VM_OC_MOV_IDENT:
+        VM_THREADED_CASE (VM_OC_MOV_IDENT)
         {
           uint32_t literal_index;
 
@@ -3003,6 +3917,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
         case VM_OC_ASSIGN_PROP:
+        VM_THREADED_CASE (VM_OC_ASSIGN_PROP)
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = left_value;
@@ -3018,6 +3933,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           break;
         }
         case VM_OC_RETURN:
+        VM_THREADED_CASE (VM_OC_RETURN)
         {
           JERRY_ASSERT (opcode == CBC_RETURN
                         || opcode == CBC_RETURN_WITH_BLOCK
@@ -3056,6 +3972,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
         case VM_OC_CALL:
+        VM_THREADED_CASE (VM_OC_CALL)
         {
           frame_ctx_p->call_operation = VM_EXEC_CALL;
           frame_ctx_p->byte_code_p = byte_code_start_p;
@@ -3072,9 +3989,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         case VM_OC_ERROR:
         {
           JERRY_ASSERT (frame_ctx_p->byte_code_p[1] == CBC_EXT_ERROR);
-#if ENABLED (JERRY_DEBUGGER)
-          frame_ctx_p->byte_code_p = JERRY_CONTEXT (debugger_exception_byte_code_p);
-#endif /* ENABLED (JERRY_DEBUGGER) */
+#if ENABLED (JERRY_DEBUGGER) || ENABLED (JERRY_LINE_INFO)
+          /* The error is thrown by the call instruction which suspended the vm_loop. */
+          byte_code_start_p = JERRY_CONTEXT (vm_exception_byte_code_p);
+          frame_ctx_p->byte_code_p = byte_code_start_p;
+#endif /* ENABLED (JERRY_DEBUGGER) || ENABLED (JERRY_LINE_INFO) */
 
           result = ECMA_VALUE_ERROR;
           goto error;
@@ -3137,6 +4056,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
         case VM_OC_JUMP:
+        VM_THREADED_CASE (VM_OC_JUMP)
         {
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
@@ -3159,30 +4079,115 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         case VM_OC_BRANCH_IF_FALSE:
         case VM_OC_BRANCH_IF_LOGICAL_TRUE:
         case VM_OC_BRANCH_IF_LOGICAL_FALSE:
+        VM_THREADED_CASE (VM_OC_BRANCH_IF_TRUE)
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_BRANCH_IF_TRUE;
           ecma_value_t value = *(--stack_top_p);
 
-          bool boolean_value = ecma_op_to_boolean (value);
+          bool boolean_value = ecma_op_to_boolean (value);
+
+          if (opcode_flags & VM_OC_BRANCH_IF_FALSE_FLAG)
+          {
+            boolean_value = !boolean_value;
+          }
+
+          if (boolean_value)
+          {
+            byte_code_p = byte_code_start_p + branch_offset;
+            if (opcode_flags & VM_OC_LOGICAL_BRANCH_FLAG)
+            {
+              /* "Push" the value back to the stack. */
+              ++stack_top_p;
+              continue;
+            }
+          }
+
+          ecma_fast_free_value (value);
+          continue;
+        }
+        case VM_OC_BRANCH_IF_LESS:
+        case VM_OC_BRANCH_IF_GREATER_EQUAL:
+        case VM_OC_BRANCH_IF_GREATER:
+        case VM_OC_BRANCH_IF_LESS_EQUAL:
+#if !ENABLED (JERRY_VM_EXEC_STOP)
+        VM_THREADED_CASE (VM_OC_BRANCH_IF_LESS)
+#endif /* !ENABLED (JERRY_VM_EXEC_STOP) */
+        {
+          uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_BRANCH_IF_LESS;
+          uint16_t literal_index;
+
+          /* The literal arguments follow the branch argument. */
+          READ_LITERAL_INDEX (literal_index);
+          READ_LITERAL (literal_index, left_value);
+          READ_LITERAL_INDEX (literal_index);
+          READ_LITERAL (literal_index, right_value);
+
+          bool is_true;
+
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
+            ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
+
+            if (opcode_flags & VM_OC_BRANCH_IF_SWAPPED_FLAG)
+            {
+              left_integer = (ecma_integer_value_t) right_value;
+              right_integer = (ecma_integer_value_t) left_value;
+            }
+
+            is_true = left_integer < right_integer;
+
+            if (opcode_flags & VM_OC_BRANCH_IF_NOT_LESS_FLAG)
+            {
+              is_true = !is_true;
+            }
+
+            if (is_true)
+            {
+              byte_code_p = byte_code_start_p + branch_offset;
+            }
+
+            /* Integer values do not need to be freed. */
+            continue;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            ecma_number_t left_number = ecma_get_number_from_value (left_value);
+            ecma_number_t right_number = ecma_get_number_from_value (right_value);
+
+            if (opcode_flags & VM_OC_BRANCH_IF_SWAPPED_FLAG)
+            {
+              left_number = ecma_get_number_from_value (right_value);
+              right_number = ecma_get_number_from_value (left_value);
+            }
+
+            /* Comparisons with NaN are always false. */
+            is_true = ((opcode_flags & VM_OC_BRANCH_IF_NOT_LESS_FLAG) ? (right_number <= left_number)
+                                                                       : (left_number < right_number));
+          }
+          else
+          {
+            VM_SAVE_POSITION ();
+            result = opfunc_relation (left_value,
+                                      right_value,
+                                      !(opcode_flags & VM_OC_BRANCH_IF_SWAPPED_FLAG),
+                                      (opcode_flags & VM_OC_BRANCH_IF_NOT_LESS_FLAG) != 0);
+
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
+              goto error;
+            }
 
-          if (opcode_flags & VM_OC_BRANCH_IF_FALSE_FLAG)
-          {
-            boolean_value = !boolean_value;
+            is_true = ecma_is_value_true (result);
           }
 
-          if (boolean_value)
+          if (is_true)
           {
             byte_code_p = byte_code_start_p + branch_offset;
-            if (opcode_flags & VM_OC_LOGICAL_BRANCH_FLAG)
-            {
-              /* "Push" the value back to the stack. */
-              ++stack_top_p;
-              continue;
-            }
           }
 
-          ecma_fast_free_value (value);
-          continue;
+          goto free_both_values;
         }
 #if ENABLED (JERRY_ESNEXT)
         case VM_OC_BRANCH_IF_NULLISH:
@@ -3292,13 +4297,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           goto free_left_value;
         }
         case VM_OC_ADD:
+        VM_THREADED_CASE (VM_OC_ADD)
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
-            *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer + right_integer));
-            continue;
+            ARITHMETIC_PUT_RESULT (ecma_make_int32_value ((int32_t) (left_integer + right_integer)));
           }
 
           if (ecma_is_value_float_number (left_value)
@@ -3307,9 +4312,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t new_value = (ecma_get_float_from_value (left_value) +
                                        ecma_get_number_from_value (right_value));
 
-            *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
-            continue;
+            ARITHMETIC_PUT_RESULT (ecma_update_float_number (left_value, new_value));
           }
 
           if (ecma_is_value_float_number (right_value)
@@ -3318,10 +4322,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t new_value = ((ecma_number_t) ecma_get_integer_from_value (left_value) +
                                        ecma_get_float_from_value (right_value));
 
-            *stack_top_p++ = ecma_update_float_number (right_value, new_value);
-            continue;
+            ARITHMETIC_PUT_RESULT (ecma_update_float_number (right_value, new_value));
           }
 
+          VM_SAVE_POSITION ();
           result = opfunc_addition (left_value, right_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
@@ -3329,10 +4333,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          break;
         }
         case VM_OC_SUB:
+        VM_THREADED_CASE (VM_OC_SUB)
         {
           JERRY_STATIC_ASSERT (ECMA_INTEGER_NUMBER_MAX * 2 <= INT32_MAX
                                && ECMA_INTEGER_NUMBER_MIN * 2 >= INT32_MIN,
@@ -3345,8 +4349,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
-            *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer - right_integer));
-            continue;
+            ARITHMETIC_PUT_RESULT (ecma_make_int32_value ((int32_t) (left_integer - right_integer)));
           }
 
           if (ecma_is_value_float_number (left_value)
@@ -3355,9 +4358,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t new_value = (ecma_get_float_from_value (left_value) -
                                        ecma_get_number_from_value (right_value));
 
-            *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
-            continue;
+            ARITHMETIC_PUT_RESULT (ecma_update_float_number (left_value, new_value));
           }
 
           if (ecma_is_value_float_number (right_value)
@@ -3366,10 +4368,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t new_value = ((ecma_number_t) ecma_get_integer_from_value (left_value) -
                                        ecma_get_float_from_value (right_value));
 
-            *stack_top_p++ = ecma_update_float_number (right_value, new_value);
-            continue;
+            ARITHMETIC_PUT_RESULT (ecma_update_float_number (right_value, new_value));
           }
 
+          VM_SAVE_POSITION ();
           result = do_number_arithmetic (NUMBER_ARITHMETIC_SUBTRACTION,
                                          left_value,
                                          right_value);
@@ -3379,10 +4381,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          break;
         }
         case VM_OC_MUL:
+        VM_THREADED_CASE (VM_OC_MUL)
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
@@ -3403,13 +4405,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                 && left_value != 0
                 && right_value != 0)
             {
-              *stack_top_p++ = ecma_integer_multiply (left_integer, right_integer);
-              continue;
+              ARITHMETIC_PUT_RESULT (ecma_integer_multiply (left_integer, right_integer));
             }
 
             ecma_number_t multiply = (ecma_number_t) left_integer * (ecma_number_t) right_integer;
-            *stack_top_p++ = ecma_make_number_value (multiply);
-            continue;
+            ARITHMETIC_PUT_RESULT (ecma_make_number_value (multiply));
           }
 
           if (ecma_is_value_float_number (left_value)
@@ -3418,9 +4418,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t new_value = (ecma_get_float_from_value (left_value) *
                                        ecma_get_number_from_value (right_value));
 
-            *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
-            continue;
+            ARITHMETIC_PUT_RESULT (ecma_update_float_number (left_value, new_value));
           }
 
           if (ecma_is_value_float_number (right_value)
@@ -3429,10 +4428,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t new_value = ((ecma_number_t) ecma_get_integer_from_value (left_value) *
                                        ecma_get_float_from_value (right_value));
 
-            *stack_top_p++ = ecma_update_float_number (right_value, new_value);
-            continue;
+            ARITHMETIC_PUT_RESULT (ecma_update_float_number (right_value, new_value));
           }
 
+          VM_SAVE_POSITION ();
           result = do_number_arithmetic (NUMBER_ARITHMETIC_MULTIPLICATION,
                                          left_value,
                                          right_value);
@@ -3442,14 +4441,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          break;
         }
         case VM_OC_DIV:
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
 
+          VM_SAVE_POSITION ();
           result = do_number_arithmetic (NUMBER_ARITHMETIC_DIVISION,
                                          left_value,
                                          right_value);
@@ -3459,10 +4458,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          break;
         }
         case VM_OC_MOD:
+        VM_THREADED_CASE (VM_OC_MOD)
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
@@ -3478,12 +4477,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
               if (mod_result != 0 || left_integer >= 0)
               {
-                *stack_top_p++ = ecma_make_integer_value (mod_result);
-                continue;
+                ARITHMETIC_PUT_RESULT (ecma_make_integer_value (mod_result));
               }
             }
           }
 
+          VM_SAVE_POSITION ();
           result = do_number_arithmetic (NUMBER_ARITHMETIC_REMAINDER,
                                          left_value,
                                          right_value);
@@ -3493,12 +4492,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          break;
         }
 #if ENABLED (JERRY_ESNEXT)
         case VM_OC_EXP:
         {
+          VM_SAVE_POSITION ();
           result = do_number_arithmetic (NUMBER_ARITHMETIC_EXPONENTIATION,
                                          left_value,
                                          right_value);
@@ -3537,6 +4536,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           goto free_both_values;
         }
         case VM_OC_STRICT_EQUAL:
+        VM_THREADED_CASE (VM_OC_STRICT_EQUAL)
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
@@ -3546,6 +4546,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           goto free_both_values;
         }
         case VM_OC_STRICT_NOT_EQUAL:
+        VM_THREADED_CASE (VM_OC_STRICT_NOT_EQUAL)
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
@@ -3555,16 +4556,17 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           goto free_both_values;
         }
         case VM_OC_BIT_OR:
+        VM_THREADED_CASE (VM_OC_BIT_OR)
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
 
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
-            *stack_top_p++ = left_value | right_value;
-            continue;
+            ARITHMETIC_PUT_RESULT (left_value | right_value);
           }
 
+          VM_SAVE_POSITION ();
           result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_OR,
                                             left_value,
                                             right_value);
@@ -3574,20 +4576,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          break;
         }
         case VM_OC_BIT_XOR:
+        VM_THREADED_CASE (VM_OC_BIT_XOR)
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
 
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
-            *stack_top_p++ = (left_value ^ right_value) & (ecma_value_t) (~ECMA_DIRECT_TYPE_MASK);
-            continue;
+            ARITHMETIC_PUT_RESULT ((left_value ^ right_value) & (ecma_value_t) (~ECMA_DIRECT_TYPE_MASK));
           }
 
+          VM_SAVE_POSITION ();
           result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_XOR,
                                             left_value,
                                             right_value);
@@ -3597,20 +4599,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          break;
         }
         case VM_OC_BIT_AND:
+        VM_THREADED_CASE (VM_OC_BIT_AND)
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
 
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
-            *stack_top_p++ = left_value & right_value;
-            continue;
+            ARITHMETIC_PUT_RESULT (left_value & right_value);
           }
 
+          VM_SAVE_POSITION ();
           result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_AND,
                                             left_value,
                                             right_value);
@@ -3620,10 +4622,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          break;
         }
         case VM_OC_LEFT_SHIFT:
+        VM_THREADED_CASE (VM_OC_LEFT_SHIFT)
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3632,10 +4634,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
-            *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer << (right_integer & 0x1f)));
-            continue;
+            ARITHMETIC_PUT_RESULT (ecma_make_int32_value ((int32_t) (left_integer << (right_integer & 0x1f))));
           }
 
+          VM_SAVE_POSITION ();
           result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_LEFT,
                                             left_value,
                                             right_value);
@@ -3645,10 +4647,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          break;
         }
         case VM_OC_RIGHT_SHIFT:
+        VM_THREADED_CASE (VM_OC_RIGHT_SHIFT)
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3657,10 +4659,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
-            *stack_top_p++ = ecma_make_integer_value (left_integer >> (right_integer & 0x1f));
-            continue;
+            ARITHMETIC_PUT_RESULT (ecma_make_integer_value (left_integer >> (right_integer & 0x1f)));
           }
 
+          VM_SAVE_POSITION ();
           result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_RIGHT,
                                             left_value,
                                             right_value);
@@ -3670,10 +4672,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          break;
         }
         case VM_OC_UNS_RIGHT_SHIFT:
+        VM_THREADED_CASE (VM_OC_UNS_RIGHT_SHIFT)
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3682,10 +4684,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             uint32_t left_uint32 = (uint32_t) ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
-            *stack_top_p++ = ecma_make_uint32_value (left_uint32 >> (right_integer & 0x1f));
-            continue;
+            ARITHMETIC_PUT_RESULT (ecma_make_uint32_value (left_uint32 >> (right_integer & 0x1f)));
           }
 
+          VM_SAVE_POSITION ();
           result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_URIGHT,
                                             left_value,
                                             right_value);
@@ -3695,10 +4697,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          break;
         }
         case VM_OC_LESS:
+        VM_THREADED_CASE (VM_OC_LESS)
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3751,6 +4753,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto free_both_values;
           }
 
+          VM_SAVE_POSITION ();
           result = opfunc_relation (left_value, right_value, true, false);
 
           if (ECMA_IS_VALUE_ERROR (result))
@@ -3762,6 +4765,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           goto free_both_values;
         }
         case VM_OC_GREATER:
+        VM_THREADED_CASE (VM_OC_GREATER)
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3781,6 +4785,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto free_both_values;
           }
 
+          VM_SAVE_POSITION ();
           result = opfunc_relation (left_value, right_value, false, false);
 
           if (ECMA_IS_VALUE_ERROR (result))
@@ -3792,6 +4797,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           goto free_both_values;
         }
         case VM_OC_LESS_EQUAL:
+        VM_THREADED_CASE (VM_OC_LESS_EQUAL)
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3811,6 +4817,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto free_both_values;
           }
 
+          VM_SAVE_POSITION ();
           result = opfunc_relation (left_value, right_value, false, true);
 
           if (ECMA_IS_VALUE_ERROR (result))
@@ -3822,6 +4829,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           goto free_both_values;
         }
         case VM_OC_GREATER_EQUAL:
+        VM_THREADED_CASE (VM_OC_GREATER_EQUAL)
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3841,6 +4849,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto free_both_values;
           }
 
+          VM_SAVE_POSITION ();
           result = opfunc_relation (left_value, right_value, true, true);
 
           if (ECMA_IS_VALUE_ERROR (result))
@@ -4530,23 +5539,6 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #endif /* ENABLED (JERRY_DEBUGGER) */
-#if ENABLED (JERRY_LINE_INFO)
-        case VM_OC_LINE:
-        {
-          uint32_t value = 0;
-          uint8_t byte;
-
-          do
-          {
-            byte = *byte_code_p++;
-            value = (value << 7) | (byte & CBC_LOWER_SEVEN_BIT_MASK);
-          }
-          while (byte & CBC_HIGHEST_BIT_MASK);
-
-          frame_ctx_p->current_line = value;
-          continue;
-        }
-#endif /* ENABLED (JERRY_LINE_INFO) */
         case VM_OC_NONE:
         default:
         {
@@ -4578,6 +5570,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         {
           ecma_string_t *var_name_str_p = ecma_get_string_from_value (literal_start_p[literal_index]);
 
+          VM_SAVE_POSITION ();
           ecma_value_t put_value_result = ecma_op_put_value_lex_env_base (frame_ctx_p->lex_env_p,
                                                                           var_name_str_p,
                                                                           is_strict,
@@ -4615,7 +5608,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         else
         {
-          ecma_value_t set_value_result = vm_op_set_value (base,
+          VM_SAVE_POSITION ();
+          ecma_value_t set_value_result = vm_op_set_value (frame_ctx_p,
+                                                           byte_code_start_p,
+                                                           base,
                                                            property,
                                                            result,
                                                            is_strict);
@@ -4660,6 +5656,16 @@ error:
       JERRY_ASSERT (jcontext_has_pending_exception ());
       ecma_value_t *stack_bottom_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
 
+#if ENABLED (JERRY_LINE_INFO)
+      /* The position of the frame is only saved by calls and error completions. */
+      frame_ctx_p->byte_code_p = byte_code_start_p;
+
+      if (JERRY_CONTEXT (vm_backtrace_error_p) != NULL)
+      {
+        vm_update_backtrace (frame_ctx_p);
+      }
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
       while (stack_top_p > stack_bottom_p)
       {
         ecma_value_t stack_item = *(--stack_top_p);
@@ -4847,9 +5853,6 @@ vm_init_exec (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
   frame_ctx_p->prev_context_p = JERRY_CONTEXT (vm_top_context_p);
   frame_ctx_p->block_result = ECMA_VALUE_UNDEFINED;
-#if ENABLED (JERRY_LINE_INFO)
-  frame_ctx_p->current_line = 0;
-#endif /* ENABLED (JERRY_LINE_INFO) */
   frame_ctx_p->context_depth = 0;
   frame_ctx_p->status_flags = (uint8_t) ((shared_p->status_flags & VM_FRAME_CTX_DIRECT_EVAL)
                                          | (bytecode_header_p->status_flags & VM_FRAME_CTX_IS_STRICT));
@@ -4884,6 +5887,9 @@ vm_init_exec (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
   frame_ctx_p->byte_code_p = (uint8_t *) literal_p;
   frame_ctx_p->byte_code_start_p = (uint8_t *) literal_p;
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+  frame_ctx_p->inline_cache_p = NULL;
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
   frame_ctx_p->stack_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end;
 
   uint32_t arg_list_len = 0;
@@ -4922,6 +5928,304 @@ vm_init_exec (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   JERRY_CONTEXT (vm_top_context_p) = frame_ctx_p;
 } /* vm_init_exec */
 
+/**
+ * Get the size of the frame context, the registers and the stack of a compiled code.
+ *
+ * @return size in uintptr_t units
+ */
+static size_t
+vm_get_frame_size (const ecma_compiled_code_t *bytecode_header_p) /**< byte-code data */
+{
+  size_t frame_size;
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
+    frame_size = (size_t) (args_p->register_end + args_p->stack_limit);
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
+    frame_size = (size_t) (args_p->register_end + args_p->stack_limit);
+  }
+
+  frame_size = frame_size * sizeof (ecma_value_t) + sizeof (vm_frame_ctx_t);
+  return (frame_size + sizeof (uintptr_t) - 1) / sizeof (uintptr_t);
+} /* vm_get_frame_size */
+
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+
+/**
+ * Allocate a frame on the top of the frame stack.
+ *
+ * @return pointer to the frame - if success
+ *         NULL - if the engine heap is exhausted
+ */
+static void *
+vm_alloc_frame (size_t frame_size) /**< size of the frame */
+{
+  vm_frame_segment_t *segment_p = JERRY_CONTEXT (vm_frame_segment_p);
+
+  if (JERRY_LIKELY (segment_p != NULL && frame_size <= segment_p->size - segment_p->top))
+  {
+    void *frame_p = ((uint8_t *) segment_p) + segment_p->top;
+    segment_p->top += (uint32_t) frame_size;
+    return frame_p;
+  }
+
+  size_t segment_size = JERRY_MAX (frame_size + sizeof (vm_frame_segment_t), VM_FRAME_SEGMENT_SIZE);
+  vm_frame_segment_t *new_segment_p = JERRY_CONTEXT (vm_frame_free_segment_p);
+
+  if (new_segment_p != NULL && new_segment_p->size >= segment_size)
+  {
+    JERRY_CONTEXT (vm_frame_free_segment_p) = NULL;
+  }
+  else
+  {
+    vm_free_unused_frame_segments ();
+
+    new_segment_p = (vm_frame_segment_t *) jmem_heap_alloc_block_null_on_error (segment_size);
+
+    if (JERRY_UNLIKELY (new_segment_p == NULL))
+    {
+      return NULL;
+    }
+
+    new_segment_p->size = (uint32_t) segment_size;
+  }
+
+  new_segment_p->prev_p = JERRY_CONTEXT (vm_frame_segment_p);
+  new_segment_p->top = (uint32_t) (sizeof (vm_frame_segment_t) + frame_size);
+  JERRY_CONTEXT (vm_frame_segment_p) = new_segment_p;
+
+  return new_segment_p + 1;
+} /* vm_alloc_frame */
+
+/**
+ * Free the frame on the top of the frame stack.
+ */
+static void
+vm_free_frame (void *frame_p, /**< frame */
+               size_t frame_size) /**< size of the frame */
+{
+  vm_frame_segment_t *segment_p = JERRY_CONTEXT (vm_frame_segment_p);
+
+  JERRY_ASSERT (segment_p != NULL && segment_p->top >= sizeof (vm_frame_segment_t) + frame_size);
+
+  segment_p->top -= (uint32_t) frame_size;
+
+  JERRY_ASSERT ((uint8_t *) frame_p == ((uint8_t *) segment_p) + segment_p->top);
+  JERRY_UNUSED (frame_p);
+
+  if (segment_p->top > sizeof (vm_frame_segment_t))
+  {
+    return;
+  }
+
+  /* The segment is empty: it is kept for reuse since the next
+   * call is likely to need a segment again. */
+  JERRY_CONTEXT (vm_frame_segment_p) = segment_p->prev_p;
+  vm_free_unused_frame_segments ();
+  JERRY_CONTEXT (vm_frame_free_segment_p) = segment_p;
+} /* vm_free_frame */
+
+/**
+ * Free the frame stack segment kept for reuse.
+ */
+void
+vm_free_unused_frame_segments (void)
+{
+  vm_frame_segment_t *segment_p = JERRY_CONTEXT (vm_frame_free_segment_p);
+
+  if (segment_p != NULL)
+  {
+    JERRY_CONTEXT (vm_frame_free_segment_p) = NULL;
+    jmem_heap_free_block (segment_p, segment_p->size);
+  }
+} /* vm_free_unused_frame_segments */
+
+/**
+ * Check whether the value is an object whose reference counter is close to its limit.
+ *
+ * Note:
+ *      a call holds a few references to the called function, the 'this' value and the
+ *      arguments, so a deep recursion must be stopped before these counters overflow
+ *
+ * @return true - if the value is an object with too many references
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+vm_call_frame_is_ref_limit (ecma_value_t value) /**< value held by a call */
+{
+  if (!ecma_is_value_object (value))
+  {
+    return false;
+  }
+
+  uint32_t refs = ecma_get_object_from_value (value)->type_flags_refs & ECMA_OBJECT_REF_MASK;
+
+  /* Larger values represent unreferenced objects during garbage collection. */
+  return (refs >= ECMA_OBJECT_MAX_REF - VM_CALL_FRAME_REF_RESERVE * ECMA_OBJECT_REF_ONE
+          && refs <= ECMA_OBJECT_MAX_REF);
+} /* vm_call_frame_is_ref_limit */
+
+/**
+ * Start a call of a function by the byte code without a recursive vm_run: the
+ * function is executed by the vm_execute of the caller on a call frame.
+ *
+ * Note:
+ *      only the calls of byte code functions which need no further processing
+ *      after their execution are started this way
+ *
+ * @return frame context of the called function - if the call is started
+ *         frame context of the caller - if the call is finished with a RangeError, because a
+ *                                       reference counter or the engine heap is exhausted
+ *         NULL - otherwise, and the call must be performed by opfunc_call
+ */
+static vm_frame_ctx_t *
+vm_call_frame_enter (vm_frame_ctx_t *frame_ctx_p) /**< frame context of the caller */
+{
+  if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_DIRECT_EVAL)
+  {
+    return NULL;
+  }
+
+  const uint8_t *byte_code_p = frame_ctx_p->byte_code_p;
+  uint8_t opcode = byte_code_p[0];
+  uint32_t arguments_list_len;
+
+  if (opcode >= CBC_CALL0)
+  {
+    arguments_list_len = (unsigned int) ((opcode - CBC_CALL0) / 6);
+  }
+  else
+  {
+    arguments_list_len = byte_code_p[1];
+  }
+
+  ecma_value_t *arguments_list_p = frame_ctx_p->stack_top_p - arguments_list_len;
+  ecma_value_t func_value = arguments_list_p[-1];
+
+  if (!ecma_is_value_object (func_value))
+  {
+    return NULL;
+  }
+
+  ecma_object_t *func_obj_p = ecma_get_object_from_value (func_value);
+
+  if (ecma_get_object_type (func_obj_p) != ECMA_OBJECT_TYPE_FUNCTION
+      || ecma_get_object_is_builtin (func_obj_p))
+  {
+    return NULL;
+  }
+
+  ecma_extended_object_t *ext_func_p = (ecma_extended_object_t *) func_obj_p;
+  const ecma_compiled_code_t *bytecode_header_p = ecma_op_function_get_compiled_code (ext_func_p);
+  uint16_t status_flags = bytecode_header_p->status_flags;
+
+  /* Lazy functions are compiled by ecma_op_function_call. Arrow functions,
+   * class constructors, generators and async functions are called by
+   * ecma_op_function_call as well, since they need extra processing. */
+  if (status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION)
+  {
+    return NULL;
+  }
+
+#if ENABLED (JERRY_ESNEXT)
+  uint16_t function_type = CBC_FUNCTION_GET_TYPE (status_flags);
+
+  if (function_type != CBC_FUNCTION_NORMAL
+      && function_type != CBC_FUNCTION_ACCESSOR
+      && function_type != CBC_FUNCTION_METHOD)
+  {
+    return NULL;
+  }
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+  size_t call_frame_size = offsetof (vm_call_frame_t, frame_ctx);
+  call_frame_size += vm_get_frame_size (bytecode_header_p) * sizeof (uintptr_t);
+
+  bool is_call_prop = ((opcode - CBC_CALL) % 6) >= 3;
+  ecma_value_t this_binding = is_call_prop ? arguments_list_p[-3] : ECMA_VALUE_UNDEFINED;
+  vm_call_frame_t *call_frame_p = NULL;
+
+  /* Without native recursion, the depth of the calls is limited by the
+   * reference counters of the objects held by the frames of the calls. */
+  if (JERRY_LIKELY (!vm_call_frame_is_ref_limit (func_value)
+                    && !vm_call_frame_is_ref_limit (this_binding)))
+  {
+    uint32_t i = 0;
+
+    while (i < arguments_list_len && !vm_call_frame_is_ref_limit (arguments_list_p[i]))
+    {
+      i++;
+    }
+
+    if (JERRY_LIKELY (i == arguments_list_len))
+    {
+      call_frame_p = (vm_call_frame_t *) vm_alloc_frame (call_frame_size);
+    }
+  }
+
+  if (JERRY_UNLIKELY (call_frame_p == NULL))
+  {
+    opfunc_call_complete (frame_ctx_p, ecma_raise_range_error (ECMA_ERR_MSG ("Maximum call stack size exceeded.")));
+    return frame_ctx_p;
+  }
+
+  call_frame_p->size = (uint32_t) call_frame_size;
+  call_frame_p->shared_args.header.bytecode_header_p = bytecode_header_p;
+  call_frame_p->shared_args.header.status_flags = (VM_FRAME_CTX_SHARED_HAS_ARG_LIST
+                                                   | VM_FRAME_CTX_SHARED_CALL_FRAME);
+  call_frame_p->shared_args.function_object_p = func_obj_p;
+  call_frame_p->shared_args.arg_list_p = arguments_list_p;
+  call_frame_p->shared_args.arg_list_len = arguments_list_len;
+
+#if ENABLED (JERRY_ESNEXT)
+  call_frame_p->old_new_target_p = JERRY_CONTEXT (current_new_target);
+  JERRY_CONTEXT (current_new_target) = NULL;
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+  this_binding = ecma_op_function_enter (&call_frame_p->shared_args, this_binding, &call_frame_p->lex_env_p);
+
+  vm_frame_ctx_t *callee_frame_ctx_p = &call_frame_p->frame_ctx;
+  callee_frame_ctx_p->shared_p = &call_frame_p->shared_args.header;
+  callee_frame_ctx_p->lex_env_p = call_frame_p->lex_env_p;
+  callee_frame_ctx_p->this_binding = this_binding;
+
+  vm_init_exec (callee_frame_ctx_p);
+  return callee_frame_ctx_p;
+} /* vm_call_frame_enter */
+
+/**
+ * Finish the call started by vm_call_frame_enter after the
+ * called function returned, and release its call frame.
+ *
+ * @return frame context of the caller
+ */
+static vm_frame_ctx_t *
+vm_call_frame_leave (vm_frame_ctx_t *frame_ctx_p, /**< frame context of the called function */
+                     ecma_value_t completion_value) /**< result of the called function */
+{
+  vm_call_frame_t *call_frame_p = VM_GET_CALL_FRAME (frame_ctx_p);
+  vm_frame_ctx_t *caller_frame_ctx_p = frame_ctx_p->prev_context_p;
+
+  JERRY_ASSERT (call_frame_p->shared_args.header.status_flags & VM_FRAME_CTX_SHARED_CALL_FRAME);
+
+  ecma_op_function_leave (&call_frame_p->shared_args, frame_ctx_p->this_binding, call_frame_p->lex_env_p);
+
+#if ENABLED (JERRY_ESNEXT)
+  JERRY_CONTEXT (current_new_target) = call_frame_p->old_new_target_p;
+#endif /* ENABLED (JERRY_ESNEXT) */
+
+  vm_free_frame (call_frame_p, call_frame_p->size);
+
+  opfunc_call_complete (caller_frame_ctx_p, completion_value);
+  return caller_frame_ctx_p;
+} /* vm_call_frame_leave */
+
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
+
 /**
  * Resume execution of a code block.
  *
@@ -4938,6 +6242,15 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
     {
       case VM_EXEC_CALL:
       {
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+        vm_frame_ctx_t *callee_frame_ctx_p = vm_call_frame_enter (frame_ctx_p);
+
+        if (callee_frame_ctx_p != NULL)
+        {
+          frame_ctx_p = callee_frame_ctx_p;
+          break;
+        }
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
         opfunc_call (frame_ctx_p);
         break;
       }
@@ -4995,6 +6308,14 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #endif /* ENABLED (JERRY_DEBUGGER) */
 
         JERRY_CONTEXT (vm_top_context_p) = frame_ctx_p->prev_context_p;
+
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+        if (frame_ctx_p->shared_p->status_flags & VM_FRAME_CTX_SHARED_CALL_FRAME)
+        {
+          frame_ctx_p = vm_call_frame_leave (frame_ctx_p, completion_value);
+          break;
+        }
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
         return completion_value;
       }
     }
@@ -5011,35 +6332,37 @@ vm_run (vm_frame_ctx_shared_t *shared_p, /**< shared data */
         ecma_value_t this_binding_value, /**< value of 'ThisBinding' */
         ecma_object_t *lex_env_p) /**< lexical environment to use */
 {
-  const ecma_compiled_code_t *bytecode_header_p = shared_p->bytecode_header_p;
   vm_frame_ctx_t *frame_ctx_p;
-  size_t frame_size;
+  size_t frame_size = vm_get_frame_size (shared_p->bytecode_header_p);
 
-  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
-  {
-    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
-    frame_size = (size_t) (args_p->register_end + args_p->stack_limit);
-  }
-  else
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+  frame_size *= sizeof (uintptr_t);
+  frame_ctx_p = (vm_frame_ctx_t *) vm_alloc_frame (frame_size);
+
+  if (JERRY_UNLIKELY (frame_ctx_p == NULL))
   {
-    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
-    frame_size = (size_t) (args_p->register_end + args_p->stack_limit);
+    return ecma_raise_range_error (ECMA_ERR_MSG ("Maximum call stack size exceeded."));
   }
-
-  frame_size = frame_size * sizeof (ecma_value_t) + sizeof (vm_frame_ctx_t);
-  frame_size = (frame_size + sizeof (uintptr_t) - 1) / sizeof (uintptr_t);
-
+#else /* !ENABLED (JERRY_VM_HEAP_FRAMES) */
   /* Use JERRY_MAX() to avoid array declaration with size 0. */
   JERRY_VLA (uintptr_t, stack, frame_size);
 
   frame_ctx_p = (vm_frame_ctx_t *) stack;
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
 
   frame_ctx_p->shared_p = shared_p;
   frame_ctx_p->lex_env_p = lex_env_p;
   frame_ctx_p->this_binding = this_binding_value;
 
   vm_init_exec (frame_ctx_p);
+
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+  ecma_value_t completion_value = vm_execute (frame_ctx_p);
+  vm_free_frame (frame_ctx_p, frame_size);
+  return completion_value;
+#else /* !ENABLED (JERRY_VM_HEAP_FRAMES) */
   return vm_execute (frame_ctx_p);
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
 } /* vm_run */
 
 /**
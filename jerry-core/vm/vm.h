@@ -172,6 +172,12 @@ typedef enum
   VM_OC_BRANCH_IF_LOGICAL_TRUE,  /**< branch if logical true */
   VM_OC_BRANCH_IF_LOGICAL_FALSE, /**< branch if logical false */
 
+  /* These four opcodes must be in this order. */
+  VM_OC_BRANCH_IF_LESS,          /**< branch if less */
+  VM_OC_BRANCH_IF_GREATER_EQUAL, /**< branch if greater equal */
+  VM_OC_BRANCH_IF_GREATER,       /**< branch if greater */
+  VM_OC_BRANCH_IF_LESS_EQUAL,    /**< branch if less equal */
+
   VM_OC_PLUS,                    /**< unary plus */
   VM_OC_MINUS,                   /**< unary minus */
   VM_OC_NOT,                     /**< not */
@@ -233,9 +239,6 @@ typedef enum
   VM_OC_BREAKPOINT_ENABLED,      /**< enabled breakpoint for debugger */
   VM_OC_BREAKPOINT_DISABLED,     /**< disabled breakpoint for debugger */
 #endif /* ENABLED (JERRY_DEBUGGER) */
-#if ENABLED (JERRY_LINE_INFO)
-  VM_OC_LINE,                    /**< line number of the next statement */
-#endif /* ENABLED (JERRY_LINE_INFO) */
 #if ENABLED (JERRY_ESNEXT)
   VM_OC_CHECK_VAR,               /**< check redeclared vars in the global scope */
   VM_OC_CHECK_LET,               /**< check redeclared lets in the global scope */
@@ -319,9 +322,6 @@ typedef enum
   VM_OC_BREAKPOINT_ENABLED = VM_OC_NONE,      /**< enabled breakpoint for debugger is unused */
   VM_OC_BREAKPOINT_DISABLED = VM_OC_NONE,     /**< disabled breakpoint for debugger is unused */
 #endif /* !ENABLED (JERRY_DEBUGGER) */
-#if !ENABLED (JERRY_LINE_INFO)
-  VM_OC_LINE = VM_OC_NONE,                    /**< line number of the next statement is unused */
-#endif /* !ENABLED (JERRY_LINE_INFO) */
 #if !ENABLED (JERRY_ESNEXT)
   VM_OC_EXT_VAR_EVAL = VM_OC_NONE,            /**< variable and function evaluation for
                                                *   functions with separate argument context */
@@ -420,6 +420,16 @@ typedef enum
  */
 #define VM_OC_LOGICAL_BRANCH_FLAG 0x2
 
+/**
+ * Branch if the left operand is not less than the right operand.
+ */
+#define VM_OC_BRANCH_IF_NOT_LESS_FLAG 0x1
+
+/**
+ * Swap the operands before the comparison.
+ */
+#define VM_OC_BRANCH_IF_SWAPPED_FLAG 0x2
+
 /**
  * Bit index shift for non-static property initializers.
  */
@@ -487,11 +497,24 @@ ecma_value_t vm_run_module (const ecma_compiled_code_t *bytecode_p, ecma_object_
 ecma_value_t vm_run (vm_frame_ctx_shared_t *shared_p, ecma_value_t this_binding_value, ecma_object_t *lex_env_p);
 ecma_value_t vm_execute (vm_frame_ctx_t *frame_ctx_p);
 
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+void vm_free_unused_frame_segments (void);
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
+
+#if ENABLED (JERRY_VM_INLINE_CACHE)
+void vm_inline_cache_free_table (const ecma_compiled_code_t *bytecode_p);
+void vm_inline_cache_invalidate_all (void);
+#endif /* ENABLED (JERRY_VM_INLINE_CACHE) */
+
 bool vm_is_strict_mode (void);
 bool vm_is_direct_eval_form_call (void);
 
 ecma_value_t vm_get_backtrace (uint32_t max_depth);
 
+#if ENABLED (JERRY_LINE_INFO)
+void vm_update_backtrace (const vm_frame_ctx_t *frame_ctx_p);
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
 /**
  * @}
  * @}
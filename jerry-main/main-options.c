@@ -33,6 +33,7 @@ typedef enum
   OPT_VERSION,
   OPT_MEM_STATS,
   OPT_PARSE_ONLY,
+  OPT_LAZY_FUNCTIONS,
   OPT_SHOW_OP,
   OPT_SHOW_RE_OP,
   OPT_DEBUG_SERVER,
@@ -62,6 +63,9 @@ static const cli_opt_t main_opts[] =
                .help = "dump memory statistics"),
   CLI_OPT_DEF (.id = OPT_PARSE_ONLY, .longopt = "parse-only",
                .help = "don't execute JS input"),
+  CLI_OPT_DEF (.id = OPT_LAZY_FUNCTIONS, .longopt = "lazy-functions",
+               .help = "generate the byte code of functions on their first call (keeps the sources loaded, "
+                       "syntax errors of function bodies are reported by the first call)"),
   CLI_OPT_DEF (.id = OPT_SHOW_OP, .longopt = "show-opcodes",
                .help = "dump parser byte-code"),
   CLI_OPT_DEF (.id = OPT_SHOW_RE_OP, .longopt = "show-regexp-opcodes",
@@ -185,6 +189,11 @@ main_parse_args (int argc, /**< argc */
         arguments_p->option_flags |= OPT_FLAG_PARSE_ONLY;
         break;
       }
+      case OPT_LAZY_FUNCTIONS:
+      {
+        arguments_p->option_flags |= OPT_FLAG_LAZY_FUNCTIONS;
+        break;
+      }
       case OPT_SHOW_OP:
       {
         if (check_feature (JERRY_FEATURE_PARSER_DUMP, cli_state.arg))
@@ -23,12 +23,13 @@
  */
 typedef enum
 {
-  OPT_FLAG_EMPTY        = 0,
-  OPT_FLAG_PARSE_ONLY   = (1 << 0),
-  OPT_FLAG_DEBUG_SERVER = (1 << 1),
-  OPT_FLAG_WAIT_SOURCE  = (1 << 2),
-  OPT_FLAG_NO_PROMPT    = (1 << 3),
-  OPT_FLAG_USE_STDIN    = (1 << 4),
+  OPT_FLAG_EMPTY          = 0,
+  OPT_FLAG_PARSE_ONLY     = (1 << 0),
+  OPT_FLAG_DEBUG_SERVER   = (1 << 1),
+  OPT_FLAG_WAIT_SOURCE    = (1 << 2),
+  OPT_FLAG_NO_PROMPT      = (1 << 3),
+  OPT_FLAG_USE_STDIN      = (1 << 4),
+  OPT_FLAG_LAZY_FUNCTIONS = (1 << 5),
 } main_option_flags_t;
 
 /**
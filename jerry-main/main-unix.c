@@ -63,12 +63,21 @@ main (int argc,
 
   main_parse_args (argc, argv, &arguments);
 
+  /* Lazy functions refer to the source code until the engine is cleaned up. */
+  JERRY_VLA (uint8_t *, lazy_sources_p, argc);
+  uint32_t lazy_source_count = 0;
+
 #if defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1)
   jerry_context_t *context_p = jerry_create_context (JERRY_GLOBAL_HEAP_SIZE * 1024, context_alloc, NULL);
   jerry_port_default_set_current_context (context_p);
 #endif /* defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1) */
 
 restart:
+  while (lazy_source_count > 0)
+  {
+    jerry_port_release_source (lazy_sources_p[--lazy_source_count]);
+  }
+
   main_init_engine (&arguments);
   int return_code = JERRY_STANDALONE_EXIT_CODE_FAIL;
   jerry_value_t ret_value;
@@ -109,13 +118,26 @@ restart:
           goto exit;
         }
 
-        ret_value = jerry_parse ((jerry_char_t *) file_path_p,
-                                 strlen (file_path_p),
-                                 source_p,
-                                 source_size,
-                                 JERRY_PARSE_NO_OPTS);
+        if (arguments.option_flags & OPT_FLAG_LAZY_FUNCTIONS)
+        {
+          ret_value = jerry_parse ((jerry_char_t *) file_path_p,
+                                   strlen (file_path_p),
+                                   source_p,
+                                   source_size,
+                                   JERRY_PARSE_LAZY_FUNCTIONS);
 
-        jerry_port_release_source (source_p);
+          lazy_sources_p[lazy_source_count++] = source_p;
+        }
+        else
+        {
+          ret_value = jerry_parse ((jerry_char_t *) file_path_p,
+                                   strlen (file_path_p),
+                                   source_p,
+                                   source_size,
+                                   JERRY_PARSE_NO_OPTS);
+
+          jerry_port_release_source (source_p);
+        }
 
         if (!jerry_value_is_error (ret_value) && !(arguments.option_flags & OPT_FLAG_PARSE_ONLY))
         {
@@ -323,6 +345,11 @@ restart:
 exit:
   jerry_cleanup ();
 
+  while (lazy_source_count > 0)
+  {
+    jerry_port_release_source (lazy_sources_p[--lazy_source_count]);
+  }
+
 #if defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1)
   free (context_p);
 #endif /* defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1) */
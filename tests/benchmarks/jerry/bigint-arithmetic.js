@@ -0,0 +1,60 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Multiplies, divides, raises to a power and converts to decimal strings
+ * BigInt values between 64 and 16384 bits. The schoolbook multiplication
+ * and the digit by digit radix conversion are quadratic in the size of
+ * the operands (see JERRY_BIGINT_KARATSUBA_THRESHOLD). */
+var bits = [64, 256, 1024, 4096, 16384];
+var seed = 0x2545f491n;
+var checksum = 0n;
+
+function random_bigint (size) {
+  var result = 1n;
+
+  for (var i = 0; i < size; i += 32) {
+    seed = (seed * 1103515245n + 12345n) & 0xffffffffn;
+    result = (result << 32n) | seed;
+  }
+
+  return result;
+}
+
+function measure (name, size, count, callback) {
+  var start = Date.now ();
+
+  for (var i = 0; i < count; i++) {
+    checksum += callback () & 0xffffn;
+  }
+
+  print (name + " " + size + " bits x " + count + ": " + (Date.now () - start) + " ms");
+}
+
+for (var s = 0; s < bits.length; s++) {
+  var size = bits[s];
+  var count = 16777216 / size;
+  var left = random_bigint (size);
+  var right = random_bigint (size);
+  var product = left * right;
+  var power = random_bigint (64);
+  var exponent = BigInt (size / 64);
+
+  measure ("mul", size, count, function () { return left * right; });
+  measure ("div", size, count, function () { return product / left; });
+  measure ("pow", size, count, function () { return power ** exponent; });
+  measure ("toString", size, count / 8, function () { return BigInt (left.toString ().length); });
+}
+
+print ("checksum: " + checksum);
+assert (typeof checksum === "bigint");
@@ -0,0 +1,56 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Looks up the keys of many dictionary-like objects with 10-30 keys. These
+ * objects are too small to get a property hashmap by a single lookup, and
+ * too many to keep their properties in the lookup cache, so they are
+ * searched linearly unless frequently searched objects get a hashmap. */
+var sizes = [10, 20, 30];
+var count = 200;
+var checksum = 0;
+
+for (var s = 0; s < sizes.length; s++) {
+  var size = sizes[s];
+  var dicts = [];
+  var keys = [];
+
+  for (var i = 0; i < size; i++) {
+    keys.push ("key" + i);
+  }
+
+  for (var d = 0; d < count; d++) {
+    var dict = {};
+    for (var i = 0; i < size; i++) {
+      dict[keys[i]] = i;
+    }
+    dicts.push (dict);
+  }
+
+  var start = Date.now ();
+  var sum = 0;
+
+  for (var round = 0; round < 100; round++) {
+    for (var i = 0; i < size; i++) {
+      var key = keys[(i * 7) % size];
+      for (var d = 0; d < count; d++) {
+        sum += dicts[d][key];
+      }
+    }
+  }
+
+  print ("Dictionaries with " + size + " keys: " + (Date.now () - start) + " ms");
+  checksum += sum;
+}
+
+assert (checksum === 100 * count * (45 + 190 + 435));
@@ -0,0 +1,53 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Builds a long linked list and a deep JSON tree and collects garbage while
+ * both are alive. Every collection has to mark the whole object graph, so the
+ * run time shows how the marking phase scales with the depth of the graph. */
+var sizes = [1000, 10000, 50000];
+var checksum = 0;
+
+for (var s = 0; s < sizes.length; s++) {
+  var size = sizes[s];
+  var list = null;
+
+  for (var i = 0; i < size; i++) {
+    list = { value: i, next: list };
+  }
+
+  var text = "";
+  for (var i = 0; i < size / 10; i++) {
+    text += '{"id":' + i + ',"child":';
+  }
+  text += "null";
+  for (var i = 0; i < size / 10; i++) {
+    text += "}";
+  }
+
+  var tree = JSON.parse (text);
+  var start = Date.now ();
+
+  for (var i = 0; i < 10; i++) {
+    gc ();
+  }
+
+  print ("Graph size " + size + ": " + (Date.now () - start) + " ms");
+
+  checksum += list.value + tree.id;
+  list = null;
+  tree = null;
+}
+
+assert (checksum === 999 + 9999 + 49999);
@@ -0,0 +1,45 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Keeps a large long-lived object graph alive while many short-lived
+ * objects are allocated. The garbage collections triggered by the allocations
+ * mark the long-lived graph again and again, unless only the young objects
+ * are collected (see JERRY_GC_GENERATIONAL). */
+var sizes = [0, 2000, 4000];
+var checksum = 0;
+
+for (var s = 0; s < sizes.length; s++) {
+  var size = sizes[s];
+  var list = null;
+
+  for (var i = 0; i < size; i++) {
+    list = { value: i, next: list };
+  }
+
+  var start = Date.now ();
+  var sum = 0;
+
+  for (var i = 0; i < 200000; i++) {
+    var point = { x: i, y: i + 1 };
+    sum += point.y - point.x;
+  }
+
+  print ("Long-lived objects " + size + ": " + (Date.now () - start) + " ms");
+
+  checksum += sum;
+  list = null;
+}
+
+assert (checksum === 3 * 200000);
@@ -0,0 +1,144 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Pause length of full and incremental garbage collections.
+ *
+ * A script keeps about 6000 objects alive, then the same number of cycles
+ * is performed by jerry_gc and by jerry_gc_step with different budgets. The
+ * duration of each call is read from the gc_time_us field of the heap
+ * statistics, and the longest call of each mode is printed.
+ *
+ * The benchmark is built with the unit tests, but it is not a unit test.
+ * The heap statistics must be enabled:
+ *
+ *   tools/build.py --builddir=build/gc-pause --unittests=on --mem-stats=on
+ *   build/gc-pause/tests/bench-gc-pause
+ */
+
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+/* Number of measured cycles of each mode. */
+#define PAUSE_CYCLES (20)
+
+/* Script which keeps about 6000 objects alive. */
+static const char pause_script[] =
+  "var live = [];\n"
+  "for (var i = 0; i < 2000; i++) {\n"
+  "  live.push ({ index: i, data: [i], next: { value: i } });\n"
+  "}\n";
+
+/**
+ * Get the duration of the last garbage collection call.
+ *
+ * @return duration in microseconds
+ */
+static size_t
+pause_last_time (void)
+{
+  jerry_heap_stats_t stats;
+  memset (&stats, 0, sizeof (stats));
+
+  bool is_ok = jerry_get_memory_stats (&stats);
+  TEST_ASSERT (is_ok);
+  return stats.gc_time_us;
+} /* pause_last_time */
+
+/**
+ * Measure full garbage collections.
+ */
+static void
+pause_measure_full (void)
+{
+  size_t max_time = 0;
+  size_t total_time = 0;
+
+  for (uint32_t i = 0; i < PAUSE_CYCLES; i++)
+  {
+    jerry_gc (JERRY_GC_PRESSURE_LOW);
+
+    size_t time = pause_last_time ();
+    total_time += time;
+    max_time = (time > max_time) ? time : max_time;
+  }
+
+  printf ("full collection:     max pause %4u us, %4u us per cycle\n",
+          (unsigned) max_time,
+          (unsigned) (total_time / PAUSE_CYCLES));
+} /* pause_measure_full */
+
+/**
+ * Measure incremental garbage collections.
+ */
+static void
+pause_measure_steps (uint32_t budget) /**< number of objects marked by a step */
+{
+  size_t max_time = 0;
+  size_t total_time = 0;
+  uint32_t steps = 0;
+
+  for (uint32_t i = 0; i < PAUSE_CYCLES; i++)
+  {
+    bool is_finished;
+
+    do
+    {
+      is_finished = jerry_gc_step (budget);
+      steps++;
+
+      size_t time = pause_last_time ();
+      total_time += time;
+      max_time = (time > max_time) ? time : max_time;
+    }
+    while (!is_finished);
+  }
+
+  printf ("steps of %4u objects: max pause %4u us, %4u us per cycle, %u steps per cycle\n",
+          (unsigned) budget,
+          (unsigned) max_time,
+          (unsigned) (total_time / PAUSE_CYCLES),
+          (unsigned) (steps / PAUSE_CYCLES));
+} /* pause_measure_steps */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_MEM_STATS))
+  {
+    printf ("The heap statistics are disabled: build with --mem-stats=on.\n");
+    jerry_cleanup ();
+    return 0;
+  }
+
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) pause_script,
+                                     sizeof (pause_script) - 1,
+                                     JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  jerry_release_value (result);
+
+  pause_measure_full ();
+  pause_measure_steps (100);
+  pause_measure_steps (500);
+  pause_measure_steps (2000);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
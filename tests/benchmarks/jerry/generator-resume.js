@@ -0,0 +1,61 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Suspends and resumes generators and async functions many times. Each
+ * resume continues the execution on the frame stored in the generator
+ * object, so the cost of a step should not depend on the frame size. */
+var iterations = 1000000;
+
+function* counter (n) {
+  var a = {}, b = {}, c = {}, d = {};
+  for (var i = 0; i < n; i++) {
+    yield i;
+  }
+  return a !== b && c !== d;
+}
+
+var start = Date.now ();
+var gen = counter (iterations);
+var sum = 0;
+var step = gen.next ();
+
+while (!step.done) {
+  sum += step.value;
+  step = gen.next ();
+}
+
+assert (step.value === true);
+assert (sum === iterations * (iterations - 1) / 2);
+print ("Generator next: " + (Date.now () - start) + " ms");
+
+async function* asyncCounter (n) {
+  var a = {}, b = {}, c = {}, d = {};
+  for (var i = 0; i < n; i++) {
+    yield i;
+  }
+}
+
+async function consume () {
+  var start = Date.now ();
+  var sum = 0;
+
+  for await (var value of asyncCounter (iterations)) {
+    sum += value;
+  }
+
+  assert (sum === iterations * (iterations - 1) / 2);
+  print ("For await: " + (Date.now () - start) + " ms");
+}
+
+consume ();
@@ -0,0 +1,45 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Keeps a ring of strings and objects with mixed sizes alive, so the heap
+ * stays fragmented while short lived strings are created and released. */
+var ring = [];
+var ring_size = 2048;
+var seed = 1;
+
+function next_random () {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed;
+}
+
+function make_string (length) {
+  var str = "";
+  while (str.length < length) {
+    str += "x" + next_random ();
+  }
+  return str.substring (0, length);
+}
+
+for (var i = 0; i < 200000; i++) {
+  var slot = next_random () % ring_size;
+  var kind = next_random () % 16;
+
+  if (kind < 10) {
+    ring[slot] = make_string (4 + next_random () % 60);
+  } else if (kind < 15) {
+    ring[slot] = { id: i, name: make_string (next_random () % 200), tag: "t" + i };
+  } else {
+    ring[slot] = make_string (256 + next_random () % 1024);
+  }
+}
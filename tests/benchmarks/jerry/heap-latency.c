@@ -0,0 +1,233 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Latency of the heap allocator on a fragmented heap.
+ *
+ * The heap is filled with blocks of random sizes between 8 and 2047 bytes
+ * until about 300 KB is live, then random blocks are freed and allocated,
+ * and the time of each call is measured. The measurement is repeated with
+ * about 400 KB live, and then with 400 KB live where 90% of the blocks are
+ * at most 127 bytes long, so the free space is split into small regions.
+ * The percentiles are printed in nanoseconds. Allocations which fail even
+ * after a garbage collection are counted and skipped.
+ *
+ * The benchmark is built with the unit tests, but it is not a unit test:
+ *
+ *   tools/build.py --builddir=build/first-fit --unittests=on
+ *   tools/build.py --builddir=build/segregated --unittests=on --mem-segregated-fit=on
+ *   build/first-fit/tests/bench-heap-latency
+ *   build/segregated/tests/bench-heap-latency
+ *
+ * The default heap size (512 KB) is expected.
+ */
+
+#if !defined (_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 199309L
+#undef _POSIX_C_SOURCE
+/* Required for clock_gettime. */
+#define _POSIX_C_SOURCE 199309L
+#endif /* !defined (_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 199309L */
+
+#include <time.h>
+
+#include "ecma-init-finalize.h"
+#include "jmem.h"
+
+#include "test-common.h"
+
+/* Number of blocks which can be alive at the same time. */
+#define LATENCY_SLOTS (8192)
+
+/* Number of measured allocations and frees. */
+#define LATENCY_OPERATIONS (400000)
+
+static uint32_t latency_small_percent;
+static uint8_t *latency_ptrs[LATENCY_SLOTS];
+static size_t latency_sizes[LATENCY_SLOTS];
+static uint32_t alloc_times[LATENCY_OPERATIONS];
+static uint32_t free_times[LATENCY_OPERATIONS];
+
+/**
+ * Get the current time in nanoseconds.
+ *
+ * @return time in nanoseconds
+ */
+static uint64_t
+latency_now (void)
+{
+  struct timespec now;
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+} /* latency_now */
+
+/**
+ * Get a random block size.
+ *
+ * @return size between 8 and 2047 bytes
+ */
+static size_t
+latency_random_size (void)
+{
+  if (latency_small_percent > 0 && (uint32_t) rand () % 100 < latency_small_percent)
+  {
+    return 8 + (size_t) rand () % 120;
+  }
+
+  return 8 + (size_t) rand () % 2040;
+} /* latency_random_size */
+
+/**
+ * Compare two measured times for qsort.
+ *
+ * @return -1, 0 or 1
+ */
+static int
+latency_compare (const void *a_p, /**< first time */
+                 const void *b_p) /**< second time */
+{
+  uint32_t a = *(const uint32_t *) a_p;
+  uint32_t b = *(const uint32_t *) b_p;
+  return (a < b) ? -1 : (a > b);
+} /* latency_compare */
+
+/**
+ * Print the percentiles of the measured times.
+ */
+static void
+latency_print (const char *name_p, /**< name of the operation */
+               uint32_t *times_p, /**< measured times */
+               uint32_t count) /**< number of times */
+{
+  qsort (times_p, count, sizeof (uint32_t), latency_compare);
+
+  printf ("%s p50/p90/p99/p99.9 = %u/%u/%u/%u ns\n",
+          name_p,
+          (unsigned) times_p[count / 2],
+          (unsigned) times_p[(uint32_t) ((uint64_t) count * 90 / 100)],
+          (unsigned) times_p[(uint32_t) ((uint64_t) count * 99 / 100)],
+          (unsigned) times_p[(uint32_t) ((uint64_t) count * 999 / 1000)]);
+} /* latency_print */
+
+/**
+ * Measure the allocations and frees while about the given number of bytes is live.
+ */
+static void
+latency_run (size_t live_limit) /**< number of live bytes */
+{
+  size_t live_bytes = 0;
+  uint32_t alloc_count = 0;
+  uint32_t free_count = 0;
+  uint32_t failed_count = 0;
+
+  /* Fill the heap, and free every second block to fragment it. */
+  for (uint32_t slot = 0; slot < LATENCY_SLOTS && live_bytes < live_limit + 150 * 1024; slot++)
+  {
+    latency_sizes[slot] = latency_random_size ();
+    latency_ptrs[slot] = (uint8_t *) jmem_heap_alloc_block_null_on_error (latency_sizes[slot]);
+
+    if (latency_ptrs[slot] == NULL)
+    {
+      break;
+    }
+
+    live_bytes += latency_sizes[slot];
+  }
+
+  for (uint32_t slot = 0; slot < LATENCY_SLOTS; slot += 2)
+  {
+    if (latency_ptrs[slot] != NULL)
+    {
+      jmem_heap_free_block (latency_ptrs[slot], latency_sizes[slot]);
+      latency_ptrs[slot] = NULL;
+      live_bytes -= latency_sizes[slot];
+    }
+  }
+
+  while (alloc_count < LATENCY_OPERATIONS || free_count < LATENCY_OPERATIONS)
+  {
+    uint32_t slot = (uint32_t) rand () % LATENCY_SLOTS;
+
+    if (latency_ptrs[slot] == NULL)
+    {
+      if (alloc_count >= LATENCY_OPERATIONS
+          || (live_bytes > live_limit && free_count < LATENCY_OPERATIONS))
+      {
+        continue;
+      }
+
+      size_t size = latency_random_size ();
+
+      uint64_t start = latency_now ();
+      latency_ptrs[slot] = (uint8_t *) jmem_heap_alloc_block_null_on_error (size);
+      alloc_times[alloc_count++] = (uint32_t) (latency_now () - start);
+
+      if (latency_ptrs[slot] == NULL)
+      {
+        failed_count++;
+        continue;
+      }
+
+      latency_sizes[slot] = size;
+      live_bytes += size;
+    }
+    else
+    {
+      if (free_count >= LATENCY_OPERATIONS
+          || (live_bytes < live_limit - 16 * 1024 && alloc_count < LATENCY_OPERATIONS))
+      {
+        continue;
+      }
+
+      uint64_t start = latency_now ();
+      jmem_heap_free_block (latency_ptrs[slot], latency_sizes[slot]);
+      free_times[free_count++] = (uint32_t) (latency_now () - start);
+
+      latency_ptrs[slot] = NULL;
+      live_bytes -= latency_sizes[slot];
+    }
+  }
+
+  printf ("%u KB live, %u failed allocations\n", (unsigned) (live_limit / 1024), (unsigned) failed_count);
+  latency_print ("alloc", alloc_times, alloc_count);
+  latency_print ("free ", free_times, free_count);
+
+  for (uint32_t slot = 0; slot < LATENCY_SLOTS; slot++)
+  {
+    if (latency_ptrs[slot] != NULL)
+    {
+      jmem_heap_free_block (latency_ptrs[slot], latency_sizes[slot]);
+      latency_ptrs[slot] = NULL;
+    }
+  }
+} /* latency_run */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jmem_init ();
+  ecma_init ();
+
+  latency_run (300 * 1024);
+  latency_run (400 * 1024);
+  latency_small_percent = 90;
+  latency_run (400 * 1024);
+
+  ecma_finalize ();
+  jmem_finalize ();
+
+  return 0;
+} /* main */
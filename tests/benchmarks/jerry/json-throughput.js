@@ -0,0 +1,108 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Parses and stringifies a small corpus of JSON documents, and reports the
+ * throughput in MB/s. The documents are about 50 KB each, so they fit into
+ * the default heap; larger documents need a larger heap (--mem-heap). */
+var words = ["lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit",
+             "sed", "do", "eiusmod", "tempor", "incididunt", "ut", "labore", "et", "dolore"];
+
+function text (seed, length, extra)
+{
+  var result = "";
+  var i = seed;
+  while (result.length < length) {
+    result += words[i % words.length] + extra + " ";
+    i += 7;
+  }
+  return result;
+}
+
+function createRecords (count)
+{
+  var records = [];
+  for (var i = 0; i < count; i++) {
+    records.push ({
+      id: i,
+      name: "user" + i,
+      email: "user" + i + "@example.com",
+      active: (i % 3) !== 0,
+      score: i * 1.5,
+      tags: ["a" + (i % 5), "b" + (i % 7)]
+    });
+  }
+  return records;
+}
+
+function createNumbers (count)
+{
+  var numbers = [];
+  for (var i = 0; i < count; i++) {
+    numbers.push (i * 31.25 - 1000);
+  }
+  return numbers;
+}
+
+function createMessages (count, extra)
+{
+  var messages = [];
+  for (var i = 0; i < count; i++) {
+    messages.push ({ from: "sender" + (i % 10), body: text (i, 1000, extra) });
+  }
+  return messages;
+}
+
+var corpus = [
+  { name: "records", create: function () { return createRecords (400); } },
+  { name: "numbers", create: function () { return createNumbers (4000); } },
+  { name: "ascii text", create: function () { return createMessages (50, ""); } },
+  { name: "escaped text", create: function () { return createMessages (50, "\n\""); } },
+  { name: "unicode text", create: function () { return createMessages (40, "éő€"); } }
+];
+
+var rounds = 50;
+var checksum = 0;
+
+for (var c = 0; c < corpus.length; c++) {
+  var json = JSON.stringify (corpus[c].create ());
+
+  /* Sizes are measured in code units, which is close to the UTF-8 size for these documents. */
+  var megabytes = json.length * rounds / (1024 * 1024);
+
+  var start = Date.now ();
+  var parsed = null;
+  for (var i = 0; i < rounds; i++) {
+    /* The previous result is released first to keep the heap usage low. */
+    parsed = null;
+    parsed = JSON.parse (json);
+  }
+  var parseTime = Math.max (Date.now () - start, 1);
+
+  start = Date.now ();
+  var result = null;
+  for (var i = 0; i < rounds; i++) {
+    result = null;
+    result = JSON.stringify (parsed);
+  }
+  var stringifyTime = Math.max (Date.now () - start, 1);
+
+  assert (result === json);
+  checksum += result.length;
+
+  print (corpus[c].name + " (" + Math.round (json.length / 1024) + " KB): parse "
+         + (megabytes * 1000 / parseTime).toFixed (1) + " MB/s, stringify "
+         + (megabytes * 1000 / stringifyTime).toFixed (1) + " MB/s");
+}
+
+assert (checksum > 0);
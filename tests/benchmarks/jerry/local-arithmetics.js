@@ -0,0 +1,52 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function checksum (count)
+{
+  var sum = 0;
+  var hash = 5381;
+
+  for (var i = 0; i < count; i++)
+  {
+    hash = ((hash << 5) + hash + i) & 0xffffff;
+    sum += hash % 1000;
+    sum = sum ^ (i >> 3);
+  }
+
+  return sum;
+}
+
+function polynomial (count)
+{
+  var result = 0;
+  var x = 0.5;
+
+  for (var i = 0; i < count; i++)
+  {
+    var value = 3;
+    value = value * x + 2;
+    value = value * x - 7;
+    value = value * x + 1;
+    result += value;
+    x = x + 0.000001;
+  }
+
+  return result;
+}
+
+var sum = checksum (2000000);
+var result = polynomial (1000000);
+
+assert (sum === 1000776568);
+assert (Math.abs (result + 83336.708382) < 0.001);
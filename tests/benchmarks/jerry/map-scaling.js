@@ -0,0 +1,49 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Fills Maps of 1k, 10k and 100k entries and performs lookups, updates and
+ * deletes on them. With a linear scan the run time grows quadratically with
+ * the number of entries, with a hash index it grows linearly. */
+var sizes = [1000, 10000, 100000];
+var checksum = 0;
+
+for (var s = 0; s < sizes.length; s++) {
+  var size = sizes[s];
+  var map = new Map ();
+  var start = Date.now ();
+
+  for (var i = 0; i < size; i++) {
+    map.set ("session" + i, i);
+  }
+
+  for (var i = 0; i < size; i++) {
+    checksum += map.get ("session" + i);
+    map.set ("session" + i, i + 1);
+  }
+
+  for (var i = 0; i < size; i += 2) {
+    map.delete ("session" + i);
+  }
+
+  for (var i = 0; i < size; i++) {
+    if (map.has ("session" + i)) {
+      checksum++;
+    }
+  }
+
+  print ("Map size " + size + ": " + (Date.now () - start) + " ms");
+}
+
+assert (checksum === 100000 * 99999 / 2 + 10000 * 9999 / 2 + 1000 * 999 / 2 + 55500);
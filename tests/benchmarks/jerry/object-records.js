@@ -0,0 +1,58 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Creates many small records with the same layout (see JERRY_OBJECT_SHAPES)
+ * and reads their fields. */
+function Record (id, name, score, active)
+{
+  this.id = id;
+  this.name = name;
+  this.score = score;
+  this.active = active;
+}
+
+var count = 2000;
+var records = [];
+
+for (var i = 0; i < count; i++)
+{
+  if (i & 0x1)
+  {
+    records.push (new Record (i, "r" + (i & 0xff), i * 0.5, true));
+  }
+  else
+  {
+    records.push ({ id: i, name: "r" + (i & 0xff), score: i * 0.5, active: false });
+  }
+}
+
+var checksum = 0;
+
+for (var round = 0; round < 100; round++)
+{
+  for (var i = 0; i < count; i++)
+  {
+    var record = records[i];
+
+    if (record.active)
+    {
+      checksum += record.id;
+    }
+
+    record.score += 1;
+  }
+}
+
+assert (checksum === 100 * (count / 2) * (count / 2));
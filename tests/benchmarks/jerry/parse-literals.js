@@ -0,0 +1,40 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Parses sources with 1k, 10k and 50k unique identifier, string and number
+ * literals spread over small functions, like a large bundle does. Each unique
+ * literal is interned in the global literal storage when its function is
+ * compiled, so the storage lookup cost grows with the number of literals. */
+var counts = [1000, 10000, 50000];
+var literals_per_function = 16;
+
+for (var c = 0; c < counts.length; c++) {
+  var count = counts[c];
+  var parts = [];
+
+  for (var i = 0; i < count; i += literals_per_function) {
+    parts.push ("function func_" + i + " () {");
+
+    for (var j = i; j < i + literals_per_function; j++) {
+      parts.push ("var ident_" + j + " = 'str_" + j + "' + " + j + ".5;");
+    }
+
+    parts.push ("}");
+  }
+
+  var source = parts.join ("\n");
+  var start = Date.now ();
+  Function (source);
+  print ("Unique literals " + count + ": " + (Date.now () - start) + " ms");
+}
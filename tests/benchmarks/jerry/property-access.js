@@ -0,0 +1,55 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Reads and writes the same named properties of many objects created
+ * by the same constructor. The objects are visited in turn, so the
+ * lookup cache keyed on the object and the property name keeps missing,
+ * while the property layout seen by each property access is the same. */
+function Particle (x, y, z)
+{
+  this.x = x;
+  this.y = y;
+  this.z = z;
+  this.vx = 1;
+  this.vy = 2;
+  this.vz = 3;
+}
+
+var particles = [];
+
+for (var i = 0; i < 2000; i++) {
+  particles.push (new Particle (i, i + 1, i + 2));
+}
+
+var start = Date.now ();
+
+for (var step = 0; step < 100; step++) {
+  for (var i = 0; i < particles.length; i++) {
+    var p = particles[i];
+    p.x = p.x + p.vx;
+    p.y = p.y + p.vy;
+    p.z = p.z + p.vz;
+  }
+}
+
+print ("Property access: " + (Date.now () - start) + " ms");
+
+var sum = 0;
+
+for (var i = 0; i < particles.length; i++) {
+  sum += particles[i].x + particles[i].y + particles[i].z;
+}
+
+assert (sum === 3 * (2000 * 1999 / 2) + 2000 * 3 + 100 * 2000 * 6);
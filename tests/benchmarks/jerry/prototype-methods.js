@@ -0,0 +1,114 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Calls methods which are found on the prototype chain of the objects. */
+function Base (value) {
+  this.value = value;
+}
+
+Base.prototype.get = function () {
+  return this.value;
+};
+
+function Derived (value) {
+  Base.call (this, value);
+  this.extra = 1;
+}
+
+Derived.prototype = Object.create (Base.prototype);
+Derived.prototype.twice = function () {
+  return this.get () * 2;
+};
+
+function Leaf (value) {
+  Derived.call (this, value);
+}
+
+Leaf.prototype = Object.create (Derived.prototype);
+
+/* Each prototype has several other methods, which are searched
+ * before the next prototype is checked. */
+var protos = [Base.prototype, Derived.prototype, Leaf.prototype];
+for (var p = 0; p < protos.length; p++) {
+  for (var i = 0; i < 8; i++) {
+    protos[p]["method" + p + "_" + i] = function () {
+      return 0;
+    };
+  }
+}
+
+var leaves = [];
+for (var i = 0; i < 16; i++) {
+  leaves.push (new Leaf (i));
+}
+
+var start = Date.now ();
+var sum = 0;
+
+for (var round = 0; round < 100000; round++) {
+  var leaf = leaves[round & 15];
+  sum += leaf.twice ();
+  sum += leaf.hasOwnProperty ("value") ? 1 : 0;
+  sum += leaf.toString ().length;
+}
+
+print ("Inherited methods: " + (Date.now () - start) + " ms");
+assert (sum === 100000 * (15 + 1 + 15));
+
+start = Date.now ();
+var length = 0;
+
+for (var round = 0; round < 10000; round++) {
+  var arr = [];
+  for (var i = 0; i < 20; i++) {
+    arr.push (i);
+  }
+  while (arr.length > 10) {
+    arr.pop ();
+  }
+  length += arr.slice (2).length + arr.indexOf (5);
+}
+
+print ("Array methods: " + (Date.now () - start) + " ms");
+assert (length === 10000 * 13);
+
+/* Calls a method of the root of a deep prototype chain, where every
+ * prototype has several properties which are searched linearly. */
+var proto = {
+  root: function () {
+    return 1;
+  }
+};
+
+for (var depth = 0; depth < 8; depth++) {
+  proto = Object.create (proto);
+  for (var i = 0; i < 12; i++) {
+    proto["property" + depth + "_" + i] = i;
+  }
+}
+
+var deep = [];
+for (var i = 0; i < 16; i++) {
+  deep.push (Object.create (proto));
+}
+
+start = Date.now ();
+sum = 0;
+
+for (var round = 0; round < 1000000; round++) {
+  sum += deep[round & 15].root ();
+}
+
+print ("Deep prototype chain: " + (Date.now () - start) + " ms");
+assert (sum === 1000000);
@@ -0,0 +1,38 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Builds a 1 MB string from 10 byte pieces by repeated concatenation,
+ * then reads its characters. Copying the whole string on every append
+ * is quadratic in the output size (see JERRY_ROPE_STRINGS).
+ * Needs a heap larger than 2 MB (e.g. --mem-heap=4096). */
+var sizes = [1000, 100000, 1000000];
+var piece = "0123456789";
+var checksum = 0;
+
+for (var s = 0; s < sizes.length; s++) {
+  var count = sizes[s] / piece.length;
+  var start = Date.now ();
+  var out = "";
+
+  for (var i = 0; i < count; i++) {
+    out += piece;
+  }
+
+  checksum += out.charCodeAt (out.length - 1) - 48;
+
+  print ("Concatenated " + out.length + " bytes: " + (Date.now () - start) + " ms");
+  out = null;
+}
+
+assert (checksum === 3 * 9);
@@ -0,0 +1,61 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Searches multi-kilobyte log lines with indexOf, includes, split and
+ * replace. The second half of the lines contains non-ASCII characters,
+ * so positions must be converted between code units and bytes. */
+var fields = ["ts=2020-11-05T10:00:00Z", "level=info", "component=storage", "latency_ms=12",
+              "path=/api/v1/items", "user=guest", "status=200", "bytes=5120"];
+
+function createLine (seed, extra)
+{
+  var line = "";
+  for (var i = 0; i < 120; i++) {
+    line += fields[(i * 5 + seed) % fields.length] + extra + " ";
+  }
+  return line + "request_id=" + seed;
+}
+
+var lines = [];
+for (var i = 0; i < 8; i++) {
+  lines.push (createLine (i, ""));
+  lines.push (createLine (i, "·ü"));
+}
+
+var start = Date.now ();
+var found = 0;
+var parts = 0;
+
+for (var round = 0; round < 40; round++) {
+  for (var l = 0; l < lines.length; l++) {
+    var line = lines[l];
+
+    if (line.includes ("request_id=")) {
+      found++;
+    }
+
+    var position = line.indexOf ("status=");
+    while (position !== -1) {
+      found++;
+      position = line.indexOf ("status=", position + 1);
+    }
+
+    parts += line.split ("component=").length;
+    parts += line.replace ("request_id=", "id=").length;
+  }
+}
+
+print ("String search: " + (Date.now () - start) + " ms");
+assert (found === 40 * 16 * 16);
+assert (parts > 0);
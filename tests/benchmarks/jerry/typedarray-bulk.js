@@ -0,0 +1,59 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Measures the bulk TypedArray operations. The arrays have 16K elements, so
+ * they fit into the default heap; the length can be increased with a larger
+ * heap (--mem-heap). */
+var length = 16384;
+var rounds = 50;
+
+var bytes = new Uint8Array (length);
+var shorts = new Int16Array (length);
+var floats = new Float32Array (length);
+var doubles = new Float64Array (length);
+
+for (var i = 0; i < length; i++) {
+  bytes[i] = i * 7;
+  shorts[i] = (i * 13) % 1000 - 500;
+}
+
+function measure (name, operation)
+{
+  var start = Date.now ();
+  var result;
+  for (var i = 0; i < rounds; i++) {
+    result = operation ();
+  }
+  print (name + ": " + (Date.now () - start) + " ms");
+  return result;
+}
+
+measure ("set Uint8 -> Float32", function () { floats.set (bytes); });
+assert (floats[1] === 7);
+measure ("set Int16 -> Float32", function () { floats.set (shorts); });
+assert (floats[1] === -487);
+measure ("set Float32 -> Float64", function () { doubles.set (floats); });
+assert (doubles[1] === -487);
+measure ("set Float64 -> Uint8", function () { bytes.set (doubles); });
+assert (bytes[1] === (-487 & 0xff));
+
+measure ("fill Uint8", function () { bytes.fill (3); });
+assert (bytes[length - 1] === 3);
+measure ("fill Float64", function () { doubles.fill (0.5); });
+assert (doubles[length - 1] === 0.5);
+
+assert (measure ("indexOf Uint8", function () { return bytes.indexOf (4); }) === -1);
+assert (measure ("indexOf Float32", function () { return floats.indexOf (0.5); }) === -1);
+assert (measure ("lastIndexOf Int16", function () { return shorts.lastIndexOf (5000); }) === -1);
+assert (measure ("includes Float64", function () { return doubles.includes (NaN); }) === false);
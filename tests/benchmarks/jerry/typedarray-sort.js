@@ -0,0 +1,54 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Sorts typed arrays with the default comparison. The arrays are small
+ * enough for the default heap; larger arrays need a larger heap (--mem-heap). */
+var length = 8000;
+var rounds = 10;
+var seed = 1;
+
+function fillRandom (array, scale)
+{
+  for (var i = 0; i < array.length; i++) {
+    seed = (seed * 16807) % 2147483647;
+    array[i] = (seed / 2147483647 - 0.5) * scale;
+  }
+}
+
+var cases = [
+  { name: "Float64Array", array: new Float64Array (length), scale: 1e6 },
+  { name: "Float32Array", array: new Float32Array (length), scale: 1e6 },
+  { name: "Int32Array", array: new Int32Array (length), scale: 4e9 },
+  { name: "Uint16Array", array: new Uint16Array (length), scale: 131072 },
+  { name: "Uint8Array", array: new Uint8Array (length), scale: 512 }
+];
+
+for (var c = 0; c < cases.length; c++) {
+  var array = cases[c].array;
+  var time = 0;
+
+  for (var round = 0; round < rounds; round++) {
+    fillRandom (array, cases[c].scale);
+
+    var start = Date.now ();
+    array.sort ();
+    time += Date.now () - start;
+
+    for (var i = 1; i < array.length; i++) {
+      assert (array[i - 1] <= array[i]);
+    }
+  }
+
+  print (cases[c].name + " sort: " + time + " ms");
+}
@@ -0,0 +1,256 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Binary operators whose result is assigned to a local variable. */
+
+function binary (a, b) {
+  var r;
+  var results = [];
+
+  r = a | b; results.push (r);
+  r = a ^ b; results.push (r);
+  r = a & b; results.push (r);
+  r = a << b; results.push (r);
+  r = a >> b; results.push (r);
+  r = a >>> b; results.push (r);
+  r = a + b; results.push (r);
+  r = a - b; results.push (r);
+  r = a * b; results.push (r);
+  r = a / b; results.push (r);
+  r = a % b; results.push (r);
+
+  r = a | 3; results.push (r);
+  r = a ^ 3; results.push (r);
+  r = a & 3; results.push (r);
+  r = a << 3; results.push (r);
+  r = a >> 3; results.push (r);
+  r = a >>> 3; results.push (r);
+  r = a + 3; results.push (r);
+  r = a - 3; results.push (r);
+  r = a * 3; results.push (r);
+  r = a / 3; results.push (r);
+  r = a % 3; results.push (r);
+
+  r = (a + 1) | (b + 1); results.push (r);
+  r = (a + 1) ^ (b + 1); results.push (r);
+  r = (a + 1) & (b + 1); results.push (r);
+  r = (a + 1) << (b + 1); results.push (r);
+  r = (a + 1) >> (b + 1); results.push (r);
+  r = (a + 1) >>> (b + 1); results.push (r);
+  r = (a + 1) + (b + 1); results.push (r);
+  r = (a + 1) - (b + 1); results.push (r);
+  r = (a + 1) * (b + 1); results.push (r);
+  r = (a + 1) / (b + 1); results.push (r);
+  r = (a + 1) % (b + 1); results.push (r);
+
+  return results;
+}
+
+function expected (a, b) {
+  var results = [];
+  var o = { r: 0 };
+
+  o.r = a | b; results.push (o.r);
+  o.r = a ^ b; results.push (o.r);
+  o.r = a & b; results.push (o.r);
+  o.r = a << b; results.push (o.r);
+  o.r = a >> b; results.push (o.r);
+  o.r = a >>> b; results.push (o.r);
+  o.r = a + b; results.push (o.r);
+  o.r = a - b; results.push (o.r);
+  o.r = a * b; results.push (o.r);
+  o.r = a / b; results.push (o.r);
+  o.r = a % b; results.push (o.r);
+
+  o.r = a | 3; results.push (o.r);
+  o.r = a ^ 3; results.push (o.r);
+  o.r = a & 3; results.push (o.r);
+  o.r = a << 3; results.push (o.r);
+  o.r = a >> 3; results.push (o.r);
+  o.r = a >>> 3; results.push (o.r);
+  o.r = a + 3; results.push (o.r);
+  o.r = a - 3; results.push (o.r);
+  o.r = a * 3; results.push (o.r);
+  o.r = a / 3; results.push (o.r);
+  o.r = a % 3; results.push (o.r);
+
+  o.r = (a + 1) | (b + 1); results.push (o.r);
+  o.r = (a + 1) ^ (b + 1); results.push (o.r);
+  o.r = (a + 1) & (b + 1); results.push (o.r);
+  o.r = (a + 1) << (b + 1); results.push (o.r);
+  o.r = (a + 1) >> (b + 1); results.push (o.r);
+  o.r = (a + 1) >>> (b + 1); results.push (o.r);
+  o.r = (a + 1) + (b + 1); results.push (o.r);
+  o.r = (a + 1) - (b + 1); results.push (o.r);
+  o.r = (a + 1) * (b + 1); results.push (o.r);
+  o.r = (a + 1) / (b + 1); results.push (o.r);
+  o.r = (a + 1) % (b + 1); results.push (o.r);
+
+  return results;
+}
+
+function same (x, y) {
+  if (x !== x) {
+    return y !== y;
+  }
+  return x === y && (x !== 0 || 1 / x === 1 / y);
+}
+
+var values = [0, -0, 1, -1, 5, -7, 0.5, -2.25, 1e300, 0x3fffffff, -0x40000000,
+              0x7fffffff, NaN, Infinity, "12", "x", true, null, undefined];
+
+for (var i = 0; i < values.length; i++) {
+  for (var j = 0; j < values.length; j++) {
+    var result = binary (values[i], values[j]);
+    var reference = expected (values[i], values[j]);
+
+    assert (result.length === reference.length);
+
+    for (var k = 0; k < result.length; k++) {
+      assert (same (result[k], reference[k]));
+    }
+  }
+}
+
+/* Compound assignments of local variables. */
+
+function compound (a, b) {
+  var s = a;
+  var results = [];
+
+  s += b; results.push (s);
+  s -= b; results.push (s);
+  s *= b + 1; results.push (s);
+  s /= 2; results.push (s);
+  s %= 7; results.push (s);
+  s |= b; results.push (s);
+  s ^= 5; results.push (s);
+  s &= a; results.push (s);
+  s <<= 2; results.push (s);
+  s >>= 1; results.push (s);
+  s >>>= b; results.push (s);
+  s += a * b; results.push (s);
+  s -= a - b; results.push (s);
+  return results;
+}
+
+assert (compound (3, 4).join () === "7,3,15,7.5,0.5,4,1,1,4,2,0,12,13");
+assert (compound (-5, 2).join () === "-3,-5,-15,-7.5,-0.5,2,7,3,12,6,1,-9,-2");
+
+/* Evaluation order of compound assignments. */
+
+function order () {
+  var s = 1;
+  var r = s += (s = 10);
+  assert (s === 11 && r === 11);
+
+  var t = 2;
+  t *= t + 1;
+  assert (t === 6);
+
+  var u = 8;
+  u -= u -= 3;
+  assert (u === 3);
+
+  var log = "";
+  var v = "a";
+  v += (log += "x", "b") + (log += "y", "c");
+  assert (v === "abc" && log === "xy");
+}
+order ();
+
+/* The result of the assignment is used. */
+
+function results (a, b) {
+  var x, y, z;
+
+  x = y = a + b;
+  assert (x === 7 && y === 7);
+
+  z = (x = a * b) + 1;
+  assert (x === 12 && z === 13);
+
+  var arr = [x = a - b, y += 1];
+  assert (arr[0] === -1 && x === -1 && arr[1] === 8 && y === 8);
+
+  z = (x = a | b, y = a & b, x + y);
+  assert (x === 7 && y === 0 && z === 7);
+
+  x = a ? (y = a << b) : (y = 0);
+  assert (x === 48 && y === 48);
+
+  if ((x = a - a)) {
+    assert (false);
+  }
+
+  x = 0;
+  while ((x = x + 1) < 5) {
+  }
+  assert (x === 5);
+
+  return y = a % b;
+}
+assert (results (3, 4) === 3);
+
+/* Strings and objects. */
+
+function strings (a) {
+  var s = "";
+  for (var i = 0; i < 5; i++) {
+    s = s + a + i;
+    s += "-";
+  }
+  return s;
+}
+assert (strings ("x") === "x0-x1-x2-x3-x4-");
+
+function objects () {
+  var calls = 0;
+  var o = { valueOf: function () { calls++; return 6; } };
+  var r;
+
+  r = o * 2;
+  assert (r === 12);
+  r = 2 - o;
+  assert (r === -4);
+  r = o;
+  r += 1;
+  assert (r === 7);
+  assert (calls === 3);
+
+  var e = { valueOf: function () { throw "err"; } };
+  r = 5;
+  try {
+    r = e + 1;
+    assert (false);
+  } catch (ex) {
+    assert (ex === "err");
+  }
+  assert (r === 5);
+
+  try {
+    r -= e;
+    assert (false);
+  } catch (ex) {
+    assert (ex === "err");
+  }
+  assert (r === 5);
+}
+objects ();
+
+/* Completion values. */
+
+assert (eval ("var ev1 = 4; (function () { var a = 3, b; b = a + 1; return b; }) ()") === 4);
+assert (eval ("var ev2 = 2, ev3 = 3; ev2 = ev2 * ev3") === 6);
+assert (eval ("(function (a) { var b = a; return eval ('b += a'); }) (5)") === 10);
@@ -0,0 +1,82 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Large values are multiplied by the Karatsuba algorithm and
+// converted to strings by splitting them with powers of the radix.
+
+var seed = 0x12345678n
+
+function random_bigint (digits) {
+  var result = 0n
+  for (var i = 0; i < digits; i++) {
+    seed = (seed * 1103515245n + 12345n) & 0xffffffffn
+    result = (result << 32n) | seed
+  }
+  return result
+}
+
+function mul_by_digits (left, right) {
+  var result = 0n
+  var shift = 0n
+  while (right > 0n) {
+    result += (left * (right & 0xffffffffn)) << shift
+    right >>= 32n
+    shift += 32n
+  }
+  return result
+}
+
+function parse_radix (str, radix) {
+  var result = 0n
+  var big_radix = BigInt (radix)
+  for (var i = 0; i < str.length; i++) {
+    result = result * big_radix + BigInt (parseInt (str[i], radix))
+  }
+  return result
+}
+
+var sizes = [[40, 40], [64, 33], [100, 150], [257, 65], [300, 301]]
+
+for (var i = 0; i < sizes.length; i++) {
+  var a = random_bigint (sizes[i][0])
+  var b = random_bigint (sizes[i][1])
+  var product = a * b
+
+  assert (product === mul_by_digits (a, b))
+  assert (product === b * a)
+  assert (product / a === b)
+  assert (product % b === 0n)
+  assert ((-a) * b === -product)
+
+  assert (BigInt (product.toString ()) === product)
+  assert (BigInt ((-product).toString ()) === -product)
+  assert (BigInt ("0x" + product.toString (16)) === product)
+  assert (BigInt ("0b" + a.toString (2)) === a)
+  assert (parse_radix (b.toString (36), 36) === b)
+  assert (parse_radix (b.toString (7), 7) === b)
+}
+
+var max = (1n << 8192n) - 1n
+assert (max * max === (max << 8192n) - max)
+assert (max.toString (16) === "f".repeat (2048))
+assert (max.toString (2) === "1".repeat (8192))
+
+assert ((10n ** 1000n).toString () === "1" + "0".repeat (1000))
+assert ((10n ** 1000n - 1n).toString () === "9".repeat (1000))
+assert ((10n ** 2000n + 1n).toString () === "1" + "0".repeat (1999) + "1")
+assert ((-(10n ** 3000n)).toString () === "-1" + "0".repeat (3000))
+assert ((36n ** 700n).toString (36) === "1" + "0".repeat (700))
+assert ((2n ** 4096n).toString ().length === 1234)
+assert ((2n ** 4096n).toString ().slice (-10) === "3154190336")
@@ -0,0 +1,35 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Division cases where the estimated quotient digit must be corrected by comparing
+// with the third digit of the dividend (Knuth's Algorithm D, step D3).
+
+function check(dividend, divisor, quotient, remainder) {
+  assert(dividend / divisor === quotient)
+  assert(dividend % divisor === remainder)
+  assert(-dividend / divisor === -quotient)
+  assert(dividend % -divisor === remainder)
+}
+
+check(0x39ba4f080000000ffffffff00000001n, 0x8000000000000001n, 0x73749e100000001n, 0x78c8b61e00000000n)
+check(0x800000007fffffff8000000025c62a38ffffffffn, 0x7fffffff0000000100000000n, 0x10000000300000003n, 0x25c62a35ffffffffn)
+check(0xffffffff7fffffff64675a607fffffffn, 0x7fffffff00000001n, 0x20000000300000000n, 0x64675a5d7fffffffn)
+check(0x7fffffff80000000ffffffffn, 0x8000000000000001n, 0xffffffffn, 0x0n)
+check(0x80000000800000000000000100000000n, 0x7fffffff80000000cd980d20n, 0x100000002n, 0x3267f2df64cfe5c0n)
+
+// The highest digit of the remaining dividend is equal to the highest digit
+// of the divisor, and the next digit is greater than or equal to it.
+
+check(0x800000009000000012345678n, 0x80000000ffffffffn, 0xffffffffn, 0x1000000212345677n)
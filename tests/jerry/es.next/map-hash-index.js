@@ -0,0 +1,128 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Containers with more entries than the hash index threshold. */
+var count = 200;
+var map = new Map ();
+var set = new Set ();
+
+for (var i = 0; i < count; i++) {
+  map.set ("key" + i, i);
+  map.set (i + 0.5, "half" + i);
+  set.add (i);
+  set.add ("key" + i);
+}
+
+assert (map.size === 2 * count);
+assert (set.size === 2 * count);
+
+for (var i = 0; i < count; i++) {
+  assert (map.get ("key" + i) === i);
+  assert (map.get (i + 0.5) === "half" + i);
+  assert (set.has (i));
+  assert (set.has ("key" + i));
+  assert (!set.has (i + 0.5));
+}
+
+/* SameValueZero semantics. */
+map.set (-0, "zero");
+assert (map.get (0) === "zero");
+assert (map.get (-0) === "zero");
+map.set (NaN, "nan");
+assert (map.get (0 / 0) === "nan");
+map.set (2147483648, "large");
+assert (map.get (Math.pow (2, 31)) === "large");
+assert (set.has (3 * 1.0));
+assert (set.has (-0));
+
+/* Delete and re-insert keeps insertion order. */
+for (var i = 0; i < count; i += 2) {
+  assert (map.delete ("key" + i));
+  assert (!map.delete ("key" + i));
+  assert (set.delete (i));
+}
+
+assert (map.size === 2 * count - count / 2 + 3);
+assert (set.size === 2 * count - count / 2);
+
+map.set ("key0", "again");
+
+var keys = [];
+map.forEach (function (value, key) {
+  if (typeof key === "string" && key.startsWith ("key")) {
+    keys.push (key);
+  }
+});
+
+assert (keys.length === count / 2 + 1);
+assert (keys[0] === "key1");
+assert (keys[1] === "key3");
+assert (keys[keys.length - 1] === "key0");
+
+var first = set.values ().next ().value;
+assert (first === "key0");
+
+/* Many deletes leave deleted slots behind, which must not break lookups. */
+var churn = new Map ();
+for (var i = 0; i < 5000; i++) {
+  churn.set (i, i);
+  if (i >= 20) {
+    assert (churn.delete (i - 20));
+  }
+}
+
+assert (churn.size === 20);
+for (var i = 4980; i < 5000; i++) {
+  assert (churn.get (i) === i);
+}
+assert (!churn.has (4979));
+
+/* Iterators survive clear and continue with the new entries. */
+var iter_set = new Set ();
+for (var i = 0; i < 50; i++) {
+  iter_set.add ({ id: i });
+}
+
+var iter = iter_set.values ();
+assert (iter.next ().value.id === 0);
+iter_set.clear ();
+assert (iter_set.size === 0);
+
+var objects = [];
+for (var i = 0; i < 50; i++) {
+  objects.push ({ id: i });
+  iter_set.add (objects[i]);
+}
+
+for (var i = 0; i < 50; i++) {
+  assert (iter_set.has (objects[i]));
+}
+assert (!iter_set.has ({ id: 0 }));
+assert (iter.next ().value.id === 0);
+
+/* WeakMap entries are removed when the keys are collected. */
+var weak = new WeakMap ();
+var weak_keys = [];
+for (var i = 0; i < 100; i++) {
+  weak_keys.push ({});
+  weak.set (weak_keys[i], i);
+}
+
+weak_keys.length = 50;
+gc ();
+
+for (var i = 0; i < 50; i++) {
+  assert (weak.get (weak_keys[i]) === i);
+}
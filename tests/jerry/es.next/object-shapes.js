@@ -0,0 +1,143 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Objects created by the same constructor share their property layout. */
+function Point (x, y)
+{
+  this.x = x;
+  this.y = y;
+}
+
+var points = [];
+
+for (var i = 0; i < 100; i++)
+{
+  points.push (new Point (i, -i));
+}
+
+for (var i = 0; i < 100; i++)
+{
+  assert (points[i].x === i && points[i].y === -i);
+}
+
+points[5].x = "five";
+assert (points[5].x === "five");
+assert (points[6].x === 6);
+
+/* The creation order is preserved. */
+var a = { first: 1, second: 2, third: 3 };
+var b = { third: 3, second: 2, first: 1 };
+
+assert (Object.keys (a).join () === "first,second,third");
+assert (Object.keys (b).join () === "third,second,first");
+assert (JSON.stringify ({ name: "x", size: 2, items: [1, { k: true }] }) === '{"name":"x","size":2,"items":[1,{"k":true}]}');
+
+var c = { b: 0, 2: 0, a: 0, 1: 0 };
+assert (Object.keys (c).join () === "1,2,b,a");
+
+var names = [];
+
+for (var name in a)
+{
+  names.push (name);
+}
+
+assert (names.join () === "first,second,third");
+
+/* Own property queries. */
+assert (a.hasOwnProperty ("second"));
+assert (!a.hasOwnProperty ("toString"));
+assert ("third" in a && "toString" in a);
+assert (a.fourth === undefined);
+
+var sym = Symbol ("s");
+var d = { v: 1 };
+d[sym] = 2;
+assert (d[sym] === 2);
+assert (Object.getOwnPropertySymbols (d)[0] === sym);
+
+/* Computed property names with the same instruction. */
+var e = { p: 1, q: 2, r: 3 };
+var sum = 0;
+
+for (var key in e)
+{
+  e[key] += 10;
+  sum += e[key];
+}
+
+assert (sum === 36 && e.p === 11 && e.q === 12 && e.r === 13);
+
+/* Changing the attributes and deleting properties. */
+var f = { x: 1, y: 2, z: 3 };
+var g = { x: 1, y: 2, z: 3 };
+
+delete f.y;
+assert (Object.keys (f).join () === "x,z");
+assert (f.y === undefined && f.z === 3);
+f.y = 4;
+assert (Object.keys (f).join () === "x,z,y");
+assert (Object.keys (g).join () === "x,y,z");
+
+Object.defineProperty (g, "x", { writable: false });
+g.x = 5;
+assert (g.x === 1);
+
+var frozen = Object.freeze ({ m: 1, n: 2 });
+frozen.m = 3;
+assert (frozen.m === 1 && Object.isFrozen (frozen));
+
+try
+{
+  (function () { "use strict"; frozen.n = 3; }) ();
+  assert (false);
+}
+catch (err)
+{
+  assert (err instanceof TypeError);
+}
+
+/* Accessors are stored in property pairs. */
+var h = { a: 1 };
+Object.defineProperty (h, "b", { get: function () { return this.a + 1; }, enumerable: true });
+h.c = 3;
+assert (h.b === 2 && h.c === 3);
+assert (Object.keys (h).join () === "a,b,c");
+
+/* Objects with many properties. */
+var large = {};
+
+for (var i = 0; i < 40; i++)
+{
+  large["k" + i] = i;
+}
+
+assert (Object.keys (large).length === 40);
+
+for (var i = 0; i < 40; i++)
+{
+  assert (large["k" + i] === i);
+}
+
+/* Prototypes with shapes. */
+var proto = { greet: function () { return "hi " + this.name; } };
+var child = Object.create (proto);
+child.name = "x";
+assert (child.greet () === "hi x");
+proto.greet = function () { return "hello " + this.name; };
+assert (child.greet () === "hello x");
+
+var copy = Object.assign ({}, a, { fourth: 4 });
+assert (Object.keys (copy).join () === "first,second,third,fourth");
@@ -0,0 +1,161 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* The set, fill, indexOf, lastIndexOf and includes routines work on the raw
+ * elements, so their results are compared with element by element operations. */
+var constructors = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+                    Int32Array, Uint32Array, Float32Array, Float64Array];
+var values = [0, -0, 1, -1, 0.5, 1.5, 2.5, -2.5, 127, 128, -128, -129, 255, 256, 32767, 32768, -32769,
+              65535, 65536, 2147483647, 2147483648, -2147483649, 4294967295, 4294967296, 1e10, -1e10,
+              1e-40, 3.4e38, 1e39, -1e39, Infinity, -Infinity, NaN];
+
+/* Conversions between every pair of types. */
+for (var s = 0; s < constructors.length; s++) {
+  var source = new constructors[s] (values);
+
+  for (var t = 0; t < constructors.length; t++) {
+    var target = new constructors[t] (values.length + 3);
+    var expected = new constructors[t] (values.length + 3);
+
+    target.set (source, 2);
+    for (var i = 0; i < source.length; i++) {
+      expected[i + 2] = source[i];
+    }
+
+    for (var i = 0; i < target.length; i++) {
+      assert (Object.is (target[i], expected[i]));
+    }
+  }
+}
+
+/* Overlapping views of the same buffer with different types. */
+var buffer = new ArrayBuffer (64);
+var bytes = new Uint8Array (buffer);
+for (var i = 0; i < bytes.length; i++) {
+  bytes[i] = i;
+}
+var words = new Uint16Array (buffer, 0, 16);
+bytes.set (words, 1);
+for (var i = 0; i < 16; i++) {
+  assert (bytes[i + 1] === ((2 * i) | ((2 * i + 1) << 8)) % 256);
+}
+
+for (var i = 0; i < bytes.length; i++) {
+  bytes[i] = i;
+}
+var source = new Uint8Array (buffer, 8, 16);
+words.set (source);
+for (var i = 0; i < 16; i++) {
+  assert (words[i] === i + 8);
+}
+
+/* Fill with every value, and with partial ranges. */
+for (var c = 0; c < constructors.length; c++) {
+  var TypedArray = constructors[c];
+
+  for (var v = 0; v < values.length; v++) {
+    var array = new TypedArray (37);
+    var element = new TypedArray ([values[v]])[0];
+
+    assert (array.fill (values[v]) === array);
+    for (var i = 0; i < array.length; i++) {
+      assert (Object.is (array[i], element));
+    }
+  }
+
+  var array = new TypedArray (20);
+  array.fill (3, 5, -5);
+  for (var i = 0; i < array.length; i++) {
+    assert (array[i] === ((i >= 5 && i < 15) ? 3 : 0));
+  }
+
+  array.fill (4, 12, 12);
+  array.fill (5, -1);
+  assert (array[11] === 3 && array[12] === 3 && array[19] === 5);
+
+  var view = new TypedArray (array.buffer, TypedArray.BYTES_PER_ELEMENT * 2, 3);
+  view.fill (7);
+  assert (array[1] === 0 && array[2] === 7 && array[4] === 7 && array[5] === 3);
+}
+
+/* Searches, compared with a search which reads every element. */
+function expectedIndexOf (array, value, from)
+{
+  for (var i = from; i < array.length; i++) {
+    if (array[i] === value) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+function expectedLastIndexOf (array, value, from)
+{
+  for (var i = from; i >= 0; i--) {
+    if (array[i] === value) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+for (var c = 0; c < constructors.length; c++) {
+  var array = new constructors[c] (values.length * 2);
+  array.set (values);
+  array.set (values, values.length);
+
+  var searched = values.concat ([2, 3, -3, 0.25, -0.5, 1e-50]);
+
+  for (var v = 0; v < searched.length; v++) {
+    var value = searched[v];
+    var froms = [0, 1, 7, values.length, array.length - 1];
+
+    for (var f = 0; f < froms.length; f++) {
+      var from = froms[f];
+
+      assert (array.indexOf (value, from) === expectedIndexOf (array, value, from));
+      assert (array.lastIndexOf (value, from) === expectedLastIndexOf (array, value, from));
+      assert (array.includes (value, from) === (expectedIndexOf (array, value, from) !== -1
+                                                || (value !== value && array.slice (from).some (function (e) {
+                                                  return e !== e;
+                                                }))));
+    }
+
+    assert (array.indexOf (value) === expectedIndexOf (array, value, 0));
+    assert (array.lastIndexOf (value) === expectedLastIndexOf (array, value, array.length - 1));
+    assert (array.indexOf (value, -5) === expectedIndexOf (array, value, array.length - 5));
+    assert (array.indexOf (value, -1000) === expectedIndexOf (array, value, 0));
+    assert (array.lastIndexOf (value, -5) === expectedLastIndexOf (array, value, array.length - 5));
+    assert (array.lastIndexOf (value, -1000) === -1);
+    assert (array.indexOf (value, 1000) === -1);
+    assert (array.includes (value, 1000) === false);
+  }
+}
+
+/* NaN is found by includes only in the floating point arrays. */
+assert (new Float32Array ([1, NaN]).includes (NaN));
+assert (new Float64Array ([NaN]).includes (NaN, -1));
+assert (!new Float64Array ([NaN, 1]).includes (NaN, 1));
+assert (new Float64Array ([NaN]).indexOf (NaN) === -1);
+assert (new Float64Array ([NaN]).lastIndexOf (NaN) === -1);
+assert (!new Uint8Array ([0]).includes (NaN));
+
+/* Zeros of both signs are equal. */
+assert (new Float64Array ([1, -0]).indexOf (0) === 1);
+assert (new Float32Array ([0, 1]).lastIndexOf (-0) === 0);
+assert (new Int8Array ([1, 0]).includes (-0));
+
+/* Only numbers are found. */
+assert (new Uint8Array ([1]).indexOf ("1") === -1);
+assert (!new Uint8Array ([1]).includes ("1"));
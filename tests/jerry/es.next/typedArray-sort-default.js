@@ -0,0 +1,152 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* The default comparison sorts the raw elements, so the results are
+ * compared with a sort which uses an explicit comparator. */
+function compare (a, b)
+{
+  if (a !== a) {
+    return (b !== b) ? 0 : 1;
+  }
+  if (b !== b) {
+    return -1;
+  }
+  if (a === 0 && b === 0) {
+    return (1 / a) - (1 / b) < 0 ? -1 : ((1 / a) === (1 / b) ? 0 : 1);
+  }
+  return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+function checkSorted (array, expected)
+{
+  assert (array.length === expected.length);
+  for (var i = 0; i < array.length; i++) {
+    assert (Object.is (array[i], expected[i]));
+  }
+}
+
+var seed = 12345;
+function random ()
+{
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed / 2147483648;
+}
+
+var constructors = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+                    Int32Array, Uint32Array, Float32Array, Float64Array];
+var specials = [0, -0, 1, -1, 127, -128, 255, 256, 32767, -32768, 65535, 2147483647, -2147483648,
+                4294967295, 0.5, -0.5, 1e-40, -1e-40, 1e30, -1e30, Infinity, -Infinity, NaN];
+
+for (var c = 0; c < constructors.length; c++) {
+  var TypedArray = constructors[c];
+  var lengths = [0, 1, 2, 31, 32, 33, 100, 1000];
+
+  for (var l = 0; l < lengths.length; l++) {
+    var length = lengths[l];
+    var source = [];
+
+    for (var i = 0; i < length; i++) {
+      if (i % 5 === 0) {
+        source.push (specials[i % specials.length]);
+      } else if (i % 2 === 0) {
+        source.push ((random () - 0.5) * 20);
+      } else {
+        source.push ((random () - 0.5) * 1e10);
+      }
+    }
+
+    var array = new TypedArray (source);
+    var expected = Array.prototype.slice.call (array).sort (compare);
+
+    assert (array.sort () === array);
+    checkSorted (array, expected);
+
+    /* Sorted, reversed and uniform inputs. */
+    array.sort ();
+    checkSorted (array, expected);
+
+    array.reverse ();
+    array.sort ();
+    checkSorted (array, expected);
+
+    array.fill (7);
+    array.sort ();
+    for (var i = 0; i < array.length; i++) {
+      assert (array[i] === 7);
+    }
+  }
+}
+
+/* Inputs with few distinct values, organ pipe and sawtooth orders. */
+var patterns = [
+  function (i, length) { return i % 3; },
+  function (i, length) { return i < length / 2 ? i : length - i; },
+  function (i, length) { return (i * 7) % 64 - 32; },
+  function (i, length) { return (i & 1) ? -i : i; }
+];
+
+for (var c = 0; c < constructors.length; c++) {
+  for (var p = 0; p < patterns.length; p++) {
+    var array = new constructors[c] (2000);
+    for (var i = 0; i < array.length; i++) {
+      array[i] = patterns[p] (i, array.length);
+    }
+
+    var expected = Array.prototype.slice.call (array).sort (compare);
+    array.sort ();
+    checkSorted (array, expected);
+  }
+}
+
+/* Negative zeros are sorted before positive zeros, NaNs are sorted to the end. */
+var floats = new Float64Array (100);
+for (var i = 0; i < floats.length; i++) {
+  floats[i] = [NaN, 0, -0, -1, 1][i % 5];
+}
+floats.sort ();
+for (var i = 0; i < floats.length; i++) {
+  assert (Object.is (floats[i], [-1, -0, 0, 1, NaN][Math.floor (i / 20)]));
+}
+
+/* Only the elements of the view are sorted. */
+var buffer = new Int16Array (200);
+for (var i = 0; i < buffer.length; i++) {
+  buffer[i] = 100 - i;
+}
+var view = new Int16Array (buffer.buffer, 100, 100);
+view.sort ();
+for (var i = 0; i < 50; i++) {
+  assert (buffer[i] === 100 - i);
+}
+for (var i = 50; i < 150; i++) {
+  assert (buffer[i] === -49 + (i - 50));
+}
+for (var i = 150; i < 200; i++) {
+  assert (buffer[i] === 100 - i);
+}
+
+if (typeof BigInt64Array === "function") {
+  var big = new BigInt64Array (100);
+  var bigUnsigned = new BigUint64Array (100);
+  for (var i = 0; i < big.length; i++) {
+    big[i] = BigInt (((i * 37) % 100) - 50) * BigInt (1e12);
+    bigUnsigned[i] = BigInt ((i * 37) % 100) * BigInt (1e15);
+  }
+  big.sort ();
+  bigUnsigned.sort ();
+  for (var i = 0; i < big.length; i++) {
+    assert (big[i] === BigInt (i - 50) * BigInt (1e12));
+    assert (bigUnsigned[i] === BigInt (i) * BigInt (1e15));
+  }
+}
@@ -0,0 +1,82 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Recursive calls with large frames. */
+
+function sum (n) {
+  var a0 = n, a1 = n + 1, a2 = n + 2, a3 = n + 3, a4 = n + 4, a5 = n + 5, a6 = n + 6, a7 = n + 7;
+  var b0 = a0 * 2, b1 = a1 * 2, b2 = a2 * 2, b3 = a3 * 2, b4 = a4 * 2, b5 = a5 * 2, b6 = a6 * 2, b7 = a7 * 2;
+
+  if (n === 0) {
+    return 0;
+  }
+
+  var r = sum (n - 1);
+  return r + a0 + a1 + a2 + a3 + a4 + a5 + a6 + a7 - (b0 + b1 + b2 + b3 + b4 + b5 + b6 + b7) / 2 + 1;
+}
+
+for (var i = 0; i < 3; i++) {
+  assert (sum (50) === 50);
+}
+
+/* Unwinding frames with exceptions. */
+
+function thrower (n) {
+  var local = [n];
+
+  if (n === 0) {
+    throw local;
+  }
+
+  try {
+    thrower (n - 1);
+  } finally {
+    local.push (n);
+  }
+}
+
+for (var i = 0; i < 3; i++) {
+  try {
+    thrower (30);
+    assert (false);
+  } catch (e) {
+    assert (e.length === 1 && e[0] === 0);
+  }
+}
+
+/* Frames of callbacks called from native code. */
+
+function nested (n) {
+  if (n === 0) {
+    return [1];
+  }
+
+  return [n].concat (nested (n - 1).map (function (x) { return x + n; }));
+}
+
+assert (nested (20).length === 21);
+assert (nested (20)[20] === 211);
+
+/* Values of the frames are released after the call. */
+
+function allocate (n) {
+  var big = [];
+  for (var i = 0; i < 64; i++) {
+    big.push (n);
+  }
+  return n === 0 ? big.length : allocate (n - 1) + 1;
+}
+
+assert (allocate (30) === 94);
@@ -0,0 +1,161 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* The same property accesses are performed on objects with different layouts. */
+function get_x (obj)
+{
+  return obj.x;
+}
+
+function set_x (obj, value)
+{
+  obj.x = value;
+}
+
+var objects = [
+  { x: 1 },
+  { a: 0, x: 2 },
+  { a: 0, b: 0, c: 0, x: 3 },
+  { x: 4, a: 0, b: 0, c: 0 },
+  { a: 0 },
+  Object.create ({ x: 6 }),
+  { get x () { return 7; } },
+];
+
+for (var round = 0; round < 3; round++) {
+  assert (get_x (objects[0]) === 1);
+  assert (get_x (objects[1]) === 2);
+  assert (get_x (objects[2]) === 3);
+  assert (get_x (objects[3]) === 4);
+  assert (get_x (objects[4]) === undefined);
+  assert (get_x (objects[5]) === 6);
+  assert (get_x (objects[6]) === 7);
+}
+
+/* Deleted and recreated properties. */
+function Point (x, y)
+{
+  this.x = x;
+  this.y = y;
+}
+
+var points = [];
+
+for (var i = 0; i < 10; i++) {
+  points.push (new Point (i, i * 2));
+}
+
+for (var i = 0; i < 10; i++) {
+  assert (get_x (points[i]) === i);
+}
+
+delete points[3].x;
+assert (get_x (points[3]) === undefined);
+assert (get_x (points[4]) === 4);
+
+points[3].x = 30;
+assert (get_x (points[3]) === 30);
+assert (get_x (points[2]) === 2);
+
+/* Non-writable and accessor properties. */
+var frozen = Object.freeze (new Point (1, 2));
+var setter_value;
+var with_setter = { set x (value) { setter_value = value; } };
+
+for (var round = 0; round < 3; round++) {
+  set_x (points[5], round);
+  assert (points[5].x === round);
+
+  set_x (frozen, round + 10);
+  assert (frozen.x === 1);
+
+  set_x (with_setter, round + 20);
+  assert (setter_value === round + 20);
+  assert (with_setter.x === undefined);
+}
+
+/* Objects which are not ordinary objects. */
+var array = [1, 2, 3];
+var str = new String ("abc");
+
+function get_length (obj)
+{
+  return obj.length;
+}
+
+for (var round = 0; round < 3; round++) {
+  assert (get_length ({ length: 5 }) === 5);
+  assert (get_length (array) === 3);
+  assert (get_length (str) === 3);
+  assert (get_length (function (a, b) {}) === 2);
+}
+
+/* Objects with many properties. */
+var large = {};
+
+for (var i = 0; i < 64; i++) {
+  large["p" + i] = i;
+}
+
+large.x = 100;
+assert (get_x (large) === 100);
+
+for (var round = 0; round < 3; round++) {
+  set_x (large, round);
+  assert (get_x (large) === round);
+}
+
+/* Repeated accesses of the same object after its properties are deleted. */
+var same = { a: 1, b: 2, c: 3, x: 4 };
+
+for (var round = 0; round < 3; round++) {
+  assert (get_x (same) === 4);
+}
+
+delete same.a;
+delete same.b;
+assert (get_x (same) === 4);
+
+delete same.x;
+same.d = 5;
+assert (get_x (same) === undefined);
+
+same.x = 6;
+assert (get_x (same) === 6);
+
+/* Objects freed by the garbage collector. */
+for (var round = 0; round < 100; round++) {
+  var temp = { a: round, x: round * 2 };
+  assert (get_x (temp) === round * 2);
+  set_x (temp, round);
+  assert (temp.x === round);
+}
+
+/* Many property accesses in the same function. */
+function sum_all (obj)
+{
+  return obj.p0 + obj.p1 + obj.p2 + obj.p3 + obj.p4 + obj.p5 + obj.p6 + obj.p7
+         + obj.p8 + obj.p9 + obj.p10 + obj.p11 + obj.p12 + obj.p13 + obj.p14 + obj.p15;
+}
+
+var many = { p0: 0, p1: 1, p2: 2, p3: 3, p4: 4, p5: 5, p6: 6, p7: 7,
+             p8: 8, p9: 9, p10: 10, p11: 11, p12: 12, p13: 13, p14: 14, p15: 15 };
+
+for (var round = 0; round < 3; round++) {
+  assert (sum_all (many) === 120);
+}
+
+many.p15 = 30;
+assert (sum_all (many) === 135);
@@ -0,0 +1,73 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Special characters at every position of long strings, which are
+ * scanned in blocks by JSON.parse and JSON.stringify. */
+var plain = "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ-_.";
+var specials = [
+  { value: "\"", quoted: "\\\"" },
+  { value: "\\", quoted: "\\\\" },
+  { value: "\n", quoted: "\\n" },
+  { value: "\u0000", quoted: "\\u0000" },
+  { value: "\u001f", quoted: "\\u001f" },
+  { value: "\u007f", quoted: "\u007f" },
+  { value: "é", quoted: "é" },
+  { value: "\ud7ff", quoted: "\ud7ff" },
+  { value: "\ue000", quoted: "\ue000" },
+  { value: "😀", quoted: "😀" }
+];
+
+for (var s = 0; s < specials.length; s++) {
+  var special = specials[s];
+
+  for (var i = 0; i <= 40; i++) {
+    var str = plain.substring (0, i) + special.value + plain.substring (i);
+    var quoted = "\"" + plain.substring (0, i) + special.quoted + plain.substring (i) + "\"";
+
+    assert (JSON.stringify (str) === quoted);
+    assert (JSON.parse (quoted) === str);
+    assert (JSON.parse ("[" + quoted + "," + quoted + "]")[1] === str);
+  }
+}
+
+/* Escape sequences in the parsed strings. */
+var escaped = "\"" + plain + "\\u0041\\t" + plain + "\\/" + plain + "\"";
+assert (JSON.parse (escaped) === plain + "A\t" + plain + "/" + plain);
+
+/* Raw control characters are not allowed in the parsed strings. */
+for (var i = 0; i < 40; i++) {
+  var invalid = "\"" + plain.substring (0, i) + "\t" + plain.substring (i) + "\"";
+
+  try {
+    JSON.parse (invalid);
+    assert (false);
+  } catch (e) {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+/* Unterminated strings. */
+for (var i = 0; i < 40; i++) {
+  try {
+    JSON.parse ("\"" + plain.substring (0, i));
+    assert (false);
+  } catch (e) {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+/* Lone surrogates are escaped since ES2019. */
+var lone = JSON.stringify (plain + "\ud800" + plain + "\udfff");
+assert (lone === "\"" + plain + "\\ud800" + plain + "\\udfff\"" || lone === "\"" + plain + "\ud800" + plain + "\udfff\"");
+assert (JSON.parse (lone) === plain + "\ud800" + plain + "\udfff");
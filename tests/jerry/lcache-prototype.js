@@ -0,0 +1,188 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Properties found on the prototype chain are hidden by new properties. */
+var base = { m: function () { return "base"; } };
+var middle = Object.create (base);
+var obj = Object.create (middle);
+
+for (var i = 0; i < 3; i++) {
+  assert (obj.m () === "base");
+}
+
+middle.m = function () { return "middle"; };
+assert (obj.m () === "middle");
+
+obj.m = function () { return "own"; };
+assert (obj.m () === "own");
+
+delete obj.m;
+assert (obj.m () === "middle");
+
+delete middle.m;
+assert (obj.m () === "base");
+
+delete base.m;
+assert (obj.m === undefined);
+
+base.m = 5;
+assert (obj.m === 5);
+
+/* Names created from other strings with the same characters. */
+var name = "dyn" + "amic";
+base.dynamic = 1;
+assert (obj.dynamic === 1);
+middle[name] = 2;
+assert (obj.dynamic === 2);
+delete middle["dyna" + "mic"];
+assert (obj[name] === 1);
+
+/* Accessors and property redefinitions. */
+var count = 0;
+Object.defineProperty (base, "acc", {
+  get: function () { count++; return this === obj; },
+  configurable: true
+});
+
+assert (obj.acc === true);
+assert (obj.acc === true);
+assert (count === 2);
+
+Object.defineProperty (base, "acc", { value: "data", configurable: true });
+assert (obj.acc === "data");
+
+Object.defineProperty (middle, "acc", {
+  get: function () { return "middle getter"; },
+  configurable: true
+});
+assert (obj.acc === "middle getter");
+
+/* A getter which hides itself on the prototype chain. */
+var hidden = { };
+Object.defineProperty (hidden, "value", {
+  get: function () {
+    Object.defineProperty (middle, "hiding", { value: "hidden", configurable: true });
+    return "getter";
+  },
+  configurable: true
+});
+base.hiding = 0;
+Object.defineProperty (base, "hiding", Object.getOwnPropertyDescriptor (hidden, "value"));
+assert (obj.hiding === "getter");
+assert (obj.hiding === "hidden");
+
+/* Built-in methods on the prototype chain. */
+var arr = [1, 2, 3];
+for (var i = 0; i < 3; i++) {
+  assert (arr.indexOf (2) === 1);
+}
+
+Array.prototype.extra = function () { return "extra"; };
+assert (arr.extra () === "extra");
+
+arr.indexOf = function () { return "own"; };
+assert (arr.indexOf (2) === "own");
+delete arr.indexOf;
+assert (arr.indexOf (2) === 1);
+
+var saved = Array.prototype.indexOf;
+delete Array.prototype.indexOf;
+assert (arr.indexOf === undefined);
+Array.prototype.indexOf = saved;
+assert (arr.indexOf (3) === 2);
+delete Array.prototype.extra;
+assert (arr.extra === undefined);
+
+var str = "abc";
+for (var i = 0; i < 3; i++) {
+  assert (str.charAt (1) === "b");
+}
+
+String.prototype.charAt = function () { return "patched"; };
+assert (str.charAt (1) === "patched");
+Object.prototype.charAt = function () { return "object"; };
+delete String.prototype.charAt;
+assert (str.charAt (1) === "object");
+delete Object.prototype.charAt;
+assert (str.charAt === undefined);
+
+/* Properties of the Object prototype hidden by an intermediate array. */
+var arrProto = [];
+var fromArray = Object.create (arrProto);
+Object.prototype[5] = "object";
+assert (fromArray[5] === "object");
+arrProto[5] = "array";
+assert (fromArray[5] === "array");
+arrProto.length = 2;
+assert (fromArray[5] === "object");
+delete Object.prototype[5];
+assert (fromArray[5] === undefined);
+
+/* Freed prototypes. */
+function createChain (value)
+{
+  var proto = { value: value };
+  return Object.create (Object.create (proto));
+}
+
+for (var i = 0; i < 20; i++) {
+  var chain = createChain (i);
+  assert (chain.value === i);
+  assert (chain.value === i);
+}
+
+/* Changing the prototype. */
+if (typeof Object.setPrototypeOf === "function") {
+  var first = { kind: "first" };
+  var second = { kind: "second" };
+  var child = Object.create (middle);
+
+  Object.setPrototypeOf (middle, first);
+  assert (child.kind === "first");
+  assert (child.kind === "first");
+
+  Object.setPrototypeOf (middle, second);
+  assert (child.kind === "second");
+
+  Object.setPrototypeOf (middle, null);
+  assert (child.kind === undefined);
+}
+
+/* Prototypes created by object literals. */
+var literalProto = { a: 1, b: 2 };
+var fromLiteral = Object.create (Object.create (literalProto));
+
+for (var i = 0; i < 3; i++) {
+  assert (fromLiteral.b === 2);
+}
+
+literalProto.b = 3;
+assert (fromLiteral.b === 3);
+
+literalProto.c = 4;
+assert (fromLiteral.b === 3);
+assert (fromLiteral.c === 4);
+
+Object.defineProperty (literalProto, "a", { writable: false });
+assert (fromLiteral.a === 1);
+assert (fromLiteral.b === 3);
+
+for (var i = 0; i < 20; i++) {
+  literalProto["p" + i] = i;
+}
+assert (fromLiteral.p19 === 19);
+assert (fromLiteral.c === 4);
+
+delete literalProto.c;
+assert (fromLiteral.c === undefined);
@@ -0,0 +1,37 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Many number literals are stored, so they are looked up through the literal
+ * hashmap when it is enabled. Negative and positive zeros must stay different. */
+var source = "[";
+for (var i = 0; i < 300; i++) {
+  source += (i + 0.5) + ", -" + (i + 0.25) + ", ";
+}
+source += "-0, 0, -0.0, 0.0]";
+
+var values = eval (source);
+assert (values.length === 604);
+
+for (var i = 0; i < 300; i++) {
+  assert (values[2 * i] === i + 0.5);
+  assert (values[2 * i + 1] === -(i + 0.25));
+}
+
+assert (1 / values[600] === -Infinity);
+assert (1 / values[601] === Infinity);
+assert (1 / values[602] === -Infinity);
+assert (1 / values[603] === Infinity);
+
+assert (1 / eval ("-0") === -Infinity);
+assert (1 / eval ("0") === Infinity);
@@ -0,0 +1,138 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Loop conditions which compare two literals are merged with the loop branch. */
+
+function count_less (start, end) {
+  var n = 0;
+  for (var i = start; i < end; i++) {
+    n++;
+  }
+  return n;
+}
+
+function count_less_equal (start, end) {
+  var n = 0;
+  var i = start;
+  while (i <= end) {
+    n++;
+    i++;
+  }
+  return n;
+}
+
+function count_greater (start, end) {
+  var n = 0;
+  var i = start;
+  do {
+    n++;
+    i--;
+  } while (i > end);
+  return n;
+}
+
+function count_greater_equal (start, end) {
+  var n = 0;
+  for (var i = start; i >= end; i--) {
+    n++;
+  }
+  return n;
+}
+
+assert (count_less (0, 10) === 10);
+assert (count_less (10, 0) === 0);
+assert (count_less (-5, 5) === 10);
+assert (count_less (0.5, 3) === 3);
+assert (count_less (0, 2.5) === 3);
+assert (count_less (0, NaN) === 0);
+assert (count_less (0, "3") === 3);
+assert (count_less (0, 1e10 - 1e10 + 4) === 4);
+
+assert (count_less_equal (0, 10) === 11);
+assert (count_less_equal (0, -1) === 0);
+assert (count_less_equal (0, NaN) === 0);
+assert (count_less_equal (-0.5, 1.5) === 3);
+
+assert (count_greater (10, 0) === 10);
+assert (count_greater (0, 10) === 1);
+assert (count_greater (0, NaN) === 1);
+assert (count_greater (2.5, 0) === 3);
+
+assert (count_greater_equal (10, 0) === 11);
+assert (count_greater_equal (0, 1) === 0);
+assert (count_greater_equal (0, NaN) === 0);
+assert (count_greater_equal (1.5, 0) === 2);
+
+/* String comparison. */
+var letters = "";
+for (var c = "a"; c < "aaaa"; c += "a") {
+  letters += c;
+}
+assert (letters === "aaaaaa");
+
+/* Global variables are identifiers. */
+var global_i = 0;
+var global_end = 5;
+var global_n = 0;
+while (global_i < global_end) {
+  global_i++;
+  global_n++;
+}
+assert (global_n === 5);
+
+/* The operands are converted in order. */
+var order = [];
+var limit = 3;
+
+function make_operand (name, value) {
+  return { valueOf: function () { order.push (name); return value; } };
+}
+
+var left = make_operand ("left", 2);
+var right = make_operand ("right", 1);
+
+do {
+  limit--;
+} while (left <= right);
+assert (limit === 2);
+assert (order.join () === "left,right");
+
+order = [];
+do {
+  limit--;
+} while (left > right && limit > 0);
+assert (limit === 0);
+assert (order.join () === "left,right,left,right");
+
+/* Conversion errors are thrown. */
+var thrower = { valueOf: function () { throw "conversion"; } };
+var zero = 0;
+
+try {
+  do {
+    zero++;
+  } while (zero < thrower);
+  assert (false);
+} catch (e) {
+  assert (e === "conversion");
+  assert (zero === 1);
+}
+
+/* Long loop bodies need longer branch offsets. */
+var src = "var s = 0; for (var k = 0; k < 3; k++) {";
+for (var j = 0; j < 200; j++) {
+  src += "s += k + " + j + ";";
+}
+src += "} s;";
+assert (eval (src) === 3 * 19900 + 200 * 3);
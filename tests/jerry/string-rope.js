@@ -0,0 +1,94 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Long strings created by concatenation are ropes until their characters are accessed. */
+
+function repeat (str, count) {
+  var result = "";
+  for (var i = 0; i < count; i++) {
+    result += str;
+  }
+  return result;
+}
+
+var piece = "0123456789";
+var str = repeat (piece, 1000);
+
+assert (str.length === 10000);
+assert (str.charAt (0) === "0");
+assert (str.charCodeAt (9999) === 57);
+assert (str.substring (4995, 5005) === "5678901234");
+assert (str.indexOf ("90") === 9);
+assert (str.lastIndexOf ("01") === 9990);
+
+/* Ropes are equal to flat strings with the same characters. */
+var flat = Array (1001).join (piece);
+assert (flat === str);
+assert (str === flat);
+assert (!(str < flat) && !(str > flat));
+assert (str + "a" > flat);
+assert (str.slice (1) > flat);
+
+/* Ropes can be used as property names. */
+var obj = {};
+obj[repeat (piece, 30)] = "rope";
+assert (obj[Array (31).join (piece)] === "rope");
+assert (Object.keys (obj)[0].length === 300);
+
+/* The same rope can be extended several times. */
+var base = repeat ("ab", 200);
+var first = base + "x";
+var second = base + "y";
+assert (first.length === 401 && second.length === 401);
+assert (first.charAt (400) === "x" && second.charAt (400) === "y");
+assert (first.slice (0, 400) === base && second.slice (0, 400) === base);
+
+/* Ropes containing ropes. */
+var doubled = base + base;
+assert (doubled.length === 800);
+assert (doubled === repeat ("ab", 400));
+
+var prepended = "";
+for (var i = 0; i < 300; i++) {
+  prepended = String.fromCharCode (65 + (i % 26)) + prepended;
+}
+assert (prepended.length === 300);
+assert (prepended.charAt (0) === "N");
+assert (prepended.charAt (299) === "A");
+
+/* Non-ASCII characters. */
+var unicode = repeat ("é中", 300);
+assert (unicode.length === 600);
+assert (unicode.charCodeAt (598) === 0xe9);
+assert (unicode.charCodeAt (599) === 0x4e2d);
+assert (unicode === Array (301).join ("é中"));
+assert (encodeURIComponent (unicode).length === 300 * (6 + 9));
+
+/* Numbers and other values are converted to strings before concatenation. */
+var mixed = repeat ("-", 300) + 12345 + true + null;
+assert (mixed.length === 300 + 5 + 4 + 4);
+assert (mixed.slice (300) === "12345truenull");
+assert (Number (repeat (" ", 300) + "42") === 42);
+
+/* Long chains of ropes are released without recursion. */
+var chain = "";
+var long_piece = repeat ("z", 260);
+for (var i = 0; i < 400; i++) {
+  chain += long_piece;
+}
+assert (chain.length === 104000);
+chain = null;
+
+var json = JSON.parse (JSON.stringify ({ text: str }));
+assert (json.text === str);
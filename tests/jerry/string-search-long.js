@@ -0,0 +1,137 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Reference implementation which compares the code units one by one. */
+function naiveIndexOf (str, search, start)
+{
+  for (var i = start; i + search.length <= str.length; i++) {
+    var j = 0;
+    while (j < search.length && str.charCodeAt (i + j) === search.charCodeAt (j)) {
+      j++;
+    }
+
+    if (j === search.length) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+function repeat (str, count)
+{
+  var result = "";
+  for (var i = 0; i < count; i++) {
+    result += str;
+  }
+  return result;
+}
+
+var parts = ["GET /index.html ", "status=200 ", "árvíztűrő ", "😀 ", "aaab ", "x"];
+var log = "";
+for (var i = 0; i < 120; i++) {
+  log += parts[(i * 7) % parts.length] + i + " ";
+}
+var asciiLog = log.replace (/[^\x00-\x7f]/g, "?");
+
+var patterns = ["status=200", "aaab", "aab", "b", "x 11", "119 ", "űrő", "\ud83d", "\ude00",
+                "😀 ", "GET /index.html status", "missing", "?rv?zt?r? ", "99 "];
+
+var strings = [log, asciiLog];
+for (var s = 0; s < strings.length; s++) {
+  var str = strings[s];
+  for (var p = 0; p < patterns.length; p++) {
+    var pattern = patterns[p];
+    for (var start = 0; start <= str.length; start += 37) {
+      assert (str.indexOf (pattern, start) === naiveIndexOf (str, pattern, start));
+    }
+    assert (str.indexOf (pattern, str.length) === -1);
+
+    /* Visit every match from left to right. */
+    var count = 0;
+    var position = str.indexOf (pattern);
+    while (position !== -1) {
+      assert (naiveIndexOf (str, pattern, position) === position);
+      assert (str.substring (position, position + pattern.length) === pattern);
+      count++;
+      position = str.indexOf (pattern, position + 1);
+    }
+
+    var separated = 0;
+    position = str.indexOf (pattern);
+    while (position !== -1) {
+      separated++;
+      position = str.indexOf (pattern, position + pattern.length);
+    }
+    assert (separated <= count);
+
+    var splitted = str.split (pattern);
+    assert (splitted.length === separated + 1);
+    assert (splitted.join (pattern) === str);
+
+    var replaced = str.replace (pattern, "#");
+    var first = naiveIndexOf (str, pattern, 0);
+    if (first === -1) {
+      assert (replaced === str);
+    } else {
+      assert (replaced === str.substring (0, first) + "#" + str.substring (first + pattern.length));
+    }
+
+    var found = -1;
+    str.replace (pattern, function (match, offset) {
+      found = offset;
+      return match;
+    });
+    assert (found === first);
+  }
+}
+
+/* Overlapping candidates and long patterns. */
+var repeated = repeat ("ab", 300) + "abc" + repeat ("ab", 300);
+assert (repeated.indexOf ("ababc") === 598);
+assert (repeated.indexOf (repeat ("ab", 100) + "c") === 402);
+assert (repeated.indexOf (repeat ("ab", 100) + "c", 403) === -1);
+assert (repeated.indexOf (repeat ("ab", 200) + "abc" + repeat ("ab", 200)) === 200);
+assert (repeated.split ("c").length === 2);
+
+var bytes = repeat ("ÿĀ", 200);
+assert (bytes.indexOf ("Āÿ", 5) === 5);
+assert (bytes.indexOf ("ÿÿ") === -1);
+assert (bytes.indexOf (repeat ("Āÿ", 50) + "Ā", 100) === 101);
+assert (bytes.indexOf (repeat ("Āÿ", 200)) === -1);
+
+/* Positions in long non-ASCII strings. */
+var mixed = repeat ("фa𐀀", 100);
+for (var i = 0; i < mixed.length; i++) {
+  assert (mixed.charCodeAt (i) === [0x444, 0x61, 0xd800, 0xdc00][i % 4]);
+}
+for (var i = mixed.length - 1; i >= 0; i -= 3) {
+  assert (mixed.charCodeAt (i) === [0x444, 0x61, 0xd800, 0xdc00][i % 4]);
+  assert (mixed.indexOf ("a", i) === naiveIndexOf (mixed, "a", i));
+  assert (mixed.indexOf ("\udc00ф", i) === naiveIndexOf (mixed, "\udc00ф", i));
+}
+assert (mixed.substring (397, 401) === "a\ud800\udc00");
+assert (mixed.slice (7, 9) === "\udc00ф");
+assert (mixed.slice (398, 399) === "\ud800");
+assert (mixed.includes === undefined || mixed.includes ("\udc00фa", 398) === false);
+
+/* Empty patterns. */
+assert (log.indexOf ("", 50) === 50);
+assert (log.indexOf ("", log.length + 5) === log.length);
+assert (log.split ("").length === log.length);
+assert (log.replace ("", "^") === "^" + log);
+
+if (typeof String.prototype.replaceAll === "function") {
+  assert (log.replaceAll ("status=200", "ok").indexOf ("status") === -1);
+  assert (log.replaceAll ("😀", "").indexOf ("\ud83d") === -1);
+}
@@ -0,0 +1,141 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "test-common.h"
+
+static jerry_value_t
+run_lazy (const jerry_char_t *source_p, /**< source code */
+          size_t source_size) /**< size of the source code */
+{
+  jerry_value_t parsed_code_val = jerry_parse (NULL, 0, source_p, source_size, JERRY_PARSE_LAZY_FUNCTIONS);
+  TEST_ASSERT (!jerry_value_is_error (parsed_code_val));
+
+  jerry_value_t result = jerry_run (parsed_code_val);
+  jerry_release_value (parsed_code_val);
+  return result;
+} /* run_lazy */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* Functions are compiled on their first call. */
+  const jerry_char_t source1[] = TEST_STRING_LITERAL (
+    "function add (a, b) { return a + b; }\n"
+    "var mul = function (a, b) { return a * b; };\n"
+    "function never_called () { return 'unused'; }\n"
+    "function outer (n) {\n"
+    "  function inner (k) { return k + n; }\n"
+    "  return inner (1) + inner (2);\n"
+    "}\n"
+    "add (mul (2, 3), outer (10)) + add.length + mul.length"
+  );
+
+  jerry_value_t result = run_lazy (source1, sizeof (source1) - 1);
+  TEST_ASSERT (jerry_value_is_number (result));
+  TEST_ASSERT (jerry_get_number_value (result) == 33.0);
+  jerry_release_value (result);
+
+  /* Closures created by the same function literal share the generated byte code. */
+  const jerry_char_t source2[] = TEST_STRING_LITERAL (
+    "var list = [];\n"
+    "for (var i = 0; i < 4; i++) { list.push (function (x) { 'use strict'; return x * this.m; }); }\n"
+    "var sum = 0;\n"
+    "for (var j = 0; j < list.length; j++) { sum += list[j].call ({ m: j }, 2); }\n"
+    "sum"
+  );
+
+  result = run_lazy (source2, sizeof (source2) - 1);
+  TEST_ASSERT (jerry_value_is_number (result));
+  TEST_ASSERT (jerry_get_number_value (result) == 12.0);
+  jerry_release_value (result);
+
+  /* Early errors of a function body are thrown by its first call. */
+  const jerry_char_t source3[] = TEST_STRING_LITERAL (
+    "function invalid (a, a) { 'use strict'; }\n"
+    "invalid ()"
+  );
+
+  result = run_lazy (source3, sizeof (source3) - 1);
+  TEST_ASSERT (jerry_value_is_error (result));
+  TEST_ASSERT (jerry_get_error_type (result) == JERRY_ERROR_SYNTAX);
+  jerry_release_value (result);
+
+  jerry_value_t parsed_code_val = jerry_parse (NULL, 0, source3, sizeof (source3) - 1, JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_error (parsed_code_val));
+  jerry_release_value (parsed_code_val);
+
+  /* The pre-scan does not detect the early errors: the source is only rejected by an eager parse. */
+  const jerry_char_t source4[] = TEST_STRING_LITERAL (
+    "function bad () { break; }\n"
+  );
+
+  parsed_code_val = jerry_parse (NULL, 0, source4, sizeof (source4) - 1, JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_error (parsed_code_val));
+  TEST_ASSERT (jerry_get_error_type (parsed_code_val) == JERRY_ERROR_SYNTAX);
+  jerry_release_value (parsed_code_val);
+
+  result = run_lazy (source4, sizeof (source4) - 1);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  jerry_release_value (result);
+
+  jerry_value_t global_val = jerry_get_global_object ();
+  jerry_value_t name_val = jerry_create_string ((const jerry_char_t *) "bad");
+  jerry_value_t bad_val = jerry_get_property (global_val, name_val);
+  TEST_ASSERT (jerry_value_is_function (bad_val));
+
+  result = jerry_call_function (bad_val, global_val, NULL, 0);
+  TEST_ASSERT (jerry_value_is_error (result));
+  TEST_ASSERT (jerry_get_error_type (result) == JERRY_ERROR_SYNTAX);
+  jerry_release_value (result);
+
+  jerry_release_value (bad_val);
+  jerry_release_value (name_val);
+  jerry_release_value (global_val);
+
+  /* The option is supported by jerry_parse_function as well. */
+  const jerry_char_t args[] = "n";
+  const jerry_char_t body[] = TEST_STRING_LITERAL (
+    "function fact (k) { return k <= 1 ? 1 : k * fact (k - 1); }\n"
+    "return fact (n);"
+  );
+
+  jerry_value_t func_val = jerry_parse_function (NULL,
+                                                 0,
+                                                 args,
+                                                 sizeof (args) - 1,
+                                                 body,
+                                                 sizeof (body) - 1,
+                                                 JERRY_PARSE_LAZY_FUNCTIONS);
+  TEST_ASSERT (jerry_value_is_function (func_val));
+
+  jerry_value_t this_val = jerry_create_undefined ();
+  jerry_value_t arg_val = jerry_create_number (5);
+  result = jerry_call_function (func_val, this_val, &arg_val, 1);
+  TEST_ASSERT (jerry_value_is_number (result));
+  TEST_ASSERT (jerry_get_number_value (result) == 120.0);
+
+  jerry_release_value (result);
+  jerry_release_value (arg_val);
+  jerry_release_value (this_val);
+  jerry_release_value (func_val);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -244,6 +244,213 @@ test_large_line_count (void)
   jerry_cleanup ();
 } /* test_large_line_count */
 
+static void
+test_backward_lines (void)
+{
+  jerry_init (JERRY_INIT_EMPTY);
+
+  const char *source = ("function f(n) {\n"
+                        "  var sum = 0;\n"
+                        "  for (var i = 0; i < n; i++) {\n"
+                        "    if (i == 3) {\n"
+                        "      undef_reference;\n"
+                        "    }\n"
+                        "    sum += i;\n"
+                        "  }\n"
+                        "  return sum;\n"
+                        "}\n"
+                        "\n"
+                        "var a = f(2), b = 0;\n"
+                        "b = f(5);\n");
+
+  jerry_value_t error = run ("loop.js", source);
+
+  TEST_ASSERT (jerry_value_is_error (error));
+
+  error = jerry_get_value_from_error (error, true);
+
+  TEST_ASSERT (jerry_value_is_object (error));
+
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "stack");
+  jerry_value_t backtrace = jerry_get_property (error, name);
+
+  jerry_release_value (name);
+  jerry_release_value (error);
+
+  TEST_ASSERT (!jerry_value_is_error (backtrace)
+               && jerry_value_is_array (backtrace));
+
+  TEST_ASSERT (jerry_get_array_length (backtrace) == 2);
+
+  compare (backtrace, 0, "loop.js:5");
+  compare (backtrace, 1, "loop.js:13");
+
+  jerry_release_value (backtrace);
+
+  jerry_cleanup ();
+} /* test_backward_lines */
+
+static void
+test_error_after_call (void)
+{
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* The error is raised by an instruction after a call. */
+  const char *source = ("function g() {}\n"
+                        "function f() {\n"
+                        "  g();\n"
+                        "  var o = {};\n"
+                        "  o.a.b = 5;\n"
+                        "}\n"
+                        "f();\n");
+
+  jerry_value_t error = run ("after.js", source);
+
+  TEST_ASSERT (jerry_value_is_error (error));
+
+  error = jerry_get_value_from_error (error, true);
+
+  TEST_ASSERT (jerry_value_is_object (error));
+
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "stack");
+  jerry_value_t backtrace = jerry_get_property (error, name);
+
+  jerry_release_value (error);
+
+  TEST_ASSERT (!jerry_value_is_error (backtrace)
+               && jerry_value_is_array (backtrace));
+
+  TEST_ASSERT (jerry_get_array_length (backtrace) == 2);
+
+  compare (backtrace, 0, "after.js:5");
+  compare (backtrace, 1, "after.js:7");
+
+  jerry_release_value (backtrace);
+
+  /* The error is raised by a built-in function, and the vm_loop continues with the error byte code. */
+  source = ("function f() {\n"
+            "  var a = 0;\n"
+            "\n"
+            "  [].reduce (function () {});\n"
+            "}\n"
+            "\n"
+            "f();\n");
+
+  error = run ("builtin.js", source);
+
+  TEST_ASSERT (jerry_value_is_error (error));
+
+  error = jerry_get_value_from_error (error, true);
+
+  TEST_ASSERT (jerry_value_is_object (error));
+
+  backtrace = jerry_get_property (error, name);
+
+  jerry_release_value (name);
+  jerry_release_value (error);
+
+  TEST_ASSERT (!jerry_value_is_error (backtrace)
+               && jerry_value_is_array (backtrace));
+
+  TEST_ASSERT (jerry_get_array_length (backtrace) == 2);
+
+  compare (backtrace, 0, "builtin.js:4");
+  compare (backtrace, 1, "builtin.js:7");
+
+  jerry_release_value (backtrace);
+
+  jerry_cleanup ();
+} /* test_error_after_call */
+
+static void
+test_implicit_call (void)
+{
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* The error is created by a valueOf method called by an addition after a call. */
+  const char *source = ("var stack;\n"
+                        "var o = { valueOf: function () {\n"
+                        "  stack = new Error ().stack;\n"
+                        "  return 1;\n"
+                        "} };\n"
+                        "function f (a) {\n"
+                        "  var x = 2;\n"
+                        "  g ();\n"
+                        "  x = x * 3;\n"
+                        "  x = a + x;\n"
+                        "  return x;\n"
+                        "}\n"
+                        "function g () {}\n"
+                        "f (o);\n"
+                        "stack;\n");
+
+  jerry_value_t backtrace = run ("coercion.js", source);
+
+  TEST_ASSERT (!jerry_value_is_error (backtrace)
+               && jerry_value_is_array (backtrace));
+
+  TEST_ASSERT (jerry_get_array_length (backtrace) == 3);
+
+  compare (backtrace, 0, "coercion.js:3");
+  compare (backtrace, 1, "coercion.js:10");
+  compare (backtrace, 2, "coercion.js:14");
+
+  jerry_release_value (backtrace);
+
+  /* The error is created by a getter called by the global code before any call. */
+  source = ("var stack;\n"
+            "var o = {\n"
+            "  get p () {\n"
+            "    stack = new Error ().stack;\n"
+            "    return 0;\n"
+            "  }\n"
+            "};\n"
+            "\n"
+            "o.p;\n"
+            "stack;\n");
+
+  backtrace = run ("getter.js", source);
+
+  TEST_ASSERT (!jerry_value_is_error (backtrace)
+               && jerry_value_is_array (backtrace));
+
+  TEST_ASSERT (jerry_get_array_length (backtrace) == 2);
+
+  compare (backtrace, 0, "getter.js:4");
+  compare (backtrace, 1, "getter.js:9");
+
+  jerry_release_value (backtrace);
+
+  /* The error is created by a setter called by a nested function. */
+  source = ("var stack;\n"
+            "var o = { set p (v) { stack = new Error ().stack; } };\n"
+            "function f () {\n"
+            "  var a = 1;\n"
+            "  o.p = a;\n"
+            "}\n"
+            "function g () {\n"
+            "  f ();\n"
+            "}\n"
+            "g ();\n"
+            "stack;\n");
+
+  backtrace = run ("setter.js", source);
+
+  TEST_ASSERT (!jerry_value_is_error (backtrace)
+               && jerry_value_is_array (backtrace));
+
+  TEST_ASSERT (jerry_get_array_length (backtrace) == 4);
+
+  compare (backtrace, 0, "setter.js:2");
+  compare (backtrace, 1, "setter.js:5");
+  compare (backtrace, 2, "setter.js:8");
+  compare (backtrace, 3, "setter.js:10");
+
+  jerry_release_value (backtrace);
+
+  jerry_cleanup ();
+} /* test_implicit_call */
+
 int
 main (void)
 {
@@ -254,6 +461,9 @@ main (void)
   test_get_backtrace_api_call ();
   test_exception_backtrace ();
   test_large_line_count ();
+  test_backward_lines ();
+  test_error_after_call ();
+  test_implicit_call ();
 
   return 0;
 } /* main */
@@ -0,0 +1,191 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-builtins.h"
+#include "ecma-gc.h"
+#include "ecma-helpers.h"
+#include "ecma-init-finalize.h"
+#include "ecma-objects.h"
+#include "jcontext.h"
+
+#include "test-common.h"
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+
+/**
+ * Number of old objects referencing young objects, which is more than the size of the remembered set.
+ */
+#define TEST_OLD_OBJECTS (CONFIG_ECMA_GC_REMEMBERED_SET_SIZE + 44)
+
+static ecma_object_t *holders_p[TEST_OLD_OBJECTS];
+static ecma_object_t *values_p[TEST_OLD_OBJECTS];
+
+static bool
+is_unremembered (ecma_object_t *object_p) /**< object */
+{
+  return (object_p->type_flags_refs & ECMA_OBJECT_REF_MASK) == ECMA_OBJECT_UNREMEMBERED;
+} /* is_unremembered */
+
+static void
+put_object (ecma_object_t *object_p, /**< target object */
+            ecma_length_t index, /**< property index */
+            ecma_object_t *value_p) /**< stored object */
+{
+  ecma_value_t result = ecma_op_object_put_by_index (object_p, index, ecma_make_object_value (value_p), true);
+  TEST_ASSERT (ecma_is_value_true (result));
+} /* put_object */
+
+static ecma_object_t *
+get_object (ecma_object_t *object_p, /**< source object */
+            ecma_length_t index) /**< property index */
+{
+  ecma_value_t result = ecma_op_object_get_by_index (object_p, index);
+  TEST_ASSERT (ecma_is_value_object (result));
+
+  ecma_object_t *result_p = ecma_get_object_from_value (result);
+  ecma_deref_object (result_p);
+  return result_p;
+} /* get_object */
+
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  jmem_init ();
+  ecma_init ();
+
+  /* Promote the objects created by the engine. */
+  ecma_gc_run ();
+
+  /* An old object without references is not in the remembered set. */
+  ecma_object_t *root_p = ecma_create_object (NULL, 0, ECMA_OBJECT_TYPE_GENERAL);
+  put_object (ecma_builtin_get_global (), 0, root_p);
+  ecma_deref_object (root_p);
+
+  ecma_gc_run ();
+  TEST_ASSERT (is_unremembered (root_p));
+
+  uint32_t remembered_count = JERRY_CONTEXT (ecma_gc_remembered_count);
+
+  /* Referenced objects can be modified without a write barrier, so they are remembered. */
+  ecma_ref_object (root_p);
+  TEST_ASSERT ((root_p->type_flags_refs & ECMA_OBJECT_REF_MASK) == ECMA_OBJECT_REF_ONE);
+  TEST_ASSERT (JERRY_CONTEXT (ecma_gc_remembered_count) == remembered_count + 1);
+  ecma_deref_object (root_p);
+
+  ecma_gc_run ();
+  TEST_ASSERT (is_unremembered (root_p));
+  TEST_ASSERT (JERRY_CONTEXT (ecma_gc_remembered_count) == remembered_count);
+
+  /* An unreachable old object in the remembered set is not freed by a minor collection. */
+  ecma_object_t *old_garbage_p = ecma_create_object (NULL, 0, ECMA_OBJECT_TYPE_GENERAL);
+  ecma_gc_run ();
+  TEST_ASSERT (JERRY_CONTEXT (ecma_gc_remembered_count) == remembered_count + 1);
+  ecma_deref_object (old_garbage_p);
+
+  /* A young object referenced only by an old object survives minor collections. */
+  ecma_object_t *young_p = ecma_create_object (NULL, 0, ECMA_OBJECT_TYPE_GENERAL);
+  ecma_object_t *young_garbage_p = ecma_create_object (NULL, 0, ECMA_OBJECT_TYPE_GENERAL);
+
+  put_object (root_p, 0, young_p);
+  TEST_ASSERT (!is_unremembered (root_p));
+  ecma_deref_object (young_p);
+  ecma_deref_object (young_garbage_p);
+
+  size_t objects_number = JERRY_CONTEXT (ecma_gc_objects_number);
+
+  for (uint32_t i = 0; i <= JERRY_GC_PROMOTION_AGE; i++)
+  {
+    ecma_object_t *temp_p = ecma_create_object (NULL, 0, ECMA_OBJECT_TYPE_GENERAL);
+    ecma_deref_object (temp_p);
+
+    ecma_free_unused_memory (JMEM_PRESSURE_LOW);
+    TEST_ASSERT (JERRY_CONTEXT (ecma_gc_objects_number) == objects_number - 1);
+    TEST_ASSERT (get_object (root_p, 0) == young_p);
+  }
+
+  ecma_gc_run ();
+  TEST_ASSERT (JERRY_CONTEXT (ecma_gc_objects_number) == objects_number - 2);
+  TEST_ASSERT (is_unremembered (young_p));
+
+  /* The next collection is a major collection when the remembered set overflows. */
+  for (uint32_t i = 0; i < TEST_OLD_OBJECTS; i++)
+  {
+    holders_p[i] = ecma_create_object (NULL, 0, ECMA_OBJECT_TYPE_GENERAL);
+    put_object (root_p, i + 1, holders_p[i]);
+    ecma_deref_object (holders_p[i]);
+  }
+
+  ecma_gc_run ();
+
+  for (uint32_t i = 0; i < TEST_OLD_OBJECTS; i++)
+  {
+    TEST_ASSERT (is_unremembered (holders_p[i]));
+
+    values_p[i] = ecma_create_object (NULL, 0, ECMA_OBJECT_TYPE_GENERAL);
+    put_object (holders_p[i], 0, values_p[i]);
+    ecma_deref_object (values_p[i]);
+  }
+
+  TEST_ASSERT (JERRY_CONTEXT (ecma_gc_remembered_count) == CONFIG_ECMA_GC_REMEMBERED_SET_SIZE);
+  TEST_ASSERT (JERRY_CONTEXT (ecma_gc_major_pending));
+
+  objects_number = JERRY_CONTEXT (ecma_gc_objects_number);
+  ecma_free_unused_memory (JMEM_PRESSURE_LOW);
+
+  TEST_ASSERT (!JERRY_CONTEXT (ecma_gc_major_pending));
+  TEST_ASSERT (JERRY_CONTEXT (ecma_gc_objects_number) == objects_number);
+
+  for (uint32_t i = 0; i < TEST_OLD_OBJECTS; i++)
+  {
+    TEST_ASSERT (is_unremembered (holders_p[i]) && is_unremembered (values_p[i]));
+    TEST_ASSERT (get_object (holders_p[i], 0) == values_p[i]);
+  }
+
+  /* The reference counter limit is below the sentinel of the old objects. */
+  TEST_ASSERT ((ECMA_OBJECT_MAX_REF >> ECMA_OBJECT_REF_SHIFT) == 1021);
+
+  ecma_object_t *object_p = ecma_create_object (NULL, 0, ECMA_OBJECT_TYPE_GENERAL);
+
+  for (uint32_t i = 1; i < 1021; i++)
+  {
+    ecma_ref_object (object_p);
+  }
+
+  TEST_ASSERT ((object_p->type_flags_refs & ECMA_OBJECT_REF_MASK) == ECMA_OBJECT_MAX_REF);
+
+  ecma_gc_run ();
+  TEST_ASSERT ((object_p->type_flags_refs & ECMA_OBJECT_REF_MASK) == ECMA_OBJECT_MAX_REF);
+
+  objects_number = JERRY_CONTEXT (ecma_gc_objects_number);
+
+  for (uint32_t i = 0; i < 1021; i++)
+  {
+    ecma_deref_object (object_p);
+  }
+
+  ecma_gc_run ();
+  TEST_ASSERT (JERRY_CONTEXT (ecma_gc_objects_number) == objects_number - 1);
+
+  ecma_finalize ();
+  jmem_finalize ();
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+  return 0;
+} /* main */
@@ -0,0 +1,171 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "test-common.h"
+
+static int free_count = 0;
+
+static void
+free_cb (void *native_p) /**< native pointer */
+{
+  JERRY_UNUSED (native_p);
+  free_count++;
+} /* free_cb */
+
+static const jerry_object_native_info_t test_info =
+{
+  .free_cb = free_cb
+};
+
+static jerry_value_t
+step_handler (const jerry_value_t func_obj_val, /**< function object */
+              const jerry_value_t this_val, /**< this value */
+              const jerry_value_t args_p[], /**< arguments list */
+              const jerry_length_t args_cnt) /**< arguments length */
+{
+  JERRY_UNUSED (func_obj_val);
+  JERRY_UNUSED (this_val);
+  JERRY_UNUSED (args_p);
+  JERRY_UNUSED (args_cnt);
+
+  return jerry_create_boolean (jerry_gc_step (2));
+} /* step_handler */
+
+static jerry_value_t
+native_object_handler (const jerry_value_t func_obj_val, /**< function object */
+                       const jerry_value_t this_val, /**< this value */
+                       const jerry_value_t args_p[], /**< arguments list */
+                       const jerry_length_t args_cnt) /**< arguments length */
+{
+  JERRY_UNUSED (func_obj_val);
+  JERRY_UNUSED (this_val);
+  JERRY_UNUSED (args_p);
+  JERRY_UNUSED (args_cnt);
+
+  jerry_value_t object = jerry_create_object ();
+  jerry_set_object_native_pointer (object, NULL, &test_info);
+  return object;
+} /* native_object_handler */
+
+static void
+register_function (const char *name_p, /**< name of the function */
+                   jerry_external_handler_t handler) /**< native handler */
+{
+  jerry_value_t global = jerry_get_global_object ();
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) name_p);
+  jerry_value_t function = jerry_create_external_function (handler);
+
+  jerry_value_t result = jerry_set_property (global, name, function);
+  TEST_ASSERT (!jerry_value_is_error (result));
+
+  jerry_release_value (result);
+  jerry_release_value (function);
+  jerry_release_value (name);
+  jerry_release_value (global);
+} /* register_function */
+
+static void
+run_script (const char *source_p) /**< source code */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  jerry_release_value (result);
+} /* run_script */
+
+static void
+finish_cycle (void)
+{
+  int steps = 0;
+
+  while (!jerry_gc_step (16))
+  {
+    steps++;
+    TEST_ASSERT (steps < 100000);
+  }
+} /* finish_cycle */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  register_function ("step", step_handler);
+  register_function ("createNativeObject", native_object_handler);
+
+  /* Objects which are moved between marked and unmarked objects during a cycle must survive. */
+  run_script ("var root = { list: null, items: [] };\n"
+              "function Node (value, next) { this.value = value; this.next = next; }\n"
+              "for (var i = 0; i < 2000; i++) {\n"
+              "  var node = new Node (i, null);\n"
+              "  step ();\n"
+              "  node.next = root.list;\n"
+              "  root.list = node;\n"
+              "  root.items[i % 100] = { node: node };\n"
+              "  root.last = (function (captured) { return function () { return captured.value; }; }) ({ value: i });\n"
+              "}\n");
+
+  run_script ("var sum = 0;\n"
+              "for (var node = root.list; node !== null; node = node.next) {\n"
+              "  sum += node.value;\n"
+              "  step ();\n"
+              "}\n"
+              "if (sum !== 1999 * 2000 / 2 || root.last () !== 1999) throw new Error ('corrupted');\n"
+              "for (var i = 0; i < 100; i++) {\n"
+              "  if (root.items[i].node.value % 100 !== i) throw new Error ('corrupted');\n"
+              "}\n");
+
+  /* Objects copied from the buffer of an array into a new array must survive. */
+  finish_cycle ();
+  run_script ("var holder = { a: [createNativeObject ()], c: [createNativeObject ()], s: [createNativeObject ()] };\n");
+
+  TEST_ASSERT (!jerry_gc_step (1));
+  run_script ("var copies = [holder.a.slice (), [].concat (holder.c), holder.s.splice (0, 1)];\n"
+              "holder.a.length = 0;\n"
+              "holder.c.length = 0;\n"
+              "holder = null;\n");
+
+  finish_cycle ();
+  finish_cycle ();
+  TEST_ASSERT (free_count == 0);
+
+  run_script ("copies = null;\n");
+
+  finish_cycle ();
+  finish_cycle ();
+  TEST_ASSERT (free_count == 3);
+  free_count = 0;
+
+  /* Unreachable objects are freed when the cycle is finished. */
+  run_script ("for (var i = 0; i < 10; i++) { createNativeObject (); }\n"
+              "var kept = createNativeObject ();\n");
+
+  finish_cycle ();
+  finish_cycle ();
+  TEST_ASSERT (free_count == 10);
+
+  /* A full collection abandons the incremental cycle. */
+  run_script ("for (var i = 0; i < 10; i++) { createNativeObject (); }\n"
+              "kept = null;\n");
+
+  TEST_ASSERT (!jerry_gc_step (1));
+  jerry_gc (JERRY_GC_PRESSURE_LOW);
+  TEST_ASSERT (free_count == 21);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
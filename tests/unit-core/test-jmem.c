@@ -20,6 +20,40 @@
 
 #define BASIC_SIZE (64)
 
+/* Number of blocks alive at the same time during the fragmentation test. */
+#define FRAGMENT_SLOTS (128)
+
+/* Iterations count of the fragmentation test. */
+#define FRAGMENT_ITERS (16384)
+
+static uint8_t *fragment_ptrs[FRAGMENT_SLOTS];
+static size_t fragment_sizes[FRAGMENT_SLOTS];
+
+/**
+ * Fill a block with a pattern which depends on its slot.
+ */
+static void
+fragment_fill (size_t slot) /**< slot index */
+{
+  for (size_t i = 0; i < fragment_sizes[slot]; i++)
+  {
+    fragment_ptrs[slot][i] = (uint8_t) (slot + i);
+  }
+} /* fragment_fill */
+
+/**
+ * Check the pattern of a block.
+ */
+static void
+fragment_check (size_t slot, /**< slot index */
+                size_t size) /**< number of bytes to check */
+{
+  for (size_t i = 0; i < size; i++)
+  {
+    TEST_ASSERT (fragment_ptrs[slot][i] == (uint8_t) (slot + i));
+  }
+} /* fragment_check */
+
 int
 main (void)
 {
@@ -103,6 +137,43 @@ main (void)
     jmem_heap_free_block (block4_p, BASIC_SIZE * 2);
   }
 
+  /* Random allocations, reallocations and frees of mixed sizes, which fragment the heap. */
+  for (uint32_t i = 0; i < FRAGMENT_ITERS; i++)
+  {
+    size_t slot = (size_t) rand () % FRAGMENT_SLOTS;
+    size_t size = ((size_t) rand () % 8 == 0) ? ((size_t) rand () % 1024) + 1 : ((size_t) rand () % 96) + 1;
+
+    if (fragment_ptrs[slot] == NULL)
+    {
+      fragment_ptrs[slot] = (uint8_t *) jmem_heap_alloc_block (size);
+      fragment_sizes[slot] = size;
+      fragment_fill (slot);
+    }
+    else if (rand () % 2 == 0)
+    {
+      size_t old_size = fragment_sizes[slot];
+      fragment_ptrs[slot] = (uint8_t *) jmem_heap_realloc_block (fragment_ptrs[slot], old_size, size);
+      fragment_check (slot, JERRY_MIN (old_size, size));
+      fragment_sizes[slot] = size;
+      fragment_fill (slot);
+    }
+    else
+    {
+      fragment_check (slot, fragment_sizes[slot]);
+      jmem_heap_free_block (fragment_ptrs[slot], fragment_sizes[slot]);
+      fragment_ptrs[slot] = NULL;
+    }
+  }
+
+  for (size_t slot = 0; slot < FRAGMENT_SLOTS; slot++)
+  {
+    if (fragment_ptrs[slot] != NULL)
+    {
+      fragment_check (slot, fragment_sizes[slot]);
+      jmem_heap_free_block (fragment_ptrs[slot], fragment_sizes[slot]);
+    }
+  }
+
   ecma_finalize ();
   jmem_finalize ();
 
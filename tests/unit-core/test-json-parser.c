@@ -0,0 +1,305 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+static const char *valid_documents[] =
+{
+  "{\"name\": \"John\", \"age\": 5, \"tags\": [\"a\", \"b\"]}",
+  " [ 1, -2.5e3, 0, true, false, null, \"\\u0041\\n\\\"\", {}, [], [[]] ] ",
+  "\"\\u00e9\\\\\xc3\xa9\\/\"",
+  "-12.75E-1",
+  "true",
+  "null",
+  "{\"a\":{\"b\":{\"c\":[1,{\"d\":\"e\"}]}},\"f\":[{},{\"g\":null}]}",
+};
+
+static const char *invalid_documents[] =
+{
+  "",
+  "-",
+  "[1,]",
+  "{\"a\" 1}",
+  "{\"a\":1,}",
+  "[1 2]",
+  "\"abc",
+  "\"a\tb\"",
+  "[\"\\x\"]",
+  "01",
+  "1.",
+  "tru",
+  "truex",
+  "nul l",
+  "[1]]",
+  "{\"a\":[}",
+  "[",
+  "1 2",
+};
+
+/**
+ * Convert a value to a JSON string and compare it with the expected value.
+ */
+static bool
+compare_json (jerry_value_t value, /**< value */
+              jerry_value_t expected) /**< expected value */
+{
+  jerry_value_t value_json = jerry_json_stringify (value);
+  jerry_value_t expected_json = jerry_json_stringify (expected);
+  jerry_value_t result = jerry_binary_operation (JERRY_BIN_OP_STRICT_EQUAL, value_json, expected_json);
+
+  bool is_equal = jerry_get_boolean_value (result);
+
+  jerry_release_value (result);
+  jerry_release_value (expected_json);
+  jerry_release_value (value_json);
+  return is_equal;
+} /* compare_json */
+
+/**
+ * Parse a document passed in chunks: the first chunk is split_size long,
+ * and the rest is passed in chunks of chunk_size.
+ */
+static jerry_value_t
+parse_in_chunks (const char *document_p, /**< document */
+                 jerry_size_t split_size, /**< size of the first chunk */
+                 jerry_size_t chunk_size, /**< size of the other chunks */
+                 jerry_json_parser_callback_t callback, /**< callback */
+                 void *user_p) /**< user pointer */
+{
+  const jerry_char_t *data_p = (const jerry_char_t *) document_p;
+  jerry_size_t size = (jerry_size_t) strlen (document_p);
+  jerry_json_parser_t *parser_p = jerry_json_parser_create (callback, user_p);
+  jerry_size_t offset = split_size;
+
+  jerry_value_t result = jerry_json_parser_feed (parser_p, data_p, split_size);
+
+  while (!jerry_value_is_error (result) && offset < size)
+  {
+    jerry_size_t next_size = (size - offset < chunk_size) ? size - offset : chunk_size;
+
+    jerry_release_value (result);
+    result = jerry_json_parser_feed (parser_p, data_p + offset, next_size);
+    offset += next_size;
+  }
+
+  if (!jerry_value_is_error (result))
+  {
+    TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+    jerry_release_value (result);
+    result = jerry_json_parser_finish (parser_p);
+  }
+
+  jerry_json_parser_free (parser_p);
+  return result;
+} /* parse_in_chunks */
+
+/**
+ * Counters of the record selecting callback.
+ */
+typedef struct
+{
+  uint32_t records; /**< number of records */
+  double id_sum; /**< sum of the ids of the records */
+  uint32_t events; /**< number of events */
+} record_counters_t;
+
+/**
+ * Keep only the objects in the arrays of the second level, and drop them after they are processed.
+ */
+static jerry_json_parser_action_t
+record_callback (jerry_json_parser_event_t event, /**< event */
+                 const jerry_value_t key, /**< key */
+                 const jerry_value_t value, /**< closed container */
+                 uint32_t depth, /**< depth */
+                 void *user_p) /**< user pointer */
+{
+  record_counters_t *counters_p = (record_counters_t *) user_p;
+  counters_p->events++;
+
+  TEST_ASSERT (depth > 0 || jerry_value_is_undefined (key));
+
+  if (event == JERRY_JSON_PARSER_OBJECT_START && depth == 2 && jerry_value_is_number (key))
+  {
+    TEST_ASSERT (jerry_value_is_undefined (value));
+    return JERRY_JSON_PARSER_KEEP;
+  }
+
+  if (event == JERRY_JSON_PARSER_OBJECT_END)
+  {
+    TEST_ASSERT (depth == 2);
+
+    jerry_value_t id_key = jerry_create_string ((const jerry_char_t *) "id");
+    jerry_value_t id_value = jerry_get_property (value, id_key);
+
+    TEST_ASSERT (jerry_value_is_number (id_value));
+    counters_p->id_sum += jerry_get_number_value (id_value);
+    counters_p->records++;
+
+    jerry_release_value (id_value);
+    jerry_release_value (id_key);
+  }
+
+  return JERRY_JSON_PARSER_DISCARD;
+} /* record_callback */
+
+/**
+ * Drop the odd elements of the arrays.
+ */
+static jerry_json_parser_action_t
+drop_odd_callback (jerry_json_parser_event_t event, /**< event */
+                   const jerry_value_t key, /**< key */
+                   const jerry_value_t value, /**< closed container */
+                   uint32_t depth, /**< depth */
+                   void *user_p) /**< user pointer */
+{
+  JERRY_UNUSED (value);
+  JERRY_UNUSED (depth);
+  JERRY_UNUSED (user_p);
+
+  if ((event == JERRY_JSON_PARSER_OBJECT_END || event == JERRY_JSON_PARSER_ARRAY_END)
+      && jerry_value_is_number (key)
+      && ((uint32_t) jerry_get_number_value (key) % 2) == 1)
+  {
+    return JERRY_JSON_PARSER_DISCARD;
+  }
+
+  return JERRY_JSON_PARSER_KEEP;
+} /* drop_odd_callback */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_JSON))
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "JSON support is disabled!\n");
+    jerry_cleanup ();
+    return 0;
+  }
+
+  /* Every document is split at every position, and also passed byte by byte. */
+  for (size_t i = 0; i < sizeof (valid_documents) / sizeof (valid_documents[0]); i++)
+  {
+    const char *document_p = valid_documents[i];
+    jerry_size_t size = (jerry_size_t) strlen (document_p);
+    jerry_value_t expected = jerry_json_parse ((const jerry_char_t *) document_p, size);
+    TEST_ASSERT (!jerry_value_is_error (expected));
+
+    for (jerry_size_t split_size = 0; split_size <= size; split_size++)
+    {
+      jerry_value_t result = parse_in_chunks (document_p, split_size, size, NULL, NULL);
+      TEST_ASSERT (!jerry_value_is_error (result));
+      TEST_ASSERT (compare_json (result, expected));
+      jerry_release_value (result);
+
+      result = parse_in_chunks (document_p, split_size, 1, NULL, NULL);
+      TEST_ASSERT (!jerry_value_is_error (result));
+      TEST_ASSERT (compare_json (result, expected));
+      jerry_release_value (result);
+    }
+
+    jerry_release_value (expected);
+  }
+
+  for (size_t i = 0; i < sizeof (invalid_documents) / sizeof (invalid_documents[0]); i++)
+  {
+    const char *document_p = invalid_documents[i];
+    jerry_size_t size = (jerry_size_t) strlen (document_p);
+
+    for (jerry_size_t split_size = 0; split_size <= size; split_size++)
+    {
+      jerry_value_t result = parse_in_chunks (document_p, split_size, 1, NULL, NULL);
+      TEST_ASSERT (jerry_value_is_error (result));
+      TEST_ASSERT (jerry_get_error_type (result) == JERRY_ERROR_SYNTAX);
+      jerry_release_value (result);
+    }
+  }
+
+  /* Only the records are built. */
+  {
+    const char *document_p = ("{\"meta\": {\"count\": 3, \"list\": [1, 2]},"
+                              " \"items\": [{\"id\": 1, \"data\": [1]}, {\"id\": 20}, {\"id\": 300, \"x\": {}}],"
+                              " \"tail\": [[{\"id\": 4000}]]}");
+    jerry_size_t size = (jerry_size_t) strlen (document_p);
+
+    for (jerry_size_t chunk_size = 1; chunk_size <= size; chunk_size += 7)
+    {
+      record_counters_t counters = { 0, 0.0, 0 };
+      jerry_value_t result = parse_in_chunks (document_p, 0, chunk_size, record_callback, &counters);
+
+      TEST_ASSERT (jerry_value_is_undefined (result));
+      TEST_ASSERT (counters.records == 3);
+      TEST_ASSERT (counters.id_sum == 321.0);
+      /* Twelve start events, and an end event for each record. */
+      TEST_ASSERT (counters.events == 12 + 3);
+    }
+  }
+
+  /* Dropped array elements do not leave holes. */
+  {
+    const char *document_p = "[{\"a\": 0}, {\"a\": 1}, [2], 3, {\"a\": [0, [1], [2], 3]}]";
+    const char *expected_p = "[{\"a\": 0}, [2], 3, {\"a\": [0, [2], 3]}]";
+
+    jerry_value_t result = parse_in_chunks (document_p, 0, 5, drop_odd_callback, NULL);
+    jerry_value_t expected = jerry_json_parse ((const jerry_char_t *) expected_p, (jerry_size_t) strlen (expected_p));
+
+    TEST_ASSERT (!jerry_value_is_error (result));
+    TEST_ASSERT (compare_json (result, expected));
+
+    jerry_release_value (expected);
+    jerry_release_value (result);
+  }
+
+  /* The parser keeps reporting the error. */
+  {
+    jerry_json_parser_t *parser_p = jerry_json_parser_create (NULL, NULL);
+
+    jerry_value_t result = jerry_json_parser_feed (parser_p, (const jerry_char_t *) "[1, }", 5);
+    TEST_ASSERT (jerry_value_is_error (result));
+    jerry_release_value (result);
+
+    result = jerry_json_parser_feed (parser_p, (const jerry_char_t *) "2]", 2);
+    TEST_ASSERT (jerry_value_is_error (result));
+    jerry_release_value (result);
+
+    result = jerry_json_parser_finish (parser_p);
+    TEST_ASSERT (jerry_value_is_error (result));
+    jerry_release_value (result);
+
+    jerry_json_parser_free (parser_p);
+  }
+
+  /* Freeing an unfinished parser releases the partially built values. */
+  {
+    jerry_json_parser_t *parser_p = jerry_json_parser_create (NULL, NULL);
+
+    const char *chunk_p = "{\"a\": [{\"b\": \"long string value\"}, {\"c\": tr";
+    jerry_value_t result = jerry_json_parser_feed (parser_p, (const jerry_char_t *) chunk_p,
+                                                   (jerry_size_t) strlen (chunk_p));
+    TEST_ASSERT (!jerry_value_is_error (result));
+    jerry_release_value (result);
+
+    jerry_json_parser_free (parser_p);
+  }
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
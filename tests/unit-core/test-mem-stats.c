@@ -26,6 +26,8 @@ int main (void)
     "var a = 'hello';"
     "var b = 'world';"
     "var c = a + ' ' + b;"
+    "var list = null;"
+    "for (var i = 0; i < 1000; i++) { list = { next: list }; }"
   );
 
   jerry_init (JERRY_INIT_EMPTY);
@@ -43,14 +45,53 @@ int main (void)
   memset (&stats, 0, sizeof (stats));
   bool get_stats_ret = jerry_get_memory_stats (&stats);
   TEST_ASSERT (get_stats_ret);
-  TEST_ASSERT (stats.version == 1);
+  TEST_ASSERT (stats.version == 2);
   TEST_ASSERT (stats.size == 524280);
 
+  /* The size of the stats struct is part of the ABI. */
+  TEST_ASSERT (sizeof (jerry_heap_stats_t) == 8 * sizeof (size_t));
+
+  /* Every element of the linked list is reachable, so the collector must scan all of them. */
+  jerry_gc (JERRY_GC_PRESSURE_LOW);
+
+  memset (&stats, 0, sizeof (stats));
+  get_stats_ret = jerry_get_memory_stats (&stats);
+  TEST_ASSERT (get_stats_ret);
+  TEST_ASSERT (stats.gc_objects_scanned > 1000);
+  TEST_ASSERT (stats.gc_max_time_us >= stats.gc_time_us);
+
   TEST_ASSERT (!jerry_get_memory_stats (NULL));
 
   jerry_release_value (res);
   jerry_release_value (parsed_code_val);
 
+  /* Methods of the prototype are found by the lookup cache. */
+  const jerry_char_t method_source[] = TEST_STRING_LITERAL (
+    "var proto = { method: function () { return 1; } };"
+    "var obj = Object.create (Object.create (proto));"
+    "var sum = 0;"
+    "for (var i = 0; i < 100; i++) { sum += obj.method (); }"
+  );
+
+  res = jerry_eval (method_source, sizeof (method_source) - 1, JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (res));
+  jerry_release_value (res);
+
+  jerry_lcache_stats_t lcache_stats;
+
+  if (jerry_get_lcache_stats (&lcache_stats))
+  {
+    TEST_ASSERT (lcache_stats.hits <= lcache_stats.lookups);
+    TEST_ASSERT (lcache_stats.prototype_hits <= lcache_stats.prototype_lookups);
+
+    if (lcache_stats.prototype_lookups > 0)
+    {
+      TEST_ASSERT (lcache_stats.prototype_hits >= 90);
+    }
+  }
+
+  TEST_ASSERT (!jerry_get_lcache_stats (NULL));
+
   jerry_cleanup ();
 
   return 0;
@@ -0,0 +1,123 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-helpers.h"
+#include "ecma-shape.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+
+/**
+ * Operations which must not convert an object with a shape to a property pair list.
+ */
+static const char *keep_shape_sources[] =
+{
+  "o.x",
+  "o['y']",
+  "o.missing",
+  "'x' in o",
+  "o.hasOwnProperty ('x')",
+  "Object.getOwnPropertyDescriptor (o, 'x')",
+  "Object.keys (o)",
+  "Object.getOwnPropertyNames (o)",
+  "Object.entries (o)",
+  "for (var key in o) {}",
+  "JSON.stringify (o)",
+  "Object.assign ({}, o)",
+  "var { x, y } = o",
+  "({ ...o })",
+  "with (o) { x + y }",
+  "Object.isFrozen (o)",
+  "o.x = 5",
+  "Object.defineProperty (o, 'x', { value: 6 })",
+  "o.z = 7",
+  "Object.defineProperty (o, 'w', { value: 8, writable: true, enumerable: true, configurable: true })",
+};
+
+/**
+ * Operations which convert an object with a shape to a property pair list.
+ */
+static const char *convert_sources[] =
+{
+  "delete o.x",
+  "Object.defineProperty (o, 'x', { enumerable: false })",
+  "Object.freeze (o)",
+  "Object.defineProperty (o, 'a', { get: function () {} })",
+};
+
+static jerry_value_t
+eval (const char *source_p) /**< source code */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  return result;
+} /* eval */
+
+static bool
+has_shape (void)
+{
+  jerry_value_t object = eval ("o");
+  TEST_ASSERT (jerry_value_is_object (object));
+
+  bool result = ECMA_OBJECT_HAS_SHAPE (ecma_get_object_from_value (object));
+  jerry_release_value (object);
+  return result;
+} /* has_shape */
+
+static void
+create_object (void)
+{
+  jerry_release_value (eval ("function Point (x, y) { this.x = x; this.y = y }\n"
+                             "var o = new Point (1, 2)"));
+  TEST_ASSERT (has_shape ());
+} /* create_object */
+
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  jerry_init (JERRY_INIT_EMPTY);
+
+  create_object ();
+
+  for (uint32_t i = 0; i < sizeof (keep_shape_sources) / sizeof (keep_shape_sources[0]); i++)
+  {
+    jerry_release_value (eval (keep_shape_sources[i]));
+    TEST_ASSERT (has_shape ());
+  }
+
+  jerry_value_t result = eval ("o.x === 6 && o.y === 2 && o.z === 7 && o.w === 8 "
+                               "&& Object.keys (o).join () === 'x,y,z,w'");
+  TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+  jerry_release_value (result);
+
+  for (uint32_t i = 0; i < sizeof (convert_sources) / sizeof (convert_sources[0]); i++)
+  {
+    create_object ();
+    jerry_release_value (eval (convert_sources[i]));
+    TEST_ASSERT (!has_shape ());
+  }
+
+  jerry_cleanup ();
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+  return 0;
+} /* main */
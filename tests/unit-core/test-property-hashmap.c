@@ -0,0 +1,132 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+static jerry_value_t
+eval (const char *source_p) /**< source code */
+{
+  return jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+} /* eval */
+
+static void
+check_eval (const char *source_p) /**< source code which must evaluate to true */
+{
+  jerry_value_t result = eval (source_p);
+  TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+  jerry_release_value (result);
+} /* check_eval */
+
+static size_t
+get_hashmap_lookups (void)
+{
+  jerry_property_hashmap_stats_t stats;
+
+  if (!jerry_get_property_hashmap_stats (&stats))
+  {
+    return 0;
+  }
+
+  TEST_ASSERT (stats.hits <= stats.lookups);
+  TEST_ASSERT (stats.lookups <= stats.probes);
+  return stats.lookups;
+} /* get_hashmap_lookups */
+
+int
+main (void)
+{
+  TEST_INIT ();
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t object = jerry_create_object ();
+  jerry_value_t number = jerry_create_number (1);
+
+  if (!jerry_set_property_hashmap_thresholds (32, 128))
+  {
+    TEST_ASSERT (!jerry_object_optimize_for_lookup (object));
+
+    jerry_release_value (number);
+    jerry_release_value (object);
+    jerry_cleanup ();
+    return 0;
+  }
+
+  TEST_ASSERT (!jerry_set_property_hashmap_thresholds (7, 128));
+  TEST_ASSERT (!jerry_set_property_hashmap_thresholds (32, 200000));
+  TEST_ASSERT (!jerry_set_property_hashmap_thresholds (200000, 128));
+  TEST_ASSERT (!jerry_get_property_hashmap_stats (NULL));
+
+  /* Only objects with properties can have a hashmap. */
+  TEST_ASSERT (!jerry_object_optimize_for_lookup (number));
+  TEST_ASSERT (!jerry_object_optimize_for_lookup (object));
+
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "a");
+  jerry_release_value (jerry_set_property (object, name, number));
+  jerry_release_value (name);
+
+  TEST_ASSERT (jerry_object_optimize_for_lookup (object));
+  TEST_ASSERT (jerry_object_optimize_for_lookup (object));
+
+  /* The hashmap is maintained when properties are added or deleted. */
+  jerry_value_t global = jerry_get_global_object ();
+  name = jerry_create_string ((const jerry_char_t *) "dict");
+  jerry_release_value (jerry_set_property (global, name, object));
+  jerry_release_value (name);
+  jerry_release_value (global);
+
+  size_t lookups = get_hashmap_lookups ();
+
+  check_eval ("for (var i = 0; i < 100; i++) dict['k' + i] = i;"
+              "for (var i = 0; i < 100; i += 2) delete dict['k' + i];"
+              "var sum = 0;"
+              "for (var i = 0; i < 100; i++) sum += dict['k' + i] || 0;"
+              "sum === 2500 && dict.a === 1 && !('k0' in dict) && Object.keys (dict).length === 51");
+
+  TEST_ASSERT (get_hashmap_lookups () >= lookups);
+
+  /* Frequently searched objects with a moderate number of properties. */
+  TEST_ASSERT (jerry_set_property_hashmap_thresholds (64, 16));
+  lookups = get_hashmap_lookups ();
+
+  check_eval ("var small = {};"
+              "for (var i = 0; i < 20; i++) small['p' + i] = i;"
+              "var found = 0;"
+              "for (var j = 0; j < 100; j++) for (var i = 0; i < 20; i++) found += small['p' + i] === i;"
+              "delete small.p3; small.q = 5;"
+              "found === 2000 && small.q === 5 && small.p3 === undefined && small.p19 === 19");
+
+  jerry_property_hashmap_stats_t stats;
+
+  if (jerry_get_property_hashmap_stats (&stats))
+  {
+    TEST_ASSERT (stats.lookups > lookups);
+    TEST_ASSERT (stats.hits > 0);
+  }
+
+  /* The adaptive creation can be disabled. */
+  TEST_ASSERT (jerry_set_property_hashmap_thresholds (32, 0));
+
+  check_eval ("var other = {};"
+              "for (var i = 0; i < 12; i++) other['p' + i] = i;"
+              "var count = 0;"
+              "for (var j = 0; j < 100; j++) for (var i = 0; i < 12; i++) count += other['p' + i];"
+              "count === 6600");
+
+  jerry_release_value (number);
+  jerry_release_value (object);
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -0,0 +1,118 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+static void
+compile (const char *pattern_p, /**< pattern */
+         uint16_t flags) /**< flags */
+{
+  jerry_value_t regex_obj = jerry_create_regexp ((const jerry_char_t *) pattern_p, flags);
+  TEST_ASSERT (jerry_value_is_object (regex_obj));
+  jerry_release_value (regex_obj);
+} /* compile */
+
+static void
+check_stats (uint32_t count, /**< expected number of cached regular expressions */
+             uint32_t hits, /**< expected number of hits */
+             uint32_t misses) /**< expected number of misses */
+{
+  jerry_regexp_cache_stats_t stats;
+
+  TEST_ASSERT (jerry_get_regexp_cache_stats (&stats));
+  TEST_ASSERT (stats.count == count);
+  TEST_ASSERT (stats.hits == hits);
+  TEST_ASSERT (stats.misses == misses);
+} /* check_stats */
+
+int
+main (void)
+{
+  TEST_INIT ();
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_REGEXP))
+  {
+    jerry_regexp_cache_stats_t stats;
+    TEST_ASSERT (!jerry_get_regexp_cache_stats (&stats));
+    TEST_ASSERT (!jerry_set_regexp_cache_size (16));
+
+    jerry_cleanup ();
+    return 0;
+  }
+
+  /* In ES5.1 the RegExp prototype is a regular expression itself, which
+   * is compiled when the first regular expression is created. */
+  compile ("", 0);
+
+  TEST_ASSERT (!jerry_set_regexp_cache_size (1025));
+  TEST_ASSERT (jerry_set_regexp_cache_size (64));
+
+  jerry_regexp_cache_stats_t stats;
+  TEST_ASSERT (jerry_get_regexp_cache_stats (&stats));
+  TEST_ASSERT (stats.size == 64);
+
+  /* The cache may already contain regular expressions created by the engine. */
+  uint32_t base_count = stats.count;
+  uint32_t base_hits = stats.hits;
+  uint32_t base_misses = stats.misses;
+  char pattern[16];
+
+  /* Patterns which fit into the cache are compiled once. */
+  for (int round = 0; round < 3; round++)
+  {
+    for (int i = 0; i < 40; i++)
+    {
+      snprintf (pattern, sizeof (pattern), "a%d[b-z]+", i);
+      compile (pattern, JERRY_REGEXP_FLAG_GLOBAL);
+    }
+  }
+
+  check_stats (base_count + 40, base_hits + 80, base_misses + 40);
+
+  /* The flags are part of the key. */
+  compile ("a0[b-z]+", JERRY_REGEXP_FLAG_IGNORE_CASE);
+  check_stats (base_count + 41, base_hits + 80, base_misses + 41);
+
+  /* The least recently used entry is evicted. */
+  TEST_ASSERT (jerry_set_regexp_cache_size (2));
+  base_hits += 80;
+  base_misses += 41;
+  check_stats (0, base_hits, base_misses);
+
+  compile ("first", 0);
+  compile ("second", 0);
+  compile ("first", 0);
+  check_stats (2, base_hits + 1, base_misses + 2);
+
+  compile ("third", 0);
+  compile ("first", 0);
+  check_stats (2, base_hits + 2, base_misses + 3);
+
+  compile ("second", 0);
+  check_stats (2, base_hits + 2, base_misses + 4);
+
+  /* The cache can be disabled. */
+  TEST_ASSERT (jerry_set_regexp_cache_size (0));
+  compile ("first", 0);
+  compile ("first", 0);
+  check_stats (0, base_hits + 2, base_misses + 6);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -192,6 +192,67 @@ static void test_exec_snapshot (uint32_t *snapshot_p, size_t snapshot_size, uint
   jerry_cleanup ();
 } /* test_exec_snapshot */
 
+static void line_info_test_exec_snapshot (uint32_t *snapshot_p, size_t snapshot_size, uint32_t exec_snapshot_flags)
+{
+  static const char expected_stack[] = "snapshot.js:4 snapshot.js:7";
+  char string_data[32];
+
+  jerry_init (JERRY_INIT_EMPTY);
+  jerry_value_t res = jerry_exec_snapshot (snapshot_p, snapshot_size, 0, exec_snapshot_flags);
+  TEST_ASSERT (!jerry_value_is_error (res));
+  TEST_ASSERT (jerry_value_is_string (res));
+  jerry_size_t sz = jerry_get_string_size (res);
+  TEST_ASSERT (sz == sizeof (expected_stack) - 1);
+  sz = jerry_string_to_char_buffer (res, (jerry_char_t *) string_data, sz);
+  TEST_ASSERT (sz == sizeof (expected_stack) - 1);
+  jerry_release_value (res);
+  TEST_ASSERT (!strncmp (string_data, expected_stack, (size_t) sz));
+
+  jerry_cleanup ();
+} /* line_info_test_exec_snapshot */
+
+static void test_line_info_snapshot (void)
+{
+  if (jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE)
+      && jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC)
+      && jerry_is_feature_enabled (JERRY_FEATURE_LINE_INFO))
+  {
+    static uint32_t line_info_snapshot_buffer[SNAPSHOT_BUFFER_SIZE];
+
+    const jerry_char_t resource_name[] = "snapshot.js";
+    const jerry_char_t code_to_snapshot[] = TEST_STRING_LITERAL (
+      "function f(a, b) {\n"
+      "  a = a + b;\n"
+      "  b = a * b;\n"
+      "  return new Error ().stack.slice (0, 2).join (' ');\n"
+      "}\n"
+      "\n"
+      "f (3, 4);\n"
+    );
+    jerry_init (JERRY_INIT_EMPTY);
+
+    jerry_value_t generate_result;
+    generate_result = jerry_generate_snapshot (resource_name,
+                                               sizeof (resource_name) - 1,
+                                               code_to_snapshot,
+                                               sizeof (code_to_snapshot) - 1,
+                                               0,
+                                               line_info_snapshot_buffer,
+                                               SNAPSHOT_BUFFER_SIZE);
+
+    TEST_ASSERT (!jerry_value_is_error (generate_result)
+                 && jerry_value_is_number (generate_result));
+
+    size_t snapshot_size = (size_t) jerry_get_number_value (generate_result);
+    jerry_release_value (generate_result);
+
+    jerry_cleanup ();
+
+    line_info_test_exec_snapshot (line_info_snapshot_buffer, snapshot_size, 0);
+    line_info_test_exec_snapshot (line_info_snapshot_buffer, snapshot_size, JERRY_SNAPSHOT_EXEC_COPY_DATA);
+  }
+} /* test_line_info_snapshot */
+
 int
 main (void)
 {
@@ -399,5 +460,7 @@ main (void)
 
   test_function_arguments_snapshot ();
 
+  test_line_info_snapshot ();
+
   return 0;
 } /* main */
@@ -545,6 +545,60 @@ test_detached_arraybuffer (void)
   }
 } /* test_detached_arraybuffer */
 
+/**
+ * Test the default sort of a TypedArray which leaves no room for a temporary buffer.
+ */
+static void
+test_sort_in_place (void)
+{
+  jerry_heap_stats_t stats;
+  memset (&stats, 0, sizeof (stats));
+
+  if (!jerry_get_memory_stats (&stats))
+  {
+    return;
+  }
+
+  /* The array takes 60% of the free heap, so the temporary buffer of the
+   * radix sort, which has the same size, cannot be allocated next to it. */
+  jerry_length_t length = (jerry_length_t) ((stats.size - stats.allocated_bytes) / 10 * 6 / sizeof (int32_t));
+
+  /* The elements are a permutation when the length is not a multiple of the prime step. */
+  if (length % 7919 == 0)
+  {
+    length--;
+  }
+
+  jerry_value_t array = jerry_create_typedarray (JERRY_TYPEDARRAY_INT32, length);
+  TEST_ASSERT (!jerry_value_is_error (array));
+  register_js_value ("large", array);
+  jerry_release_value (array);
+
+  const jerry_char_t eval_src[] = TEST_STRING_LITERAL (
+    "var half = large.length >> 1;"
+    "for (var i = 0; i < large.length; i++) {"
+    "  large[i] = (i * 7919) % large.length - half;"
+    "}"
+    "large.sort ();"
+    "for (var i = 0; i < large.length; i++) {"
+    "  assert (large[i] === i - half);"
+    "}"
+  );
+  jerry_value_t result = jerry_eval (eval_src,
+                                     sizeof (eval_src) - 1,
+                                     JERRY_PARSE_NO_OPTS);
+
+  TEST_ASSERT (!jerry_value_is_error (result));
+  jerry_release_value (result);
+
+  /* Release the array. */
+  jerry_value_t global = jerry_get_global_object ();
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "large");
+  TEST_ASSERT (jerry_delete_property (global, name));
+  jerry_release_value (name);
+  jerry_release_value (global);
+} /* test_sort_in_place */
+
 int
 main (void)
 {
@@ -720,6 +774,8 @@ main (void)
 
   test_detached_arraybuffer ();
 
+  test_sort_in_place ();
+
   jerry_cleanup ();
 
   return 0;
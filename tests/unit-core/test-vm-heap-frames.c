@@ -0,0 +1,113 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+#include "jerryscript.h"
+#include "test-common.h"
+
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+
+/**
+ * Lowest native stack address seen by the stack handler.
+ */
+static uintptr_t stack_lowest;
+
+/**
+ * Highest native stack address seen by the stack handler.
+ */
+static uintptr_t stack_highest;
+
+static jerry_value_t
+stack_handler (const jerry_value_t function_obj, /**< function object */
+               const jerry_value_t this_val, /**< this value */
+               const jerry_value_t args_p[], /**< argument list */
+               const jerry_length_t args_count) /**< argument count */
+{
+  JERRY_UNUSED (function_obj);
+  JERRY_UNUSED (this_val);
+  JERRY_UNUSED (args_p);
+  JERRY_UNUSED (args_count);
+
+  volatile int local = 0;
+  uintptr_t address = (uintptr_t) &local;
+
+  if (stack_lowest == 0 || address < stack_lowest)
+  {
+    stack_lowest = address;
+  }
+
+  if (address > stack_highest)
+  {
+    stack_highest = address;
+  }
+
+  return jerry_create_undefined ();
+} /* stack_handler */
+
+static jerry_value_t
+eval (const char *source_p) /**< source code */
+{
+  return jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+} /* eval */
+
+static void
+check_eval (const char *source_p) /**< source code which returns with true */
+{
+  jerry_value_t result = eval (source_p);
+  TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+  jerry_release_value (result);
+} /* check_eval */
+
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+#if ENABLED (JERRY_VM_HEAP_FRAMES)
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t global = jerry_get_global_object ();
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "stack");
+  jerry_value_t function = jerry_create_external_function (stack_handler);
+  jerry_release_value (jerry_set_property (global, name, function));
+  jerry_release_value (function);
+  jerry_release_value (name);
+  jerry_release_value (global);
+
+  /* Calls of byte code functions by the byte code do not consume native stack. */
+  check_eval ("function deep (n) { if (n === 0) { stack (); return 0; } return deep (n - 1) + 1; }"
+              "deep (1) === 1 && deep (2) === 2 && deep (900) === 900");
+
+  TEST_ASSERT (stack_highest - stack_lowest < 256);
+
+  /* A RangeError is thrown before a reference counter of an object held by the calls overflows. */
+  check_eval ("var depth = 0;"
+              "function runaway (n) { depth = n; runaway (n + 1); }"
+              "try { runaway (0); false } catch (e) { e instanceof RangeError && depth > 900 }");
+
+  check_eval ("var o = { m: function (self, n) { depth = n; return self.m (self, n + 1); } };"
+              "try { o.m (o, 0); false } catch (e) { e instanceof RangeError && depth > 300 }");
+
+  /* Exceptions unwind the frames of the calls. */
+  check_eval ("function thrower (n) { if (n === 0) throw n; try { thrower (n - 1) } finally { depth = n } }"
+              "try { thrower (500); false } catch (e) { e === 0 && depth === 500 }");
+
+  jerry_cleanup ();
+#endif /* ENABLED (JERRY_VM_HEAP_FRAMES) */
+
+  return 0;
+} /* main */
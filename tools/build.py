@@ -128,12 +128,18 @@ def get_arguments():
                          help='memory usage limit to trigger garbage collection (in bytes)')
     coregrp.add_argument('--stack-limit', metavar='SIZE', type=int,
                          help='maximum stack usage (in kilobytes)')
+    coregrp.add_argument('--gc-mark-stack-size', metavar='SIZE', type=int,
+                         help='number of objects on the GC mark stack')
     coregrp.add_argument('--gc-mark-limit', metavar='SIZE', type=int,
-                         help='maximum depth of recursion during GC mark phase')
+                         help='deprecated, use --gc-mark-stack-size instead')
+    coregrp.add_argument('--gc-generational', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable generational garbage collection (%(choices)s)')
     coregrp.add_argument('--mem-stats', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable memory statistics (%(choices)s)'))
     coregrp.add_argument('--mem-stress-test', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable mem-stress test (%(choices)s)'))
+    coregrp.add_argument('--mem-segregated-fit', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable segregated-fit heap allocator (%(choices)s)')
     coregrp.add_argument('--profile', metavar='FILE',
                          help='specify profile file')
     coregrp.add_argument('--regexp-strict-mode', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -204,9 +210,11 @@ def generate_build_options(arguments):
     build_options_append('JERRY_LOGGING', arguments.logging)
     build_options_append('JERRY_GLOBAL_HEAP_SIZE', arguments.mem_heap)
     build_options_append('JERRY_GC_LIMIT', arguments.gc_limit)
+    build_options_append('JERRY_GC_GENERATIONAL', arguments.gc_generational)
     build_options_append('JERRY_STACK_LIMIT', arguments.stack_limit)
     build_options_append('JERRY_MEM_STATS', arguments.mem_stats)
     build_options_append('JERRY_MEM_GC_BEFORE_EACH_ALLOC', arguments.mem_stress_test)
+    build_options_append('JERRY_MEM_SEGREGATED_FIT', arguments.mem_segregated_fit)
     build_options_append('JERRY_PROFILE', arguments.profile)
     build_options_append('JERRY_REGEXP_STRICT_MODE', arguments.regexp_strict_mode)
     build_options_append('JERRY_PARSER_DUMP_BYTE_CODE', arguments.show_opcodes)
@@ -217,7 +225,10 @@ def generate_build_options(arguments):
     build_options_append('JERRY_VALGRIND', arguments.valgrind)
     build_options_append('JERRY_VM_EXEC_STOP', arguments.vm_exec_stop)
 
-    if arguments.gc_mark_limit is not None:
+    if arguments.gc_mark_stack_size is not None:
+        build_options.append('-D%s=%s' % ('JERRY_GC_MARK_STACK_SIZE', arguments.gc_mark_stack_size))
+    elif arguments.gc_mark_limit is not None:
+        print('Warning: --gc-mark-limit is deprecated, please use --gc-mark-stack-size instead.')
         build_options.append('-D%s=%s' % ('JERRY_GC_MARK_LIMIT', arguments.gc_mark_limit))
 
     # jerry-main options
@@ -38,7 +38,7 @@ OPTIONS_PROFILE_MIN = ['--profile=minimal']
 OPTIONS_PROFILE_ES51 = ['--profile=es5.1']
 OPTIONS_PROFILE_ESNEXT = ['--profile=es.next']
 OPTIONS_STACK_LIMIT = ['--stack-limit=96']
-OPTIONS_GC_MARK_LIMIT = ['--gc-mark-limit=16']
+OPTIONS_GC_MARK_STACK_SIZE = ['--gc-mark-stack-size=16']
 OPTIONS_DEBUG = ['--debug']
 OPTIONS_SNAPSHOT = ['--snapshot-save=on', '--snapshot-exec=on', '--jerry-cmdline-snapshot=on']
 OPTIONS_UNITTESTS = ['--unittests=on', '--jerry-cmdline=off', '--error-messages=on',
@@ -53,6 +53,18 @@ JERRY_UNITTESTS_OPTIONS = [
             OPTIONS_COMMON + OPTIONS_UNITTESTS + OPTIONS_PROFILE_ESNEXT),
     Options('unittests-es.next-debug',
             OPTIONS_COMMON + OPTIONS_UNITTESTS + OPTIONS_PROFILE_ESNEXT + OPTIONS_DEBUG),
+    Options('unittests-es.next-debug-gc_generational',
+            OPTIONS_COMMON + OPTIONS_UNITTESTS + OPTIONS_PROFILE_ESNEXT + OPTIONS_DEBUG
+            + ['--gc-generational=on']),
+    Options('unittests-es.next-debug-object_shapes',
+            OPTIONS_COMMON + OPTIONS_UNITTESTS + OPTIONS_PROFILE_ESNEXT + OPTIONS_DEBUG
+            + ['--compile-flag=-DJERRY_OBJECT_SHAPES=1']),
+    Options('unittests-es.next-debug-mem_segregated_fit',
+            OPTIONS_COMMON + OPTIONS_UNITTESTS + OPTIONS_PROFILE_ESNEXT + OPTIONS_DEBUG
+            + ['--mem-segregated-fit=on']),
+    Options('unittests-es.next-debug-vm_heap_frames',
+            OPTIONS_COMMON + OPTIONS_UNITTESTS + OPTIONS_PROFILE_ESNEXT + OPTIONS_DEBUG
+            + ['--compile-flag=-DJERRY_VM_HEAP_FRAMES=1']),
     Options('doctests-es.next',
             OPTIONS_COMMON + OPTIONS_DOCTESTS + OPTIONS_PROFILE_ESNEXT),
     Options('doctests-es.next-debug',
@@ -76,23 +88,38 @@ JERRY_UNITTESTS_OPTIONS = [
 # Test options for jerry-tests
 JERRY_TESTS_OPTIONS = [
     Options('jerry_tests-es.next-debug',
-            OPTIONS_COMMON + OPTIONS_PROFILE_ESNEXT + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_LIMIT),
+            OPTIONS_COMMON + OPTIONS_PROFILE_ESNEXT + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_STACK_SIZE),
     Options('jerry_tests-es5.1',
-            OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_LIMIT),
+            OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_STACK_SIZE),
     Options('jerry_tests-es5.1-snapshot',
-            OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_SNAPSHOT + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_LIMIT,
+            OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_SNAPSHOT + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_STACK_SIZE,
             ['--snapshot']),
     Options('jerry_tests-es5.1-debug',
-            OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_LIMIT),
+            OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_STACK_SIZE),
     Options('jerry_tests-es5.1-debug-snapshot',
             OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_SNAPSHOT + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT
-            + OPTIONS_GC_MARK_LIMIT, ['--snapshot']),
+            + OPTIONS_GC_MARK_STACK_SIZE, ['--snapshot']),
     Options('jerry_tests-es5.1-debug-cpointer_32bit',
-            OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_LIMIT
+            OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_STACK_SIZE
             + ['--cpointer-32bit=on', '--mem-heap=1024']),
     Options('jerry_tests-es5.1-debug-external_context',
-            OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_LIMIT
+            OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_STACK_SIZE
             + ['--external-context=on']),
+    Options('jerry_tests-es.next-debug-gc_generational',
+            OPTIONS_COMMON + OPTIONS_PROFILE_ESNEXT + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_STACK_SIZE
+            + ['--gc-generational=on', '--gc-limit=4096']),
+    Options('jerry_tests-es.next-debug-object_shapes',
+            OPTIONS_COMMON + OPTIONS_PROFILE_ESNEXT + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_STACK_SIZE
+            + ['--compile-flag=-DJERRY_OBJECT_SHAPES=1']),
+    Options('jerry_tests-es.next-debug-mem_segregated_fit',
+            OPTIONS_COMMON + OPTIONS_PROFILE_ESNEXT + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_STACK_SIZE
+            + ['--mem-segregated-fit=on']),
+    Options('jerry_tests-es.next-debug-vm_heap_frames',
+            OPTIONS_COMMON + OPTIONS_PROFILE_ESNEXT + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_STACK_SIZE
+            + ['--compile-flag=-DJERRY_VM_HEAP_FRAMES=1']),
+    Options('jerry_tests-es.next-debug-switch_dispatch',
+            OPTIONS_COMMON + OPTIONS_PROFILE_ESNEXT + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + OPTIONS_GC_MARK_STACK_SIZE
+            + ['--compile-flag=-DJERRY_VM_COMPUTED_GOTO=0']),
 ]
 
 # Test options for test262
@@ -159,7 +186,7 @@ JERRY_BUILDOPTIONS = [
     Options('buildoption_test-recursion_limit',
             OPTIONS_STACK_LIMIT),
     Options('buildoption_test-gc-mark_limit',
-            OPTIONS_GC_MARK_LIMIT),
+            OPTIONS_GC_MARK_STACK_SIZE),
     Options('buildoption_test-single-source',
             ['--cmake-param=-DENABLE_ALL_IN_ONE_SOURCE=ON']),
     Options('buildoption_test-jerry-debugger',